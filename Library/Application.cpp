@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <fstream>
 #include <ShlObj.h>
 #include <Shlwapi.h>
@@ -36,82 +37,177 @@ Application::Application(Settings settings, Config config): settings_(settings)
 		MessageBox(NULL, L"Applicatoin instance is already created.", L"Error", MB_OK);
 		exit(1);
 	}
-	windows_util_.reset(new WindowsUtil());
-	windows_util_->EnableDPIAwareness();
 
-	main_monitor_.reset(new Monitor(windows_util_.get()));
+	// Objects are created by the phases and handed to Platform on the main thread once all of
+	// them are done, phases that don't depend on each other may run concurrently.
+	bool create_logger = !Platform::instance().logger();
+	bool create_font_loader = !Platform::instance().font_loader();
+	bool create_file_system = !Platform::instance().file_system();
 
-	// Generate cache path. Required for persisted sessions
-	String cache_path = GetRoamingAppDataPath();
-	cache_path = FileSystemHelpers::AppendPath(cache_path, settings_.developer_name);
-	cache_path = FileSystemHelpers::AppendPath(cache_path, settings_.app_name);
+	String file_system_path;
+	std::unique_ptr<FontLoaderImpl> font_loader;
+	std::unique_ptr<FileSystemImpl> file_system;
 
-	int res = SHCreateDirectory(NULL, cache_path.utf16().data());
+	// Windows and the monitor's DPI depend on the thread's DPI awareness.
+	auto dpi = startup_.Add("dpi", [&]() {
+		windows_util_.reset(new WindowsUtil());
+		windows_util_->EnableDPIAwareness();
 
-	if (!(res == ERROR_SUCCESS || res == ERROR_FILE_EXISTS || res == ERROR_ALREADY_EXISTS)) {
-		MessageBox(NULL, L"Couldn't create cache path.", L"Error", MB_OK);
-		exit(1);
-	}
+		main_monitor_.reset(new Monitor(windows_util_.get()));
+	}, {}, true);
 
-	std::ostringstream info;
+	// Generate cache path. Required for persisted sessions
+	auto cache_dir = startup_.Add("cache_dir", [&]() {
+		cache_path_ = GetRoamingAppDataPath();
+		cache_path_ = FileSystemHelpers::AppendPath(cache_path_, settings_.developer_name);
+		cache_path_ = FileSystemHelpers::AppendPath(cache_path_, settings_.app_name);
+
+		int res = SHCreateDirectory(NULL, cache_path_.utf16().data());
+
+		if (!(res == ERROR_SUCCESS || res == ERROR_FILE_EXISTS || res == ERROR_ALREADY_EXISTS)) {
+			MessageBox(NULL, L"Couldn't create cache path.", L"Error", MB_OK);
+			exit(1);
+		}
+	});
 
-	if (!Platform::instance().logger()) {
-		String log_path = FileSystemHelpers::AppendPath(cache_path, "ultralight.log");
+	auto logger = startup_.Add("logger", [&]() {
+		if (!create_logger)
+			return;
 
+		String log_path = FileSystemHelpers::AppendPath(cache_path_, "ultralight.log");
 		logger_.reset(new FileLogger(log_path));
-		Platform::instance().set_logger(logger_.get());
 
+		std::ostringstream info;
 		info << "Writing log to: " << log_path.utf8().data() << std::endl;
 		OutputDebugStringA(info.str().c_str());
-	}
+	}, { cache_dir });
 
-	String module_path = GetModulePath();
-	config.cache_path = cache_path.utf16();
-	config.face_winding = FaceWinding::Clockwise;
-	Platform::instance().set_config(config);
-
-	if (!Platform::instance().font_loader()) {
-		Platform::instance().set_font_loader(new FontLoaderImpl());
-	}
+	auto file_system_phase = startup_.Add("file_system", [&]() {
+		if (!create_file_system)
+			return;
 
-	if (!Platform::instance().file_system()) {
 		// Replace forward slashes with backslashes for proper path
-	// resolution on Windows
+		// resolution on Windows
 		std::wstring fs_str = settings_.file_system_base.utf16().data();
 		std::replace(fs_str.begin(), fs_str.end(), L'/', L'\\');
 
-		String file_system_path = FileSystemHelpers::AppendPath(module_path, String16(fs_str.data(), fs_str.length()));
+		file_system_path = FileSystemHelpers::AppendPath(GetModulePath(),
+			String16(fs_str.data(), fs_str.length()));
+		file_system.reset(new FileSystemImpl(file_system_path.utf16().data()));
+	});
 
-		Platform::instance().set_file_system(new FileSystemImpl(file_system_path.utf16().data()));
+	// Loading the fallback font brings up DirectWrite and the system font collection.
+	auto fonts = startup_.Add("fonts", [&]() {
+		if (!create_font_loader)
+			return;
 
-		info.clear();
-		info << "File system base directory resolved to: " << file_system_path.utf8().data();
-		UL_LOG_INFO(info.str().c_str());
-	}
+		font_loader.reset(new FontLoaderImpl());
+		font_loader->Load(font_loader->fallback_font(), 400, false);
+	});
 
-	clipboard_.reset(new ClipboardImpl());
-	Platform::instance().set_clipboard(clipboard_.get());
+	auto gpu = startup_.Add("gpu", [&]() {
+		if (settings_.force_cpu_render)
+			return;
 
-	if (settings_.force_cpu_render) {
-		surface_factory_.reset(new DIBSurfaceFactory(GetDC(NULL)));
-		Platform::instance().set_surface_factory(surface_factory_.get());
-	}
-	else {
 		gpu_context_.reset(new GPUContextD3D11());
-		if (gpu_context_->device()) {
-			gpu_driver_.reset(new GPUDriverD3D11(gpu_context_.get()));
+		if (!gpu_context_->device()) {
+			gpu_context_.reset();
+			return;
+		}
+
+		gpu_driver_.reset(new GPUDriverD3D11(gpu_context_.get()));
+
+		MSAAPolicyConfig msaa_config;
+		msaa_config.max_samples = settings_.msaa_max_samples;
+		msaa_config.memory_budget = settings_.msaa_memory_budget;
+		gpu_driver_->set_msaa_policy(msaa_config);
+
+		ResidencyConfig residency_config;
+		residency_config.budget_bytes = settings_.gpu_memory_budget;
+		gpu_driver_->set_residency_config(residency_config);
+
+		gpu_driver_->WarmUpShaders();
+	});
+
+	auto platform = startup_.Add("platform", [&]() {
+		if (logger_)
+			Platform::instance().set_logger(logger_.get());
+
+		config.cache_path = cache_path_.utf16();
+		config.face_winding = FaceWinding::Clockwise;
+		Platform::instance().set_config(config);
+
+		if (font_loader)
+			Platform::instance().set_font_loader(font_loader.release());
+
+		if (file_system) {
+			if (settings_.startup_prefetch)
+				file_system->EnableStartupTrace(cache_path_);
+
+			file_system_ = file_system.get();
+			Platform::instance().set_file_system(file_system.release());
+
+			std::ostringstream info;
+			info << "File system base directory resolved to: " << file_system_path.utf8().data();
+			UL_LOG_INFO(info.str().c_str());
+		}
+
+		clipboard_.reset(new ClipboardImpl());
+		Platform::instance().set_clipboard(clipboard_.get());
+
+		if (settings_.force_cpu_render) {
+			surface_factory_.reset(new DIBSurfaceFactory(GetDC(NULL)));
+			Platform::instance().set_surface_factory(surface_factory_.get());
+		}
+		else if (gpu_driver_) {
+			if (!settings_.gpu_capture_path.empty())
+				gpu_driver_->StartCapture(settings_.gpu_capture_path.utf8().data());
+
 			Platform::instance().set_gpu_driver(gpu_driver_.get());
 		}
-		else {
-			gpu_context_.reset();
+	}, { dpi, logger, file_system_phase, fonts, gpu }, true);
+
+	startup_.Add("renderer", [&]() {
+		renderer_ = Renderer::Create();
+
+		if (settings_.view_pool_size) {
+			ViewConfig pool_config;
+			pool_config.initial_device_scale = main_monitor_->scale();
+			pool_config.is_accelerated = gpu_driver_ != nullptr;
+			pool_config.is_transparent = settings_.view_pool_transparent;
+
+			auto factory = [this](uint32_t width, uint32_t height, const ViewConfig& config) {
+				return renderer_->CreateView(width, height, config, nullptr);
+			};
+			view_pool_.reset(new ViewPool(factory, pool_config, settings_.view_pool_size,
+				settings_.view_pool_width, settings_.view_pool_height, settings_.view_pool_template_url));
 		}
-	}
+	}, { platform }, true);
 
-	renderer_ = Renderer::Create();
+	startup_.Run(settings_.parallel_startup);
+
+	std::istringstream report(startup_.Report());
+	std::string line;
+	while (std::getline(report, line)) {
+		std::string message = "Startup " + line;
+		UL_LOG_INFO(message.c_str());
+	}
 
 	instance_ = this;
 }
 
+void Application::OnFirstFrame()
+{
+	if (first_frame_shown_)
+		return;
+
+	first_frame_shown_ = true;
+
+	std::ostringstream info;
+	info << "Time to first frame: " << startup_.Elapsed() << " ms";
+	UL_LOG_INFO(info.str().c_str());
+}
+
 void Application::Run()
 {
 	if (is_running_)
@@ -121,22 +217,28 @@ void Application::Run()
 	std::chrono::steady_clock::time_point next_paint = std::chrono::steady_clock::now();
 
 	is_running_ = true;
+	next_stats_log_ = std::chrono::steady_clock::now()
+		+ std::chrono::seconds(settings_.stats_log_interval_s);
 	while (is_running_) {
-		auto timeout_ns = next_paint - std::chrono::steady_clock::now();
-		long long timeout_ms = std::chrono::duration_cast<std::chrono::milliseconds>(timeout_ns).count();
-		DWORD timeout = timeout_ms <= 0 ? 0 : (DWORD)timeout_ms;
+		// Round up, a truncated sub-millisecond wait would poll without sleeping until the
+		// deadline passed.
+		double timeout_ms = std::ceil(std::chrono::duration<double, std::milli>(
+			next_paint - std::chrono::steady_clock::now()).count());
+		DWORD timeout = timeout_ms <= 0.0 ? 0 : (DWORD)timeout_ms;
 		DWORD result = (timeout
 			? MsgWaitForMultipleObjects(0, 0, TRUE, timeout, QS_ALLEVENTS)
 			: WAIT_TIMEOUT);
 		if (result == WAIT_TIMEOUT) {
 			Update();
 			for (auto window : windows_) {
-				if (window->NeedsRepaint()) {
-					window->InvalidateWindow();
+				if (window->NeedsRepaint())
 					window->Paint();
-				}
 			}
-			next_paint = std::chrono::steady_clock::now() + interval_ms;
+			// Wake up for the next vblank if it comes before the next poll.
+			auto vblank = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+				std::chrono::duration<double>(main_monitor_->TimeUntilVBlank()));
+			next_paint = std::chrono::steady_clock::now()
+				+ std::min<std::chrono::steady_clock::duration>(interval_ms, vblank);
 		}
 
 		MSG msg;
@@ -158,6 +260,13 @@ void Application::Quit()
 
 Application::~Application()
 {
+	// Pooled views release their GPU resources through the driver.
+	view_pool_.reset();
+
+	// Runs shorter than the trace window still leave a trace for the next start.
+	if (file_system_)
+		file_system_->FinishStartupTrace();
+
 	Platform::instance().set_gpu_driver(nullptr);
 	Platform::instance().set_clipboard(nullptr);
 	Platform::instance().set_file_system(nullptr);
@@ -180,10 +289,43 @@ Application* Application::instance()
 
 void Application::Update()
 {
+	if (gpu_driver_)
+		gpu_driver_->EnforceResidencyBudget();
+
 	renderer()->Update();
 
-	// ul 1.4 needs this to be called when you expect animations.
-	// TODO: revisit when docs are updated.
-	renderer()->RefreshDisplay(0);
+	for (auto window : windows_)
+		window->UpdateClickThrough();
+
+	// One view per frame, so refilling never stalls a frame for long.
+	if (view_pool_)
+		view_pool_->Refill();
+
+	// Animations and requestAnimationFrame advance once per vblank of the monitor, not on every
+	// poll.
+	if (main_monitor_->UpdateDisplayLink())
+		renderer()->RefreshDisplay(main_monitor_->display_id());
+
+	if (settings_.stats_log_interval_s && std::chrono::steady_clock::now() >= next_stats_log_) {
+		LogStats();
+		next_stats_log_ = std::chrono::steady_clock::now()
+			+ std::chrono::seconds(settings_.stats_log_interval_s);
+	}
+}
+
+void Application::LogStats()
+{
+	if (gpu_driver_)
+		gpu_driver_->LogStats();
+
+	main_monitor_->LogStats();
+
+	for (auto window : windows_)
+		window->LogStats();
+
+	if (view_pool_) {
+		std::string report = view_pool_->Report();
+		UL_LOG_INFO(report.c_str());
+	}
 }
 
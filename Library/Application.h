@@ -1,4 +1,5 @@
 #pragma once
+#include <chrono>
 #include <vector>
 
 #include <Ultralight/platform/Platform.h>
@@ -14,17 +15,68 @@
 #include "Monitor.h"
 #include "FileLogger.h"
 #include "DIBSurface.h"
+#include "PhaseGraph.h"
+#include "ViewPool.h"
 
 using namespace ultralight;
 
+class FileSystemImpl;
+
 struct Settings {
 	String developer_name = "deathcrafter";
 	String app_name = "TransparentUltralight";
 
 	String file_system_base = "./assets/";
 	bool load_shaders_from_file_system = false;
+	// Compile fill shaders specialized per fill type in the background and use them when a
+	// draw only has one fill type.
+	bool fill_shader_permutations = true;
 
 	bool force_cpu_render = false;
+
+	// Route input to the overlay under the cursor by its alpha, tested against a downsampled
+	// mask of each overlay (4x4 pixel cells). Pixels with zero alpha are always click-through
+	// (layered window), a threshold above 0 also lets clicks through wherever the alpha is at
+	// or below it.
+	bool alpha_hit_testing = true;
+	uint8_t hit_test_alpha_threshold = 0;
+
+	// Upper bound for per-view antialiasing; large views get fewer samples.
+	uint32_t msaa_max_samples = 8;
+	// GPU memory all multisampled render targets together may use.
+	uint64_t msaa_memory_budget = 256ull * 1024 * 1024;
+	// Estimated GPU memory before render targets of hidden overlays are evicted early.
+	uint64_t gpu_memory_budget = 512ull * 1024 * 1024;
+
+	// CPU time each window's RenderOnly may take per frame in milliseconds (0 = unlimited).
+	// Dirty views that don't fit are rendered on later frames, focused and hovered ones first.
+	double window_render_budget_ms = 0.0;
+
+	// Save each window's last presented frame to the cache path when it closes and show it as
+	// soon as the window is created on the next start, until the first real frame replaces it.
+	bool window_snapshots = true;
+
+	// Record which files each start page opens in its first seconds and read them on background
+	// threads at the next start, before the page asks for them.
+	bool startup_prefetch = true;
+
+	// Run independent startup phases (log file, file system, fonts, D3D device and shaders)
+	// on their own threads. Either way each phase's timing is logged.
+	bool parallel_startup = true;
+
+	// Views created ahead of time for Overlay::Create (0 = off). They are sized and loaded with
+	// the template page (empty = about:blank) and must match the overlay's ViewConfig to be used.
+	uint32_t view_pool_size = 0;
+	uint32_t view_pool_width = 400;
+	uint32_t view_pool_height = 300;
+	bool view_pool_transparent = true;
+	String view_pool_template_url;
+
+	// Record all GPU commands and resources to this file for offline replay (empty = off).
+	String gpu_capture_path;
+
+	// Log the counters of the GPU driver, monitor, windows and view pool this often (0 = never).
+	uint32_t stats_log_interval_s = 30;
 };
 
 class Application final: RefCountedImpl<Application> {
@@ -35,6 +87,9 @@ public:
 
 	const Settings& settings() const { return settings_; }
 
+	// Per-user directory for the log, persisted sessions and window snapshots.
+	const String& cache_path() const { return cache_path_; }
+
 	bool is_running() const { return is_running_; }
 
 	Monitor* main_monitor() { return main_monitor_.get(); }
@@ -45,9 +100,15 @@ public:
 
 	void Quit();
 
+	// Ask every component that keeps counters to log them, called on a timer from Run.
+	void LogStats();
+
 	GPUContextD3D11* gpu_context() { return gpu_context_.get(); }
 	GPUDriverD3D11* gpu_driver() { return gpu_driver_.get(); }
 
+	// Null when Settings::view_pool_size is 0.
+	ViewPool* view_pool() { return view_pool_.get(); }
+
 	REF_COUNTED_IMPL(Application);
 protected:
 	DISALLOW_COPY_AND_ASSIGN(Application);
@@ -57,6 +118,13 @@ protected:
 
 	void Update();
 
+	// Log the time from construction to the first presented frame, once.
+	void OnFirstFrame();
+
+	// Created first, startup times are relative to it.
+	PhaseGraph startup_;
+	bool first_frame_shown_ = false;
+
 	std::vector<Window*> windows_;
 	void AddWindow(Window* window) { windows_.push_back(window); }
 	void RemoveWindow(Window* window) {
@@ -64,9 +132,12 @@ protected:
 	}
 
 	Settings settings_;
+	String cache_path_;
 	bool is_running_ = false;
+	std::chrono::steady_clock::time_point next_stats_log_;
 
 	RefPtr<Renderer> renderer_;
+	std::unique_ptr<ViewPool> view_pool_;
 	
 	std::unique_ptr<WindowsUtil> windows_util_;
 	std::unique_ptr<Monitor> main_monitor_;
@@ -79,5 +150,8 @@ protected:
 
 	std::unique_ptr<FileLogger> logger_;
 
+	// Owned by Platform, null if the app set its own file system.
+	FileSystemImpl* file_system_ = nullptr;
+
 	friend class Window;
 };
\ No newline at end of file
@@ -0,0 +1,208 @@
+#include "DirectoryIndex.h"
+
+#include <chrono>
+
+DirectoryIndex::DirectoryIndex(Lister lister, bool case_sensitive) :
+	lister_(lister), case_sensitive_(case_sensitive) {}
+
+DirectoryIndex::~DirectoryIndex()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		stopping_ = true;
+	}
+	requested_.notify_all();
+
+	if (thread_.joinable())
+		thread_.join();
+}
+
+void DirectoryIndex::Build()
+{
+	Map map;
+	double ms = BuildMap(map);
+
+	std::lock_guard<std::mutex> lock(mutex_);
+	map_.swap(map);
+	ready_ = true;
+	stats_.builds++;
+	stats_.entries = (uint32_t)map_.size();
+	stats_.build_ms = ms;
+}
+
+void DirectoryIndex::Invalidate()
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	ready_ = false;
+	rebuild_ = true;
+
+	if (!thread_.joinable())
+		thread_ = std::thread(&DirectoryIndex::Work, this);
+	requested_.notify_one();
+}
+
+void DirectoryIndex::Work()
+{
+	std::unique_lock<std::mutex> lock(mutex_);
+	for (;;) {
+		requested_.wait(lock, [this]() { return rebuild_ || stopping_; });
+		if (stopping_)
+			return;
+
+		rebuild_ = false;
+		lock.unlock();
+
+		Map map;
+		double ms = BuildMap(map);
+
+		lock.lock();
+		// Changed again while building, the next pass picks it up.
+		if (rebuild_ || stopping_)
+			continue;
+
+		map_.swap(map);
+		ready_ = true;
+		stats_.builds++;
+		stats_.entries = (uint32_t)map_.size();
+		stats_.build_ms = ms;
+	}
+}
+
+double DirectoryIndex::BuildMap(Map& map) const
+{
+	auto start = std::chrono::steady_clock::now();
+
+	std::vector<std::string> pending(1, std::string());
+	std::vector<DirectoryEntry> entries;
+
+	while (!pending.empty()) {
+		std::string dir = pending.back();
+		pending.pop_back();
+
+		entries.clear();
+		if (!lister_(dir, entries))
+			continue;
+
+		for (auto& entry : entries) {
+			if (entry.name == "." || entry.name == "..")
+				continue;
+
+			std::string path = dir.empty() ? entry.name : dir + "/" + entry.name;
+
+			FileInfo info;
+			info.is_directory = entry.is_directory;
+			info.is_link = entry.is_link;
+			info.size = entry.size;
+			info.mtime = entry.mtime;
+			map[Normalize(path, case_sensitive_)] = info;
+
+			if (entry.is_directory && !entry.is_link)
+				pending.push_back(path);
+		}
+	}
+
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+		.count();
+}
+
+DirectoryIndex::Lookup DirectoryIndex::Find(const std::string& path, FileInfo* info) const
+{
+	std::string key = Normalize(path, case_sensitive_);
+
+	std::lock_guard<std::mutex> lock(mutex_);
+	stats_.lookups++;
+
+	if (!ready_ || key.empty()) {
+		stats_.unknown++;
+		return Lookup::Unknown;
+	}
+
+	auto i = map_.find(key);
+	if (i != map_.end()) {
+		if (info)
+			*info = i->second;
+		return Lookup::Found;
+	}
+
+	// The nearest indexed parent decides, nothing below a linked directory was listed.
+	for (size_t slash = key.rfind('/'); slash != std::string::npos && slash > 0;
+		slash = key.rfind('/', slash - 1)) {
+		auto parent = map_.find(key.substr(0, slash));
+		if (parent == map_.end())
+			continue;
+
+		if (parent->second.is_link) {
+			stats_.unknown++;
+			return Lookup::Unknown;
+		}
+		break;
+	}
+
+	// Only ASCII is case folded, the file system may match other letters in another case.
+	if (!case_sensitive_) {
+		for (char c : key) {
+			if ((unsigned char)c >= 0x80) {
+				stats_.unknown++;
+				return Lookup::Unknown;
+			}
+		}
+	}
+
+	return Lookup::Missing;
+}
+
+bool DirectoryIndex::is_ready() const
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	return ready_;
+}
+
+DirectoryIndexStats DirectoryIndex::stats() const
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	return stats_;
+}
+
+std::string DirectoryIndex::Normalize(const std::string& path, bool case_sensitive)
+{
+	// Drive letters, UNC and rooted paths aren't relative to the index.
+	if (path.find(':') != std::string::npos || (!path.empty() && (path[0] == '/' || path[0] == '\\')))
+		return std::string();
+
+	std::string result;
+	result.reserve(path.size());
+
+	size_t start = 0;
+	while (start <= path.size()) {
+		size_t end = path.find_first_of("/\\", start);
+		if (end == std::string::npos)
+			end = path.size();
+
+		std::string segment = path.substr(start, end - start);
+		start = end + 1;
+
+		if (segment.empty() || segment == ".")
+			continue;
+
+		if (segment == "..") {
+			if (result.empty())
+				return std::string();
+			size_t slash = result.rfind('/');
+			result.erase(slash == std::string::npos ? 0 : slash);
+			continue;
+		}
+
+		if (!result.empty())
+			result += '/';
+		result += segment;
+	}
+
+	if (!case_sensitive) {
+		for (char& c : result) {
+			if (c >= 'A' && c <= 'Z')
+				c = (char)(c - 'A' + 'a');
+		}
+	}
+
+	return result;
+}
@@ -0,0 +1,89 @@
+#pragma once
+#include <stdint.h>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+struct DirectoryEntry {
+	std::string name;
+	bool is_directory = false;
+	bool is_link = false;  // directory junction or symlink, its contents aren't indexed
+	uint64_t size = 0;
+	int64_t mtime = 0;
+};
+
+struct FileInfo {
+	bool is_directory = false;
+	bool is_link = false;
+	uint64_t size = 0;
+	int64_t mtime = 0;
+};
+
+struct DirectoryIndexStats {
+	uint64_t lookups = 0;
+	uint64_t unknown = 0;  // asked while building or for paths the index can't answer
+	uint32_t builds = 0;
+	uint32_t entries = 0;
+	double build_ms = 0;   // of the last build
+};
+
+// Every file and directory below a root, keyed by normalized relative path, so existence and
+// size checks don't touch the disk.
+//
+// Paths are normalized to forward slashes without "." and ".." segments, and lowercased
+// (ASCII) unless case sensitive. The index is (re)built on a background thread; until it is
+// ready, and for paths it can't decide (absolute, escaping the root, non-ASCII when case
+// insensitive, below a linked directory), lookups answer Unknown and the caller asks the file
+// system. Linked directories are recorded but not descended, they may loop or point anywhere.
+// Call Invalidate when a watcher reports changes.
+class DirectoryIndex {
+public:
+	// List one directory given relative to the root ("" is the root), false if it can't be read.
+	typedef std::function<bool(const std::string& dir, std::vector<DirectoryEntry>& entries)> Lister;
+
+	enum class Lookup { Unknown, Missing, Found };
+
+	DirectoryIndex(Lister lister, bool case_sensitive);
+
+	// Joins the builder.
+	~DirectoryIndex();
+
+	// Build on the calling thread.
+	void Build();
+
+	// Drop the index and rebuild it in the background, requests during a build coalesce.
+	void Invalidate();
+
+	Lookup Find(const std::string& path, FileInfo* info = nullptr) const;
+
+	bool is_ready() const;
+
+	DirectoryIndexStats stats() const;
+
+	// Empty if path is absolute or leaves the root.
+	static std::string Normalize(const std::string& path, bool case_sensitive);
+
+protected:
+	typedef std::unordered_map<std::string, FileInfo> Map;
+
+	// Returns the time it took in milliseconds.
+	double BuildMap(Map& map) const;
+
+	void Work();
+
+	Lister lister_;
+	bool case_sensitive_;
+
+	mutable std::mutex mutex_;
+	std::condition_variable requested_;
+	Map map_;
+	bool ready_ = false;
+	bool rebuild_ = false;
+	bool stopping_ = false;
+	std::thread thread_;
+	mutable DirectoryIndexStats stats_;
+};
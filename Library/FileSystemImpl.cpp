@@ -12,6 +12,21 @@
 #include <algorithm>
 #include <memory>
 #include <Strsafe.h>
+#include <wctype.h>
+#include <chrono>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <Ultralight/platform/Logger.h>
+
+#include "gpu/FrameReuse.h"
+#include "helpers/LogHelpers.h"
+
+// Files opened this long after the start page make up its trace.
+static const double kTraceDurationMs = 10000.0;
+
+static const uint32_t kPrefetchThreads = 4;
+static const uint64_t kPrefetchMaxBytes = 64ull * 1024 * 1024;
 
 static bool getFindData(LPCWSTR path, WIN32_FIND_DATAW& findData) {
 	HANDLE handle = FindFirstFileW(path, &findData);
@@ -47,23 +62,129 @@ std::wstring GetMimeType(const std::wstring& szExtension) {
 	return szResult;
 }
 
+static double NowMs() {
+	return std::chrono::duration<double, std::milli>(
+		std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static bool ListDirectory(LPCWSTR baseDir, const std::string& dir,
+	std::vector<DirectoryEntry>& entries) {
+	std::wstring pattern = baseDir;
+	if (!dir.empty()) {
+		std::wstring dir16 = String(dir.c_str()).utf16().data();
+		std::replace(dir16.begin(), dir16.end(), L'/', L'\\');
+		pattern += L"\\" + dir16;
+	}
+	pattern += L"\\*";
+
+	WIN32_FIND_DATAW findData;
+	HANDLE handle = FindFirstFileExW(pattern.c_str(), FindExInfoBasic, &findData,
+		FindExSearchNameMatch, NULL, FIND_FIRST_EX_LARGE_FETCH);
+	if (handle == INVALID_HANDLE_VALUE)
+		return false;
+
+	do {
+		DirectoryEntry entry;
+		entry.name = String16(findData.cFileName, lstrlenW(findData.cFileName)).utf8().data();
+		entry.is_directory = (findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
+		// Junctions and symlinks may loop back, what's below them is left to the file system.
+		entry.is_link = entry.is_directory
+			&& (findData.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT) != 0;
+		entry.size = ((uint64_t)findData.nFileSizeHigh << 32) | findData.nFileSizeLow;
+		entry.mtime = ((int64_t)findData.ftLastWriteTime.dwHighDateTime << 32)
+			| findData.ftLastWriteTime.dwLowDateTime;
+
+		entries.push_back(entry);
+	} while (FindNextFileW(handle, &findData));
+
+	FindClose(handle);
+	return true;
+}
+
+static bool ReadWholeFile(LPCWSTR path, std::vector<uint8_t>& data) {
+	HANDLE hFile = CreateFileW(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+		FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, 0);
+	if (hFile == INVALID_HANDLE_VALUE)
+		return false;
+
+	LARGE_INTEGER liFileSize;
+	bool result = GetFileSizeEx(hFile, &liFileSize) && liFileSize.QuadPart > 0
+		&& liFileSize.QuadPart < (1ll << 31);
+
+	if (result) {
+		data.resize((size_t)liFileSize.QuadPart);
+		DWORD read = 0;
+		result = ReadFile(hFile, data.data(), (DWORD)data.size(), &read, NULL) && read == data.size();
+	}
+
+	CloseHandle(hFile);
+	return result;
+}
+
 FileSystemImpl::FileSystemImpl(LPCWSTR baseDir) {
 	baseDir_.reset(new WCHAR[_MAX_PATH]);
 	StringCchCopyW(baseDir_.get(), MAX_PATH, baseDir);
+
+	change_handle_ = FindFirstChangeNotificationW(baseDir_.get(), TRUE, FILE_NOTIFY_CHANGE_FILE_NAME
+		| FILE_NOTIFY_CHANGE_DIR_NAME | FILE_NOTIFY_CHANGE_SIZE | FILE_NOTIFY_CHANGE_LAST_WRITE);
+	if (change_handle_ == INVALID_HANDLE_VALUE)
+		return;
+
+	LPCWSTR base = baseDir_.get();
+	index_.reset(new DirectoryIndex([base](const std::string& dir, std::vector<DirectoryEntry>& entries) {
+		return ListDirectory(base, dir, entries);
+	}, false));
+	index_->Invalidate();
+
+	stop_event_ = CreateEventW(NULL, TRUE, FALSE, NULL);
+	watcher_ = std::thread(&FileSystemImpl::WatchDirectory, this);
 }
 
-FileSystemImpl::~FileSystemImpl() {}
+FileSystemImpl::~FileSystemImpl() {
+	if (watcher_.joinable()) {
+		SetEvent(stop_event_);
+		watcher_.join();
+	}
+
+	if (stop_event_)
+		CloseHandle(stop_event_);
+	if (change_handle_ != INVALID_HANDLE_VALUE)
+		FindCloseChangeNotification(change_handle_);
+}
+
+void FileSystemImpl::WatchDirectory() {
+	HANDLE handles[2] = { stop_event_, change_handle_ };
+	while (WaitForMultipleObjects(2, handles, FALSE, INFINITE) == WAIT_OBJECT_0 + 1) {
+		index_->Invalidate();
+		if (!FindNextChangeNotification(change_handle_))
+			break;
+	}
+}
 
 bool FileSystemImpl::FileExists(const String& path) {
+	TraceAccess(IOTraceEntry::Exists, path);
+
+	if (index_) {
+		DirectoryIndex::Lookup lookup = index_->Find(path.utf8().data());
+		if (lookup != DirectoryIndex::Lookup::Unknown)
+			return lookup == DirectoryIndex::Lookup::Found;
+	}
+
 	WIN32_FIND_DATAW findData;
 	return getFindData(GetRelative(path).get(), findData);
 }
 
 String FileSystemImpl::GetFileMimeType(const String& file_path) {
 	String16 path16 = file_path.utf16();
-	LPWSTR ext = PathFindExtensionW(path16.data());
-	std::wstring mimetype = GetMimeType(ext);
-	return String16(mimetype.c_str(), mimetype.length());
+	std::wstring ext = PathFindExtensionW(path16.data());
+	std::transform(ext.begin(), ext.end(), ext.begin(), towlower);
+
+	std::lock_guard<std::mutex> lock(mime_mutex_);
+	auto i = mime_types_.find(ext);
+	if (i == mime_types_.end())
+		i = mime_types_.emplace(ext, GetMimeType(ext)).first;
+
+	return String16(i->second.c_str(), i->second.length());
 }
 
 String FileSystemImpl::GetFileCharset(const String& file_path) { return "utf-8"; }
@@ -82,7 +203,38 @@ void FileSystemWin_DestroyBufferCallback(void* user_data, void* data) {
 	delete buffer_data;
 }
 
+void FileSystemWin_DestroyPrefetchedCallback(void* user_data, void* data) {
+	delete reinterpret_cast<std::vector<uint8_t>*>(user_data);
+}
+
 RefPtr<Buffer> FileSystemImpl::OpenFile(const String& file_path) {
+	TraceAccess(IOTraceEntry::Open, file_path);
+
+	// Missing, empty and directories can't be mapped.
+	FileInfo info;
+	if (index_) {
+		DirectoryIndex::Lookup lookup = index_->Find(file_path.utf8().data(), &info);
+		if (lookup == DirectoryIndex::Lookup::Missing
+			|| (lookup == DirectoryIndex::Lookup::Found && (info.is_directory || !info.size)))
+			return nullptr;
+	}
+
+	// Set once by the first OpenFile and kept for the lifetime of the file system.
+	IOPrefetcher* prefetcher;
+	{
+		std::lock_guard<std::mutex> lock(trace_mutex_);
+		prefetcher = prefetcher_.get();
+	}
+
+	if (prefetcher) {
+		std::unique_ptr<std::vector<uint8_t>> data(new std::vector<uint8_t>());
+		if (prefetcher->Take(file_path.utf8().data(), *data)) {
+			std::vector<uint8_t>* contents = data.release();
+			return Buffer::Create((char*)contents->data(), contents->size(), contents,
+				FileSystemWin_DestroyPrefetchedCallback);
+		}
+	}
+
 	auto pathStr = GetRelative(file_path);
 	HANDLE hFile;
 	HANDLE hMap;
@@ -151,3 +303,85 @@ std::unique_ptr<WCHAR[]> FileSystemImpl::GetRelative(const String& path) {
 	PathCombineW(relPath.get(), baseDir_.get(), path16.data());
 	return relPath;
 }
+
+void FileSystemImpl::EnableStartupTrace(const String& trace_dir) {
+	std::lock_guard<std::mutex> lock(trace_mutex_);
+	trace_dir_ = trace_dir.utf16().data();
+	recorder_.reset(new IOTraceRecorder(kTraceDurationMs));
+}
+
+void FileSystemImpl::FinishStartupTrace() {
+	std::lock_guard<std::mutex> lock(trace_mutex_);
+	if (recorder_ && !trace_key_.empty())
+		WriteTrace();
+	recorder_.reset();
+}
+
+void FileSystemImpl::TraceAccess(IOTraceEntry::Op op, const String& path) {
+	std::lock_guard<std::mutex> lock(trace_mutex_);
+	if (!recorder_)
+		return;
+
+	std::string path8 = path.utf8().data();
+	if (trace_key_.empty()) {
+		// Only a page can start a trace, WebCore checks for other files first.
+		if (op != IOTraceEntry::Open)
+			return;
+		trace_key_ = path8;
+		StartPrefetch();
+	}
+
+	if (recorder_->Record(op, path8, NowMs()))
+		return;
+
+	WriteTrace();
+
+	if (prefetcher_) {
+		PrefetchStats stats = prefetcher_->stats();
+		uint32_t opens = stats.hits + stats.misses;
+		std::ostringstream info;
+		info << "Startup prefetch: " << stats.hits << " of " << opens << " opens served ("
+			<< (opens ? stats.hits * 100 / opens : 0) << "%, " << stats.waits << " waited), "
+			<< stats.wasted << " of " << stats.files << " files (" << stats.wasted_bytes / 1024
+			<< " KB) read but never opened";
+		UL_LOG_INFO(info.str().c_str());
+	}
+
+	recorder_.reset();
+}
+
+static std::wstring TracePath(const std::wstring& trace_dir, const std::string& key) {
+	std::wostringstream name;
+	name << trace_dir << L"\\io-trace-" << std::hex << HashBytes(key.data(), key.size()) << L".txt";
+	return name.str();
+}
+
+void FileSystemImpl::StartPrefetch() {
+	std::ifstream file(TracePath(trace_dir_, trace_key_).c_str(), std::ios::binary);
+	if (!file)
+		return;
+
+	std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	std::vector<IOTraceEntry> entries;
+	if (!IOTraceRecorder::Parse(text, entries))
+		return;
+
+	std::vector<std::string> paths;
+	for (auto& entry : entries) {
+		if (entry.op == IOTraceEntry::Open && entry.path != trace_key_)
+			paths.push_back(entry.path);
+	}
+
+	if (paths.empty())
+		return;
+
+	prefetcher_.reset(new IOPrefetcher([this](const std::string& path, std::vector<uint8_t>& data) {
+		return ReadWholeFile(GetRelative(path.c_str()).get(), data);
+	}, kPrefetchMaxBytes));
+	prefetcher_->Start(paths, kPrefetchThreads);
+}
+
+void FileSystemImpl::WriteTrace() {
+	std::ofstream file(TracePath(trace_dir_, trace_key_).c_str(), std::ios::binary | std::ios::trunc);
+	file << recorder_->Serialize();
+}
@@ -1,7 +1,14 @@
 #pragma once
 #include <Ultralight/platform/FileSystem.h>
 #include <Windows.h>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "DirectoryIndex.h"
+#include "IOTrace.h"
 
 #pragma comment (lib, "shlwapi.lib")
 
@@ -14,6 +21,9 @@ public:
 	// @note You can pass a valid baseDir here which will be prepended to
 	//       all file paths. This is useful for making all File URLs relative
 	//       to your HTML asset directory.
+	//
+	// The directory is indexed in the background and watched for changes, FileExists and
+	// missing files are answered from the index once it's built.
 	FileSystemImpl(LPCWSTR baseDir);
 
 	virtual ~FileSystemImpl();
@@ -26,8 +36,41 @@ public:
 
 	virtual RefPtr<Buffer> OpenFile(const String& file_path) override;
 
+	// Record the files opened in the first seconds after the start page into trace_dir, keyed
+	// by the start page (the first file opened). When a trace for the start page exists, its
+	// files are read on background threads as soon as the start page is opened.
+	void EnableStartupTrace(const String& trace_dir);
+
+	// Write the trace now if the recording window didn't end yet, eg, on shutdown.
+	void FinishStartupTrace();
+
 protected:
 	std::unique_ptr<WCHAR[]> GetRelative(const String& path);
 
+	void TraceAccess(IOTraceEntry::Op op, const String& path);
+
+	// Rebuilds the index whenever anything below baseDir_ changes.
+	void WatchDirectory();
+
+	// Called with trace_mutex_ held.
+	void StartPrefetch();
+	void WriteTrace();
+
 	std::unique_ptr<WCHAR[]> baseDir_;
+
+	// Null if the directory can't be watched, a stale index would hide new files.
+	std::unique_ptr<DirectoryIndex> index_;
+	HANDLE change_handle_ = INVALID_HANDLE_VALUE;
+	HANDLE stop_event_ = NULL;
+	std::thread watcher_;
+
+	// Registry lookups by lowercase extension.
+	std::mutex mime_mutex_;
+	std::map<std::wstring, std::wstring> mime_types_;
+
+	std::mutex trace_mutex_;
+	std::wstring trace_dir_;
+	std::string trace_key_;
+	std::unique_ptr<IOTraceRecorder> recorder_;
+	std::unique_ptr<IOPrefetcher> prefetcher_;
 };
\ No newline at end of file
@@ -0,0 +1,190 @@
+#include "IOTrace.h"
+
+#include <sstream>
+#include <stdlib.h>
+
+bool IOTraceRecorder::Record(IOTraceEntry::Op op, const std::string& path, double now_ms)
+{
+	if (start_ms_ < 0.0)
+		start_ms_ = now_ms;
+
+	if (is_finished(now_ms))
+		return false;
+
+	// Paths go one per line.
+	if (path.empty() || path.find_first_of("\t\r\n") != std::string::npos)
+		return true;
+
+	uint32_t& seen = seen_[path];
+	if (seen & (1u << op))
+		return true;
+	seen |= 1u << op;
+
+	IOTraceEntry entry;
+	entry.op = op;
+	entry.time_ms = now_ms - start_ms_;
+	entry.path = path;
+	entries_.push_back(entry);
+	return true;
+}
+
+bool IOTraceRecorder::is_finished(double now_ms) const
+{
+	return start_ms_ >= 0.0 && now_ms - start_ms_ > duration_ms_;
+}
+
+std::string IOTraceRecorder::Serialize() const
+{
+	std::ostringstream out;
+	for (auto& entry : entries_) {
+		out << (entry.op == IOTraceEntry::Open ? "open" : "exists") << '\t' << entry.time_ms << '\t'
+			<< entry.path << '\n';
+	}
+	return out.str();
+}
+
+bool IOTraceRecorder::Parse(const std::string& text, std::vector<IOTraceEntry>& entries)
+{
+	entries.clear();
+
+	std::istringstream in(text);
+	std::string line;
+	while (std::getline(in, line)) {
+		if (!line.empty() && line.back() == '\r')
+			line.pop_back();
+		if (line.empty())
+			continue;
+
+		size_t op_end = line.find('\t');
+		size_t time_end = op_end == std::string::npos ? op_end : line.find('\t', op_end + 1);
+		if (time_end == std::string::npos || time_end + 1 >= line.size())
+			return false;
+
+		std::string op = line.substr(0, op_end);
+		IOTraceEntry entry;
+		if (op == "open")
+			entry.op = IOTraceEntry::Open;
+		else if (op == "exists")
+			entry.op = IOTraceEntry::Exists;
+		else
+			return false;
+
+		entry.time_ms = strtod(line.c_str() + op_end + 1, nullptr);
+		entry.path = line.substr(time_end + 1);
+		entries.push_back(entry);
+	}
+
+	return true;
+}
+
+IOPrefetcher::IOPrefetcher(Loader loader, uint64_t max_bytes) :
+	loader_(loader), max_bytes_(max_bytes) {}
+
+IOPrefetcher::~IOPrefetcher()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		stopping_ = true;
+	}
+
+	for (auto& thread : threads_)
+		thread.join();
+}
+
+void IOPrefetcher::Start(const std::vector<std::string>& paths, uint32_t threads)
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		for (auto& path : paths) {
+			if (files_.count(path))
+				continue;
+			files_[path];
+			queue_.push_back(path);
+		}
+		stats_.files = (uint32_t)queue_.size();
+	}
+
+	for (uint32_t i = 0; i < threads; i++)
+		threads_.emplace_back(&IOPrefetcher::Work, this);
+}
+
+void IOPrefetcher::Work()
+{
+	std::unique_lock<std::mutex> lock(mutex_);
+	while (!stopping_ && next_ < queue_.size()) {
+		const std::string& path = queue_[next_++];
+		File& file = files_[path];
+
+		// Taken early, the caller reads it.
+		if (file.state != State::Queued)
+			continue;
+
+		if (stats_.loaded_bytes >= max_bytes_) {
+			file.state = State::Failed;
+			continue;
+		}
+
+		file.state = State::Loading;
+		lock.unlock();
+
+		std::vector<uint8_t> data;
+		bool loaded = loader_(path, data);
+
+		lock.lock();
+		if (loaded) {
+			file.data.swap(data);
+			file.state = State::Ready;
+			stats_.loaded++;
+			stats_.loaded_bytes += file.data.size();
+		}
+		else {
+			file.state = State::Failed;
+		}
+		loaded_.notify_all();
+	}
+}
+
+bool IOPrefetcher::Take(const std::string& path, std::vector<uint8_t>& data)
+{
+	std::unique_lock<std::mutex> lock(mutex_);
+
+	auto i = files_.find(path);
+	if (i == files_.end()) {
+		stats_.misses++;
+		return false;
+	}
+
+	File& file = i->second;
+	if (file.state == State::Loading) {
+		stats_.waits++;
+		loaded_.wait(lock, [&file]() { return file.state != State::Loading; });
+	}
+
+	if (file.state != State::Ready) {
+		// Queued files are not read anymore, taken ones were already handed out.
+		if (file.state == State::Queued)
+			file.state = State::Taken;
+		stats_.misses++;
+		return false;
+	}
+
+	data.swap(file.data);
+	file.data = std::vector<uint8_t>();
+	file.state = State::Taken;
+	stats_.hits++;
+	return true;
+}
+
+PrefetchStats IOPrefetcher::stats() const
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+
+	PrefetchStats stats = stats_;
+	for (auto& file : files_) {
+		if (file.second.state == State::Ready) {
+			stats.wasted++;
+			stats.wasted_bytes += file.second.data.size();
+		}
+	}
+	return stats;
+}
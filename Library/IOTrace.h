@@ -0,0 +1,98 @@
+#pragma once
+#include <stdint.h>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct IOTraceEntry {
+	enum Op { Open, Exists };
+
+	Op op;
+	double time_ms;  // since the first recorded access
+	std::string path;
+};
+
+// Records the files a start accesses, in order of their first access, for the first
+// duration_ms after the first one. Not thread safe.
+class IOTraceRecorder {
+public:
+	explicit IOTraceRecorder(double duration_ms) : duration_ms_(duration_ms) {}
+
+	// Returns false once the recording window is over, the access is not recorded then.
+	bool Record(IOTraceEntry::Op op, const std::string& path, double now_ms);
+
+	bool is_finished(double now_ms) const;
+
+	const std::vector<IOTraceEntry>& entries() const { return entries_; }
+
+	// One "open|exists <tab> ms <tab> path" line per entry.
+	std::string Serialize() const;
+
+	static bool Parse(const std::string& text, std::vector<IOTraceEntry>& entries);
+
+protected:
+	double duration_ms_;
+	double start_ms_ = -1.0;
+	std::vector<IOTraceEntry> entries_;
+	std::map<std::string, uint32_t> seen_;  // path -> bit per Op
+};
+
+struct PrefetchStats {
+	uint32_t files = 0;         // queued for prefetch
+	uint32_t loaded = 0;
+	uint32_t hits = 0;          // served from the prefetched contents
+	uint32_t waits = 0;         // hits that waited for a read in flight
+	uint32_t misses = 0;        // not in the trace, skipped or failed, read on demand
+	uint32_t wasted = 0;        // read but never taken (yet)
+	uint64_t loaded_bytes = 0;
+	uint64_t wasted_bytes = 0;
+};
+
+// Reads a list of files on worker threads ahead of demand and hands out their contents once.
+//
+// Take waits for a file that is being read rather than reading it twice, files not read yet are
+// dropped from the queue and left to the caller. The loader does the actual I/O so the
+// prefetcher runs the same over any file API.
+class IOPrefetcher {
+public:
+	typedef std::function<bool(const std::string& path, std::vector<uint8_t>& data)> Loader;
+
+	// Files past max_bytes of prefetched data are skipped.
+	IOPrefetcher(Loader loader, uint64_t max_bytes);
+
+	// Stops reading and joins the workers.
+	~IOPrefetcher();
+
+	void Start(const std::vector<std::string>& paths, uint32_t threads);
+
+	// Move the prefetched contents of path into data, false if the caller has to read it.
+	bool Take(const std::string& path, std::vector<uint8_t>& data);
+
+	PrefetchStats stats() const;
+
+protected:
+	enum class State { Queued, Loading, Ready, Taken, Failed };
+
+	struct File {
+		State state = State::Queued;
+		std::vector<uint8_t> data;
+	};
+
+	void Work();
+
+	Loader loader_;
+	uint64_t max_bytes_;
+
+	mutable std::mutex mutex_;
+	std::condition_variable loaded_;
+	std::map<std::string, File> files_;
+	std::vector<std::string> queue_;
+	size_t next_ = 0;
+	bool stopping_ = false;
+	std::vector<std::thread> threads_;
+	PrefetchStats stats_;
+};
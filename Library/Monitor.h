@@ -2,11 +2,13 @@
 #include <stdint.h>
 #include <Windows.h>
 #include "WindowsUtil.h"
+#include "gpu/VSyncPacer.h"
 
-
+// The primary monitor. Its display link follows DWM's composition clock, all views are paced by
+// it regardless of the monitor their window is on.
 class Monitor {
 public:
-	Monitor(WindowsUtil* util);
+	Monitor(WindowsUtil* util, uint32_t display_id = 0);
 	virtual ~Monitor() {}
 
 	virtual double scale() const;
@@ -15,7 +17,34 @@ public:
 
 	virtual uint32_t height() const;
 
+	// Passed to Renderer::RefreshDisplay and View::set_display_id for views shown on this monitor.
+	virtual uint32_t display_id() const { return display_id_; }
+
+	// Refresh rate reported by the display settings, 60 if unknown.
+	virtual double refresh_rate() const { return refresh_rate_; }
+
+	// Query the refresh rate again, call when the display settings changed.
+	virtual void UpdateRefreshRate();
+
+	// Display link: true once per vblank of this monitor, call at least once per refresh.
+	// Vblanks are taken from DWM's composition timing, or predicted from refresh_rate() when
+	// DWM doesn't report them.
+	virtual bool UpdateDisplayLink();
+
+	// Seconds until the next vblank.
+	virtual double TimeUntilVBlank() const;
+
+	virtual const VSyncStats& display_link_stats() const { return pacer_.stats(); }
+
+	virtual void LogStats() const;
+
 protected:
+	double Now() const;
+
 	WindowsUtil* util_;
 	HMONITOR monitor_;
+	uint32_t display_id_;
+	double refresh_rate_ = 60.0;
+	VSyncPacer pacer_;
+	LARGE_INTEGER qpc_frequency_;
 };
\ No newline at end of file
@@ -1,7 +1,16 @@
 #include "Monitor.h"
 
-Monitor::Monitor(WindowsUtil* util) : util_(util) {
-	monitor_ = MonitorFromPoint({ 1,1 }, MONITOR_DEFAULTTONEAREST);
+#include <dwmapi.h>
+#include <sstream>
+#include <Ultralight/platform/Logger.h>
+
+#include "helpers/LogHelpers.h"
+
+Monitor::Monitor(WindowsUtil* util, uint32_t display_id) : util_(util), display_id_(display_id) {
+	// The primary monitor always has its origin at 0, 0.
+	monitor_ = MonitorFromPoint({ 0, 0 }, MONITOR_DEFAULTTOPRIMARY);
+	QueryPerformanceFrequency(&qpc_frequency_);
+	UpdateRefreshRate();
 }
 
 double Monitor::scale() const {
@@ -24,4 +33,55 @@ uint32_t Monitor::height() const {
 		MessageBoxW(NULL, (LPCWSTR)L"GetMonitorInfo failed", (LPCWSTR)L"Notification", MB_OK);
 
 	return (uint32_t)abs(info.rcMonitor.top - info.rcMonitor.bottom);
-}
\ No newline at end of file
+}
+void Monitor::UpdateRefreshRate() {
+	refresh_rate_ = 60.0;
+
+	MONITORINFOEXW info;
+	info.cbSize = sizeof(info);
+	DEVMODEW mode = {};
+	mode.dmSize = sizeof(mode);
+
+	// 0 and 1 stand for the hardware default.
+	if (GetMonitorInfoW(monitor_, &info)
+		&& EnumDisplaySettingsW(info.szDevice, ENUM_CURRENT_SETTINGS, &mode)
+		&& mode.dmDisplayFrequency > 1)
+		refresh_rate_ = (double)mode.dmDisplayFrequency;
+
+	pacer_.SetPeriod(1.0 / refresh_rate_);
+}
+
+bool Monitor::UpdateDisplayLink() {
+	uint32_t missed;
+	if (!pacer_.Tick(Now(), missed))
+		return false;
+
+	// Re-align to DWM's last composition vblank once per tick, querying it on every poll would
+	// cost more than it corrects.
+	DWM_TIMING_INFO timing = {};
+	timing.cbSize = sizeof(timing);
+	if (SUCCEEDED(DwmGetCompositionTimingInfo(NULL, &timing)) && timing.qpcRefreshPeriod) {
+		double frequency = (double)qpc_frequency_.QuadPart;
+		pacer_.Sync(timing.qpcVBlank / frequency, timing.qpcRefreshPeriod / frequency);
+	}
+
+	return true;
+}
+
+double Monitor::TimeUntilVBlank() const {
+	return pacer_.TimeUntilNext(Now());
+}
+
+void Monitor::LogStats() const {
+	const VSyncStats& vsync = pacer_.stats();
+	std::ostringstream info;
+	info << "Display link: " << vsync.ticks << " vblanks at " << refresh_rate_ << " Hz, "
+		<< vsync.missed << " missed, " << vsync.resyncs << " resyncs";
+	UL_LOG_INFO(info.str().c_str());
+}
+
+double Monitor::Now() const {
+	LARGE_INTEGER counter;
+	QueryPerformanceCounter(&counter);
+	return (double)counter.QuadPart / qpc_frequency_.QuadPart;
+}
@@ -1,35 +1,64 @@
 #include "Overlay.h"
 
+#include <chrono>
+#include <math.h>
 #include <Ultralight/platform/Platform.h>
 #include <Ultralight/platform/Config.h>
 
 #include "Application.h"
 
-static IndexType patternCW[] = { 0, 1, 3, 1, 2, 3 };
-static IndexType patternCCW[] = { 0, 3, 1, 1, 3, 2 };
+// Display that is never refreshed, CSS animations and requestAnimationFrame stop ticking for
+// views moved onto it.
+static const uint32_t kSuspendedDisplayId = 0xFFFFFFFF;
 
-Overlay::Overlay(RefPtr<Window> window, uint32_t width, uint32_t height, int x, int y, ViewConfig cfg) :
-	window_(window), width_(width), height_(height), x_(x), y_(y), needs_update_(true),
-	use_gpu_(Platform::instance().gpu_driver()) {
-	if (use_gpu_)
-		driver_.reset((GPUDriverD3D11*)Platform::instance().gpu_driver());
+// Pages can't tell the overlay is hidden otherwise, let them throttle their own timers.
+static const char* kVisibilityScript =
+	"(function(hidden) {"
+	"  Object.defineProperty(document, 'hidden', { configurable: true, get: function() { return hidden; } });"
+	"  Object.defineProperty(document, 'visibilityState', { configurable: true,"
+	"    get: function() { return hidden ? 'hidden' : 'visible'; } });"
+	"  document.dispatchEvent(new Event('visibilitychange'));"
+	"})";
+
+static uint32_t g_next_overlay_id = 1;
+
+static double Now()
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
 
+Overlay::Overlay(RefPtr<Window> window, uint32_t width, uint32_t height, int x, int y, ViewConfig cfg) :
+	window_(window), id_(g_next_overlay_id++), width_(width), height_(height), x_(x), y_(y),
+	use_gpu_(Platform::instance().gpu_driver()),
+	state_([this]() { return window_->is_visible(); }) {
 	ViewConfig view_config = cfg;
 	view_config.initial_device_scale = window_->scale();
 	view_config.is_accelerated = use_gpu_;
 
-	view_ = Application::instance()->renderer()->CreateView(width, height, view_config, nullptr);
+	ViewPool* pool = Application::instance()->view_pool();
+	if (pool)
+		view_ = pool->Claim(width, height, view_config, from_pool_);
+	else
+		view_ = Application::instance()->renderer()->CreateView(width, height, view_config, nullptr);
+
+	// Animate in step with the monitor the window is shown on.
+	view_->set_display_id(window_->monitor()->display_id());
 
 	window_->overlay_manager()->Add(this);
 }
 
 Overlay::Overlay(RefPtr<Window> window, RefPtr<View> view, int x, int y):
-	window_(window), view_(view), width_(view->width()),
-	height_(view->height()), x_(x), y_(y), needs_update_(true),
-	use_gpu_(Platform::instance().gpu_driver()) {
-	if (use_gpu_)
-		driver_.reset((GPUDriverD3D11*)Platform::instance().gpu_driver());
+	window_(window), id_(g_next_overlay_id++), view_(view), width_(view->width()),
+	height_(view->height()), x_(x), y_(y), use_gpu_(Platform::instance().gpu_driver()),
+	state_([this]() { return window_->is_visible(); }) {
+	view_->set_display_id(window_->monitor()->display_id());
+	window_->overlay_manager()->Add(this);
+}
 
+Overlay::Overlay(RefPtr<Window> window, RefPtr<Overlay> source, int x, int y):
+	window_(window), id_(g_next_overlay_id++), view_(source->view()), width_(source->width()),
+	height_(source->height()), x_(x), y_(y), use_gpu_(Platform::instance().gpu_driver()),
+	source_(source), state_([this]() { return window_->is_visible(); }, &source->state_) {
 	window_->overlay_manager()->Add(this);
 }
 
@@ -38,8 +67,9 @@ Overlay::~Overlay()
 	if (Application::instance()) {
 		window_->overlay_manager()->Remove(this);
 
-		if (use_gpu_ && vertices_.size() && driver_)
-			driver_->DestroyGeometry(geometry_id_);
+		ViewPool* pool = Application::instance()->view_pool();
+		if (from_pool_ && pool)
+			pool->Recycle(view_);
 	}
 }
 
@@ -53,25 +83,40 @@ RefPtr<Overlay> Overlay::Create(RefPtr<Window> window, RefPtr<View> view, int x,
 	return AdoptRef(*(new Overlay(window, view, x, y)));
 }
 
+RefPtr<Overlay> Overlay::CreateMirror(RefPtr<Window> window, RefPtr<Overlay> source, int x, int y)
+{
+	// Mirrors of mirrors show the original.
+	if (source->source_)
+		source = source->source_;
+
+	return AdoptRef(*(new Overlay(window, source, x, y)));
+}
+
 void Overlay::Paint()
 {
-	if (is_hidden_)
+	// A hidden overlay stays awake while its mirrors are shown, but isn't drawn itself.
+	if (!state_.is_drawn())
 		return;
 
-	if (use_gpu_) {
-		UpdateGeometry();
-		driver_->DrawGeometry(geometry_id_, 6, 0, gpu_state_);
-	}
-	else if (view()->surface()) {
+
+	timeline_.Tick(Now());
+
+	// GPU overlays are composited in one batch by OverlayManager::Composite. The CPU path can
+	// only fade the whole window, transforms are ignored there.
+	if (!use_gpu_ && view()->surface()) {
 		Surface* surface = view()->surface();
-		window_->DrawSurface(x_, y_, surface);
+		window_->DrawSurface(x_, y_, surface, timeline_.value().opacity);
+		UpdateHitMask();
 	}
 
-	needs_update_ = false;
+	state_.OnComposite();
 }
 
 void Overlay::Resize(uint32_t width, uint32_t height)
 {
+	if (source_)
+		return;
+
 	// Clamp each dimension to 2
 	width = width <= 2 ? 2 : width;
 	height = height <= 2 ? 2 : height;
@@ -83,132 +128,236 @@ void Overlay::Resize(uint32_t width, uint32_t height)
 
 	width_ = width;
 	height_ = height;
-	needs_update_ = true;
-
-	if (use_gpu_) {
-		UpdateGeometry();
+	state_.set_needs_update(true);
+}
 
-		// Update these now since they were invalidated
-		RenderTarget target = view_->render_target();
-		gpu_state_.texture_1_id = target.texture_id;
-		gpu_state_.viewport_width = window_->width();
-		gpu_state_.viewport_height = window_->height();
-	}
+void Overlay::PrepareRender()
+{
+	if (view_->needs_paint())
+		state_.OnRender();
 }
 
-void Overlay::UpdateGeometry()
+void Overlay::UpdateRenderTarget()
 {
-	if (!use_gpu_)
+	// The source manages the render target of its mirrors.
+	if (!use_gpu_ || source_)
 		return;
 
-	bool initial_creation = false;
 	RenderTarget target = view_->render_target();
+	if (target.is_empty)
+		return;
 
-	if (vertices_.empty()) {
-		vertices_.resize(4);
-		indices_.resize(6);
-
-		auto& config = Platform::instance().config();
-		if (config.face_winding == FaceWinding::Clockwise)
-			memcpy(indices_.data(), patternCW, sizeof(IndexType) * indices_.size());
-		else
-			memcpy(indices_.data(), patternCCW, sizeof(IndexType) * indices_.size());
-
-		memset(&gpu_state_, 0, sizeof(gpu_state_));
-		Matrix identity;
-		identity.SetIdentity();
-
-		gpu_state_.viewport_width = window_->width();
-		gpu_state_.viewport_height = window_->height();
-		gpu_state_.transform = identity.GetMatrix4x4();
-		gpu_state_.enable_blend = true;
-		gpu_state_.enable_texturing = true;
-		gpu_state_.shader_type = ShaderType::Fill;
-		gpu_state_.render_buffer_id = window_->render_buffer_id();
-		gpu_state_.texture_1_id = target.texture_id;
-
-		initial_creation = true;
-	}
+	GPUDriverD3D11* driver = Application::instance()->gpu_driver();
 
-	if (!needs_update_)
+	// Hidden and occluded overlays may lose their render target, it's regenerated once shown
+	// again.
+	bool needs_render = NeedsRender();
+	driver->SetRenderTargetHidden(target.texture_id, !needs_render);
+	if (!needs_render)
 		return;
 
-	Vertex_2f_4ub_2f_2f_28f v;
-	memset(&v, 0, sizeof(v));
+	// The texture's contents are gone when it was evicted, just placed or moved by a repack.
+	bool contents_lost = driver->EnsureResident(target.texture_id);
+	if (driver->PlaceInAtlas(target.texture_id))
+		contents_lost = true;
 
-	v.data0[0] = 1; // Fill Type: Image
+	if (contents_lost)
+		view_->set_needs_paint(true);
+}
 
-	v.color[0] = 255;
-	v.color[1] = 255;
-	v.color[2] = 255;
-	v.color[3] = 255;
+void Overlay::AppendInstance(CompositeBatch& batch)
+{
+	if (!state_.is_drawn() || !use_gpu_)
+		return;
 
-	float left = static_cast<float>(x_);
-	float top = static_cast<float>(y_);
-	float right = static_cast<float>(x_ + width());
-	float bottom = static_cast<float>(y_ + height());
 
-	// TOP LEFT
-	v.pos[0] = v.obj[0] = left;
-	v.pos[1] = v.obj[1] = top;
-	v.tex[0] = target.uv_coords.left;
-	v.tex[1] = target.uv_coords.top;
+	// The render target may change whenever the view is resized, fetch it every frame.
+	RenderTarget target = view_->render_target();
 
-	vertices_[0] = v;
+	timeline_.Tick(Now());
+	const CompositeTransform& transform = timeline_.value();
 
-	// TOP RIGHT
-	v.pos[0] = v.obj[0] = right;
-	v.pos[1] = v.obj[1] = top;
-	v.tex[0] = target.uv_coords.right;
-	v.tex[1] = target.uv_coords.top;
+	Rect rect = {
+		static_cast<float>(x_) + transform.translate_x,
+		static_cast<float>(y_) + transform.translate_y,
+		static_cast<float>(x_ + width()) + transform.translate_x,
+		static_cast<float>(y_ + height()) + transform.translate_y
+	};
 
-	vertices_[1] = v;
+	Rect uv = Application::instance()->gpu_driver()->MapAtlasUV(target.texture_id, target.uv_coords);
 
-	// BOTTOM RIGHT
-	v.pos[0] = v.obj[0] = right;
-	v.pos[1] = v.obj[1] = bottom;
-	v.tex[0] = target.uv_coords.right;
-	v.tex[1] = target.uv_coords.bottom;
+	float matrix[4];
+	transform.GetMatrix(matrix);
 
-	vertices_[2] = v;
+	batch.Add(target.texture_id, rect, uv, transform.opacity, matrix);
 
-	// BOTTOM LEFT
-	v.pos[0] = v.obj[0] = left;
-	v.pos[1] = v.obj[1] = bottom;
-	v.tex[0] = target.uv_coords.left;
-	v.tex[1] = target.uv_coords.bottom;
+	state_.OnComposite();
+}
 
-	vertices_[3] = v;
+void Overlay::UpdateHitMask()
+{
+	// Mirrors test against their source's mask.
+	if (state_.is_suspended() || source_ || !Application::instance()->settings().alpha_hit_testing)
+		return;
 
-	ultralight::VertexBuffer vbuffer;
-	vbuffer.format = ultralight::VertexBufferFormat::_2f_4ub_2f_2f_28f;
-	vbuffer.size = static_cast<uint32_t>(sizeof(ultralight::Vertex_2f_4ub_2f_2f_28f) * vertices_.size());
-	vbuffer.data = (uint8_t*)vertices_.data();
+	if (use_gpu_) {
+		RenderTarget target = view_->render_target();
+		if (!target.is_empty)
+			Application::instance()->gpu_driver()->UpdateAlphaMask(target.texture_id, target.width,
+				target.height, hit_mask_);
+		return;
+	}
 
-	ultralight::IndexBuffer ibuffer;
-	ibuffer.size = static_cast<uint32_t>(sizeof(ultralight::IndexType) * indices_.size());
-	ibuffer.data = (uint8_t*)indices_.data();
+	Surface* surface = view_->surface();
+	if (!surface)
+		return;
 
-	if (initial_creation) {
-		geometry_id_ = driver_->NextGeometryId();
-		driver_->CreateGeometry(geometry_id_, vbuffer, ibuffer);
+	IntRect dirty = surface->dirty_bounds();
+	if (hit_mask_.width() != surface->width() || hit_mask_.height() != surface->height()) {
+		hit_mask_.Resize(surface->width(), surface->height());
+		dirty = { 0, 0, (int)surface->width(), (int)surface->height() };
 	}
-	else {
-		driver_->UpdateGeometry(geometry_id_, vbuffer, ibuffer);
+
+	if (dirty.IsEmpty())
+		return;
+
+	// Only the cells under the dirty rect are rebuilt.
+	const uint8_t* pixels = static_cast<const uint8_t*>(surface->LockPixels());
+	hit_mask_.Update(pixels, surface->row_bytes(), dirty.left, dirty.top, dirty.right, dirty.bottom);
+	surface->UnlockPixels();
+	surface->ClearDirtyBounds();
+}
+
+bool Overlay::HitTest(int x, int y) const
+{
+	if (state_.is_hidden() || timeline_.value().opacity <= 0.0f)
+		return false;
+
+	float view_x = (float)x;
+	float view_y = (float)y;
+	WindowToView(view_x, view_y);
+
+	int px = (int)floorf(view_x);
+	int py = (int)floorf(view_y);
+	if (px < 0 || py < 0 || px >= (int)width() || py >= (int)height())
+		return false;
+
+	// Until the mask caught up with a resize the whole overlay takes input.
+	const Settings& settings = Application::instance()->settings();
+	const AlphaMask& mask = hit_mask();
+	if (!settings.alpha_hit_testing || mask.width() != width() || mask.height() != height())
+		return true;
+
+	return mask.Test(px, py, settings.hit_test_alpha_threshold);
+}
+
+void Overlay::WindowToView(float& x, float& y) const
+{
+	x -= x_;
+	y -= y_;
+
+	// A collapsed overlay covers nothing.
+	if (!timeline_.value().Unproject((float)width(), (float)height(), x, y)) {
+		x = -1.0f;
+		y = -1.0f;
 	}
+}
+
+IntRect Overlay::composite_bounds() const
+{
+	const CompositeTransform& transform = timeline_.value();
+	float m[4];
+	transform.GetMatrix(m);
+
+	// Half extents of the transformed quad around its center.
+	float half_width = width() * 0.5f;
+	float half_height = height() * 0.5f;
+	float extent_x = fabsf(m[0]) * half_width + fabsf(m[1]) * half_height;
+	float extent_y = fabsf(m[2]) * half_width + fabsf(m[3]) * half_height;
+	float center_x = x_ + transform.translate_x + half_width;
+	float center_y = y_ + transform.translate_y + half_height;
+
+	return {
+		(int)floorf(center_x - extent_x),
+		(int)floorf(center_y - extent_y),
+		(int)ceilf(center_x + extent_x),
+		(int)ceilf(center_y + extent_y)
+	};
+}
+
+bool Overlay::is_opaque() const
+{
+	const CompositeTransform& transform = timeline_.value();
+	if (transform.opacity < 1.0f || transform.rotation != 0.0f || transform.scale_x != 1.0f
+		|| transform.scale_y != 1.0f || transform.translate_x != floorf(transform.translate_x)
+		|| transform.translate_y != floorf(transform.translate_y))
+		return false;
+
+	return !view_->is_transparent();
+}
+
+void Overlay::SetOpacity(float opacity)
+{
+	CompositeTransform transform = timeline_.target();
+	transform.opacity = opacity;
+	SetTransform(transform);
+}
+
+void Overlay::SetTransform(const CompositeTransform& transform)
+{
+	timeline_.Set(transform);
+	state_.set_needs_update(true);
+}
 
-	needs_update_ = false;
+void Overlay::AnimateTo(const CompositeTransform& target, double duration, Easing easing)
+{
+	timeline_.AnimateTo(target, duration, easing, Now());
+	state_.set_needs_update(true);
 }
 
 void Overlay::Hide()
 {
-	is_hidden_ = true;
+	state_.Hide();
 }
 
 void Overlay::Show()
 {
-	is_hidden_ = false;
-	needs_update_ = true;
+	state_.Show();
+}
+
+bool Overlay::UpdateSuspension()
+{
+	if (!state_.UpdateSuspension())
+		return false;
+
+	// The shared view belongs to the source.
+	if (source_)
+		return true;
+
+	if (state_.is_suspended())
+		Suspend();
+	else
+		Resume();
+
+	return true;
+}
+
+void Overlay::Suspend()
+{
+	display_id_ = view_->display_id();
+	view_->set_display_id(kSuspendedDisplayId);
+
+	view_->EvaluateScript(String(kVisibilityScript) + "(true)");
+}
+
+void Overlay::Resume()
+{
+	view_->set_display_id(display_id_);
+
+	view_->EvaluateScript(String(kVisibilityScript) + "(false)");
+
+	// Catch up on everything that changed while suspended in one frame.
+	view_->set_needs_paint(true);
 }
 
 void Overlay::Focus()
@@ -226,10 +375,14 @@ void Overlay::MoveTo(int x, int y)
 {
 	x_ = x;
 	y_ = y;
-	needs_update_ = true;
+	state_.set_needs_update(true);
 }
 
 bool Overlay::NeedsRepaint()
 {
-	return needs_update_ || view_->needs_paint();
+	// Capped views stay dirty until their next refresh is due.
+	bool view_needs_render = !source_ && view_->needs_paint()
+		&& window_->overlay_manager()->IsRenderDue(this);
+
+	return state_.NeedsRepaint(view_needs_render, timeline_.is_animating());
 }
@@ -2,8 +2,11 @@
 #include <Ultralight/View.h>
 #include <Ultralight/RefPtr.h>
 
+#include "OverlayState.h"
 #include "Window.h"
-#include "gpu/GPUDriver.h"
+#include "gpu/AlphaMask.h"
+#include "gpu/CompositeAnimation.h"
+#include "gpu/CompositeBatch.h"
 #include "RefCountedImpl.h"
 
 using namespace ultralight;
@@ -14,31 +17,108 @@ public:
 	static RefPtr<Overlay> Create(RefPtr<Window> window, uint32_t width, uint32_t height, int x, int y, ViewConfig cfg = ViewConfig());
 	static RefPtr<Overlay> Create(RefPtr<Window> window, RefPtr<View> view, int x, int y);
 
+	// Show another overlay's view without creating a new one: the mirror composites the source's
+	// render target (or surface) in its own window and position, and is recomposited whenever the
+	// source view paints. Input goes to the shared view.
+	static RefPtr<Overlay> CreateMirror(RefPtr<Window> window, RefPtr<Overlay> source, int x, int y);
+
 	void Paint();
+
+	// Mirrors follow their source's size, resize the source instead.
 	void Resize(uint32_t width, uint32_t height);
-	void UpdateGeometry();
+
+	// Called right before the view is rendered, see content_version().
+	void PrepareRender();
+
+	// Keep the view's render target resident (evictable while hidden) and move it into the
+	// shared atlas, called before each render.
+	void UpdateRenderTarget();
+
+	// Append this overlay's quad to the window's composite batch (GPU path only).
+	void AppendInstance(CompositeBatch& batch);
+
+	// Refresh the hit test mask from what the view painted since the last call, called by Paint
+	// on the CPU path and after the command list was drawn on the GPU path.
+	void UpdateHitMask();
+
+	// True if x, y (window pixels) is inside the overlay and not transparent there.
+	bool HitTest(int x, int y) const;
 
 	void Hide();
 	void Show();
 
+	// Stop rendering and animating the view while the overlay or its window is hidden, resume
+	// with a single catch-up frame once shown again. Returns true if the state changed.
+	bool UpdateSuspension();
+
 	void Focus();
 	void Unfocus();
 
 	void MoveTo(int x, int y);
 
+	// Opacity and 2D transform applied by the compositor to the view's existing pixels, the view
+	// is not re-rendered. Both cancel a running animation.
+	void SetOpacity(float opacity);
+	void SetTransform(const CompositeTransform& transform);
+
+	// Tween opacity and transform over duration seconds, at frame rate and without re-rendering
+	// the view.
+	void AnimateTo(const CompositeTransform& target, double duration,
+		Easing easing = Easing::EaseInOut);
+
+	const CompositeTransform& transform() const { return timeline_.value(); }
+
+	bool is_animating() const { return timeline_.is_animating(); }
+
+	// Map a point in window pixels into the view's pixels, undoing the composite transform.
+	void WindowToView(float& x, float& y) const;
+
+	// Window pixels the composited quad may touch.
+	IntRect composite_bounds() const;
+
+	// True if every pixel of composite_bounds() is drawn fully opaque: an opaque view, full
+	// opacity and no rotation, scaling or subpixel offset. The alpha mask can't tell, its cells
+	// hold the largest alpha so antialiased edges and rounded corners still look opaque.
+	bool is_opaque() const;
+
+	// Set by OverlayManager when the overlay is offscreen or covered by opaque overlays, it is
+	// then neither rendered nor composited.
+	void set_occluded(bool occluded) { state_.set_occluded(occluded); }
+
+	bool is_occluded() const { return state_.is_occluded(); }
+
+	// False if nothing shows the view this frame: suspended, or occluded along with every mirror.
+	bool NeedsRender() const { return state_.NeedsRender(); }
+
 	bool NeedsRepaint();
 
+	// Render the view at most fps times per second (0 = every frame it's dirty). Input and
+	// compositor animations are not throttled.
+	void set_max_refresh_rate(double fps) { max_refresh_rate_ = fps; }
+
+	double max_refresh_rate() const { return max_refresh_rate_; }
+
+	// Unique per overlay, identifies it to the window's RenderScheduler.
+	uint32_t id() const { return id_; }
+
 	RefPtr<View> view() { return view_; }
 
-	uint32_t width() const { return width_; }
+	uint32_t width() const { return source_ ? source_->width_ : width_; }
 
-	uint32_t height() const { return height_; }
+	uint32_t height() const { return source_ ? source_->height_ : height_; }
+
+	bool is_mirror() const { return !!source_; }
+
+	// Bumped whenever the view is about to paint new contents.
+	uint64_t content_version() const { return state_.content_version(); }
 
 	int x() const { return x_; }
 
 	int y() const { return y_; }
 
-	bool is_hidden() const { return is_hidden_; }
+	bool is_hidden() const { return state_.is_hidden(); }
+
+	bool is_suspended() const { return state_.is_suspended(); }
 
 	bool has_focus() const {
 		return window_->overlay_manager()->IsOverlayFocused((Overlay*)this);
@@ -49,26 +129,38 @@ public:
 protected:
 	Overlay(RefPtr<Window> window, uint32_t width, uint32_t height, int x, int y, ViewConfig cfg);
 	Overlay(RefPtr<Window> window, RefPtr<View> view, int x, int y);
+	Overlay(RefPtr<Window> window, RefPtr<Overlay> source, int x, int y);
 	~Overlay();
 
 	DISALLOW_COPY_AND_ASSIGN(Overlay);
 
 	RefPtr<Window> window_;
 
+	uint32_t id_;
+	double max_refresh_rate_ = 0.0;
 	uint32_t width_;
 	uint32_t height_;
 	int x_;
 	int y_;
-	bool is_hidden_ = false;
 	bool use_gpu_ = true;
 
+	// Move the view off its display and tell the page it's hidden, and back.
+	void Suspend();
+	void Resume();
+
+	uint32_t display_id_ = 0;
+
 	RefPtr<View> view_;
+	bool from_pool_ = false;  // view_ goes back to the ViewPool when the overlay is destroyed
+	AlphaMask hit_mask_;
+	CompositeTimeline timeline_;
+
+	// Set on mirrors, they share the source's view, render target and hit test mask.
+	RefPtr<Overlay> source_;
+
+	// Declared after source_ so a mirror leaves its source's state before releasing it.
+	OverlayState state_;
 
-	std::unique_ptr<GPUDriverD3D11> driver_;
-	std::vector<Vertex_2f_4ub_2f_2f_28f> vertices_;
-	std::vector<IndexType> indices_;
-	bool needs_update_;
-	uint32_t geometry_id_;
-	GPUState gpu_state_;
+	const AlphaMask& hit_mask() const { return source_ ? source_->hit_mask_ : hit_mask_; }
 };
 
@@ -1,15 +1,26 @@
 #include "OverlayManager.h"
 
+#include <chrono>
+#include <sstream>
+#include <Ultralight/platform/Logger.h>
 #include <Ultralight/View.h>
 
 #include "Application.h"
+#include "gpu/FrameReuse.h"
+#include "helpers/LogHelpers.h"
 #include "Overlay.h"
 
 using namespace ultralight;
 
+static double Now()
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
 void OverlayManager::Remove(Overlay* overlay)
 {
     overlays_.erase(std::remove(overlays_.begin(), overlays_.end(), overlay), overlays_.end());
+    render_scheduler_.Remove(overlay->id());
 
     if (focused_overlay_ == overlay) {
         focused_overlay_ = nullptr;
@@ -20,31 +31,127 @@ void OverlayManager::Remove(Overlay* overlay)
         hovered_overlay_ = nullptr;
 }
 
-void OverlayManager::Render()
+void OverlayManager::Render(uint32_t viewport_width, uint32_t viewport_height)
 {
     if (overlays_.empty())
         return;
 
-    size_t view_array_len = overlays_.size();
+    // Overlays that were just hidden or shown have to be removed from or added to the window.
+    for (auto& overlay : overlays_) {
+        if (overlay->UpdateSuspension())
+            needs_composite_ = true;
+    }
+
+    UpdateOcclusion(viewport_width, viewport_height);
+
+    render_scheduler_.Begin(Now());
+
+    std::vector<Overlay*> candidates;
+    for (auto& overlay : overlays_) {
+        overlay->UpdateRenderTarget();
+
+        // Mirrors show a view rendered by its own overlay, covered views wait until uncovered.
+        if (!overlay->NeedsRender() || !overlay->view()->needs_paint())
+            continue;
+
+        uint32_t priority = overlay == focused_overlay_ ? 2 : overlay == hovered_overlay_ ? 1 : 0;
+        render_scheduler_.Add(overlay->id(), overlay->max_refresh_rate(), priority);
+        candidates.push_back(overlay);
+    }
+
+    if (candidates.empty())
+        return;
+
+    const std::vector<uint32_t>& scheduled = render_scheduler_.Schedule();
+    if (scheduled.empty())
+        return;
+
+    size_t view_array_len = scheduled.size();
     View** view_array = new View * [view_array_len];
 
+    // Scheduled ids are in the order they were added.
     size_t i = 0;
-    for (auto& overlay : overlays_) {
+    for (auto& overlay : candidates) {
+        if (i == view_array_len || overlay->id() != scheduled[i])
+            continue;
+
+        overlay->PrepareRender();
+
         view_array[i] = overlay->view().get();
         i++;
     }
 
-    Application::instance()->renderer()->RenderOnly(view_array, view_array_len);
+    auto start = std::chrono::steady_clock::now();
+    Application::instance()->renderer()->RenderOnly(view_array, i);
+    render_scheduler_.EndFrame(std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - start).count());
 
     delete[] view_array;
 }
 
+bool OverlayManager::IsRenderDue(Overlay* overlay) const
+{
+    return render_scheduler_.IsDue(overlay->id(), overlay->max_refresh_rate(), Now());
+}
+
+void OverlayManager::UpdateOcclusion(uint32_t viewport_width, uint32_t viewport_height)
+{
+    occlusion_culler_.Begin((int)viewport_width, (int)viewport_height);
+
+    // Suspended and hidden overlays are never drawn, they neither cover nor get covered.
+    for (auto& overlay : overlays_) {
+        if (overlay->is_suspended() || overlay->is_hidden())
+            occlusion_culler_.Add(IntRect::MakeEmpty(), false);
+        else
+            occlusion_culler_.Add(overlay->composite_bounds(), overlay->is_opaque());
+    }
+
+    occlusion_culler_.Cull();
+
+    for (size_t i = 0; i < overlays_.size(); i++) {
+        bool occluded = occlusion_culler_.is_culled(i) && !overlays_[i]->is_suspended()
+            && !overlays_[i]->is_hidden();
+        if (occluded != overlays_[i]->is_occluded()) {
+            overlays_[i]->set_occluded(occluded);
+            needs_composite_ = true;
+        }
+    }
+}
+
 void OverlayManager::Paint()
 {
+    needs_composite_ = false;
+
     for (auto& i : overlays_)
         i->Paint();
 }
 
+uint64_t OverlayManager::PrepareComposite()
+{
+    needs_composite_ = false;
+    composite_batch_.Clear();
+
+    for (auto& i : overlays_)
+        i->AppendInstance(composite_batch_);
+
+    auto& instances = composite_batch_.instances();
+    auto& draws = composite_batch_.draws();
+    uint64_t hash = HashBytes(instances.data(), instances.size() * sizeof(CompositeBatch::Instance));
+    return HashBytes(draws.data(), draws.size() * sizeof(CompositeBatch::Draw), hash);
+}
+
+void OverlayManager::Composite(GPUDriverD3D11* driver, uint32_t render_buffer_id,
+    uint32_t viewport_width, uint32_t viewport_height)
+{
+    driver->DrawCompositeBatch(render_buffer_id, viewport_width, viewport_height, composite_batch_);
+}
+
+void OverlayManager::UpdateHitMasks()
+{
+    for (auto& i : overlays_)
+        i->UpdateHitMask();
+}
+
 void OverlayManager::SetWindowFocused(bool focused)
 {
     window_focused_ = focused;
@@ -68,11 +175,7 @@ void OverlayManager::FireKeyEvent(const ultralight::KeyEvent& evt) {
 
 void OverlayManager::FireMouseEvent(const ultralight::MouseEvent& evt) {
     if (is_dragging_) {
-        MouseEvent rel_evt = evt;
-        rel_evt.x -= (int)std::round(hovered_overlay_->x() / window_scale_);
-        rel_evt.y -= (int)std::round(hovered_overlay_->y() / window_scale_);
-
-        focused_overlay_->view()->FireMouseEvent(rel_evt);
+        focused_overlay_->view()->FireMouseEvent(ToOverlayEvent(hovered_overlay_, evt));
 
         if (evt.type == ultralight::MouseEvent::kType_MouseUp && evt.button == MouseEvent::kButton_Left)
             is_dragging_ = false;
@@ -96,14 +199,22 @@ void OverlayManager::FireMouseEvent(const ultralight::MouseEvent& evt) {
             is_dragging_ = true;
         }
 
-        MouseEvent rel_evt = evt;
-        rel_evt.x -= (int)std::round(hovered_overlay_->x() / window_scale_);
-        rel_evt.y -= (int)std::round(hovered_overlay_->y() / window_scale_);
-
-        hovered_overlay_->view()->FireMouseEvent(rel_evt);
+        hovered_overlay_->view()->FireMouseEvent(ToOverlayEvent(hovered_overlay_, evt));
     }
 }
 
+MouseEvent OverlayManager::ToOverlayEvent(Overlay* overlay, const MouseEvent& evt) {
+    // Undo the overlay's composite transform so the view gets its own coordinates.
+    float x = (float)(evt.x * window_scale_);
+    float y = (float)(evt.y * window_scale_);
+    overlay->WindowToView(x, y);
+
+    MouseEvent rel_evt = evt;
+    rel_evt.x = (int)std::round(x / window_scale_);
+    rel_evt.y = (int)std::round(y / window_scale_);
+    return rel_evt;
+}
+
 void OverlayManager::FireScrollEvent(const ultralight::ScrollEvent& evt) {
     if (hovered_overlay_)
         hovered_overlay_->view()->FireScrollEvent(evt);
@@ -133,6 +244,9 @@ bool OverlayManager::IsOverlayFocused(Overlay* overlay) const {
 }
 
 bool OverlayManager::NeedsRepaint() {
+    if (needs_composite_)
+        return true;
+
     for (auto& i : overlays_)
         if (i->NeedsRepaint())
             return true;
@@ -141,11 +255,28 @@ bool OverlayManager::NeedsRepaint() {
 }
 
 Overlay* OverlayManager::HitTest(int x, int y) {
+    // Transparent pixels of an overlay let the event through to the overlays below it.
     for (auto& i : overlays_) {
-        if (!i->is_hidden() && x >= i->x() && y >= i->y() && x < i->x() + (int)i->width() && y < i->y() + (int)i->height())
+        if (i->HitTest(x, y))
             return i;
     }
 
     return nullptr;
 }
 
+void OverlayManager::LogStats() const
+{
+    const OcclusionStats& occlusion = occlusion_stats();
+    std::ostringstream culled;
+    culled << "Overlay occlusion: " << occlusion.occluded << " occluded and "
+        << occlusion.offscreen << " offscreen of " << occlusion.overlays << " overlays over "
+        << occlusion.frames << " frames";
+    UL_LOG_INFO(culled.str().c_str());
+
+    const RenderSchedulerStats& scheduler = render_scheduler_stats();
+    std::ostringstream scheduled;
+    scheduled << "Render scheduler: " << scheduler.scheduled << " of " << scheduler.candidates
+        << " dirty views rendered, " << scheduler.deferred_rate << " deferred by refresh rate caps and "
+        << scheduler.deferred_budget << " by the render budget";
+    UL_LOG_INFO(scheduled.str().c_str());
+}
@@ -6,7 +6,12 @@
 #include <Ultralight/ScrollEvent.h>
 #include <vector>
 
+#include "gpu/CompositeBatch.h"
+#include "gpu/OcclusionCuller.h"
+#include "gpu/RenderScheduler.h"
+
 class Overlay;
+class GPUDriverD3D11;
 
 class OverlayManager {
 public:
@@ -17,12 +22,29 @@ public:
 
     virtual void Remove(Overlay* overlay);
 
-    // Render all active Views.
-    virtual void Render();
+    // Render all active Views. Suspended overlays and those outside the viewport or covered by
+    // opaque overlays are skipped, see OcclusionCuller. Dirty views are picked by
+    // RenderScheduler: capped overlays wait for their next refresh and the rest share the
+    // render budget, focused and hovered overlays first.
+    virtual void Render(uint32_t viewport_width, uint32_t viewport_height);
+
+    // CPU time RenderOnly may take per frame in milliseconds (0 = unlimited). At least one
+    // dirty view is rendered every frame, the others are deferred to later frames.
+    virtual void SetRenderBudget(double budget_ms) { render_scheduler_.set_budget(budget_ms); }
+
+    // False while an overlay's view was rendered more recently than its refresh rate cap allows.
+    virtual bool IsRenderDue(Overlay* overlay) const;
 
     // Repaint overlays
     virtual void Paint();
 
+    // Collect the quads of all visible overlays for Composite, returns a hash of the batch.
+    virtual uint64_t PrepareComposite();
+
+    // Composite the prepared quads into a render buffer with instanced draws (GPU path)
+    virtual void Composite(GPUDriverD3D11* driver, uint32_t render_buffer_id,
+        uint32_t viewport_width, uint32_t viewport_height);
+
     virtual void SetWindowFocused(bool focused);
 
     virtual void SetWindowScale(double scale);
@@ -41,13 +63,39 @@ public:
 
     virtual bool NeedsRepaint();
 
+    // Overlays skipped by the last Render and in total.
+    const OcclusionStats& occlusion_frame_stats() const { return occlusion_culler_.frame_stats(); }
+
+    const OcclusionStats& occlusion_stats() const { return occlusion_culler_.total_stats(); }
+
+    const RenderSchedulerStats& render_scheduler_stats() const { return render_scheduler_.stats(); }
+
+    // Occlusion and render scheduler totals.
+    virtual void LogStats() const;
+
+    // Refresh the hit test masks of GPU overlays, call once per frame after drawing.
+    virtual void UpdateHitMasks();
+
+    // True if an overlay takes input at x, y (window pixels), false where every overlay is
+    // transparent so the click can go to whatever is below the window.
+    virtual bool IsHitAt(int x, int y) { return HitTest(x, y) != nullptr; }
+
 protected:
     Overlay* HitTest(int x, int y);
 
+    void UpdateOcclusion(uint32_t viewport_width, uint32_t viewport_height);
+
+    // Mouse event relative to an overlay's view.
+    ultralight::MouseEvent ToOverlayEvent(Overlay* overlay, const ultralight::MouseEvent& evt);
+
     std::vector<Overlay*> overlays_;
     Overlay* focused_overlay_ = nullptr;
     Overlay* hovered_overlay_ = nullptr;
     bool is_dragging_ = false;
     bool window_focused_ = false;
     double window_scale_ = 1.0;
+    bool needs_composite_ = false;
+    CompositeBatch composite_batch_;
+    OcclusionCuller occlusion_culler_;
+    RenderScheduler render_scheduler_;
 };
\ No newline at end of file
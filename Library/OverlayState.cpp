@@ -0,0 +1,105 @@
+#include "OverlayState.h"
+
+#include <algorithm>
+
+OverlayState::OverlayState(std::function<bool()> window_visible, OverlayState* source) :
+	window_visible_(window_visible), source_(source && source->source_ ? source->source_ : source)
+{
+	if (source_)
+		source_->mirrors_.push_back(this);
+}
+
+OverlayState::~OverlayState()
+{
+	if (source_) {
+		auto& mirrors = source_->mirrors_;
+		mirrors.erase(std::remove(mirrors.begin(), mirrors.end(), this), mirrors.end());
+	}
+}
+
+void OverlayState::Hide()
+{
+	is_hidden_ = true;
+}
+
+void OverlayState::Show()
+{
+	is_hidden_ = false;
+	needs_update_ = true;
+}
+
+bool OverlayState::ShouldSuspend() const
+{
+	if (!is_hidden_ && window_visible_())
+		return false;
+
+	// Mirrors show this view elsewhere, keep it rendering while any of them is shown.
+	for (auto mirror : mirrors_) {
+		if (!mirror->ShouldSuspend())
+			return false;
+	}
+
+	return true;
+}
+
+bool OverlayState::UpdateSuspension()
+{
+	if (ShouldSuspend() == is_suspended_)
+		return false;
+
+	is_suspended_ = !is_suspended_;
+
+	// Catch up on everything that changed while suspended in one frame.
+	if (!is_suspended_)
+		needs_update_ = true;
+
+	return true;
+}
+
+void OverlayState::OnComposite()
+{
+	if (source_)
+		mirrored_version_ = source_->content_version_;
+
+	needs_update_ = false;
+}
+
+bool OverlayState::NeedsRepaint(bool view_needs_render, bool animating) const
+{
+	// A pending suspend or resume needs one more pass through OverlayManager::Render.
+	if (suspension_pending())
+		return true;
+
+	if (is_suspended_)
+		return false;
+
+	// Running animations only recomposite, the view itself stays clean.
+	if (needs_update_ || animating)
+		return true;
+
+	// New contents would not be seen, OverlayManager renders them once uncovered.
+	if (source_ ? is_occluded_ : !NeedsRender())
+		return false;
+
+	// The source's window renders the shared view, mirrors recomposite once it did.
+	if (source_)
+		return source_->content_version_ != mirrored_version_;
+
+	return view_needs_render;
+}
+
+bool OverlayState::NeedsRender() const
+{
+	if (is_suspended_ || source_)
+		return false;
+
+	if (!is_occluded_)
+		return true;
+
+	for (auto mirror : mirrors_) {
+		if (!mirror->is_suspended_ && !mirror->is_occluded_)
+			return true;
+	}
+
+	return false;
+}
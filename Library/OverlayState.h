@@ -0,0 +1,87 @@
+#pragma once
+#include <stdint.h>
+#include <functional>
+#include <vector>
+
+// Whether an overlay's view runs and is drawn, apart from Overlay so the rules can be checked
+// without a window or a view.
+//
+// A view is suspended while its overlay or the overlay's window is hidden, unless a mirror
+// still shows it. Once shown again it resumes and needs_update() asks for one composite, the
+// caller marks the view dirty so everything that changed meanwhile is rendered in one frame.
+//
+// Mirrors share their source's view: only the source renders it, each mirror recomposites once
+// the source rendered a content_version() it hasn't shown yet.
+class OverlayState {
+public:
+	// |window_visible| reports whether the overlay's window is shown. Mirrors pass the state of
+	// the overlay they show, a mirror of a mirror shows the original.
+	explicit OverlayState(std::function<bool()> window_visible, OverlayState* source = nullptr);
+	~OverlayState();
+
+	void Hide();
+	void Show();
+
+	// Set by OverlayManager when the overlay is offscreen or covered by opaque overlays.
+	void set_occluded(bool occluded) { is_occluded_ = occluded; }
+
+	// True if the view should stop rendering: this overlay isn't shown and neither is any mirror.
+	bool ShouldSuspend() const;
+
+	// Follow ShouldSuspend(), returns true if is_suspended() changed. Mirrors share the source's
+	// view, the caller only suspends or resumes it when !is_mirror().
+	bool UpdateSuspension();
+
+	// A suspend or resume is due on the next UpdateSuspension().
+	bool suspension_pending() const { return ShouldSuspend() != is_suspended_; }
+
+	// False if nothing shows the view this frame: suspended, or occluded along with every mirror.
+	// Mirrors never render, their source does.
+	bool NeedsRender() const;
+
+	// This overlay's quad is composited: not suspended, hidden or occluded. A source kept
+	// rendering for its mirrors may be awake but not drawn.
+	bool is_drawn() const { return !is_suspended_ && !is_hidden_ && !is_occluded_; }
+
+	// The window has to be recomposited for this overlay, cleared by OnComposite().
+	bool needs_update() const { return needs_update_; }
+	void set_needs_update(bool needs_update) { needs_update_ = needs_update; }
+
+	// The view is about to paint new contents.
+	void OnRender() { content_version_++; }
+
+	// The overlay's quad was drawn, mirrors now show the source's current contents.
+	void OnComposite();
+
+	// True if the window has to be redrawn for this overlay: a pending suspend or resume, a
+	// recomposite, or |view_needs_render| (dirty and due) on a view somebody sees. Mirrors ignore
+	// |view_needs_render|, they wait for their source's content_version().
+	bool NeedsRepaint(bool view_needs_render, bool animating) const;
+
+	// Bumped by OnRender on the source, mirrors report their source's.
+	uint64_t content_version() const { return source_ ? source_->content_version_ : content_version_; }
+
+	bool is_hidden() const { return is_hidden_; }
+	bool is_suspended() const { return is_suspended_; }
+	bool is_occluded() const { return is_occluded_; }
+	bool is_mirror() const { return !!source_; }
+
+	OverlayState* source() const { return source_; }
+	const std::vector<OverlayState*>& mirrors() const { return mirrors_; }
+
+private:
+	std::function<bool()> window_visible_;
+	bool is_hidden_ = false;
+	bool is_suspended_ = false;
+	bool is_occluded_ = false;
+	bool needs_update_ = true;
+	uint64_t content_version_ = 0;
+	uint64_t mirrored_version_ = 0;  // source's content_version() last composited by a mirror
+
+	OverlayState* source_;
+	// Mirrors of this overlay, they keep the view rendering while any of them is shown.
+	std::vector<OverlayState*> mirrors_;
+
+	OverlayState(const OverlayState&) = delete;
+	OverlayState& operator=(const OverlayState&) = delete;
+};
@@ -0,0 +1,129 @@
+#include "PhaseGraph.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+static double NowMs()
+{
+	return std::chrono::duration<double, std::milli>(
+		std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+PhaseGraph::PhaseGraph() : origin_(NowMs()) {}
+
+PhaseGraph::Phase PhaseGraph::Add(const char* name, std::function<void()> fn,
+	std::initializer_list<Phase> deps, bool main_thread)
+{
+	Node node;
+	node.fn = fn;
+	node.deps.assign(deps.begin(), deps.end());
+	nodes_.push_back(node);
+
+	PhaseTiming timing;
+	timing.name = name;
+	timing.main_thread = main_thread;
+	timings_.push_back(timing);
+
+	return nodes_.size() - 1;
+}
+
+void PhaseGraph::RunPhase(Phase phase)
+{
+	timings_[phase].start_ms = Elapsed();
+	nodes_[phase].fn();
+	timings_[phase].end_ms = Elapsed();
+}
+
+void PhaseGraph::Run(bool parallel)
+{
+	if (!parallel) {
+		for (Phase i = 0; i < nodes_.size(); i++) {
+			timings_[i].main_thread = true;
+			RunPhase(i);
+			nodes_[i].finished = true;
+		}
+		return;
+	}
+
+	std::mutex mutex;
+	std::condition_variable finished;
+	std::vector<std::thread> threads;
+	size_t remaining = nodes_.size();
+
+	std::unique_lock<std::mutex> lock(mutex);
+	while (remaining) {
+		// Start every ready worker phase before blocking this thread on a main thread phase.
+		Phase main_phase = nodes_.size();
+		for (Phase i = 0; i < nodes_.size(); i++) {
+			if (nodes_[i].started || !IsReady(i))
+				continue;
+
+			if (timings_[i].main_thread) {
+				if (main_phase == nodes_.size())
+					main_phase = i;
+				continue;
+			}
+
+			nodes_[i].started = true;
+			threads.emplace_back([this, i, &mutex, &finished, &remaining]() {
+				RunPhase(i);
+				std::lock_guard<std::mutex> guard(mutex);
+				nodes_[i].finished = true;
+				remaining--;
+				finished.notify_one();
+			});
+		}
+
+		if (main_phase != nodes_.size()) {
+			nodes_[main_phase].started = true;
+			lock.unlock();
+			RunPhase(main_phase);
+			lock.lock();
+			nodes_[main_phase].finished = true;
+			remaining--;
+		}
+		else if (remaining) {
+			finished.wait(lock);
+		}
+	}
+	lock.unlock();
+
+	for (auto& thread : threads)
+		thread.join();
+}
+
+bool PhaseGraph::IsReady(Phase phase) const
+{
+	for (Phase dep : nodes_[phase].deps) {
+		if (!nodes_[dep].finished)
+			return false;
+	}
+
+	return true;
+}
+
+double PhaseGraph::Elapsed() const
+{
+	return NowMs() - origin_;
+}
+
+std::string PhaseGraph::Report() const
+{
+	std::ostringstream report;
+	report << std::fixed << std::setprecision(2);
+
+	double end_ms = 0;
+	for (auto& timing : timings_) {
+		report << timing.name << ": " << timing.start_ms << " - " << timing.end_ms << " ms"
+			<< (timing.main_thread ? " (main)" : "") << "\n";
+		if (timing.end_ms > end_ms)
+			end_ms = timing.end_ms;
+	}
+
+	report << "total: " << end_ms << " ms";
+	return report.str();
+}
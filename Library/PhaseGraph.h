@@ -0,0 +1,56 @@
+#pragma once
+#include <stdint.h>
+#include <functional>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+struct PhaseTiming {
+	std::string name;
+	double start_ms = 0;  // since the graph was created
+	double end_ms = 0;
+	bool main_thread = false;
+};
+
+// Startup work split into named phases with dependencies, timed as they run.
+//
+// Phases run after every phase they depend on finished. Serially they run in Add order on the
+// calling thread, in parallel each ready phase gets its own thread while the calling thread
+// runs the main thread phases (window, DPI and platform setup) as soon as they are ready.
+// Dependencies must be added first, so Add order is always a valid serial order.
+class PhaseGraph {
+public:
+	typedef size_t Phase;
+
+	PhaseGraph();
+
+	Phase Add(const char* name, std::function<void()> fn, std::initializer_list<Phase> deps = {},
+		bool main_thread = false);
+
+	// Run all phases and return once they finished.
+	void Run(bool parallel);
+
+	const std::vector<PhaseTiming>& timings() const { return timings_; }
+
+	// Milliseconds since the graph was created.
+	double Elapsed() const;
+
+	// One line per phase: "name: start - end ms (main)", followed by the total.
+	std::string Report() const;
+
+protected:
+	struct Node {
+		std::function<void()> fn;
+		std::vector<Phase> deps;
+		bool started = false;
+		bool finished = false;
+	};
+
+	bool IsReady(Phase phase) const;
+
+	void RunPhase(Phase phase);
+
+	std::vector<Node> nodes_;
+	std::vector<PhaseTiming> timings_;
+	double origin_;
+};
@@ -0,0 +1,120 @@
+#include "ViewPool.h"
+
+#include <chrono>
+#include <sstream>
+
+ViewPool::ViewPool(Factory factory, const ViewConfig& config, uint32_t capacity, uint32_t width,
+	uint32_t height, const String& template_url) :
+	factory_(factory), config_(config), capacity_(capacity), width_(width), height_(height),
+	template_url_(template_url.empty() ? String("about:blank") : template_url) {
+	views_.reserve(capacity);
+}
+
+void ViewPool::Refill()
+{
+	if (views_.size() >= capacity_)
+		return;
+
+	views_.push_back(CreateView(width_, height_));
+	stats_.created++;
+}
+
+RefPtr<View> ViewPool::Claim(uint32_t width, uint32_t height, const ViewConfig& config,
+	bool& pooled)
+{
+	auto start = std::chrono::steady_clock::now();
+	stats_.claims++;
+
+	RefPtr<View> view;
+	pooled = IsCompatible(config);
+	bool hit = pooled && !views_.empty();
+
+	if (hit) {
+		view = views_.back();
+		views_.pop_back();
+
+		if (view->width() != width || view->height() != height)
+			view->Resize(width, height);
+	}
+	else {
+		view = factory_(width, height, config);
+	}
+
+	if (pooled)
+		claimed_.insert(view.get());
+
+	double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+		.count();
+
+	if (hit) {
+		stats_.hits++;
+		stats_.hit_claim_ms += ms;
+	}
+	else {
+		stats_.misses++;
+		stats_.miss_claim_ms += ms;
+	}
+
+	return view;
+}
+
+void ViewPool::Recycle(RefPtr<View> view)
+{
+	// Someone else's view, its listeners and page are not ours to reset.
+	if (!claimed_.erase(view.get())) {
+		stats_.ignored++;
+		return;
+	}
+
+	// The listeners belong to the last owner and may be gone, nothing may reach them from here
+	// on, not even the template page load below.
+	view->set_view_listener(nullptr);
+	view->set_load_listener(nullptr);
+	view->set_download_listener(nullptr);
+	view->set_network_listener(nullptr);
+
+	if (views_.size() >= capacity_) {
+		stats_.dropped++;
+		return;
+	}
+
+	// Drop everything else the last overlay left behind: page state, focus, scale and a
+	// suspended display.
+	view->Stop();
+	view->Unfocus();
+	view->set_device_scale(config_.initial_device_scale);
+	view->set_display_id(display_id_);
+	view->LoadURL(template_url_);
+
+	views_.push_back(view);
+	stats_.recycled++;
+}
+
+bool ViewPool::IsCompatible(const ViewConfig& config) const
+{
+	return capacity_ && config.is_accelerated == config_.is_accelerated
+		&& config.is_transparent == config_.is_transparent
+		&& config.initial_device_scale == config_.initial_device_scale
+		&& config.enable_images == config_.enable_images
+		&& config.enable_javascript == config_.enable_javascript
+		&& config.enable_compositor == config_.enable_compositor;
+}
+
+std::string ViewPool::Report() const
+{
+	std::ostringstream info;
+	info << "View pool: " << stats_.hits << " of " << stats_.claims << " claims served from "
+		<< views_.size() << "/" << capacity_ << " pooled views, "
+		<< (stats_.hits ? stats_.hit_claim_ms / stats_.hits : 0.0) << " ms per hit vs "
+		<< (stats_.misses ? stats_.miss_claim_ms / stats_.misses : 0.0) << " ms per miss; "
+		<< stats_.recycled << " recycled, " << stats_.dropped << " dropped";
+	return info.str();
+}
+
+RefPtr<View> ViewPool::CreateView(uint32_t width, uint32_t height)
+{
+	RefPtr<View> view = factory_(width, height, config_);
+	display_id_ = view->display_id();
+	view->LoadURL(template_url_);
+	return view;
+}
@@ -0,0 +1,69 @@
+#pragma once
+#include <Ultralight/View.h>
+#include <functional>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace ultralight;
+
+struct ViewPoolStats {
+	uint32_t claims = 0;
+	uint32_t hits = 0;        // served from the pool
+	uint32_t misses = 0;      // pool empty or incompatible config, a view was created on demand
+	uint32_t created = 0;     // by Refill
+	uint32_t recycled = 0;
+	uint32_t dropped = 0;     // given back while the pool was full
+	uint32_t ignored = 0;     // given back but never handed out by Claim
+	double hit_claim_ms = 0;  // total claim time of hits and misses
+	double miss_claim_ms = 0;
+};
+
+// Views created ahead of time so overlays don't pay for view construction, JS context setup
+// and loading the template page when they are created.
+//
+// The pool is refilled one view per frame and views are given back when their overlay is
+// destroyed. Only claims whose ViewConfig matches the pool's are served, others get a new view.
+class ViewPool {
+public:
+	// Creates a view, Renderer::CreateView in the app.
+	typedef std::function<RefPtr<View>(uint32_t width, uint32_t height, const ViewConfig& config)>
+		Factory;
+
+	ViewPool(Factory factory, const ViewConfig& config, uint32_t capacity, uint32_t width,
+		uint32_t height, const String& template_url);
+
+	// Create one view if the pool isn't full, call once per frame.
+	void Refill();
+
+	// A pooled view resized to width x height, or a new one. pooled is set if the view may be
+	// given back with Recycle.
+	RefPtr<View> Claim(uint32_t width, uint32_t height, const ViewConfig& config, bool& pooled);
+
+	// Give back a view from Claim. Its listeners are cleared, then it is reset to the template
+	// page or dropped if the pool is full. Views the pool didn't hand out are left alone.
+	void Recycle(RefPtr<View> view);
+
+	bool IsCompatible(const ViewConfig& config) const;
+
+	size_t available() const { return views_.size(); }
+
+	const ViewPoolStats& stats() const { return stats_; }
+
+	// One line with the stats and average claim times.
+	std::string Report() const;
+
+protected:
+	RefPtr<View> CreateView(uint32_t width, uint32_t height);
+
+	Factory factory_;
+	ViewConfig config_;
+	uint32_t capacity_;
+	uint32_t width_;
+	uint32_t height_;
+	String template_url_;
+	uint32_t display_id_ = 0;
+	std::vector<RefPtr<View>> views_;
+	std::set<View*> claimed_;  // handed out by Claim and not recycled yet
+	ViewPoolStats stats_;
+};
@@ -4,6 +4,11 @@
 #include <tchar.h>
 #include <windowsx.h>
 #include <dwmapi.h>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+
+#include <Ultralight/platform/Platform.h>
 
 #include "Application.h"
 #include "DIBSurface.h"
@@ -12,6 +17,9 @@
 
 #include "gpu/GPUDriver.h"
 #include "gpu/GPUContext.h"
+#include "gpu/SnapshotCodec.h"
+#include "helpers/FileSystemHelpers.h"
+#include "helpers/LogHelpers.h"
 
 #pragma comment (lib, "Dwmapi.lib")
 
@@ -58,6 +66,7 @@ static LRESULT CALLBACK WndProc(HWND hWnd, UINT message, WPARAM wParam, LPARAM l
 			WINDOW()->OnChangeDPI(fscale, (RECT*)lParam);
 			InvalidateRect(hWnd, nullptr, false);
 		}
+		break;
 	}
 	case WM_EXITSIZEMOVE:
 		WINDOWDATA()->is_resizing_modal = false;
@@ -137,6 +146,10 @@ static LRESULT CALLBACK WndProc(HWND hWnd, UINT message, WPARAM wParam, LPARAM l
 			{ ScrollEvent::kType_ScrollByPixel, 0,
 			  static_cast<int>(WINDOW()->PixelsToScreen(GET_WHEEL_DELTA_WPARAM(wParam)) * 0.8) });
 		break;
+	case WM_DISPLAYCHANGE:
+		if (WINDOWDATA())
+			WINDOW()->monitor()->UpdateRefreshRate();
+		return DefWindowProc(hWnd, message, wParam, lParam);
 	case WM_SETFOCUS:
 		WINDOW()->SetWindowFocused(true);
 		break;
@@ -254,6 +267,7 @@ Window::Window(Monitor* monitor, uint32_t width, uint32_t height, bool fullscree
 	is_accelerated_ = false;
 
 	assert(Application::instance());
+	SetRenderBudget(Application::instance()->settings().window_render_budget_ms);
 
 	auto gpu_context = Application::instance()->gpu_context();
 	auto gpu_driver = Application::instance()->gpu_driver();
@@ -273,6 +287,15 @@ Window::Window(Monitor* monitor, uint32_t width, uint32_t height, bool fullscree
 		}
 	}
 
+	// Windows are told apart by creation order, apps create theirs the same way every start.
+	if (Application::instance()->settings().window_snapshots && is_accelerated_) {
+		std::ostringstream name;
+		name << "window-" << Application::instance()->windows_.size() << ".snapshot";
+		snapshot_path_ = FileSystemHelpers::AppendPath(Application::instance()->cache_path(),
+			name.str().c_str());
+		ShowSnapshot();
+	}
+
 	Application::instance()->AddWindow(this);
 }
 
@@ -297,6 +320,33 @@ Window::~Window()
 	}
 }
 
+void Window::UpdateClickThrough()
+{
+	// Layered windows already pass clicks through pixels with zero alpha, only a threshold needs
+	// the mask. WS_EX_TRANSPARENT cuts the window off from mouse messages (HTTRANSPARENT would
+	// only reach windows of this thread), so it is toggled from the polled cursor position.
+	const Settings& settings = Application::instance()->settings();
+	bool click_through = false;
+
+	if (settings.alpha_hit_testing && settings.hit_test_alpha_threshold > 0
+		&& GetCapture() != hwnd_) {
+		POINT pt;
+		RECT client;
+		if (GetCursorPos(&pt) && ScreenToClient(hwnd_, &pt) && GetClientRect(hwnd_, &client)
+			&& PtInRect(&client, pt))
+			click_through = !IsHitAt(pt.x, pt.y);
+	}
+
+	if (click_through == is_click_through_)
+		return;
+
+	is_click_through_ = click_through;
+	if (click_through)
+		AddWindowExStyle(WS_EX_TRANSPARENT);
+	else
+		RemoveWindowExStyle(WS_EX_TRANSPARENT);
+}
+
 void Window::AddWindowExStyle(LONG_PTR flag)
 {
 	LONG_PTR style = GetWindowLongPtr(hwnd_, GWL_EXSTYLE);
@@ -426,16 +476,17 @@ bool Window::is_visible() const { return IsWindowVisible(hwnd_); }
 
 void Window::Close() { DestroyWindow(hwnd_); }
 
-void Window::DrawSurface(int x, int y, Surface* surface) {
+void Window::DrawSurface(int x, int y, Surface* surface, float opacity) {
 	DIBSurface* dibSurface = static_cast<DIBSurface*>(surface);
-	PaintLayeredWindow(dibSurface->dc());
+	PaintLayeredWindow(dibSurface->dc(), opacity);
 }
 
 void Window::Paint()
 {
 	if (!is_accelerated()) {
-		OverlayManager::Render();
+		OverlayManager::Render(width(), height());
 		OverlayManager::Paint();
+		Application::instance()->OnFirstFrame();
 		return;
 	}
 
@@ -443,36 +494,67 @@ void Window::Paint()
 	auto gpu_driver = Application::instance()->gpu_driver();
 
 	gpu_driver->BeginSynchronize();
-	OverlayManager::Render();
+	OverlayManager::Render(width(), height());
 	gpu_driver->EndSynchronize();
 
 	if (gpu_driver->HasCommandsPending() || OverlayManager::NeedsRepaint()
 		|| window_needs_repaint_) {
-		gpu_driver->ClearRenderBuffer(swap_chain_->render_buffer_id());
-		
 		gpu_context->BeginDrawing();
-		
+
+		// Skipped by the driver when it would redraw the same pixels.
 		gpu_driver->DrawCommandList();
-		OverlayManager::Paint();
+
+		// Same quads over the same contents as the last present, the window is already up to date.
+		if (window_needs_repaint_)
+			present_reuse_.Invalidate();
+
+		uint64_t signature = HashValue(gpu_driver->content_generation(),
+			OverlayManager::PrepareComposite());
+		bool present = !present_reuse_.Matches(signature);
+
+		if (present) {
+			gpu_driver->ClearRenderBuffer(swap_chain_->render_buffer_id());
+			OverlayManager::Composite(gpu_driver, swap_chain_->render_buffer_id(), width(), height());
+		}
 
 		gpu_context->EndDrawing();
 
-		PaintLayeredWindow(swap_chain_->GetDC());
-		swap_chain_->ReleaseDC();
+		if (present) {
+			PaintLayeredWindow(swap_chain_->GetDC());
+			swap_chain_->ReleaseDC();
 
-		if (is_first_paint_)
-			is_first_paint_ = false;
+			if (is_first_paint_) {
+				is_first_paint_ = false;
+				Application::instance()->OnFirstFrame();
+			}
+		}
 	}
 
+	// Also picks up readbacks requested on earlier frames when nothing was drawn.
+	OverlayManager::UpdateHitMasks();
+
 	window_needs_repaint_ = false;
 }
 
-void Window::PaintLayeredWindow(HDC dc)
+void Window::LogStats() const
+{
+	if (is_accelerated()) {
+		std::ostringstream info;
+		info << "Window presents: " << (int)(present_reuse_.skip_ratio() * 100) << "% of "
+			<< present_reuse_.frames() << " skipped";
+		UL_LOG_INFO(info.str().c_str());
+	}
+
+	OverlayManager::LogStats();
+}
+
+void Window::PaintLayeredWindow(HDC dc, float opacity)
 {
 	PAINTSTRUCT ps;
 	BeginPaint(hwnd(), &ps);
 
-	BLENDFUNCTION blendPixelFunction = { AC_SRC_OVER, 0, (BYTE)255, AC_SRC_ALPHA };
+	opacity = opacity < 0.0f ? 0.0f : (opacity > 1.0f ? 1.0f : opacity);
+	BLENDFUNCTION blendPixelFunction = { AC_SRC_OVER, 0, (BYTE)(opacity * 255.0f + 0.5f), AC_SRC_ALPHA };
 	POINT ptWindowScreenPosition = { x(), y() };
 	POINT ptSrc = { 0 };
 	SIZE szWindow = { width(), height() };
@@ -490,6 +572,86 @@ void Window::PaintLayeredWindow(HDC dc)
 	EndPaint(hwnd(), &ps);
 }
 
+// A 32-bit top-down DIB section selected into a memory DC.
+struct SnapshotBitmap {
+	SnapshotBitmap(uint32_t width, uint32_t height) {
+		BITMAPINFO bmi = {};
+		bmi.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
+		bmi.bmiHeader.biWidth = (LONG)width;
+		bmi.bmiHeader.biHeight = -(LONG)height;
+		bmi.bmiHeader.biPlanes = 1;
+		bmi.bmiHeader.biBitCount = 32;
+		bmi.bmiHeader.biCompression = BI_RGB;
+
+		dc = CreateCompatibleDC(NULL);
+		bitmap = CreateDIBSection(dc, &bmi, DIB_RGB_COLORS, &bits, NULL, 0);
+		if (bitmap)
+			old_bitmap = SelectObject(dc, bitmap);
+	}
+
+	~SnapshotBitmap() {
+		if (bitmap) {
+			SelectObject(dc, old_bitmap);
+			DeleteObject(bitmap);
+		}
+		DeleteDC(dc);
+	}
+
+	HDC dc;
+	HBITMAP bitmap;
+	HGDIOBJ old_bitmap = NULL;
+	void* bits = nullptr;
+};
+
+bool Window::ShowSnapshot()
+{
+	std::ifstream file(snapshot_path_.utf16().data(), std::ios::binary);
+	if (!file)
+		return false;
+
+	std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+	uint32_t snapshot_width, snapshot_height;
+	std::vector<uint8_t> pixels;
+	if (!DecodeSnapshot(data.data(), data.size(), snapshot_width, snapshot_height, pixels)
+		|| snapshot_width != width() || snapshot_height != height())
+		return false;
+
+	SnapshotBitmap bitmap(snapshot_width, snapshot_height);
+	if (!bitmap.bitmap)
+		return false;
+
+	memcpy(bitmap.bits, pixels.data(), pixels.size());
+	GdiFlush();
+	PaintLayeredWindow(bitmap.dc);
+	return true;
+}
+
+bool Window::SaveSnapshot()
+{
+	uint32_t snapshot_width = width();
+	uint32_t snapshot_height = height();
+	if (!swap_chain_ || snapshot_path_.empty() || !snapshot_width || !snapshot_height)
+		return false;
+
+	SnapshotBitmap bitmap(snapshot_width, snapshot_height);
+	if (!bitmap.bitmap)
+		return false;
+
+	// The back buffer is never flipped, it still holds the last composited frame.
+	BitBlt(bitmap.dc, 0, 0, snapshot_width, snapshot_height, swap_chain_->GetDC(), 0, 0, SRCCOPY);
+	swap_chain_->ReleaseDC();
+	GdiFlush();
+
+	std::vector<uint8_t> data;
+	EncodeSnapshot((const uint8_t*)bitmap.bits, snapshot_width, snapshot_height, snapshot_width * 4,
+		data);
+
+	std::ofstream file(snapshot_path_.utf16().data(), std::ios::binary | std::ios::trunc);
+	file.write((const char*)data.data(), data.size());
+	return file.good();
+}
+
 void Window::FireKeyEvent(const ultralight::KeyEvent& evt)
 {
 	OverlayManager::FireKeyEvent(evt);
@@ -508,14 +670,22 @@ void Window::FireScrollEvent(const ultralight::ScrollEvent& evt)
 void Window::OnClose() {
 	// Keep window alive in case user-callbacks release our reference.
 	RefPtr<Window> retain(this);
+
+	// Nothing worth restoring was presented yet.
+	if (!is_first_paint_)
+		SaveSnapshot();
 }
 
 void Window::OnResize(uint32_t width, uint32_t height) {
 	// Keep window alive in case user-callbacks release our reference.
 	RefPtr<Window> retain(this);
 
+	// Buffers only grow while the user drags, WM_EXITSIZEMOVE fits them exactly.
 	if (swap_chain_)
-		swap_chain_->Resize(width, height);
+		swap_chain_->Resize(width, height, window_data_.is_resizing_modal);
+
+	// The resized buffers are blank, or at least hold a crop of the old size.
+	window_needs_repaint_ = true;
 }
 
 void Window::OnChangeDPI(double scale, const RECT* suggested_rect) {
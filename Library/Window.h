@@ -10,7 +10,9 @@
 #include <Ultralight/platform/Surface.h>
 #include <Ultralight/RefPtr.h>
 #include <Ultralight/ScrollEvent.h>
+#include <Ultralight/String.h>
 
+#include "gpu/FrameReuse.h"
 #include "gpu/SwapChain.h"
 #include "Monitor.h"
 #include "OverlayManager.h"
@@ -51,6 +53,8 @@ public:
 
 	virtual double scale() const { return scale_; }
 
+	virtual Monitor* monitor() const { return monitor_; }
+
 	virtual void MoveTo(int x, int y);
 
 	virtual void MoveToCenter();
@@ -75,13 +79,22 @@ public:
 
 	virtual int PixelsToScreen(int val) const { return (int)round(val / scale()); }
 
-	virtual void DrawSurface(int x, int y, Surface* surface);
+	virtual void DrawSurface(int x, int y, Surface* surface, float opacity = 1.0f);
 
 	virtual OverlayManager* overlay_manager() const { return const_cast<Window*>(this); }
 
 	// Inherited from OverlayManager
 	virtual void Paint() override;
 
+	virtual bool NeedsRepaint() override {
+		return window_needs_repaint_ || OverlayManager::NeedsRepaint();
+	}
+
+	// How often Paint found nothing new to present.
+	virtual const FrameReuse& present_reuse() const { return present_reuse_; }
+
+	virtual void LogStats() const override;
+
 	virtual void FireKeyEvent(const ultralight::KeyEvent& evt) override;
 
 	virtual void FireMouseEvent(const ultralight::MouseEvent& evt) override;
@@ -100,8 +113,18 @@ public:
 		window_needs_repaint_ = true;
 	}
 
-	// For now let's support opaque windows. We'll support transparency going forward when implementing fade and stuff.
-	void PaintLayeredWindow(HDC dc);
+	// Push dc's per-pixel alpha contents to the layered window, opacity fades all of it.
+	void PaintLayeredWindow(HDC dc, float opacity = 1.0f);
+
+	// Show the frame this window presented last time the app ran, if it still has the same size.
+	bool ShowSnapshot();
+
+	// Save the last presented frame for ShowSnapshot (GPU path only).
+	bool SaveSnapshot();
+
+	// Let mouse input through to the windows below while the cursor is over pixels at or below
+	// the hit test alpha threshold, call once per frame.
+	void UpdateClickThrough();
 
 	REF_COUNTED_IMPL(Window);
 protected:
@@ -116,6 +139,8 @@ protected:
 
 	bool is_first_paint_ = true;
 	bool window_needs_repaint_ = false;
+	bool is_click_through_ = false;
+	FrameReuse present_reuse_;
 	Monitor* monitor_;
 	double scale_;
 	bool is_fullscreen_;
@@ -134,6 +159,7 @@ protected:
 	DWORD style_;
 
 	std::unique_ptr<SwapChainD3D11> swap_chain_;
+	String snapshot_path_;
 
 	friend class Application;
 	friend class Overlay;
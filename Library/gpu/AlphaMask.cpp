@@ -0,0 +1,113 @@
+#include "AlphaMask.h"
+
+#include <string.h>
+
+#if defined(_M_X64) || defined(_M_AMD64) || defined(__SSE2__)
+#include <emmintrin.h>
+#define ALPHA_MASK_SSE2 1
+#endif
+
+void AlphaMask::Resize(uint32_t width, uint32_t height)
+{
+	width_ = width;
+	height_ = height;
+	cells_x_ = (width + kCellSize - 1) / kCellSize;
+	cells_y_ = (height + kCellSize - 1) / kCellSize;
+	cells_.assign((size_t)cells_x_ * cells_y_, 0xFF);
+}
+
+void AlphaMask::Update(const uint8_t* pixels, uint32_t row_bytes, int left, int top, int right,
+	int bottom)
+{
+	if (left < 0)
+		left = 0;
+	if (top < 0)
+		top = 0;
+	if (right > (int)width_)
+		right = (int)width_;
+	if (bottom > (int)height_)
+		bottom = (int)height_;
+	if (left >= right || top >= bottom)
+		return;
+
+	// Cells are rebuilt whole, including the pixels just outside the dirty rect.
+	uint32_t first_cell = left / kCellSize;
+	uint32_t last_cell = (right + kCellSize - 1) / kCellSize;
+
+	for (uint32_t cy = top / kCellSize; cy * kCellSize < (uint32_t)bottom; cy++) {
+		uint32_t y = cy * kCellSize;
+		uint32_t rows = height_ - y < kCellSize ? height_ - y : kCellSize;
+
+		UpdateRow(pixels + (size_t)y * row_bytes, row_bytes, rows, first_cell, last_cell,
+			&cells_[(size_t)cy * cells_x_]);
+	}
+}
+
+void AlphaMask::UpdateRow(const uint8_t* pixels, uint32_t row_bytes, uint32_t rows,
+	uint32_t first_cell, uint32_t last_cell, uint8_t* out)
+{
+	uint32_t cx = first_cell;
+
+	// A cell is exactly one 16 byte vector wide: take the max of its rows, then reduce the four
+	// alpha bytes. Four cells are packed together so each group stores 4 bytes at once.
+#ifdef ALPHA_MASK_SSE2
+	uint32_t full_cells = width_ / kCellSize;
+	uint32_t simd_end = last_cell < full_cells ? last_cell : full_cells;
+
+	for (; cx + 4 <= simd_end; cx += 4) {
+		__m128i alpha[4];
+		for (uint32_t i = 0; i < 4; i++) {
+			const uint8_t* src = pixels + (size_t)(cx + i) * kCellSize * 4;
+			__m128i m = _mm_loadu_si128((const __m128i*)src);
+			for (uint32_t r = 1; r < rows; r++)
+				m = _mm_max_epu8(m, _mm_loadu_si128((const __m128i*)(src + (size_t)r * row_bytes)));
+			alpha[i] = _mm_srli_epi32(m, 24);
+		}
+
+		// 16 alpha bytes, four per cell.
+		__m128i packed = _mm_packus_epi16(_mm_packs_epi32(alpha[0], alpha[1]),
+			_mm_packs_epi32(alpha[2], alpha[3]));
+		packed = _mm_max_epu8(packed, _mm_srli_epi32(packed, 8));
+		packed = _mm_max_epu8(packed, _mm_srli_epi32(packed, 16));
+		packed = _mm_and_si128(packed, _mm_set1_epi32(0xFF));
+		packed = _mm_packus_epi16(_mm_packs_epi32(packed, packed), packed);
+
+		int result = _mm_cvtsi128_si32(packed);
+		memcpy(out + cx, &result, 4);
+	}
+#endif
+
+	for (; cx < last_cell; cx++) {
+		uint32_t x = cx * kCellSize;
+		uint32_t columns = width_ - x < kCellSize ? width_ - x : kCellSize;
+
+		uint8_t max_alpha = 0;
+		for (uint32_t r = 0; r < rows; r++) {
+			const uint8_t* src = pixels + (size_t)r * row_bytes + (size_t)x * 4;
+			for (uint32_t c = 0; c < columns; c++) {
+				if (src[c * 4 + 3] > max_alpha)
+					max_alpha = src[c * 4 + 3];
+			}
+		}
+
+		out[cx] = max_alpha;
+	}
+
+	updated_cells_ += last_cell - first_cell;
+}
+
+void AlphaMask::SetCells(const uint8_t* cells, uint32_t row_bytes)
+{
+	for (uint32_t cy = 0; cy < cells_y_; cy++)
+		memcpy(&cells_[(size_t)cy * cells_x_], cells + (size_t)cy * row_bytes, cells_x_);
+
+	updated_cells_ += cells_.size();
+}
+
+bool AlphaMask::Test(int x, int y, uint8_t threshold) const
+{
+	if (x < 0 || y < 0 || x >= (int)width_ || y >= (int)height_)
+		return false;
+
+	return cells_[(size_t)(y / kCellSize) * cells_x_ + x / kCellSize] > threshold;
+}
@@ -0,0 +1,44 @@
+#pragma once
+#include <stdint.h>
+#include <vector>
+
+// Downsampled alpha of an overlay for hit testing, one byte per kCellSize x kCellSize block
+// holding the largest alpha inside it. A point is click-through only if its whole cell is.
+//
+// Cells start opaque so the overlay keeps receiving input until its first update.
+class AlphaMask {
+public:
+	static const uint32_t kCellSize = 4;
+
+	// Size in pixels, resets every cell to opaque.
+	void Resize(uint32_t width, uint32_t height);
+
+	// Rebuild the cells overlapping [left, right) x [top, bottom) from 32-bit BGRA pixels.
+	void Update(const uint8_t* pixels, uint32_t row_bytes, int left, int top, int right,
+		int bottom);
+
+	// Replace every cell with an already downsampled alpha plane, eg, read back from the GPU.
+	void SetCells(const uint8_t* cells, uint32_t row_bytes);
+
+	// Returns true if the cell under x, y has an alpha above threshold. Points outside the mask
+	// never hit.
+	bool Test(int x, int y, uint8_t threshold) const;
+
+	uint32_t width() const { return width_; }
+	uint32_t height() const { return height_; }
+	uint32_t cells_x() const { return cells_x_; }
+	uint32_t cells_y() const { return cells_y_; }
+
+	uint64_t updated_cells() const { return updated_cells_; }
+
+protected:
+	void UpdateRow(const uint8_t* pixels, uint32_t row_bytes, uint32_t rows, uint32_t first_cell,
+		uint32_t last_cell, uint8_t* out);
+
+	uint32_t width_ = 0;
+	uint32_t height_ = 0;
+	uint32_t cells_x_ = 0;
+	uint32_t cells_y_ = 0;
+	std::vector<uint8_t> cells_;
+	uint64_t updated_cells_ = 0;
+};
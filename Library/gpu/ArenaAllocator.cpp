@@ -0,0 +1,118 @@
+#include "ArenaAllocator.h"
+
+#include <iterator>
+
+ArenaAllocator::ArenaAllocator(uint32_t capacity) : capacity_(capacity)
+{
+	if (capacity)
+		AddFreeBlock(0, capacity);
+}
+
+bool ArenaAllocator::Allocate(uint32_t size, uint32_t& offset)
+{
+	if (!size)
+		return false;
+
+	auto best = free_by_size_.lower_bound(size);
+	if (best == free_by_size_.end())
+		return false;
+
+	offset = best->second;
+	uint32_t block_size = best->first;
+	RemoveFreeBlock(free_by_offset_.find(offset));
+
+	if (block_size > size)
+		AddFreeBlock(offset + size, block_size - size);
+
+	allocations_[offset] = size;
+	used_ += size;
+	return true;
+}
+
+void ArenaAllocator::Free(uint32_t offset)
+{
+	auto i = allocations_.find(offset);
+	if (i == allocations_.end())
+		return;
+
+	uint32_t size = i->second;
+	allocations_.erase(i);
+	used_ -= size;
+
+	// Merge with the free blocks right after and right before.
+	auto next = free_by_offset_.find(offset + size);
+	if (next != free_by_offset_.end()) {
+		size += next->second;
+		RemoveFreeBlock(next);
+	}
+
+	auto prev = free_by_offset_.lower_bound(offset);
+	if (prev != free_by_offset_.begin()) {
+		--prev;
+		if (prev->first + prev->second == offset) {
+			offset = prev->first;
+			size += prev->second;
+			RemoveFreeBlock(prev);
+		}
+	}
+
+	AddFreeBlock(offset, size);
+}
+
+uint32_t ArenaAllocator::allocation_size(uint32_t offset) const
+{
+	auto i = allocations_.find(offset);
+	return i == allocations_.end() ? 0 : i->second;
+}
+
+void ArenaAllocator::Grow(uint32_t new_capacity)
+{
+	if (new_capacity <= capacity_)
+		return;
+
+	uint32_t offset = capacity_;
+	uint32_t size = new_capacity - capacity_;
+	capacity_ = new_capacity;
+
+	// Extend a free block that ends at the old capacity.
+	if (!free_by_offset_.empty()) {
+		auto last = std::prev(free_by_offset_.end());
+		if (last->first + last->second == offset) {
+			offset = last->first;
+			size += last->second;
+			RemoveFreeBlock(last);
+		}
+	}
+
+	AddFreeBlock(offset, size);
+}
+
+uint32_t ArenaAllocator::largest_free_block() const
+{
+	return free_by_size_.empty() ? 0 : free_by_size_.rbegin()->first;
+}
+
+double ArenaAllocator::fragmentation() const
+{
+	uint32_t free = capacity_ - used_;
+	return free ? 1.0 - (double)largest_free_block() / free : 0.0;
+}
+
+void ArenaAllocator::AddFreeBlock(uint32_t offset, uint32_t size)
+{
+	free_by_offset_[offset] = size;
+	free_by_size_.insert(std::make_pair(size, offset));
+}
+
+void ArenaAllocator::RemoveFreeBlock(std::map<uint32_t, uint32_t>::iterator block)
+{
+	auto range = free_by_size_.equal_range(block->second);
+	for (auto i = range.first; i != range.second; ++i) {
+		if (i->second == block->first) {
+			free_by_size_.erase(i);
+			break;
+		}
+	}
+
+	free_by_offset_.erase(block);
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include <stdint.h>
+#include <map>
+
+// Best-fit free-list suballocator for a linear range of elements (eg, vertices in a shared
+// vertex buffer). Neighbouring free blocks are merged on Free so churn doesn't shred the range.
+class ArenaAllocator {
+public:
+	explicit ArenaAllocator(uint32_t capacity = 0);
+
+	// Returns false if no free block is large enough, Grow() and try again.
+	bool Allocate(uint32_t size, uint32_t& offset);
+
+	void Free(uint32_t offset);
+
+	// Size of the allocation starting at |offset|, 0 if there is none.
+	uint32_t allocation_size(uint32_t offset) const;
+
+	// Extend the range, existing allocations keep their offsets.
+	void Grow(uint32_t new_capacity);
+
+	uint32_t capacity() const { return capacity_; }
+
+	uint32_t used() const { return used_; }
+
+	uint32_t allocation_count() const { return (uint32_t)allocations_.size(); }
+
+	uint32_t largest_free_block() const;
+
+	// 0 when all free space is one block, approaching 1 as it splinters.
+	double fragmentation() const;
+
+protected:
+	void AddFreeBlock(uint32_t offset, uint32_t size);
+	void RemoveFreeBlock(std::map<uint32_t, uint32_t>::iterator block);
+
+	uint32_t capacity_;
+	uint32_t used_ = 0;
+	std::map<uint32_t, uint32_t> free_by_offset_;       // offset -> size
+	std::multimap<uint32_t, uint32_t> free_by_size_;    // size -> offset
+	std::map<uint32_t, uint32_t> allocations_;          // offset -> size
+};
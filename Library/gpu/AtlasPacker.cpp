@@ -0,0 +1,308 @@
+#include "AtlasPacker.h"
+
+#include <algorithm>
+
+SkylinePacker::SkylinePacker(uint32_t width, uint32_t height) : width_(width), height_(height)
+{
+	Reset();
+}
+
+void SkylinePacker::Reset()
+{
+	skyline_.clear();
+	skyline_.push_back({ 0, 0, width_ });
+	extent_width_ = 0;
+	extent_height_ = 0;
+	used_area_ = 0;
+}
+
+uint32_t SkylinePacker::Fit(size_t index, uint32_t width, uint32_t height) const
+{
+	if (skyline_[index].x + width > width_)
+		return UINT32_MAX;
+
+	uint32_t y = skyline_[index].y;
+	uint32_t remaining = width;
+
+	for (size_t i = index; remaining > 0; i++) {
+		if (i >= skyline_.size())
+			return UINT32_MAX;
+
+		y = std::max(y, skyline_[i].y);
+		if (y + height > height_)
+			return UINT32_MAX;
+
+		if (skyline_[i].width >= remaining)
+			break;
+
+		remaining -= skyline_[i].width;
+	}
+
+	return y;
+}
+
+bool SkylinePacker::Insert(uint32_t width, uint32_t height, uint32_t& x, uint32_t& y)
+{
+	if (!width || !height)
+		return false;
+
+	size_t best_index = skyline_.size();
+	uint32_t best_side = UINT32_MAX;
+	uint64_t best_area = UINT64_MAX;
+	uint32_t best_bottom = UINT32_MAX;
+	uint32_t best_width = UINT32_MAX;
+	uint32_t best_y = 0;
+
+	// Prefer the spot that keeps the bounding box closest to square, then smallest, then
+	// the one that keeps the skyline lowest, then the narrowest segment.
+	for (size_t i = 0; i < skyline_.size(); i++) {
+		uint32_t fit_y = Fit(i, width, height);
+		if (fit_y == UINT32_MAX)
+			continue;
+
+		uint32_t bottom = fit_y + height;
+		uint32_t extent_width = std::max(extent_width_, skyline_[i].x + width);
+		uint32_t extent_height = std::max(extent_height_, bottom);
+		uint32_t side = std::max(extent_width, extent_height);
+		uint64_t area = (uint64_t)extent_width * extent_height;
+
+		bool better = side != best_side ? side < best_side
+			: area != best_area ? area < best_area
+			: bottom != best_bottom ? bottom < best_bottom
+			: skyline_[i].width < best_width;
+		if (better) {
+			best_index = i;
+			best_side = side;
+			best_area = area;
+			best_bottom = bottom;
+			best_width = skyline_[i].width;
+			best_y = fit_y;
+		}
+	}
+
+	if (best_index == skyline_.size())
+		return false;
+
+	Node node = { skyline_[best_index].x, best_bottom, width };
+	skyline_.insert(skyline_.begin() + best_index, node);
+
+	// Trim the segments now covered by the new node.
+	for (size_t i = best_index + 1; i < skyline_.size();) {
+		uint32_t covered_to = skyline_[i - 1].x + skyline_[i - 1].width;
+		if (skyline_[i].x >= covered_to)
+			break;
+
+		uint32_t shrink = covered_to - skyline_[i].x;
+		if (skyline_[i].width <= shrink) {
+			skyline_.erase(skyline_.begin() + i);
+			continue;
+		}
+
+		skyline_[i].x += shrink;
+		skyline_[i].width -= shrink;
+		break;
+	}
+
+	// Merge neighbours at the same height.
+	for (size_t i = 0; i + 1 < skyline_.size();) {
+		if (skyline_[i].y == skyline_[i + 1].y) {
+			skyline_[i].width += skyline_[i + 1].width;
+			skyline_.erase(skyline_.begin() + i + 1);
+		}
+		else {
+			i++;
+		}
+	}
+
+	x = node.x;
+	y = best_y;
+	extent_width_ = std::max(extent_width_, x + width);
+	extent_height_ = std::max(extent_height_, best_bottom);
+	used_area_ += (uint64_t)width * height;
+
+	return true;
+}
+
+RenderTargetAtlas::RenderTargetAtlas(uint32_t max_page_size, uint32_t max_pages,
+	uint32_t max_region_size)
+	: max_page_size_(max_page_size), max_pages_(max_pages), max_region_size_(max_region_size)
+{
+}
+
+bool RenderTargetAtlas::Accepts(uint32_t width, uint32_t height) const
+{
+	return width && height && width <= max_region_size_ && height <= max_region_size_
+		&& width + 2 <= max_page_size_ && height + 2 <= max_page_size_;
+}
+
+bool RenderTargetAtlas::Allocate(uint32_t id, uint32_t width, uint32_t height,
+	std::vector<uint32_t>& moved)
+{
+	if (!Accepts(width, height))
+		return false;
+
+	auto i = regions_.find(id);
+	if (i != regions_.end()) {
+		if (i->second.width == width && i->second.height == height)
+			return true;
+
+		Free(id);
+	}
+
+	Region region;
+	if (Place(width, height, region)) {
+		regions_[id] = region;
+		live_regions_per_page_[region.page]++;
+		return true;
+	}
+
+	return Repack(id, width, height, moved);
+}
+
+void RenderTargetAtlas::Free(uint32_t id)
+{
+	auto i = regions_.find(id);
+	if (i == regions_.end())
+		return;
+
+	uint32_t page = i->second.page;
+	regions_.erase(i);
+
+	// Skyline can't reclaim holes, but an empty page can start over.
+	if (--live_regions_per_page_[page] == 0)
+		pages_[page].Reset();
+}
+
+const RenderTargetAtlas::Region* RenderTargetAtlas::Find(uint32_t id) const
+{
+	auto i = regions_.find(id);
+	if (i == regions_.end())
+		return nullptr;
+
+	return &i->second;
+}
+
+static uint32_t RoundUpToPageGranularity(uint32_t size, uint32_t max_size)
+{
+	uint32_t granularity = RenderTargetAtlas::kPageGranularity;
+	return std::min((size + granularity - 1) / granularity * granularity, max_size);
+}
+
+uint32_t RenderTargetAtlas::page_width(uint32_t page) const
+{
+	return RoundUpToPageGranularity(pages_[page].extent_width(), max_page_size_);
+}
+
+uint32_t RenderTargetAtlas::page_height(uint32_t page) const
+{
+	return RoundUpToPageGranularity(pages_[page].extent_height(), max_page_size_);
+}
+
+uint64_t RenderTargetAtlas::page_bytes() const
+{
+	uint64_t bytes = 0;
+	for (uint32_t page = 0; page < pages_.size(); page++)
+		bytes += AllocationBytes(page_width(page), page_height(page));
+
+	return bytes;
+}
+
+uint64_t RenderTargetAtlas::standalone_bytes() const
+{
+	uint64_t bytes = 0;
+	for (auto& i : regions_)
+		bytes += AllocationBytes(i.second.width, i.second.height);
+
+	return bytes;
+}
+
+uint64_t RenderTargetAtlas::AllocationBytes(uint32_t width, uint32_t height)
+{
+	uint64_t bytes = (uint64_t)width * height * 4;
+	return (bytes + kAllocationGranularity - 1) / kAllocationGranularity * kAllocationGranularity;
+}
+
+uint64_t RenderTargetAtlas::used_area() const
+{
+	uint64_t area = 0;
+	for (auto& i : regions_)
+		area += (uint64_t)i.second.width * i.second.height;
+
+	return area;
+}
+
+bool RenderTargetAtlas::Place(uint32_t width, uint32_t height, Region& region)
+{
+	uint32_t x, y;
+
+	for (uint32_t page = 0; page < pages_.size(); page++) {
+		if (pages_[page].Insert(width + 2, height + 2, x, y)) {
+			region = { page, x + 1, y + 1, width, height };
+			return true;
+		}
+	}
+
+	if (pages_.size() >= max_pages_)
+		return false;
+
+	pages_.push_back(SkylinePacker(max_page_size_, max_page_size_));
+	live_regions_per_page_.push_back(0);
+
+	if (!pages_.back().Insert(width + 2, height + 2, x, y))
+		return false;
+
+	region = { (uint32_t)pages_.size() - 1, x + 1, y + 1, width, height };
+	return true;
+}
+
+bool RenderTargetAtlas::Repack(uint32_t id, uint32_t width, uint32_t height,
+	std::vector<uint32_t>& moved)
+{
+	struct Item {
+		uint32_t id;
+		uint32_t width;
+		uint32_t height;
+	};
+
+	std::vector<Item> items;
+	items.reserve(regions_.size() + 1);
+	for (auto& i : regions_)
+		items.push_back({ i.first, i.second.width, i.second.height });
+	items.push_back({ id, width, height });
+
+	std::sort(items.begin(), items.end(), [](const Item& a, const Item& b) {
+		return a.height != b.height ? a.height > b.height : a.width > b.width;
+	});
+
+	auto old_pages = pages_;
+	auto old_live = live_regions_per_page_;
+	auto old_regions = regions_;
+
+	for (auto& page : pages_)
+		page.Reset();
+	std::fill(live_regions_per_page_.begin(), live_regions_per_page_.end(), 0);
+	regions_.clear();
+
+	for (auto& item : items) {
+		Region region;
+		if (!Place(item.width, item.height, region)) {
+			// Even a fresh pack doesn't fit, leave the atlas as it was.
+			pages_ = old_pages;
+			live_regions_per_page_ = old_live;
+			regions_ = old_regions;
+			return false;
+		}
+
+		regions_[item.id] = region;
+		live_regions_per_page_[region.page]++;
+	}
+
+	for (auto& i : old_regions) {
+		const Region& now = regions_[i.first];
+		if (now.page != i.second.page || now.x != i.second.x || now.y != i.second.y)
+			moved.push_back(i.first);
+	}
+
+	repack_count_++;
+	return true;
+}
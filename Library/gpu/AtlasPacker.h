@@ -0,0 +1,123 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <map>
+#include <vector>
+
+// Skyline rectangle packer for a single atlas page.
+//
+// Regions are placed where they keep the bounding box of everything packed so far small
+// and close to square, so a page's texture can be sized to that box instead of the whole page.
+// Regions can't be freed one by one, the owner keeps track of live regions and either
+// resets an empty page or repacks everything once the page gets too fragmented.
+class SkylinePacker {
+public:
+	SkylinePacker(uint32_t width, uint32_t height);
+
+	// Find a spot for a |width| x |height| region, returns false if the page is full.
+	bool Insert(uint32_t width, uint32_t height, uint32_t& x, uint32_t& y);
+
+	void Reset();
+
+	uint32_t width() const { return width_; }
+
+	uint32_t height() const { return height_; }
+
+	uint64_t used_area() const { return used_area_; }
+
+	// Bounding box of all inserted regions.
+	uint32_t extent_width() const { return extent_width_; }
+
+	uint32_t extent_height() const { return extent_height_; }
+
+protected:
+	struct Node {
+		uint32_t x;
+		uint32_t y;
+		uint32_t width;
+	};
+
+	// Returns the lowest y a region of |width| x |height| fits at when placed on node |index|,
+	// or UINT32_MAX if it doesn't fit.
+	uint32_t Fit(size_t index, uint32_t width, uint32_t height) const;
+
+	uint32_t width_;
+	uint32_t height_;
+	uint32_t extent_width_ = 0;
+	uint32_t extent_height_ = 0;
+	uint64_t used_area_ = 0;
+	std::vector<Node> skyline_;
+};
+
+// Places small render targets into shared atlas pages.
+//
+// Each region is padded by one pixel on every side so bilinear sampling never bleeds
+// into a neighbour. When a new region doesn't fit anywhere and no more pages may be
+// added, all live regions are repacked from scratch, tallest first.
+//
+// Pages are sized to demand: a page's texture only covers the bounding box of its regions,
+// rounded up to kPageGranularity, and grows up to |max_page_size| as regions are added.
+class RenderTargetAtlas {
+public:
+	struct Region {
+		uint32_t page;
+		uint32_t x;
+		uint32_t y;
+		uint32_t width;
+		uint32_t height;
+	};
+
+	static const uint32_t kPageGranularity = 16;
+
+	// Render targets are allocated in 64 KB pages, small ones waste most of theirs.
+	static const uint64_t kAllocationGranularity = 64 * 1024;
+
+	RenderTargetAtlas(uint32_t max_page_size, uint32_t max_pages, uint32_t max_region_size);
+
+	// Whether a region of this size is allowed in the atlas at all.
+	bool Accepts(uint32_t width, uint32_t height) const;
+
+	// Allocate a region for |id|. Ids of other regions that changed place during a repack
+	// are appended to |moved|, their contents must be regenerated.
+	bool Allocate(uint32_t id, uint32_t width, uint32_t height, std::vector<uint32_t>& moved);
+
+	void Free(uint32_t id);
+
+	const Region* Find(uint32_t id) const;
+
+	uint32_t max_page_size() const { return max_page_size_; }
+
+	uint32_t page_count() const { return (uint32_t)pages_.size(); }
+
+	// Texture size |page| needs right now, 0 x 0 once it is empty.
+	uint32_t page_width(uint32_t page) const;
+
+	uint32_t page_height(uint32_t page) const;
+
+	// Memory of all page textures and of the live regions as standalone textures, both as
+	// allocated for a 32 bit render target.
+	uint64_t page_bytes() const;
+
+	uint64_t standalone_bytes() const;
+
+	static uint64_t AllocationBytes(uint32_t width, uint32_t height);
+
+	size_t region_count() const { return regions_.size(); }
+
+	// Sum of all live region areas (without padding) in pixels.
+	uint64_t used_area() const;
+
+	uint32_t repack_count() const { return repack_count_; }
+
+protected:
+	bool Place(uint32_t width, uint32_t height, Region& region);
+	bool Repack(uint32_t id, uint32_t width, uint32_t height, std::vector<uint32_t>& moved);
+
+	uint32_t max_page_size_;
+	uint32_t max_pages_;
+	uint32_t max_region_size_;
+	uint32_t repack_count_ = 0;
+	std::vector<SkylinePacker> pages_;
+	std::vector<uint32_t> live_regions_per_page_;
+	std::map<uint32_t, Region> regions_;
+};
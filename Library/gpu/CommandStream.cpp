@@ -0,0 +1,473 @@
+#include "CommandStream.h"
+
+#include <string.h>
+
+static const char kMagic[4] = { 'U', 'L', 'C', 'S' };
+
+// Largest record we accept when replaying, guards against corrupt sizes.
+static const uint32_t kMaxRecordSize = 512 * 1024 * 1024;
+
+// A command without clip matrices as written by CommandStreamWriter::WriteCommand.
+static const size_t kMinCommandSize = sizeof(uint8_t) + 3 * sizeof(uint32_t)  // type, geometry
+	+ 2 * sizeof(uint32_t) + sizeof(Matrix4x4::data) + 3 * sizeof(uint8_t)    // viewport .. shader
+	+ 4 * sizeof(uint32_t)                                                     // target, textures
+	+ sizeof(GPUState::uniform_scalar) + 8 * 4 * sizeof(float)                 // uniforms
+	+ sizeof(uint8_t) + sizeof(uint8_t) + 4 * sizeof(int32_t);                 // clip size, scissor
+
+// Larger bitmaps are taken as corrupt.
+static const uint32_t kMaxBitmapDimension = 16384;
+
+bool CommandStreamWriter::Open(const char* path)
+{
+	Close();
+
+	file_.open(path, std::ios::binary | std::ios::trunc);
+	if (!file_.is_open())
+		return false;
+
+	uint32_t version = kVersion;
+	file_.write(kMagic, sizeof(kMagic));
+	file_.write((const char*)&version, sizeof(version));
+	bytes_written_ = sizeof(kMagic) + sizeof(version);
+	frame_count_ = 0;
+
+	return true;
+}
+
+void CommandStreamWriter::Close()
+{
+	if (file_.is_open())
+		file_.close();
+}
+
+void CommandStreamWriter::BeginSynchronize()
+{
+	WriteRecord(CommandRecord::BeginSynchronize);
+}
+
+void CommandStreamWriter::EndSynchronize()
+{
+	WriteRecord(CommandRecord::EndSynchronize);
+}
+
+void CommandStreamWriter::CreateTexture(uint32_t texture_id, Bitmap* bitmap)
+{
+	WriteBitmap(CommandRecord::CreateTexture, texture_id, bitmap);
+}
+
+void CommandStreamWriter::UpdateTexture(uint32_t texture_id, Bitmap* bitmap)
+{
+	WriteBitmap(CommandRecord::UpdateTexture, texture_id, bitmap);
+}
+
+void CommandStreamWriter::DestroyTexture(uint32_t texture_id)
+{
+	WriteId(CommandRecord::DestroyTexture, texture_id);
+}
+
+void CommandStreamWriter::CreateRenderBuffer(uint32_t render_buffer_id, const RenderBuffer& buffer)
+{
+	Put(render_buffer_id);
+	Put(buffer.texture_id);
+	Put(buffer.width);
+	Put(buffer.height);
+	Put((uint8_t)buffer.has_stencil_buffer);
+	Put((uint8_t)buffer.has_depth_buffer);
+	WriteRecord(CommandRecord::CreateRenderBuffer);
+}
+
+void CommandStreamWriter::DestroyRenderBuffer(uint32_t render_buffer_id)
+{
+	WriteId(CommandRecord::DestroyRenderBuffer, render_buffer_id);
+}
+
+void CommandStreamWriter::CreateGeometry(uint32_t geometry_id, const VertexBuffer& vertices,
+	const IndexBuffer& indices)
+{
+	WriteGeometry(CommandRecord::CreateGeometry, geometry_id, vertices, indices);
+}
+
+void CommandStreamWriter::UpdateGeometry(uint32_t geometry_id, const VertexBuffer& vertices,
+	const IndexBuffer& indices)
+{
+	WriteGeometry(CommandRecord::UpdateGeometry, geometry_id, vertices, indices);
+}
+
+void CommandStreamWriter::DestroyGeometry(uint32_t geometry_id)
+{
+	WriteId(CommandRecord::DestroyGeometry, geometry_id);
+}
+
+void CommandStreamWriter::UpdateCommandList(const CommandList& list)
+{
+	Put(list.size);
+	for (uint32_t i = 0; i < list.size; i++)
+		WriteCommand(list.commands[i]);
+
+	WriteRecord(CommandRecord::UpdateCommandList);
+}
+
+void CommandStreamWriter::DrawCommandList()
+{
+	WriteRecord(CommandRecord::DrawCommandList);
+	frame_count_++;
+
+	// Keep what we have on disk in case the process dies mid-capture.
+	file_.flush();
+}
+
+void CommandStreamWriter::WriteRecord(CommandRecord type)
+{
+	if (file_.is_open()) {
+		uint8_t record_type = (uint8_t)type;
+		uint32_t size = (uint32_t)record_.size();
+		file_.write((const char*)&record_type, sizeof(record_type));
+		file_.write((const char*)&size, sizeof(size));
+		if (size)
+			file_.write((const char*)record_.data(), size);
+
+		bytes_written_ += sizeof(record_type) + sizeof(size) + size;
+	}
+
+	record_.clear();
+}
+
+void CommandStreamWriter::WriteId(CommandRecord type, uint32_t id)
+{
+	Put(id);
+	WriteRecord(type);
+}
+
+void CommandStreamWriter::WriteBitmap(CommandRecord type, uint32_t texture_id, Bitmap* bitmap)
+{
+	bool is_empty = bitmap->IsEmpty();
+	uint32_t size = is_empty ? 0 : (uint32_t)bitmap->size();
+
+	Put(texture_id);
+	Put(bitmap->width());
+	Put(bitmap->height());
+	Put((uint8_t)bitmap->format());
+	Put((uint8_t)is_empty);
+	Put(bitmap->row_bytes());
+	Put(size);
+
+	if (size) {
+		Put(bitmap->LockPixels(), size);
+		bitmap->UnlockPixels();
+	}
+
+	WriteRecord(type);
+}
+
+void CommandStreamWriter::WriteGeometry(CommandRecord type, uint32_t geometry_id,
+	const VertexBuffer& vertices, const IndexBuffer& indices)
+{
+	Put(geometry_id);
+	Put((uint8_t)vertices.format);
+	Put(vertices.size);
+	Put(vertices.data, vertices.size);
+	Put(indices.size);
+	Put(indices.data, indices.size);
+	WriteRecord(type);
+}
+
+void CommandStreamWriter::WriteCommand(const Command& command)
+{
+	const GPUState& state = command.gpu_state;
+	uint8_t clip_size = state.clip_size > 8 ? 8 : state.clip_size;
+
+	Put((uint8_t)command.command_type);
+	Put(command.geometry_id);
+	Put(command.indices_count);
+	Put(command.indices_offset);
+
+	Put(state.viewport_width);
+	Put(state.viewport_height);
+	Put(state.transform.data, sizeof(state.transform.data));
+	Put((uint8_t)state.enable_texturing);
+	Put((uint8_t)state.enable_blend);
+	Put((uint8_t)state.shader_type);
+	Put(state.render_buffer_id);
+	Put(state.texture_1_id);
+	Put(state.texture_2_id);
+	Put(state.texture_3_id);
+	Put(state.uniform_scalar, sizeof(state.uniform_scalar));
+	for (auto& v : state.uniform_vector) {
+		Put(v.x);
+		Put(v.y);
+		Put(v.z);
+		Put(v.w);
+	}
+	Put(clip_size);
+	for (uint8_t i = 0; i < clip_size; i++)
+		Put(state.clip[i].data, sizeof(state.clip[i].data));
+	Put((uint8_t)state.enable_scissor);
+	Put((int32_t)state.scissor_rect.left);
+	Put((int32_t)state.scissor_rect.top);
+	Put((int32_t)state.scissor_rect.right);
+	Put((int32_t)state.scissor_rect.bottom);
+}
+
+void CommandStreamWriter::Put(const void* data, size_t size)
+{
+	const uint8_t* bytes = (const uint8_t*)data;
+	record_.insert(record_.end(), bytes, bytes + size);
+}
+
+bool CommandStreamReplayer::Open(const char* path)
+{
+	file_.open(path, std::ios::binary);
+	if (!file_.is_open())
+		return false;
+
+	char magic[4];
+	uint32_t version = 0;
+	file_.read(magic, sizeof(magic));
+	file_.read((char*)&version, sizeof(version));
+
+	error_ = !file_ || memcmp(magic, kMagic, sizeof(magic)) != 0
+		|| version != CommandStreamWriter::kVersion;
+	frame_count_ = 0;
+
+	return !error_;
+}
+
+bool CommandStreamReplayer::ReplayFrame(GPUDriver& driver)
+{
+	CommandRecord type;
+	while (!error_ && ReadRecord(type)) {
+		switch (type) {
+		case CommandRecord::BeginSynchronize:
+			driver.BeginSynchronize();
+			break;
+		case CommandRecord::EndSynchronize:
+			driver.EndSynchronize();
+			break;
+		case CommandRecord::CreateTexture:
+		case CommandRecord::UpdateTexture: {
+			uint32_t texture_id;
+			RefPtr<Bitmap> bitmap = ReadBitmap(texture_id);
+			if (!bitmap)
+				break;
+
+			if (type == CommandRecord::CreateTexture)
+				driver.CreateTexture(texture_id, bitmap);
+			else
+				driver.UpdateTexture(texture_id, bitmap);
+			break;
+		}
+		case CommandRecord::DestroyTexture: {
+			uint32_t texture_id;
+			if (Get(texture_id))
+				driver.DestroyTexture(texture_id);
+			break;
+		}
+		case CommandRecord::CreateRenderBuffer: {
+			uint32_t render_buffer_id;
+			uint8_t has_stencil_buffer, has_depth_buffer;
+			RenderBuffer buffer;
+			if (Get(render_buffer_id) && Get(buffer.texture_id) && Get(buffer.width)
+				&& Get(buffer.height) && Get(has_stencil_buffer) && Get(has_depth_buffer)) {
+				buffer.has_stencil_buffer = has_stencil_buffer != 0;
+				buffer.has_depth_buffer = has_depth_buffer != 0;
+				driver.CreateRenderBuffer(render_buffer_id, buffer);
+			}
+			break;
+		}
+		case CommandRecord::DestroyRenderBuffer: {
+			uint32_t render_buffer_id;
+			if (Get(render_buffer_id))
+				driver.DestroyRenderBuffer(render_buffer_id);
+			break;
+		}
+		case CommandRecord::CreateGeometry:
+		case CommandRecord::UpdateGeometry: {
+			uint32_t geometry_id;
+			VertexBuffer vertices;
+			IndexBuffer indices;
+			if (!ReadGeometry(geometry_id, vertices, indices))
+				break;
+
+			if (type == CommandRecord::CreateGeometry)
+				driver.CreateGeometry(geometry_id, vertices, indices);
+			else
+				driver.UpdateGeometry(geometry_id, vertices, indices);
+			break;
+		}
+		case CommandRecord::DestroyGeometry: {
+			uint32_t geometry_id;
+			if (Get(geometry_id))
+				driver.DestroyGeometry(geometry_id);
+			break;
+		}
+		case CommandRecord::UpdateCommandList: {
+			uint32_t count;
+			if (!Get(count))
+				break;
+
+			// Don't let a corrupt count allocate more commands than the record can hold.
+			if (count > (record_.size() - read_offset_) / kMinCommandSize) {
+				error_ = true;
+				break;
+			}
+
+			commands_.resize(count);
+			for (uint32_t i = 0; i < count && !error_; i++)
+				ReadCommand(commands_[i]);
+
+			if (!error_) {
+				CommandList list = { count, count ? commands_.data() : nullptr };
+				driver.UpdateCommandList(list);
+			}
+			break;
+		}
+		case CommandRecord::DrawCommandList:
+			frame_count_++;
+			return true;
+		default:
+			error_ = true;
+			break;
+		}
+	}
+
+	return false;
+}
+
+bool CommandStreamReplayer::ReadRecord(CommandRecord& type)
+{
+	uint8_t record_type;
+	uint32_t size;
+	if (!file_.read((char*)&record_type, sizeof(record_type)))
+		return false;
+
+	if (!file_.read((char*)&size, sizeof(size)) || size > kMaxRecordSize) {
+		error_ = true;
+		return false;
+	}
+
+	record_.resize(size);
+	if (size && !file_.read((char*)record_.data(), size)) {
+		error_ = true;
+		return false;
+	}
+
+	type = (CommandRecord)record_type;
+	read_offset_ = 0;
+	return true;
+}
+
+RefPtr<Bitmap> CommandStreamReplayer::ReadBitmap(uint32_t& texture_id)
+{
+	uint32_t width, height, row_bytes, size;
+	uint8_t format, is_empty;
+	if (!Get(texture_id) || !Get(width) || !Get(height) || !Get(format) || !Get(is_empty)
+		|| !Get(row_bytes) || !Get(size) || read_offset_ + size > record_.size()) {
+		error_ = true;
+		return nullptr;
+	}
+
+	if (is_empty)
+		return Bitmap::Create();
+
+	// Bitmap::Create trusts its arguments, check them against each other and the payload.
+	BitmapFormat bitmap_format = (BitmapFormat)format;
+	if ((bitmap_format != BitmapFormat::A8_UNORM && bitmap_format != BitmapFormat::BGRA8_UNORM_SRGB)
+		|| !width || !height || width > kMaxBitmapDimension || height > kMaxBitmapDimension
+		|| row_bytes < width * GetBytesPerPixel(bitmap_format)
+		|| size < (uint64_t)row_bytes * height) {
+		error_ = true;
+		return nullptr;
+	}
+
+	RefPtr<Bitmap> bitmap = Bitmap::Create(width, height, bitmap_format, row_bytes,
+		record_.data() + read_offset_, size, true);
+	read_offset_ += size;
+	return bitmap;
+}
+
+bool CommandStreamReplayer::ReadGeometry(uint32_t& geometry_id, VertexBuffer& vertices,
+	IndexBuffer& indices)
+{
+	uint8_t format;
+	if (!Get(geometry_id) || !Get(format) || !Get(vertices.size))
+		return false;
+
+	vertices_.resize(vertices.size);
+	if (!Get(vertices_.data(), vertices.size) || !Get(indices.size))
+		return false;
+
+	indices_.resize(indices.size);
+	if (!Get(indices_.data(), indices.size))
+		return false;
+
+	vertices.format = (VertexBufferFormat)format;
+	vertices.data = vertices_.data();
+	indices.data = indices_.data();
+	return true;
+}
+
+bool CommandStreamReplayer::ReadCommand(Command& command)
+{
+	GPUState& state = command.gpu_state;
+	uint8_t command_type = 0, enable_texturing = 0, enable_blend = 0, shader_type = 0,
+		enable_scissor = 0;
+	int32_t scissor[4] = {};
+
+	// A failed Get sets error_, the record is rejected below once everything was read.
+	Get(command_type);
+	Get(command.geometry_id);
+	Get(command.indices_count);
+	Get(command.indices_offset);
+
+	Get(state.viewport_width);
+	Get(state.viewport_height);
+	Get(state.transform.data, sizeof(state.transform.data));
+	Get(enable_texturing);
+	Get(enable_blend);
+	Get(shader_type);
+	Get(state.render_buffer_id);
+	Get(state.texture_1_id);
+	Get(state.texture_2_id);
+	Get(state.texture_3_id);
+	Get(state.uniform_scalar, sizeof(state.uniform_scalar));
+	for (auto& v : state.uniform_vector) {
+		Get(v.x);
+		Get(v.y);
+		Get(v.z);
+		Get(v.w);
+	}
+	Get(state.clip_size);
+	if (state.clip_size > 8)
+		error_ = true;
+	for (uint8_t i = 0; i < state.clip_size && !error_; i++)
+		Get(state.clip[i].data, sizeof(state.clip[i].data));
+	Get(enable_scissor);
+	Get(scissor, sizeof(scissor));
+
+	if (command_type > (uint8_t)CommandType::DrawGeometry || shader_type > (uint8_t)ShaderType::FillPath)
+		error_ = true;
+
+	if (error_)
+		return false;
+
+	command.command_type = (CommandType)command_type;
+	state.enable_texturing = enable_texturing != 0;
+	state.enable_blend = enable_blend != 0;
+	state.shader_type = (ShaderType)shader_type;
+	state.enable_scissor = enable_scissor != 0;
+	state.scissor_rect = { scissor[0], scissor[1], scissor[2], scissor[3] };
+	return true;
+}
+
+bool CommandStreamReplayer::Get(void* data, size_t size)
+{
+	if (read_offset_ + size > record_.size()) {
+		error_ = true;
+		return false;
+	}
+
+	if (size)
+		memcpy(data, record_.data() + read_offset_, size);
+	read_offset_ += size;
+	return true;
+}
@@ -0,0 +1,111 @@
+#pragma once
+#include <stdint.h>
+#include <fstream>
+#include <vector>
+
+#include <Ultralight/Bitmap.h>
+#include <Ultralight/platform/GPUDriver.h>
+
+using namespace ultralight;
+
+// Versioned binary stream of everything Ultralight hands a GPUDriver, so a heavy frame can be
+// reproduced outside the live process.
+//
+// The stream starts with "ULCS", the format version and is followed by records of
+// { uint8_t type, uint32_t payload size, payload }. Structs are written field by field
+// (little endian, no padding) so captures replay on any platform, and commands only store
+// the clip matrices they use.
+enum class CommandRecord : uint8_t {
+	BeginSynchronize = 1,
+	EndSynchronize,
+	CreateTexture,
+	UpdateTexture,
+	DestroyTexture,
+	CreateRenderBuffer,
+	DestroyRenderBuffer,
+	CreateGeometry,
+	UpdateGeometry,
+	DestroyGeometry,
+	UpdateCommandList,
+	DrawCommandList,  // frame boundary
+};
+
+class CommandStreamWriter {
+public:
+	static const uint32_t kVersion = 1;
+
+	bool Open(const char* path);
+	void Close();
+
+	bool is_open() const { return file_.is_open(); }
+
+	uint32_t frame_count() const { return frame_count_; }
+
+	uint64_t bytes_written() const { return bytes_written_; }
+
+	void BeginSynchronize();
+	void EndSynchronize();
+	void CreateTexture(uint32_t texture_id, Bitmap* bitmap);
+	void UpdateTexture(uint32_t texture_id, Bitmap* bitmap);
+	void DestroyTexture(uint32_t texture_id);
+	void CreateRenderBuffer(uint32_t render_buffer_id, const RenderBuffer& buffer);
+	void DestroyRenderBuffer(uint32_t render_buffer_id);
+	void CreateGeometry(uint32_t geometry_id, const VertexBuffer& vertices, const IndexBuffer& indices);
+	void UpdateGeometry(uint32_t geometry_id, const VertexBuffer& vertices, const IndexBuffer& indices);
+	void DestroyGeometry(uint32_t geometry_id);
+	void UpdateCommandList(const CommandList& list);
+	void DrawCommandList();
+
+protected:
+	void WriteRecord(CommandRecord type);
+	void WriteId(CommandRecord type, uint32_t id);
+	void WriteBitmap(CommandRecord type, uint32_t texture_id, Bitmap* bitmap);
+	void WriteGeometry(CommandRecord type, uint32_t geometry_id, const VertexBuffer& vertices,
+		const IndexBuffer& indices);
+	void WriteCommand(const Command& command);
+	void Put(const void* data, size_t size);
+
+	template<typename T>
+	void Put(T value) { Put(&value, sizeof(T)); }
+
+	std::ofstream file_;
+	std::vector<uint8_t> record_;
+	uint32_t frame_count_ = 0;
+	uint64_t bytes_written_ = 0;
+};
+
+// Drives any GPUDriver implementation from a capture, one frame at a time.
+class CommandStreamReplayer {
+public:
+	bool Open(const char* path);
+
+	// Replay recorded calls up to and including the next frame boundary. The caller executes the
+	// frame afterwards (eg, GPUDriverD3D11::DrawCommandList).
+	//
+	// Returns false at the end of the stream or when it is corrupt, see has_error().
+	bool ReplayFrame(GPUDriver& driver);
+
+	bool has_error() const { return error_; }
+
+	uint32_t frame_count() const { return frame_count_; }
+
+protected:
+	bool ReadRecord(CommandRecord& type);
+	RefPtr<Bitmap> ReadBitmap(uint32_t& texture_id);
+	bool ReadGeometry(uint32_t& geometry_id, VertexBuffer& vertices, IndexBuffer& indices);
+	bool ReadCommand(Command& command);
+	bool Get(void* data, size_t size);
+
+	template<typename T>
+	bool Get(T& value) { return Get(&value, sizeof(T)); }
+
+	std::ifstream file_;
+	std::vector<uint8_t> record_;
+	size_t read_offset_ = 0;
+	bool error_ = false;
+	uint32_t frame_count_ = 0;
+
+	std::vector<Command> commands_;
+	std::vector<uint8_t> vertices_;
+	std::vector<uint8_t> indices_;
+};
@@ -0,0 +1,115 @@
+#include "CompositeAnimation.h"
+
+#include <math.h>
+
+void CompositeTransform::GetMatrix(float m[4]) const
+{
+	float c = cosf(rotation);
+	float s = sinf(rotation);
+
+	m[0] = c * scale_x;
+	m[1] = -s * scale_y;
+	m[2] = s * scale_x;
+	m[3] = c * scale_y;
+}
+
+bool CompositeTransform::Unproject(float width, float height, float& x, float& y) const
+{
+	float m[4];
+	GetMatrix(m);
+
+	float det = m[0] * m[3] - m[1] * m[2];
+	if (fabsf(det) < 1e-6f)
+		return false;
+
+	float dx = x - translate_x - width * 0.5f;
+	float dy = y - translate_y - height * 0.5f;
+
+	x = (m[3] * dx - m[1] * dy) / det + width * 0.5f;
+	y = (m[0] * dy - m[2] * dx) / det + height * 0.5f;
+	return true;
+}
+
+bool CompositeTransform::operator==(const CompositeTransform& other) const
+{
+	return opacity == other.opacity && translate_x == other.translate_x
+		&& translate_y == other.translate_y && scale_x == other.scale_x && scale_y == other.scale_y
+		&& rotation == other.rotation;
+}
+
+float ApplyEasing(Easing easing, float t)
+{
+	switch (easing) {
+	case Easing::EaseIn:
+		return t * t * t;
+	case Easing::EaseOut: {
+		float u = 1.0f - t;
+		return 1.0f - u * u * u;
+	}
+	case Easing::EaseInOut:
+		return t * t * (3.0f - 2.0f * t);
+	default:
+		return t;
+	}
+}
+
+static float Lerp(float a, float b, float t)
+{
+	return a + (b - a) * t;
+}
+
+CompositeTransform Interpolate(const CompositeTransform& from, const CompositeTransform& to,
+	float t)
+{
+	CompositeTransform result;
+	result.opacity = Lerp(from.opacity, to.opacity, t);
+	result.translate_x = Lerp(from.translate_x, to.translate_x, t);
+	result.translate_y = Lerp(from.translate_y, to.translate_y, t);
+	result.scale_x = Lerp(from.scale_x, to.scale_x, t);
+	result.scale_y = Lerp(from.scale_y, to.scale_y, t);
+	result.rotation = Lerp(from.rotation, to.rotation, t);
+	return result;
+}
+
+void CompositeTimeline::Set(const CompositeTransform& value)
+{
+	value_ = value;
+	is_animating_ = false;
+}
+
+void CompositeTimeline::AnimateTo(const CompositeTransform& target, double duration, Easing easing,
+	double now)
+{
+	if (duration <= 0.0) {
+		Set(target);
+		return;
+	}
+
+	from_ = value_;
+	to_ = target;
+	start_ = now;
+	duration_ = duration;
+	easing_ = easing;
+	is_animating_ = true;
+}
+
+bool CompositeTimeline::Tick(double now)
+{
+	if (!is_animating_)
+		return false;
+
+	double t = (now - start_) / duration_;
+	CompositeTransform value;
+
+	if (t >= 1.0) {
+		value = to_;
+		is_animating_ = false;
+	}
+	else {
+		value = Interpolate(from_, to_, ApplyEasing(easing_, t <= 0.0 ? 0.0f : (float)t));
+	}
+
+	bool changed = value != value_;
+	value_ = value;
+	return changed;
+}
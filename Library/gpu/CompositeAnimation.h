@@ -0,0 +1,64 @@
+#pragma once
+#include <stdint.h>
+
+// How the compositor draws an overlay's quad on top of the view's existing pixels. Changing it
+// never re-renders the view.
+struct CompositeTransform {
+	float opacity = 1.0f;
+	float translate_x = 0.0f;  // in pixels
+	float translate_y = 0.0f;
+	float scale_x = 1.0f;      // around the quad's center
+	float scale_y = 1.0f;
+	float rotation = 0.0f;     // in radians, clockwise around the quad's center
+
+	// Row-major 2x2 matrix of scale and rotation.
+	void GetMatrix(float m[4]) const;
+
+	// Map a point relative to the untransformed quad's top-left into the quad's own coordinates.
+	// Returns false if the quad is collapsed (zero scale).
+	bool Unproject(float width, float height, float& x, float& y) const;
+
+	bool operator==(const CompositeTransform& other) const;
+	bool operator!=(const CompositeTransform& other) const { return !(*this == other); }
+};
+
+enum class Easing {
+	Linear,
+	EaseIn,
+	EaseOut,
+	EaseInOut,
+};
+
+float ApplyEasing(Easing easing, float t);
+
+CompositeTransform Interpolate(const CompositeTransform& from, const CompositeTransform& to,
+	float t);
+
+// Tweens a CompositeTransform over time, one tween at a time. Times are in seconds on any
+// monotonic clock.
+class CompositeTimeline {
+public:
+	// Jump to a value, cancelling the running tween.
+	void Set(const CompositeTransform& value);
+
+	// Tween from the current value to target, replacing the running tween.
+	void AnimateTo(const CompositeTransform& target, double duration, Easing easing, double now);
+
+	// Advance the running tween to now. Returns true if the value changed.
+	bool Tick(double now);
+
+	bool is_animating() const { return is_animating_; }
+
+	const CompositeTransform& value() const { return value_; }
+
+	const CompositeTransform& target() const { return is_animating_ ? to_ : value_; }
+
+protected:
+	CompositeTransform from_;
+	CompositeTransform to_;
+	CompositeTransform value_;
+	double start_ = 0.0;
+	double duration_ = 0.0;
+	Easing easing_ = Easing::Linear;
+	bool is_animating_ = false;
+};
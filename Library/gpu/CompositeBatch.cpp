@@ -0,0 +1,58 @@
+#include "CompositeBatch.h"
+
+void CompositeBatch::Clear()
+{
+	instances_.clear();
+	draws_.clear();
+}
+
+void CompositeBatch::Add(uint32_t texture_id, const Rect& rect, const Rect& uv, float opacity,
+	const float* transform)
+{
+	if (!texture_id || rect.right <= rect.left || rect.bottom <= rect.top || opacity <= 0.0f)
+		return;
+
+	Draw* draw = draws_.empty() ? nullptr : &draws_.back();
+
+	uint32_t slot = kMaxTextureSlots;
+	if (draw) {
+		for (uint32_t i = 0; i < draw->texture_count; i++) {
+			if (draw->texture_ids[i] == texture_id) {
+				slot = i;
+				break;
+			}
+		}
+	}
+
+	if (slot == kMaxTextureSlots) {
+		// Texture isn't bound by the current draw, start a new one if all slots are taken.
+		if (!draw || draw->texture_count == kMaxTextureSlots) {
+			Draw next = {};
+			next.first_instance = (uint32_t)instances_.size();
+			draws_.push_back(next);
+			draw = &draws_.back();
+		}
+
+		slot = draw->texture_count++;
+		draw->texture_ids[slot] = texture_id;
+	}
+
+	Instance instance;
+	instance.rect[0] = rect.left;
+	instance.rect[1] = rect.top;
+	instance.rect[2] = rect.right;
+	instance.rect[3] = rect.bottom;
+	instance.uv[0] = uv.left;
+	instance.uv[1] = uv.top;
+	instance.uv[2] = uv.right;
+	instance.uv[3] = uv.bottom;
+	instance.transform[0] = transform ? transform[0] : 1.0f;
+	instance.transform[1] = transform ? transform[1] : 0.0f;
+	instance.transform[2] = transform ? transform[2] : 0.0f;
+	instance.transform[3] = transform ? transform[3] : 1.0f;
+	instance.opacity = opacity > 1.0f ? 1.0f : opacity;
+	instance.texture_slot = slot;
+
+	instances_.push_back(instance);
+	draw->instance_count++;
+}
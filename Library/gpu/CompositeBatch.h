@@ -0,0 +1,50 @@
+#pragma once
+#include <stdint.h>
+#include <vector>
+
+#include <Ultralight/Geometry.h>
+
+using namespace ultralight;
+
+// Per-frame list of overlay quads to composite onto a window's render buffer.
+//
+// Every overlay becomes one compact instance that is expanded from a shared unit quad
+// in the vertex shader. Consecutive instances are grouped into draws of up to
+// kMaxTextureSlots distinct textures so that z-order is preserved while the whole
+// window is composited with as few draws as possible.
+class CompositeBatch {
+public:
+	static const uint32_t kMaxTextureSlots = 8;
+
+	// Layout must match the per-instance input layout of the composite shader.
+	struct Instance {
+		float rect[4];  // left, top, right, bottom in pixels
+		float uv[4];    // left, top, right, bottom in texture space
+		float transform[4];  // row-major 2x2 applied around the rect's center
+		float opacity;
+		uint32_t texture_slot;
+	};
+
+	struct Draw {
+		uint32_t first_instance;
+		uint32_t instance_count;
+		uint32_t texture_count;
+		uint32_t texture_ids[kMaxTextureSlots];
+	};
+
+	void Clear();
+
+	// transform is a row-major 2x2 matrix applied around the rect's center, null for identity.
+	void Add(uint32_t texture_id, const Rect& rect, const Rect& uv, float opacity,
+		const float* transform = nullptr);
+
+	bool empty() const { return instances_.empty(); }
+
+	const std::vector<Instance>& instances() const { return instances_; }
+
+	const std::vector<Draw>& draws() const { return draws_; }
+
+protected:
+	std::vector<Instance> instances_;
+	std::vector<Draw> draws_;
+};
@@ -0,0 +1,239 @@
+#include "DrawCuller.h"
+
+#include <algorithm>
+#include <float.h>
+#include <string.h>
+
+// Antialiased edges may reach a little past the geometry.
+static const float kBoundsMargin = 1.0f;
+
+void DrawCuller::SetGeometry(uint32_t geometry_id, const VertexBuffer& vertices,
+	const IndexBuffer& indices)
+{
+	Geometry& geometry = geometry_[geometry_id];
+	geometry.range_bounds.clear();
+	geometry.stride = vertices.format == VertexBufferFormat::_2f_4ub_2f ? sizeof(Vertex_2f_4ub_2f)
+		: sizeof(Vertex_2f_4ub_2f_2f_28f);
+	geometry.vertices.assign(vertices.data, vertices.data + vertices.size);
+
+	geometry.indices.resize(indices.size / sizeof(IndexType));
+	if (geometry.indices.size())
+		memcpy(geometry.indices.data(), indices.data, geometry.indices.size() * sizeof(IndexType));
+}
+
+void DrawCuller::RemoveGeometry(uint32_t geometry_id)
+{
+	geometry_.erase(geometry_id);
+}
+
+bool DrawCuller::Matches(uint32_t geometry_id, const VertexBuffer& vertices,
+	const IndexBuffer& indices) const
+{
+	auto i = geometry_.find(geometry_id);
+	if (i == geometry_.end())
+		return false;
+
+	const Geometry& geometry = i->second;
+	size_t stride = vertices.format == VertexBufferFormat::_2f_4ub_2f ? sizeof(Vertex_2f_4ub_2f)
+		: sizeof(Vertex_2f_4ub_2f_2f_28f);
+	if (stride != geometry.stride || vertices.size != geometry.vertices.size()
+		|| indices.size != geometry.indices.size() * sizeof(IndexType))
+		return false;
+
+	return (!vertices.size || !memcmp(vertices.data, geometry.vertices.data(), vertices.size))
+		&& (!indices.size || !memcmp(indices.data, geometry.indices.data(), indices.size));
+}
+
+size_t DrawCuller::VertexCount(const Geometry& geometry)
+{
+	return geometry.vertices.size() / geometry.stride;
+}
+
+void DrawCuller::GetPosition(const Geometry& geometry, uint32_t index, float& x, float& y)
+{
+	// Both vertex formats start with float pos[2].
+	float pos[2];
+	memcpy(pos, geometry.vertices.data() + index * geometry.stride, sizeof(pos));
+	x = pos[0];
+	y = pos[1];
+}
+
+bool DrawCuller::IsVisible(const Command& command)
+{
+	if (command.command_type != CommandType::DrawGeometry)
+		return true;
+
+	const GPUState& state = command.gpu_state;
+
+	Rect target = { 0.0f, 0.0f, (float)state.viewport_width, (float)state.viewport_height };
+	if (state.enable_scissor) {
+		const IntRect& scissor = state.scissor_rect;
+		if (scissor.right <= scissor.left || scissor.bottom <= scissor.top) {
+			culled_count_++;
+			return false;
+		}
+
+		target.left = std::max(target.left, (float)scissor.left);
+		target.top = std::max(target.top, (float)scissor.top);
+		target.right = std::min(target.right, (float)scissor.right);
+		target.bottom = std::min(target.bottom, (float)scissor.bottom);
+	}
+
+	// Only affine 2D transforms, anything with perspective is drawn as is.
+	const float* m = state.transform.data;
+	if (m[3] != 0.0f || m[7] != 0.0f || m[15] != 1.0f)
+		return true;
+
+	Rect local;
+	if (!GetRangeBounds(command.geometry_id, command.indices_offset, command.indices_count, local))
+		return true;
+
+	float xs[4], ys[4];
+	float corners[4][2] = { { local.left, local.top }, { local.right, local.top },
+		{ local.left, local.bottom }, { local.right, local.bottom } };
+	for (int i = 0; i < 4; i++) {
+		xs[i] = m[0] * corners[i][0] + m[4] * corners[i][1] + m[12];
+		ys[i] = m[1] * corners[i][0] + m[5] * corners[i][1] + m[13];
+	}
+
+	Rect bounds = {
+		*std::min_element(xs, xs + 4) - kBoundsMargin,
+		*std::min_element(ys, ys + 4) - kBoundsMargin,
+		*std::max_element(xs, xs + 4) + kBoundsMargin,
+		*std::max_element(ys, ys + 4) + kBoundsMargin
+	};
+
+	if (bounds.right <= target.left || bounds.left >= target.right || bounds.bottom <= target.top
+		|| bounds.top >= target.bottom) {
+		culled_count_++;
+		return false;
+	}
+
+	return true;
+}
+
+bool DrawCuller::CoversTarget(const Command& command, uint32_t width, uint32_t height)
+{
+	if (command.command_type != CommandType::DrawGeometry || command.indices_count != 6)
+		return false;
+
+	const GPUState& state = command.gpu_state;
+	if (!width || !height || state.viewport_width < width || state.viewport_height < height)
+		return false;
+
+	if (state.enable_scissor) {
+		const IntRect& scissor = state.scissor_rect;
+		if (scissor.left > 0 || scissor.top > 0 || scissor.right < (int)width
+			|| scissor.bottom < (int)height)
+			return false;
+	}
+
+	// Scale and translation only, so the quad stays axis-aligned.
+	const float* m = state.transform.data;
+	if (m[1] != 0.0f || m[4] != 0.0f || m[3] != 0.0f || m[7] != 0.0f || m[15] != 1.0f)
+		return false;
+
+	auto i = geometry_.find(command.geometry_id);
+	if (i == geometry_.end())
+		return false;
+
+	const Geometry& geometry = i->second;
+	uint32_t offset = command.indices_offset;
+	if ((uint64_t)offset + 6 > geometry.indices.size())
+		return false;
+
+	// Two triangles over four distinct vertices.
+	uint32_t vertices[4];
+	uint32_t vertex_count = 0;
+	for (uint32_t j = offset; j < offset + 6; j++) {
+		uint32_t index = geometry.indices[j];
+		if (index >= VertexCount(geometry))
+			return false;
+		if (std::find(vertices, vertices + vertex_count, index) == vertices + vertex_count) {
+			if (vertex_count == 4)
+				return false;
+			vertices[vertex_count++] = index;
+		}
+	}
+
+	if (vertex_count != 4)
+		return false;
+
+	float xs[4], ys[4];
+	for (int j = 0; j < 4; j++) {
+		float x, y;
+		GetPosition(geometry, vertices[j], x, y);
+		xs[j] = m[0] * x + m[12];
+		ys[j] = m[5] * y + m[13];
+	}
+
+	float left = *std::min_element(xs, xs + 4);
+	float right = *std::max_element(xs, xs + 4);
+	float top = *std::min_element(ys, ys + 4);
+	float bottom = *std::max_element(ys, ys + 4);
+	if (left > 0.0f || top > 0.0f || right < (float)width || bottom < (float)height)
+		return false;
+
+	// Every vertex must sit on a distinct corner of the bounds.
+	int corners = 0;
+	for (int j = 0; j < 4; j++) {
+		if ((xs[j] != left && xs[j] != right) || (ys[j] != top && ys[j] != bottom))
+			return false;
+		corners |= 1 << ((xs[j] == right ? 1 : 0) + (ys[j] == bottom ? 2 : 0));
+	}
+
+	if (corners != 0xF)
+		return false;
+
+	// The triangles must split the quad along a diagonal, ie, share two opposite corners.
+	const uint32_t* first = &geometry.indices[offset];
+	const uint32_t* second = first + 3;
+	int shared = 0;
+	float shared_x[2], shared_y[2];
+	for (int j = 0; j < 3; j++) {
+		if (std::find(second, second + 3, first[j]) != second + 3 && shared < 2) {
+			int k = (int)(std::find(vertices, vertices + 4, first[j]) - vertices);
+			shared_x[shared] = xs[k];
+			shared_y[shared] = ys[k];
+			shared++;
+		}
+	}
+
+	return shared == 2 && shared_x[0] != shared_x[1] && shared_y[0] != shared_y[1];
+}
+
+bool DrawCuller::GetRangeBounds(uint32_t geometry_id, uint32_t offset, uint32_t count, Rect& bounds)
+{
+	auto i = geometry_.find(geometry_id);
+	if (i == geometry_.end() || !count)
+		return false;
+
+	Geometry& geometry = i->second;
+	uint64_t key = ((uint64_t)offset << 32) | count;
+	auto cached = geometry.range_bounds.find(key);
+	if (cached != geometry.range_bounds.end()) {
+		bounds = cached->second;
+		return true;
+	}
+
+	if ((uint64_t)offset + count > geometry.indices.size())
+		return false;
+
+	size_t vertex_count = VertexCount(geometry);
+	bounds = { FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX };
+	for (uint32_t j = offset; j < offset + count; j++) {
+		uint32_t index = geometry.indices[j];
+		if (index >= vertex_count)
+			return false;
+
+		float x, y;
+		GetPosition(geometry, index, x, y);
+		bounds.left = std::min(bounds.left, x);
+		bounds.top = std::min(bounds.top, y);
+		bounds.right = std::max(bounds.right, x);
+		bounds.bottom = std::max(bounds.bottom, y);
+	}
+
+	geometry.range_bounds[key] = bounds;
+	return true;
+}
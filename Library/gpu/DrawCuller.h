@@ -0,0 +1,53 @@
+#pragma once
+#include <stdint.h>
+#include <map>
+#include <vector>
+
+#include <Ultralight/Geometry.h>
+#include <Ultralight/platform/GPUDriver.h>
+
+using namespace ultralight;
+
+// Drops draw commands that can't touch a single pixel before they reach the device.
+//
+// Keeps a CPU copy of each geometry's vertices and indices so the bounds of the exact index
+// range a command draws can be found, Ultralight packs many unrelated quads into
+// one geometry. Culling is conservative: only empty scissor rects and ranges whose transformed
+// bounds lie fully outside the viewport or scissor rect are dropped, clip masks and
+// non-affine transforms never cull.
+class DrawCuller {
+public:
+	void SetGeometry(uint32_t geometry_id, const VertexBuffer& vertices, const IndexBuffer& indices);
+	void RemoveGeometry(uint32_t geometry_id);
+
+	// True if |vertices| and |indices| are byte for byte what was last set for |geometry_id|.
+	bool Matches(uint32_t geometry_id, const VertexBuffer& vertices, const IndexBuffer& indices) const;
+
+	void BeginFrame() { culled_count_ = 0; }
+
+	// Returns false if the command can be skipped, always true for non-draw commands.
+	bool IsVisible(const Command& command);
+
+	// True if the command draws one axis-aligned quad over every pixel of its |width| x |height|
+	// render target texture. The texture may be larger than the viewport, the draw can't reach
+	// past it then. Blending and the pixel shader are up to the caller.
+	bool CoversTarget(const Command& command, uint32_t width, uint32_t height);
+
+	// Draws dropped since BeginFrame.
+	uint32_t culled_count() const { return culled_count_; }
+
+protected:
+	struct Geometry {
+		std::vector<uint8_t> vertices;
+		size_t stride = 0;
+		std::vector<uint32_t> indices;
+		std::map<uint64_t, Rect> range_bounds;  // keyed by offset << 32 | count
+	};
+
+	static size_t VertexCount(const Geometry& geometry);
+	static void GetPosition(const Geometry& geometry, uint32_t index, float& x, float& y);
+	bool GetRangeBounds(uint32_t geometry_id, uint32_t offset, uint32_t count, Rect& bounds);
+
+	std::map<uint32_t, Geometry> geometry_;
+	uint32_t culled_count_ = 0;
+};
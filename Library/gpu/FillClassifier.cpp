@@ -0,0 +1,102 @@
+#include "FillClassifier.h"
+
+#include <stddef.h>
+#include <string.h>
+
+// From fill.hlsl, types without a variant are only drawn by the uber-shader.
+static const uint32_t kFillTypes[] = { 0, 0, 1, 2, 3, 7, 8 };
+static const char* kFillVariantNames[] = { "uber", "solid", "image", "pattern", "gradient",
+	"rounded rect", "box shadow" };
+static const uint8_t kNoVariant = 0xFF;
+
+static uint8_t GetVariantForFillType(uint32_t fill_type)
+{
+	for (size_t i = (size_t)FillVariant::Solid; i < (size_t)FillVariant::Count; i++) {
+		if (kFillTypes[i] == fill_type)
+			return (uint8_t)i;
+	}
+
+	return kNoVariant;
+}
+
+uint32_t GetFillType(FillVariant variant)
+{
+	return kFillTypes[(size_t)variant];
+}
+
+const char* GetFillVariantName(FillVariant variant)
+{
+	return kFillVariantNames[(size_t)variant];
+}
+
+void FillClassifier::SetGeometry(uint32_t geometry_id, const VertexBuffer& vertices,
+	const IndexBuffer& indices)
+{
+	if (vertices.format != VertexBufferFormat::_2f_4ub_2f_2f_28f)
+		return;
+
+	size_t stride = sizeof(Vertex_2f_4ub_2f_2f_28f);
+	size_t vertex_count = vertices.size / stride;
+
+	Geometry& geometry = geometry_[geometry_id];
+	geometry.range_variants.clear();
+
+	// Stored as the variant each vertex maps to, so ranges compare bytes only.
+	geometry.fill_types.resize(vertex_count);
+	for (size_t i = 0; i < vertex_count; i++) {
+		float fill_type;
+		memcpy(&fill_type, vertices.data + i * stride + offsetof(Vertex_2f_4ub_2f_2f_28f, data0),
+			sizeof(float));
+		geometry.fill_types[i] = GetVariantForFillType((uint32_t)(fill_type + 0.5f));
+	}
+
+	geometry.indices.resize(indices.size / sizeof(IndexType));
+	if (geometry.indices.size())
+		memcpy(geometry.indices.data(), indices.data, geometry.indices.size() * sizeof(IndexType));
+}
+
+void FillClassifier::RemoveGeometry(uint32_t geometry_id)
+{
+	geometry_.erase(geometry_id);
+}
+
+FillVariant FillClassifier::Classify(const Command& command)
+{
+	FillVariant variant = FillVariant::Uber;
+
+	if (command.command_type == CommandType::DrawGeometry
+		&& command.gpu_state.shader_type == ShaderType::Fill) {
+		auto i = geometry_.find(command.geometry_id);
+		if (i != geometry_.end())
+			variant = ClassifyRange(i->second, command.indices_offset, command.indices_count);
+	}
+
+	histogram_[(size_t)variant]++;
+	return variant;
+}
+
+FillVariant FillClassifier::ClassifyRange(Geometry& geometry, uint32_t offset, uint32_t count)
+{
+	uint64_t key = ((uint64_t)offset << 32) | count;
+	auto cached = geometry.range_variants.find(key);
+	if (cached != geometry.range_variants.end())
+		return cached->second;
+
+	uint8_t variant = kNoVariant;
+	if (count && (uint64_t)offset + count <= geometry.indices.size()) {
+		for (uint32_t i = offset; i < offset + count; i++) {
+			uint32_t index = geometry.indices[i];
+			uint8_t vertex_variant = index < geometry.fill_types.size() ? geometry.fill_types[index]
+				: kNoVariant;
+			if (vertex_variant == kNoVariant || (i != offset && vertex_variant != variant)) {
+				variant = kNoVariant;
+				break;
+			}
+			variant = vertex_variant;
+		}
+	}
+
+	FillVariant result = variant == kNoVariant ? FillVariant::Uber : (FillVariant)variant;
+	geometry.range_variants[key] = result;
+	return result;
+}
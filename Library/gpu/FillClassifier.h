@@ -0,0 +1,54 @@
+#pragma once
+#include <stdint.h>
+#include <map>
+#include <vector>
+
+#include <Ultralight/platform/GPUDriver.h>
+
+using namespace ultralight;
+
+// Pixel shader permutations of fill.hlsl, each compiled with FILL_TYPE fixed to one fill type.
+enum class FillVariant : uint8_t {
+	Uber,  // branches per pixel on the fill type, handles everything
+	Solid,
+	Image,
+	Pattern,
+	Gradient,
+	RoundedRect,
+	BoxShadow,
+	Count,
+};
+
+// The FILL_TYPE a variant is compiled with, see the FillType_ constants in fill.hlsl.
+uint32_t GetFillType(FillVariant variant);
+
+const char* GetFillVariantName(FillVariant variant);
+
+// Picks the specialized fill shader a draw can use.
+//
+// The fill type lives in every vertex (data0.x), so a CPU copy of each fill geometry's fill
+// types and indices is kept, and a draw gets a specialized variant only when every vertex of
+// the index range it draws has the same fill type. Mixed ranges use the uber-shader.
+class FillClassifier {
+public:
+	void SetGeometry(uint32_t geometry_id, const VertexBuffer& vertices, const IndexBuffer& indices);
+	void RemoveGeometry(uint32_t geometry_id);
+
+	// Always Uber for non-draw commands and FillPath draws. Counted in the histogram.
+	FillVariant Classify(const Command& command);
+
+	// Draws classified as each variant since startup, indexed by FillVariant.
+	const uint64_t* histogram() const { return histogram_; }
+
+protected:
+	struct Geometry {
+		std::vector<uint8_t> fill_types;  // per vertex
+		std::vector<uint32_t> indices;
+		std::map<uint64_t, FillVariant> range_variants;  // keyed by offset << 32 | count
+	};
+
+	FillVariant ClassifyRange(Geometry& geometry, uint32_t offset, uint32_t count);
+
+	std::map<uint32_t, Geometry> geometry_;
+	uint64_t histogram_[(size_t)FillVariant::Count] = {};
+};
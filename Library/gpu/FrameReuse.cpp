@@ -0,0 +1,49 @@
+#include "FrameReuse.h"
+
+#include <algorithm>
+#include <vector>
+
+uint64_t HashBytes(const void* data, size_t size, uint64_t hash)
+{
+	const uint8_t* bytes = (const uint8_t*)data;
+	for (size_t i = 0; i < size; i++) {
+		hash ^= bytes[i];
+		hash *= 1099511628211ull;
+	}
+
+	return hash;
+}
+
+uint64_t HashCommandList(const Command* commands, size_t count)
+{
+	std::vector<uint32_t> cleared;
+	uint64_t hash = HashValue(count);
+
+	for (size_t i = 0; i < count; i++) {
+		const Command& command = commands[i];
+		uint32_t render_buffer_id = command.gpu_state.render_buffer_id;
+
+		if (command.command_type == CommandType::ClearRenderBuffer) {
+			cleared.push_back(render_buffer_id);
+		}
+		else if (std::find(cleared.begin(), cleared.end(), render_buffer_id) == cleared.end()) {
+			return 0;
+		}
+
+		hash = HashBytes(&command, sizeof(Command), hash);
+	}
+
+	return hash ? hash : 1;
+}
+
+bool FrameReuse::Matches(uint64_t signature)
+{
+	bool matches = signature && signature == last_signature_;
+	last_signature_ = signature;
+
+	frames_++;
+	if (matches)
+		skipped_++;
+
+	return matches;
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+#include <Ultralight/platform/GPUDriver.h>
+
+using namespace ultralight;
+
+// 64-bit FNV-1a. Frames are only skipped when signatures match, a collision would have to
+// happen between two consecutive frames to show a stale one.
+uint64_t HashBytes(const void* data, size_t size, uint64_t hash = 14695981039346656037ull);
+
+template<typename T>
+uint64_t HashValue(const T& value, uint64_t hash = 14695981039346656037ull) {
+	return HashBytes(&value, sizeof(T), hash);
+}
+
+// Signature of a command list, or 0 if replaying it twice doesn't give the same pixels (it
+// draws into a render buffer without clearing it first, so it would blend over its own output).
+uint64_t HashCommandList(const Command* commands, size_t count);
+
+// Remembers the signature of the last frame so an identical one can be skipped.
+class FrameReuse {
+public:
+	// Returns true if |signature| equals the previous frame's. A signature of 0 never matches.
+	bool Matches(uint64_t signature);
+
+	// Forget the last frame, eg, after the target was resized.
+	void Invalidate() { last_signature_ = 0; }
+
+	uint32_t frames() const { return frames_; }
+
+	uint32_t skipped() const { return skipped_; }
+
+	double skip_ratio() const { return frames_ ? (double)skipped_ / frames_ : 0.0; }
+
+protected:
+	uint64_t last_signature_ = 0;
+	uint32_t frames_ = 0;
+	uint32_t skipped_ = 0;
+};
@@ -6,7 +6,8 @@ GPUContextD3D11::GPUContextD3D11() {
 	HRESULT hr = S_OK;
 	feature_level_ = D3D_FEATURE_LEVEL_11_0;
 
-	UINT deviceFlags = D3D11_CREATE_DEVICE_SINGLETHREADED | D3D11_CREATE_DEVICE_BGRA_SUPPORT;
+	// Not single threaded, textures are created on the driver's upload thread.
+	UINT deviceFlags = D3D11_CREATE_DEVICE_BGRA_SUPPORT;
 
 #ifdef _DEBUG
 	deviceFlags |= D3D11_CREATE_DEVICE_DEBUG;
@@ -9,11 +9,15 @@
 #include <Ultralight/platform/Platform.h>
 
 #include "../Application.h"
+#include "../helpers/LogHelpers.h"
 #include "GPUContext.h"
 #include "shaders/bin/fill_fxc.h"
+#include "shaders/bin/fill_hlsl.h"
 #include "shaders/bin/fill_path_fxc.h"
 #include "shaders/bin/v2f_c4f_t2f_fxc.h"
 #include "shaders/bin/v2f_c4f_t2f_t2f_d28f_fxc.h"
+#include "shaders/src/alpha_mask_hlsl.h"
+#include "shaders/src/composite_hlsl.h"
 #include "SwapChain.h"
 
 struct Vertex_2f_4ub_2f {
@@ -45,12 +49,22 @@ struct Uniforms {
 	DirectX::XMMATRIX Clip[8];
 };
 
+struct CompositeUniforms {
+	DirectX::XMFLOAT4 ViewportSize;
+};
+
+struct AlphaMaskUniforms {
+	int32_t SourceRect[4];
+	int32_t CellSize[4];
+};
+
 HRESULT CompileShaderFromSource(const char* source,
 	size_t source_size,
 	const char* source_name,
 	LPCSTR szEntryPoint,
 	LPCSTR szShaderModel,
-	ID3DBlob** ppBlobOut) {
+	ID3DBlob** ppBlobOut,
+	const D3D_SHADER_MACRO* pDefines = nullptr) {
 	DWORD dwShaderFlags = D3DCOMPILE_ENABLE_STRICTNESS;
 #ifdef _DEBUG
 	dwShaderFlags |= D3DCOMPILE_DEBUG;
@@ -67,7 +81,7 @@ HRESULT CompileShaderFromSource(const char* source,
 	ComPtr<ID3DBlob> pErrorBlob;
 
 	HRESULT hr
-		= D3DCompile2(source, source_size, source_name, nullptr, nullptr, szEntryPoint, szShaderModel,
+		= D3DCompile2(source, source_size, source_name, pDefines, nullptr, szEntryPoint, szShaderModel,
 			dwShaderFlags, 0, 0, 0, 0, ppBlobOut, pErrorBlob.GetAddressOf());
 
 	if (FAILED(hr) && pErrorBlob)
@@ -98,9 +112,74 @@ HRESULT CompileShaderFromFile(const char* path,
 		szShaderModel, ppBlobOut);
 }
 
-GPUDriverD3D11::GPUDriverD3D11(GPUContextD3D11* context) : context_(context) {}
+static uint64_t EstimateRenderTargetBytes(uint32_t width, uint32_t height, uint32_t samples) {
+	// Single-sample texture (or MSAA resolve texture) plus the multisampled surface
+	return (uint64_t)width * height * 4 + MSAAPolicy::OverheadBytes(width, height, samples);
+}
+
+static DXGI_FORMAT GetTextureFormat(BitmapFormat format) {
+	return format == BitmapFormat::BGRA8_UNORM_SRGB ? DXGI_FORMAT_B8G8R8A8_UNORM
+		: DXGI_FORMAT_A8_UNORM;
+}
+
+// Device calls only, safe on any thread.
+static HRESULT CreateShaderTexture(ID3D11Device* device, UINT width, UINT height,
+	DXGI_FORMAT format, UsageClass usage, const D3D11_SUBRESOURCE_DATA* data,
+	ComPtr<ID3D11Texture2D>& texture, ComPtr<ID3D11ShaderResourceView>& texture_srv) {
+	D3D11_TEXTURE2D_DESC desc;
+	ZeroMemory(&desc, sizeof(desc));
+	desc.Width = width;
+	desc.Height = height;
+	desc.MipLevels = desc.ArraySize = 1;
+	desc.Format = format;
+	desc.SampleDesc.Count = 1;
+	desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+
+	switch (usage) {
+	case UsageClass::Immutable:
+		desc.Usage = D3D11_USAGE_IMMUTABLE;
+		break;
+	case UsageClass::Default:
+		desc.Usage = D3D11_USAGE_DEFAULT;
+		break;
+	case UsageClass::Dynamic:
+		desc.Usage = D3D11_USAGE_DYNAMIC;
+		desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+		break;
+	}
+
+	HRESULT hr = device->CreateTexture2D(&desc, data, texture.ReleaseAndGetAddressOf());
+	if (FAILED(hr))
+		return hr;
+
+	D3D11_SHADER_RESOURCE_VIEW_DESC srv_desc;
+	ZeroMemory(&srv_desc, sizeof(srv_desc));
+	srv_desc.Format = desc.Format;
+	srv_desc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
+	srv_desc.Texture2D.MostDetailedMip = 0;
+	srv_desc.Texture2D.MipLevels = 1;
+
+	hr = device->CreateShaderResourceView(texture.Get(), &srv_desc,
+		texture_srv.ReleaseAndGetAddressOf());
+	if (FAILED(hr))
+		texture.Reset();
+
+	return hr;
+}
+
+GPUDriverD3D11::GPUDriverD3D11(GPUContextD3D11* context)
+	: context_(context), uploader_(context->device()),
+	upload_queue_(&uploader_, kUploadStagingBytes),
+	atlas_(kAtlasMaxPageSize, kAtlasMaxPages, kAtlasMaxRegionSize) {
+	context_->immediate_context()->QueryInterface(__uuidof(ID3D11DeviceContext1),
+		(void**)immediate_context1_.GetAddressOf());
+	set_msaa_policy(MSAAPolicyConfig());
+}
 
-GPUDriverD3D11::~GPUDriverD3D11() {}
+GPUDriverD3D11::~GPUDriverD3D11() {
+	if (fill_variant_thread_.joinable())
+		fill_variant_thread_.join();
+}
 
 void GPUDriverD3D11::CreateTexture(uint32_t texture_id, RefPtr<Bitmap> bitmap) {
 	auto i = textures_.find(texture_id);
@@ -115,50 +194,159 @@ void GPUDriverD3D11::CreateTexture(uint32_t texture_id, RefPtr<Bitmap> bitmap) {
 		MessageBoxW(nullptr, L"GPUDriverD3D11::CreateTexture, unsupported format.", L"Error", MB_OK);
 	}
 
-	D3D11_TEXTURE2D_DESC desc;
-	ZeroMemory(&desc, sizeof(desc));
-	desc.Width = bitmap->width();
-	desc.Height = bitmap->height();
-	desc.MipLevels = desc.ArraySize = 1;
-	desc.Format = bitmap->format() == BitmapFormat::BGRA8_UNORM_SRGB ? DXGI_FORMAT_B8G8R8A8_UNORM
-		: DXGI_FORMAT_A8_UNORM;
-	desc.SampleDesc.Count = 1;
-	desc.Usage = D3D11_USAGE_DYNAMIC;
-	desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
-	desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
-	desc.MiscFlags = 0;
+	if (capture_.is_open())
+		capture_.CreateTexture(texture_id, bitmap.get());
+
+	resource_generation_++;
 
 	auto& texture_entry = textures_[texture_id];
-	HRESULT hr;
+	texture_entry.width = bitmap->width();
+	texture_entry.height = bitmap->height();
+	texture_entry.is_render_target = bitmap->IsEmpty();
 
 	if (bitmap->IsEmpty()) {
-		desc.BindFlags = D3D11_BIND_RENDER_TARGET | D3D11_BIND_SHADER_RESOURCE;
-		desc.Usage = D3D11_USAGE_DEFAULT;
-		desc.CPUAccessFlags = 0;
-#if ENABLE_MSAA
-		desc.SampleDesc.Count = 8;
-		desc.SampleDesc.Quality = D3D11_STANDARD_MULTISAMPLE_PATTERN;
+		CreateRenderTargetTexture(texture_id, texture_entry);
+		residency_.Add(ResidencyTracker::Key(ResidencyKind::RenderTarget, texture_id),
+			ResidencyKind::RenderTarget,
+			EstimateRenderTargetBytes(texture_entry.width, texture_entry.height,
+				texture_entry.samples));
+		return;
+	}
 
-		texture_entry.is_msaa_render_target = true;
-#endif
+	// Most images never change, they only move to a writable class once they are updated.
+	SubmitUpload(texture_id, texture_entry, bitmap, UsageClass::Immutable);
+
+	texture_usage_.Add(texture_id, UsageClass::Immutable);
+	residency_.Add(ResidencyTracker::Key(ResidencyKind::Texture, texture_id), ResidencyKind::Texture,
+		(uint64_t)bitmap->width() * bitmap->height() * bitmap->bpp());
+}
+
+HRESULT GPUDriverD3D11::CreateBitmapTexture(TextureEntry& texture_entry, DXGI_FORMAT format,
+	UsageClass usage, const D3D11_SUBRESOURCE_DATA* data) {
+	ComPtr<ID3D11Texture2D> texture;
+	ComPtr<ID3D11ShaderResourceView> texture_srv;
+	HRESULT hr = CreateShaderTexture(context_->device(), texture_entry.width, texture_entry.height,
+		format, usage, data, texture, texture_srv);
+	if (FAILED(hr))
+		return hr;
+
+	texture_entry.texture = texture;
+	texture_entry.texture_srv = texture_srv;
+	texture_entry.usage = usage;
+	return S_OK;
+}
+
+void GPUDriverD3D11::DemoteTexture(TextureEntry& texture_entry) {
+	// A pending upload decides the class of the texture it replaces.
+	if (texture_entry.usage != UsageClass::Dynamic || texture_entry.pending_upload)
+		return;
+
+	ComPtr<ID3D11Texture2D> dynamic_texture = texture_entry.texture;
+	D3D11_TEXTURE2D_DESC desc;
+	dynamic_texture->GetDesc(&desc);
 
-		hr = context_->device()->CreateTexture2D(&desc, NULL, texture_entry.texture.GetAddressOf());
+	// Keeps the dynamic texture when this fails, it still works, only slower to sample.
+	if (SUCCEEDED(CreateBitmapTexture(texture_entry, desc.Format, UsageClass::Default, nullptr)))
+		context_->immediate_context()->CopyResource(texture_entry.texture.Get(), dynamic_texture.Get());
+}
+
+void GPUDriverD3D11::SubmitUpload(uint32_t texture_id, TextureEntry& texture_entry,
+	RefPtr<Bitmap> bitmap, UsageClass usage) {
+	UploadJob job;
+	job.id = texture_id;
+	job.width = bitmap->width();
+	job.height = bitmap->height();
+	job.row_bytes = bitmap->row_bytes();
+	job.format = (uint32_t)GetTextureFormat(bitmap->format());
+	job.usage = (uint32_t)usage;
+	job.size = bitmap->size();
+
+	texture_entry.pending_upload = upload_queue_.Submit(job, bitmap->LockPixels());
+	bitmap->UnlockPixels();
+}
+
+void GPUDriverD3D11::WaitForUpload(uint64_t fence) {
+	if (!upload_queue_.IsComplete(fence))
+		upload_queue_.Wait(fence);
+
+	ApplyUploads();
+}
+
+void GPUDriverD3D11::ApplyUploads() {
+	std::map<uint64_t, TextureUploader::Result> results;
+	uploader_.TakeResults(results);
+
+	for (auto& result : results) {
+		// Drop uploads superseded by a later one or whose texture was destroyed meanwhile.
+		auto i = textures_.find(result.second.texture_id);
+		if (i == textures_.end() || i->second.pending_upload != result.first)
+			continue;
+
+		auto& entry = i->second;
+		entry.pending_upload = 0;
+
+		if (!result.second.texture) {
+			MessageBoxW(nullptr, L"GPUDriverD3D11::ApplyUploads, unable to create texture.", L"Error",
+				MB_OK);
+			continue;
+		}
+
+		entry.texture = result.second.texture;
+		entry.texture_srv = result.second.texture_srv;
+		entry.usage = result.second.usage;
 	}
-	else {
-		D3D11_SUBRESOURCE_DATA tex_data;
-		ZeroMemory(&tex_data, sizeof(tex_data));
-		tex_data.pSysMem = bitmap->LockPixels();
-		tex_data.SysMemPitch = bitmap->row_bytes();
-		tex_data.SysMemSlicePitch = (UINT)bitmap->size();
-
-		hr = context_->device()->CreateTexture2D(&desc, &tex_data,
-			texture_entry.texture.GetAddressOf());
-		bitmap->UnlockPixels();
+}
+
+void GPUDriverD3D11::TextureUploader::Execute(const UploadJob& job) {
+	D3D11_SUBRESOURCE_DATA tex_data;
+	ZeroMemory(&tex_data, sizeof(tex_data));
+	tex_data.pSysMem = job.pixels;
+	tex_data.SysMemPitch = job.row_bytes;
+	tex_data.SysMemSlicePitch = (UINT)job.size;
+
+	Result result;
+	result.texture_id = job.id;
+	result.usage = (UsageClass)job.usage;
+	CreateShaderTexture(device_, job.width, job.height, (DXGI_FORMAT)job.format, result.usage,
+		&tex_data, result.texture, result.texture_srv);
+
+	std::lock_guard<std::mutex> lock(mutex_);
+	results_[job.fence] = result;
+}
+
+void GPUDriverD3D11::TextureUploader::TakeResults(std::map<uint64_t, Result>& results) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	results.swap(results_);
+}
+
+void GPUDriverD3D11::CreateRenderTargetTexture(uint32_t texture_id, TextureEntry& texture_entry) {
+	D3D11_TEXTURE2D_DESC desc;
+	ZeroMemory(&desc, sizeof(desc));
+	desc.Width = texture_entry.width;
+	desc.Height = texture_entry.height;
+	desc.MipLevels = desc.ArraySize = 1;
+	desc.Format = DXGI_FORMAT_B8G8R8A8_UNORM;
+	desc.SampleDesc.Count = 1;
+	desc.Usage = D3D11_USAGE_DEFAULT;
+	desc.BindFlags = D3D11_BIND_RENDER_TARGET | D3D11_BIND_SHADER_RESOURCE;
+	desc.CPUAccessFlags = 0;
+	desc.MiscFlags = 0;
+
+	// Atlas pages are single-sample, a target that may move into one is never multisampled.
+	msaa_policy_.Release(texture_id);
+	texture_entry.samples = IsAtlasCandidate(desc.Width, desc.Height) ? 1
+		: msaa_policy_.Acquire(texture_id, desc.Width, desc.Height);
+	texture_entry.is_msaa_render_target = texture_entry.samples > 1;
+	if (texture_entry.is_msaa_render_target) {
+		desc.SampleDesc.Count = texture_entry.samples;
+		desc.SampleDesc.Quality = D3D11_STANDARD_MULTISAMPLE_PATTERN;
 	}
 
+	HRESULT hr = context_->device()->CreateTexture2D(&desc, NULL, texture_entry.texture.GetAddressOf());
+
 	if (FAILED(hr)) {
-		MessageBoxW(nullptr, L"GPUDriverD3D11::CreateTexture, unable to create texture.", L"Error",
-			MB_OK);
+		MessageBoxW(nullptr, L"GPUDriverD3D11::CreateRenderTargetTexture, unable to create texture.",
+			L"Error", MB_OK);
 	}
 
 	D3D11_SHADER_RESOURCE_VIEW_DESC srv_desc;
@@ -173,13 +361,12 @@ void GPUDriverD3D11::CreateTexture(uint32_t texture_id, RefPtr<Bitmap> bitmap) {
 		texture_entry.texture_srv.GetAddressOf());
 
 	if (FAILED(hr)) {
-		MessageBoxW(
-			nullptr,
-			L"GPUDriverD3D11::CreateTexture, unable to create shader resource view for texture.",
+		MessageBoxW(nullptr,
+			L"GPUDriverD3D11::CreateRenderTargetTexture, unable to create shader resource view for "
+			L"texture.",
 			L"Error", MB_OK);
 	}
 
-#if ENABLE_MSAA
 	if (texture_entry.is_msaa_render_target) {
 		// Create resolve texture and shader resource view
 
@@ -189,7 +376,8 @@ void GPUDriverD3D11::CreateTexture(uint32_t texture_id, RefPtr<Bitmap> bitmap) {
 			texture_entry.resolve_texture.GetAddressOf());
 
 		if (FAILED(hr)) {
-			MessageBoxW(nullptr, L"GPUDriverD3D11::CreateTexture, unable to create MSAA resolve texture.",
+			MessageBoxW(nullptr,
+				L"GPUDriverD3D11::CreateRenderTargetTexture, unable to create MSAA resolve texture.",
 				L"Error", MB_OK);
 		}
 
@@ -201,12 +389,23 @@ void GPUDriverD3D11::CreateTexture(uint32_t texture_id, RefPtr<Bitmap> bitmap) {
 
 		if (FAILED(hr)) {
 			MessageBoxW(nullptr,
-				L"GPUDriverD3D11::CreateTexture, unable to create shader resource view for MSAA "
-				L"resolve texture.",
+				L"GPUDriverD3D11::CreateRenderTargetTexture, unable to create shader resource view for "
+				L"MSAA resolve texture.",
 				L"Error", MB_OK);
 		}
 	}
-#endif
+}
+
+HRESULT GPUDriverD3D11::CreateTextureRenderTargetView(const TextureEntry& texture_entry,
+	ID3D11RenderTargetView** render_target_view) {
+	D3D11_RENDER_TARGET_VIEW_DESC renderTargetViewDesc;
+	ZeroMemory(&renderTargetViewDesc, sizeof(renderTargetViewDesc));
+	renderTargetViewDesc.Format = DXGI_FORMAT_B8G8R8A8_UNORM;
+	renderTargetViewDesc.ViewDimension = texture_entry.is_msaa_render_target
+		? D3D11_RTV_DIMENSION_TEXTURE2DMS : D3D11_RTV_DIMENSION_TEXTURE2D;
+
+	return context_->device()->CreateRenderTargetView(texture_entry.texture.Get(),
+		&renderTargetViewDesc, render_target_view);
 }
 
 void GPUDriverD3D11::UpdateTexture(uint32_t texture_id, RefPtr<Bitmap> bitmap) {
@@ -217,7 +416,21 @@ void GPUDriverD3D11::UpdateTexture(uint32_t texture_id, RefPtr<Bitmap> bitmap) {
 		return;
 	}
 
+	if (capture_.is_open())
+		capture_.UpdateTexture(texture_id, bitmap.get());
+
+	resource_generation_++;
+
 	auto& entry = i->second;
+	UsageClass usage = texture_usage_.OnUpdate(texture_id);
+
+	// Anything but a dynamic texture already in place is replaced by a new texture in its new
+	// class, with the new contents as initial data.
+	if (usage != UsageClass::Dynamic || entry.usage != UsageClass::Dynamic || entry.pending_upload) {
+		SubmitUpload(texture_id, entry, bitmap, usage);
+		return;
+	}
+
 	D3D11_MAPPED_SUBRESOURCE res;
 	context_->immediate_context()->Map(entry.texture.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &res);
 
@@ -237,8 +450,24 @@ void GPUDriverD3D11::UpdateTexture(uint32_t texture_id, RefPtr<Bitmap> bitmap) {
 }
 
 void GPUDriverD3D11::DestroyTexture(uint32_t texture_id) {
+	if (capture_.is_open())
+		capture_.DestroyTexture(texture_id);
+
+	resource_generation_++;
+
 	auto i = textures_.find(texture_id);
 	if (i != textures_.end()) {
+		if (i->second.in_atlas) {
+			atlas_.Free(texture_id);
+			EnsureAtlasPages();
+		}
+
+		msaa_policy_.Release(texture_id);
+		texture_usage_.Remove(texture_id);
+		composited_textures_.erase(texture_id);
+		alpha_masks_.erase(texture_id);
+		residency_.Remove(ResidencyTracker::Key(ResidencyKind::Texture, texture_id));
+		residency_.Remove(ResidencyTracker::Key(ResidencyKind::RenderTarget, texture_id));
 		textures_.erase(i);
 	}
 }
@@ -266,18 +495,14 @@ void GPUDriverD3D11::CreateRenderBuffer(uint32_t render_buffer_id, const RenderB
 		return;
 	}
 
-	D3D11_RENDER_TARGET_VIEW_DESC renderTargetViewDesc;
-	ZeroMemory(&renderTargetViewDesc, sizeof(renderTargetViewDesc));
-	renderTargetViewDesc.Format = DXGI_FORMAT_B8G8R8A8_UNORM;
-	renderTargetViewDesc.ViewDimension = D3D11_RTV_DIMENSION_TEXTURE2D;
-#if ENABLE_MSAA
-	renderTargetViewDesc.ViewDimension = D3D11_RTV_DIMENSION_TEXTURE2DMS;
-#endif
+	if (capture_.is_open())
+		capture_.CreateRenderBuffer(render_buffer_id, buffer);
+
+	resource_generation_++;
 
-	ComPtr<ID3D11Texture2D> tex = tex_entry->second.texture;
 	auto& render_target_entry = render_targets_[render_buffer_id];
-	HRESULT hr = context_->device()->CreateRenderTargetView(
-		tex.Get(), &renderTargetViewDesc, render_target_entry.render_target_view.GetAddressOf());
+	HRESULT hr = CreateTextureRenderTargetView(tex_entry->second,
+		render_target_entry.render_target_view.GetAddressOf());
 
 	render_target_entry.render_target_texture_id = buffer.texture_id;
 
@@ -288,6 +513,11 @@ void GPUDriverD3D11::CreateRenderBuffer(uint32_t render_buffer_id, const RenderB
 }
 
 void GPUDriverD3D11::DestroyRenderBuffer(uint32_t render_buffer_id) {
+	if (capture_.is_open())
+		capture_.DestroyRenderBuffer(render_buffer_id);
+
+	resource_generation_++;
+
 	auto i = render_targets_.find(render_buffer_id);
 	if (i != render_targets_.end()) {
 		i->second.render_target_view.Reset();
@@ -298,49 +528,31 @@ void GPUDriverD3D11::DestroyRenderBuffer(uint32_t render_buffer_id) {
 void GPUDriverD3D11::CreateGeometry(uint32_t geometry_id,
 	const VertexBuffer& vertices,
 	const IndexBuffer& indices) {
-	BindVertexLayout(vertices.format);
+	LoadShaders();
 
 	if (geometry_.find(geometry_id) != geometry_.end())
 		return;
 
-	GeometryEntry geometry;
-	geometry.format = vertices.format;
-
-	HRESULT hr;
-
-	D3D11_BUFFER_DESC vertex_desc;
-	ZeroMemory(&vertex_desc, sizeof(vertex_desc));
-	vertex_desc.Usage = D3D11_USAGE_DYNAMIC;
-	vertex_desc.ByteWidth = vertices.size;
-	vertex_desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
-	vertex_desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
-
-	D3D11_SUBRESOURCE_DATA vertex_data;
-	ZeroMemory(&vertex_data, sizeof(vertex_data));
-	vertex_data.pSysMem = vertices.data;
-
-	hr = context_->device()->CreateBuffer(&vertex_desc, &vertex_data,
-		geometry.vertexBuffer.GetAddressOf());
-	if (FAILED(hr))
-		return;
+	if (capture_.is_open())
+		capture_.CreateGeometry(geometry_id, vertices, indices);
 
-	D3D11_BUFFER_DESC index_desc;
-	ZeroMemory(&index_desc, sizeof(index_desc));
-	index_desc.Usage = D3D11_USAGE_DYNAMIC;
-	index_desc.ByteWidth = indices.size;
-	index_desc.BindFlags = D3D11_BIND_INDEX_BUFFER;
-	index_desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+	resource_generation_++;
 
-	D3D11_SUBRESOURCE_DATA index_data;
-	ZeroMemory(&index_data, sizeof(index_data));
-	index_data.pSysMem = indices.data;
+	GeometryEntry geometry;
+	geometry.format = vertices.format;
 
-	hr = context_->device()->CreateBuffer(&index_desc, &index_data,
-		geometry.indexBuffer.GetAddressOf());
-	if (FAILED(hr))
+	if (!StoreGeometry(geometry, vertices, indices)) {
+		MessageBoxW(nullptr, L"GPUDriverD3D11::CreateGeometry, unable to allocate geometry buffers.",
+			L"Error", MB_OK);
 		return;
+	}
 
 	geometry_.insert({ geometry_id, std::move(geometry) });
+	geometry_usage_.Add(geometry_id, UsageClass::Default);
+	culler_.SetGeometry(geometry_id, vertices, indices);
+	fill_classifier_.SetGeometry(geometry_id, vertices, indices);
+	residency_.Add(ResidencyTracker::Key(ResidencyKind::Geometry, geometry_id), ResidencyKind::Geometry,
+		(uint64_t)vertices.size + indices.size);
 }
 
 void GPUDriverD3D11::UpdateGeometry(uint32_t geometry_id,
@@ -353,25 +565,339 @@ void GPUDriverD3D11::UpdateGeometry(uint32_t geometry_id,
 		return;
 	}
 
+	if (capture_.is_open())
+		capture_.UpdateGeometry(geometry_id, vertices, indices);
+
 	auto& entry = i->second;
-	D3D11_MAPPED_SUBRESOURCE res;
 
-	context_->immediate_context()->Map(entry.vertexBuffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &res);
-	memcpy(res.pData, vertices.data, vertices.size);
-	context_->immediate_context()->Unmap(entry.vertexBuffer.Get(), 0);
+	// Ultralight rewrites geometry on every paint, most of the time with the same data. Compared
+	// against the culler's copy rather than a hash, a collision would leave stale vertices on the
+	// GPU and let frame reuse skip the frame that should show them.
+	if (culler_.Matches(geometry_id, vertices, indices))
+		return;
+
+	resource_generation_++;
+	culler_.SetGeometry(geometry_id, vertices, indices);
+	fill_classifier_.SetGeometry(geometry_id, vertices, indices);
+
+	UsageClass usage = geometry_usage_.OnUpdate(geometry_id);
+	if (usage != UsageClass::Dynamic && !DemoteGeometry(entry)) {
+		MessageBoxW(nullptr, L"GPUDriverD3D11::UpdateGeometry, unable to allocate geometry buffers.",
+			L"Error", MB_OK);
+		return;
+	}
+
+	bool stored = usage == UsageClass::Dynamic ? StoreDynamicGeometry(entry, vertices, indices)
+		: StoreGeometry(entry, vertices, indices);
+	if (!stored) {
+		MessageBoxW(nullptr, L"GPUDriverD3D11::UpdateGeometry, unable to allocate geometry buffers.",
+			L"Error", MB_OK);
+		return;
+	}
 
-	context_->immediate_context()->Map(entry.indexBuffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &res);
-	memcpy(res.pData, indices.data, indices.size);
-	context_->immediate_context()->Unmap(entry.indexBuffer.Get(), 0);
+	residency_.Resize(ResidencyTracker::Key(ResidencyKind::Geometry, geometry_id),
+		(uint64_t)vertices.size + indices.size);
 }
 
 void GPUDriverD3D11::DestroyGeometry(uint32_t geometry_id) {
+	if (capture_.is_open())
+		capture_.DestroyGeometry(geometry_id);
+
+	resource_generation_++;
+
 	auto i = geometry_.find(geometry_id);
 	if (i != geometry_.end()) {
-		i->second.vertexBuffer.Reset();
-		i->second.indexBuffer.Reset();
+		// Dynamic geometry owns its buffers, everything else has blocks in the arenas.
+		if (i->second.usage != UsageClass::Dynamic) {
+			if (i->second.vertex_count)
+				vertex_arenas_[(size_t)i->second.format].allocator.Free(i->second.first_vertex);
+			if (i->second.index_count)
+				index_arena_.allocator.Free(i->second.first_index);
+		}
+
 		geometry_.erase(i);
+		geometry_usage_.Remove(geometry_id);
+		culler_.RemoveGeometry(geometry_id);
+		fill_classifier_.RemoveGeometry(geometry_id);
+		residency_.Remove(ResidencyTracker::Key(ResidencyKind::Geometry, geometry_id));
+	}
+}
+
+bool GPUDriverD3D11::StoreGeometry(GeometryEntry& geometry, const VertexBuffer& vertices,
+	const IndexBuffer& indices) {
+	GeometryArena& vertex_arena = vertex_arenas_[(size_t)geometry.format];
+	if (!vertex_arena.element_size) {
+		vertex_arena.element_size = geometry.format == VertexBufferFormat::_2f_4ub_2f
+			? sizeof(::Vertex_2f_4ub_2f) : sizeof(::Vertex_2f_4ub_2f_2f_28f);
+		vertex_arena.bind_flags = D3D11_BIND_VERTEX_BUFFER;
+	}
+
+	if (!index_arena_.element_size) {
+		index_arena_.element_size = sizeof(IndexType);
+		index_arena_.bind_flags = D3D11_BIND_INDEX_BUFFER;
+	}
+
+	uint32_t vertex_count = vertices.size / vertex_arena.element_size;
+	uint32_t index_count = indices.size / index_arena_.element_size;
+
+	// Keep the blocks when the sizes didn't change, which is the common case for updates.
+	if (vertex_count != geometry.vertex_count) {
+		if (geometry.vertex_count)
+			vertex_arena.allocator.Free(geometry.first_vertex);
+		geometry.vertex_count = 0;
+
+		if (vertex_count && !AllocateInArena(vertex_arena, vertex_count, geometry.first_vertex))
+			return false;
+		geometry.vertex_count = vertex_count;
+	}
+
+	if (index_count != geometry.index_count) {
+		if (geometry.index_count)
+			index_arena_.allocator.Free(geometry.first_index);
+		geometry.index_count = 0;
+
+		if (index_count && !AllocateInArena(index_arena_, index_count, geometry.first_index))
+			return false;
+		geometry.index_count = index_count;
+	}
+
+	auto immediate_ctx = context_->immediate_context();
+
+	if (vertex_count) {
+		D3D11_BOX box = { geometry.first_vertex * vertex_arena.element_size, 0, 0,
+			(geometry.first_vertex + vertex_count) * vertex_arena.element_size, 1, 1 };
+		immediate_ctx->UpdateSubresource(vertex_arena.buffer.Get(), 0, &box, vertices.data, 0, 0);
+	}
+
+	if (index_count) {
+		D3D11_BOX box = { geometry.first_index * index_arena_.element_size, 0, 0,
+			(geometry.first_index + index_count) * index_arena_.element_size, 1, 1 };
+		immediate_ctx->UpdateSubresource(index_arena_.buffer.Get(), 0, &box, indices.data, 0, 0);
+	}
+
+	return true;
+}
+
+bool GPUDriverD3D11::AllocateInArena(GeometryArena& arena, uint32_t count, uint32_t& offset) {
+	if (arena.allocator.Allocate(count, offset))
+		return true;
+
+	uint32_t capacity = arena.allocator.capacity();
+	uint32_t initial = arena.bind_flags == D3D11_BIND_INDEX_BUFFER ? kArenaInitialIndices
+		: kArenaInitialVertices;
+	uint32_t new_capacity = capacity ? capacity * 2 : initial;
+	while (new_capacity < capacity + count)
+		new_capacity *= 2;
+
+	D3D11_BUFFER_DESC desc;
+	ZeroMemory(&desc, sizeof(desc));
+	desc.Usage = D3D11_USAGE_DEFAULT;
+	desc.ByteWidth = new_capacity * arena.element_size;
+	desc.BindFlags = arena.bind_flags;
+
+	ComPtr<ID3D11Buffer> buffer;
+	HRESULT hr = context_->device()->CreateBuffer(&desc, nullptr, buffer.GetAddressOf());
+	if (FAILED(hr))
+		return false;
+
+	// Offsets stay valid, carry over everything allocated so far.
+	if (arena.buffer) {
+		D3D11_BOX box = { 0, 0, 0, capacity * arena.element_size, 1, 1 };
+		context_->immediate_context()->CopySubresourceRegion(buffer.Get(), 0, 0, 0, 0,
+			arena.buffer.Get(), 0, &box);
+	}
+
+	arena.buffer = buffer;
+	arena.allocator.Grow(new_capacity);
+
+	// The old buffer may still be bound.
+	bound_vertex_buffer_ = nullptr;
+	bound_index_buffer_ = nullptr;
+
+	std::ostringstream info;
+	info << "Geometry arena grown to " << (uint64_t)desc.ByteWidth / 1024 << " KB ("
+		<< arena.allocator.allocation_count() << " blocks, "
+		<< (int)(arena.allocator.fragmentation() * 100) << "% fragmented before growing)";
+	UL_LOG_INFO(info.str().c_str());
+
+	return arena.allocator.Allocate(count, offset);
+}
+
+bool GPUDriverD3D11::StoreDynamicGeometry(GeometryEntry& geometry, const VertexBuffer& vertices,
+	const IndexBuffer& indices) {
+	GeometryArena& vertex_arena = vertex_arenas_[(size_t)geometry.format];
+
+	if (geometry.usage != UsageClass::Dynamic) {
+		if (geometry.vertex_count)
+			vertex_arena.allocator.Free(geometry.first_vertex);
+		if (geometry.index_count)
+			index_arena_.allocator.Free(geometry.first_index);
+
+		geometry.first_vertex = geometry.vertex_count = 0;
+		geometry.first_index = geometry.index_count = 0;
+		geometry.usage = UsageClass::Dynamic;
+	}
+
+	struct Part {
+		ComPtr<ID3D11Buffer>& buffer;
+		const void* data;
+		uint32_t size;
+		UINT bind_flags;
+	} parts[] = {
+		{ geometry.dynamic_vertex_buffer, vertices.data, vertices.size, D3D11_BIND_VERTEX_BUFFER },
+		{ geometry.dynamic_index_buffer, indices.data, indices.size, D3D11_BIND_INDEX_BUFFER },
+	};
+
+	auto immediate_ctx = context_->immediate_context();
+
+	for (auto& part : parts) {
+		if (!part.size)
+			continue;
+
+		D3D11_BUFFER_DESC desc;
+		ZeroMemory(&desc, sizeof(desc));
+		if (part.buffer)
+			part.buffer->GetDesc(&desc);
+
+		if (desc.ByteWidth < part.size) {
+			desc.Usage = D3D11_USAGE_DYNAMIC;
+			desc.ByteWidth = part.size;
+			desc.BindFlags = part.bind_flags;
+			desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+			D3D11_SUBRESOURCE_DATA data;
+			ZeroMemory(&data, sizeof(data));
+			data.pSysMem = part.data;
+
+			part.buffer.Reset();
+			HRESULT hr = context_->device()->CreateBuffer(&desc, &data, part.buffer.GetAddressOf());
+			if (FAILED(hr))
+				return false;
+			continue;
+		}
+
+		D3D11_MAPPED_SUBRESOURCE res;
+		if (FAILED(immediate_ctx->Map(part.buffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &res)))
+			return false;
+		memcpy(res.pData, part.data, part.size);
+		immediate_ctx->Unmap(part.buffer.Get(), 0);
+	}
+
+	geometry.vertex_count = vertices.size / vertex_arena.element_size;
+	geometry.index_count = indices.size / index_arena_.element_size;
+	return true;
+}
+
+bool GPUDriverD3D11::DemoteGeometry(GeometryEntry& geometry) {
+	if (geometry.usage != UsageClass::Dynamic)
+		return true;
+
+	GeometryArena& vertex_arena = vertex_arenas_[(size_t)geometry.format];
+	uint32_t first_vertex = 0;
+	uint32_t first_index = 0;
+
+	if (geometry.vertex_count
+		&& !AllocateInArena(vertex_arena, geometry.vertex_count, first_vertex))
+		return false;
+
+	if (geometry.index_count && !AllocateInArena(index_arena_, geometry.index_count, first_index)) {
+		if (geometry.vertex_count)
+			vertex_arena.allocator.Free(first_vertex);
+		return false;
+	}
+
+	// Copy the current contents over on the GPU, there is no CPU copy to upload from.
+	auto immediate_ctx = context_->immediate_context();
+
+	if (geometry.vertex_count) {
+		D3D11_BOX box = { 0, 0, 0, geometry.vertex_count * vertex_arena.element_size, 1, 1 };
+		immediate_ctx->CopySubresourceRegion(vertex_arena.buffer.Get(), 0,
+			first_vertex * vertex_arena.element_size, 0, 0, geometry.dynamic_vertex_buffer.Get(), 0,
+			&box);
+	}
+
+	if (geometry.index_count) {
+		D3D11_BOX box = { 0, 0, 0, geometry.index_count * index_arena_.element_size, 1, 1 };
+		immediate_ctx->CopySubresourceRegion(index_arena_.buffer.Get(), 0,
+			first_index * index_arena_.element_size, 0, 0, geometry.dynamic_index_buffer.Get(), 0,
+			&box);
+	}
+
+	geometry.first_vertex = first_vertex;
+	geometry.first_index = first_index;
+	geometry.usage = UsageClass::Default;
+	geometry.dynamic_vertex_buffer.Reset();
+	geometry.dynamic_index_buffer.Reset();
+	return true;
+}
+
+void GPUDriverD3D11::BeginSynchronize() {
+	if (capture_.is_open())
+		capture_.BeginSynchronize();
+
+	texture_usage_.NextFrame();
+	geometry_usage_.NextFrame();
+
+	// Resources that stopped changing go back out of CPU-writable memory.
+	std::vector<uint32_t> ids;
+	texture_usage_.CollectDemotions(ids);
+	for (uint32_t id : ids) {
+		auto i = textures_.find(id);
+		if (i != textures_.end())
+			DemoteTexture(i->second);
+	}
+
+	// Geometry that fails to move keeps its dynamic buffers until its next update.
+	geometry_usage_.CollectDemotions(ids);
+	for (uint32_t id : ids) {
+		auto i = geometry_.find(id);
+		if (i != geometry_.end())
+			DemoteGeometry(i->second);
+	}
+}
+
+void GPUDriverD3D11::EndSynchronize() {
+	if (capture_.is_open())
+		capture_.EndSynchronize();
+}
+
+UsageStats GPUDriverD3D11::usage_stats() const {
+	UsageStats stats;
+	stats.textures = texture_usage_.stats();
+	stats.geometry = geometry_usage_.stats();
+	return stats;
+}
+
+void GPUDriverD3D11::LogStats() const {
+	std::ostringstream info;
+	info << "Command list reuse: " << (int)(replay_reuse_.skip_ratio() * 100) << "% of "
+		<< replay_reuse_.frames() << " replays skipped";
+	UL_LOG_INFO(info.str().c_str());
+
+	LogUsageStats();
+	LogFillVariants();
+	LogRenderPassStats();
+}
+
+void GPUDriverD3D11::LogUsageStats() const {
+	UsageStats stats = usage_stats();
+
+	std::ostringstream info;
+	info << "Usage classes:";
+
+	const char* names[] = { "textures", "geometry" };
+	const UsageClassStats* classes[] = { &stats.textures, &stats.geometry };
+	for (size_t i = 0; i < 2; i++) {
+		const UsageClassStats& c = *classes[i];
+		info << (i ? "; " : " ") << names[i] << " "
+			<< c.resources[(size_t)UsageClass::Immutable] << " immutable, "
+			<< c.resources[(size_t)UsageClass::Default] << " default ("
+			<< c.updates[(size_t)UsageClass::Default] << " updates), "
+			<< c.resources[(size_t)UsageClass::Dynamic] << " dynamic ("
+			<< c.updates[(size_t)UsageClass::Dynamic] << " updates), " << c.promotions
+			<< " promotions, " << c.demotions << " demotions";
 	}
+	UL_LOG_INFO(info.str().c_str());
 }
 
 // Inherited from GPUDriverImpl
@@ -386,11 +912,30 @@ void GPUDriverD3D11::BindTexture(uint8_t texture_unit, uint32_t texture_id) {
 
 	auto& entry = i->second;
 
-	if (entry.is_msaa_render_target) {
+	if (entry.pending_upload)
+		WaitForUpload(entry.pending_upload);
+
+	if (entry.evicted)
+		RestoreRenderTarget(texture_id);
+
+	residency_.Touch(ResidencyTracker::Key(entry.is_render_target ? ResidencyKind::RenderTarget
+		: ResidencyKind::Texture, texture_id));
+
+	if (entry.in_atlas) {
+		auto& page = atlas_pages_[atlas_.Find(texture_id)->page];
+		context_->immediate_context()->PSSetShaderResources(texture_unit, 1,
+			page.texture_srv.GetAddressOf());
+	}
+	else if (entry.is_msaa_render_target) {
+		// Only resolve when the target was rendered to since the last resolve.
 		if (entry.needs_resolve) {
 			context_->immediate_context()->ResolveSubresource(
 				entry.resolve_texture.Get(), 0, entry.texture.Get(), 0, DXGI_FORMAT_B8G8R8A8_UNORM);
 			entry.needs_resolve = false;
+			resolve_count_++;
+		}
+		else {
+			skipped_resolve_count_++;
 		}
 
 		context_->immediate_context()->PSSetShaderResources(texture_unit, 1,
@@ -405,10 +950,8 @@ void GPUDriverD3D11::BindTexture(uint8_t texture_unit, uint32_t texture_id) {
 void GPUDriverD3D11::BindRenderBuffer(uint32_t render_buffer_id) {
 	// Unbind any textures/shader resources to avoid warnings in case a render
 	// buffer that we would like to bind is already bound as an input texture.
-	ID3D11ShaderResourceView* nullSRV[1] = { nullptr };
-	context_->immediate_context()->PSSetShaderResources(0, 1, nullSRV);
-	context_->immediate_context()->PSSetShaderResources(1, 1, nullSRV);
-	context_->immediate_context()->PSSetShaderResources(2, 1, nullSRV);
+	ID3D11ShaderResourceView* nullSRV[CompositeBatch::kMaxTextureSlots] = { nullptr };
+	context_->immediate_context()->PSSetShaderResources(0, CompositeBatch::kMaxTextureSlots, nullSRV);
 
 	ID3D11RenderTargetView* target = GetRenderTargetView(render_buffer_id);
 	if (!target) {
@@ -430,16 +973,28 @@ void GPUDriverD3D11::ClearRenderBuffer(uint32_t render_buffer_id) {
 		return;
 	}
 
+	// Atlas pages are shared, only clear this render buffer's region.
+	auto region = GetAtlasRegion(render_buffer_id);
+	if (region) {
+		ClearAtlasRegion(*region);
+		return;
+	}
+
 	context_->immediate_context()->ClearRenderTargetView(target, color);
 }
 
 void GPUDriverD3D11::DrawGeometry(uint32_t geometry_id,
 	uint32_t indices_count,
 	uint32_t indices_offset,
-	const GPUState& state) {
+	const GPUState& state,
+	FillVariant fill_variant) {
 	BindRenderBuffer(state.render_buffer_id);
 
-	SetViewport(state.viewport_width, state.viewport_height);
+	auto region = GetAtlasRegion(state.render_buffer_id);
+	if (region)
+		SetViewport(state.viewport_width, state.viewport_height, region->x, region->y);
+	else
+		SetViewport(state.viewport_width, state.viewport_height);
 
 	if (state.texture_1_id)
 		BindTexture(0, state.texture_1_id);
@@ -449,14 +1004,16 @@ void GPUDriverD3D11::DrawGeometry(uint32_t geometry_id,
 
 	UpdateConstantBuffer(state);
 
-	BindGeometry(geometry_id);
+	const GeometryEntry* geometry = BindGeometry(geometry_id);
+	if (!geometry)
+		return;
 
 	auto immediate_ctx = context_->immediate_context();
 
 	auto sampler_state = GetSamplerState();
 	immediate_ctx->PSSetSamplers(0, 1, sampler_state.GetAddressOf());
 
-	BindShader(state.shader_type);
+	BindShader(state.shader_type, fill_variant);
 
 	if (state.enable_blend)
 		context_->EnableBlend();
@@ -469,6 +1026,21 @@ void GPUDriverD3D11::DrawGeometry(uint32_t geometry_id,
 			= { (LONG)(state.scissor_rect.left), (LONG)(state.scissor_rect.top),
 				(LONG)(state.scissor_rect.right), (LONG)(state.scissor_rect.bottom) };
 
+		if (region) {
+			OffsetRect(&scissor_rect, (int)region->x, (int)region->y);
+			RECT bounds = { (LONG)region->x, (LONG)region->y, (LONG)(region->x + region->width),
+				(LONG)(region->y + region->height) };
+			IntersectRect(&scissor_rect, &scissor_rect, &bounds);
+		}
+
+		immediate_ctx->RSSetScissorRects(1, &scissor_rect);
+	}
+	else if (region) {
+		// Keep draws inside this render buffer's region of the shared page.
+		context_->EnableScissor();
+		D3D11_RECT scissor_rect = { (LONG)region->x, (LONG)region->y,
+			(LONG)(region->x + region->width), (LONG)(region->y + region->height) };
+
 		immediate_ctx->RSSetScissorRects(1, &scissor_rect);
 	}
 	else {
@@ -478,7 +1050,8 @@ void GPUDriverD3D11::DrawGeometry(uint32_t geometry_id,
 	immediate_ctx->VSSetConstantBuffers(0, 1, GetConstantBuffer().GetAddressOf());
 	immediate_ctx->PSSetConstantBuffers(0, 1, GetConstantBuffer().GetAddressOf());
 
-	immediate_ctx->DrawIndexed(indices_count, indices_offset, 0);
+	immediate_ctx->DrawIndexed(indices_count, geometry->first_index + indices_offset,
+		geometry->first_vertex);
 	batch_count_++;
 }
 
@@ -487,25 +1060,725 @@ void GPUDriverD3D11::DrawCommandList()
 	if (command_list_.empty())
 		return;
 
-	batch_count_ = 0;
+	if (capture_.is_open())
+		capture_.DrawCommandList();
 
-	for (auto& cmd : command_list_) {
-		if (cmd.command_type == CommandType::DrawGeometry)
-			DrawGeometry(cmd.geometry_id, cmd.indices_count, cmd.indices_offset, cmd.gpu_state);
-		else if (cmd.command_type == CommandType::ClearRenderBuffer)
-			ClearRenderBuffer(cmd.gpu_state.render_buffer_id);
-		batch_count_++;
+	uint64_t signature = command_list_hash_ ? HashValue(resource_generation_, command_list_hash_) : 0;
+	if (replay_reuse_.Matches(signature)) {
+		command_list_.clear();
+		return;
+	}
+
+	replayed_lists_++;
+	batch_count_ = 0;
+	culler_.BeginFrame();
+
+	// Fence: wait once for the last upload this list samples instead of stalling per draw.
+	uint64_t fence = 0;
+	for (auto& cmd : command_list_) {
+		if (cmd.command_type != CommandType::DrawGeometry)
+			continue;
+
+		for (uint32_t texture_id : { cmd.gpu_state.texture_1_id, cmd.gpu_state.texture_2_id }) {
+			auto i = texture_id ? textures_.find(texture_id) : textures_.end();
+			if (i != textures_.end() && i->second.pending_upload > fence)
+				fence = i->second.pending_upload;
+		}
+	}
+
+	if (fence)
+		WaitForUpload(fence);
+	else
+		ApplyUploads();
+
+	render_pass_graph_.Begin();
+	command_fill_variants_.resize(command_list_.size());
+
+	for (uint32_t i = 0; i < (uint32_t)command_list_.size(); i++) {
+		auto& cmd = command_list_[i];
+		if (!culler_.IsVisible(cmd))
+			continue;
+
+		uint32_t target = GetRenderBufferTexture(cmd.gpu_state.render_buffer_id);
+		if (cmd.command_type == CommandType::ClearRenderBuffer) {
+			render_pass_graph_.AddClear(target, i);
+			continue;
+		}
+
+		if (cmd.command_type != CommandType::DrawGeometry)
+			continue;
+
+		// Without blending an opaque fill replaces whatever was there, unless it discards. The
+		// texture can be larger than the viewport, the clear is only redundant if every texel is
+		// drawn, stale ones past the viewport bleed into bilinear samples at the edge.
+		FillVariant fill_variant = fill_classifier_.Classify(cmd);
+		command_fill_variants_[i] = fill_variant;
+		auto texture = textures_.find(target);
+		bool covers_target = texture != textures_.end() && !cmd.gpu_state.enable_blend
+			&& (fill_variant == FillVariant::Solid || fill_variant == FillVariant::Image)
+			&& culler_.CoversTarget(cmd, texture->second.width, texture->second.height);
+
+		render_pass_graph_.AddDraw(target, i, cmd.gpu_state.texture_1_id,
+			cmd.gpu_state.texture_2_id, covers_target);
+	}
+
+	render_pass_graph_.Build(pass_commands_, composited_textures_);
+
+	for (uint32_t i : pass_commands_) {
+		auto& cmd = command_list_[i];
+		if (cmd.command_type == CommandType::DrawGeometry)
+			DrawGeometry(cmd.geometry_id, cmd.indices_count, cmd.indices_offset, cmd.gpu_state,
+				command_fill_variants_[i]);
+		else
+			ClearRenderBuffer(cmd.gpu_state.render_buffer_id);
+		batch_count_++;
 	}
 
 	command_list_.clear();
 }
 
+void GPUDriverD3D11::DrawCompositeBatch(uint32_t render_buffer_id,
+	uint32_t viewport_width,
+	uint32_t viewport_height,
+	const CompositeBatch& batch) {
+	if (batch.empty())
+		return;
+
+	LoadCompositeShader();
+	if (!composite_vertex_shader_ || !composite_pixel_shader_)
+		return;
+
+	auto immediate_ctx = context_->immediate_context();
+	auto& instances = batch.instances();
+
+	// Grow the instance buffer geometrically, it is rewritten in full every frame.
+	if (instances.size() > composite_instance_capacity_) {
+		UINT capacity = composite_instance_capacity_ ? composite_instance_capacity_ : 16;
+		while (capacity < instances.size())
+			capacity *= 2;
+
+		D3D11_BUFFER_DESC desc;
+		ZeroMemory(&desc, sizeof(desc));
+		desc.Usage = D3D11_USAGE_DYNAMIC;
+		desc.ByteWidth = capacity * sizeof(CompositeBatch::Instance);
+		desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+		desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+		composite_instance_buffer_.Reset();
+		HRESULT hr = context_->device()->CreateBuffer(&desc, nullptr,
+			composite_instance_buffer_.GetAddressOf());
+		if (FAILED(hr)) {
+			composite_instance_capacity_ = 0;
+			return;
+		}
+		composite_instance_capacity_ = capacity;
+	}
+
+	D3D11_MAPPED_SUBRESOURCE res;
+	immediate_ctx->Map(composite_instance_buffer_.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &res);
+	memcpy(res.pData, instances.data(), instances.size() * sizeof(CompositeBatch::Instance));
+	immediate_ctx->Unmap(composite_instance_buffer_.Get(), 0);
+
+	CompositeUniforms uniforms;
+	uniforms.ViewportSize = { (float)viewport_width, (float)viewport_height, 0.0f, 0.0f };
+	immediate_ctx->Map(composite_constant_buffer_.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &res);
+	memcpy(res.pData, &uniforms, sizeof(CompositeUniforms));
+	immediate_ctx->Unmap(composite_constant_buffer_.Get(), 0);
+
+	BindRenderBuffer(render_buffer_id);
+	SetViewport(viewport_width, viewport_height);
+
+	ID3D11Buffer* buffers[2] = { composite_quad_buffer_.Get(), composite_instance_buffer_.Get() };
+	UINT strides[2] = { sizeof(DirectX::XMFLOAT2), sizeof(CompositeBatch::Instance) };
+	UINT offsets[2] = { 0, 0 };
+	immediate_ctx->IASetVertexBuffers(0, 2, buffers, strides, offsets);
+	immediate_ctx->IASetInputLayout(composite_vertex_layout_.Get());
+	bound_vertex_buffer_ = nullptr;
+	immediate_ctx->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP);
+
+	immediate_ctx->VSSetShader(composite_vertex_shader_.Get(), nullptr, 0);
+	immediate_ctx->PSSetShader(composite_pixel_shader_.Get(), nullptr, 0);
+	immediate_ctx->VSSetConstantBuffers(0, 1, composite_constant_buffer_.GetAddressOf());
+
+	auto sampler_state = GetSamplerState();
+	immediate_ctx->PSSetSamplers(0, 1, sampler_state.GetAddressOf());
+
+	context_->EnableBlend();
+	context_->DisableScissor();
+
+	for (auto& draw : batch.draws()) {
+		for (uint32_t i = 0; i < draw.texture_count; i++) {
+			BindTexture((uint8_t)i, draw.texture_ids[i]);
+			composited_textures_.insert(draw.texture_ids[i]);
+		}
+
+		immediate_ctx->DrawInstanced(4, draw.instance_count, 0, draw.first_instance);
+		batch_count_++;
+	}
+}
+
+bool GPUDriverD3D11::UpdateAlphaMask(uint32_t texture_id, uint32_t width, uint32_t height,
+	AlphaMask& mask) {
+	auto i = textures_.find(texture_id);
+	if (i == textures_.end() || !i->second.is_render_target || i->second.evicted || !width
+		|| !height)
+		return false;
+
+	auto immediate_ctx = context_->immediate_context();
+	auto& readback = alpha_masks_[texture_id];
+	bool updated = false;
+
+	if (readback.pending) {
+		D3D11_MAPPED_SUBRESOURCE res;
+		HRESULT hr = immediate_ctx->Map(readback.staging.Get(), 0, D3D11_MAP_READ,
+			D3D11_MAP_FLAG_DO_NOT_WAIT, &res);
+		if (hr == DXGI_ERROR_WAS_STILL_DRAWING)
+			return false;
+
+		readback.pending = false;
+		if (SUCCEEDED(hr)) {
+			if (mask.width() != readback.source_width || mask.height() != readback.source_height)
+				mask.Resize(readback.source_width, readback.source_height);
+
+			mask.SetCells((const uint8_t*)res.pData, res.RowPitch);
+			immediate_ctx->Unmap(readback.staging.Get(), 0);
+			updated = true;
+		}
+	}
+
+	if (readback.render_count == i->second.render_count)
+		return updated;
+
+	LoadAlphaMaskShader();
+	if (!alpha_mask_vertex_shader_ || !alpha_mask_pixel_shader_ || !alpha_mask_constant_buffer_)
+		return updated;
+
+	uint32_t cells_x = (width + AlphaMask::kCellSize - 1) / AlphaMask::kCellSize;
+	uint32_t cells_y = (height + AlphaMask::kCellSize - 1) / AlphaMask::kCellSize;
+	if ((readback.cells_x != cells_x || readback.cells_y != cells_y)
+		&& !CreateAlphaMaskReadback(readback, cells_x, cells_y))
+		return updated;
+
+	int32_t x = 0;
+	int32_t y = 0;
+	if (i->second.in_atlas) {
+		auto region = atlas_.Find(texture_id);
+		x = (int32_t)region->x;
+		y = (int32_t)region->y;
+	}
+
+	AlphaMaskUniforms uniforms = {
+		{ x, y, x + (int32_t)width, y + (int32_t)height },
+		{ (int32_t)AlphaMask::kCellSize, 0, 0, 0 }
+	};
+
+	D3D11_MAPPED_SUBRESOURCE res;
+	immediate_ctx->Map(alpha_mask_constant_buffer_.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &res);
+	memcpy(res.pData, &uniforms, sizeof(AlphaMaskUniforms));
+	immediate_ctx->Unmap(alpha_mask_constant_buffer_.Get(), 0);
+
+	// Resolves multisampled targets and atlas pages if needed.
+	BindTexture(0, texture_id);
+
+	immediate_ctx->OMSetRenderTargets(1, readback.render_target_view.GetAddressOf(), nullptr);
+	SetViewport(cells_x, cells_y);
+
+	// Fullscreen triangle generated from SV_VertexID, no vertex buffers.
+	immediate_ctx->IASetInputLayout(nullptr);
+	bound_vertex_buffer_ = nullptr;
+	immediate_ctx->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+
+	immediate_ctx->VSSetShader(alpha_mask_vertex_shader_.Get(), nullptr, 0);
+	immediate_ctx->PSSetShader(alpha_mask_pixel_shader_.Get(), nullptr, 0);
+	immediate_ctx->PSSetConstantBuffers(0, 1, alpha_mask_constant_buffer_.GetAddressOf());
+
+	context_->DisableBlend();
+	context_->DisableScissor();
+
+	immediate_ctx->Draw(3, 0);
+	immediate_ctx->CopyResource(readback.staging.Get(), readback.texture.Get());
+
+	readback.render_count = i->second.render_count;
+	readback.source_width = width;
+	readback.source_height = height;
+	readback.pending = true;
+
+	return updated;
+}
+
+bool GPUDriverD3D11::CreateAlphaMaskReadback(AlphaMaskReadback& readback, uint32_t cells_x,
+	uint32_t cells_y) {
+	readback = AlphaMaskReadback();
+
+	D3D11_TEXTURE2D_DESC desc;
+	ZeroMemory(&desc, sizeof(desc));
+	desc.Width = cells_x;
+	desc.Height = cells_y;
+	desc.MipLevels = 1;
+	desc.ArraySize = 1;
+	desc.Format = DXGI_FORMAT_R8_UNORM;
+	desc.SampleDesc.Count = 1;
+	desc.Usage = D3D11_USAGE_DEFAULT;
+	desc.BindFlags = D3D11_BIND_RENDER_TARGET;
+
+	auto device = context_->device();
+	HRESULT hr = device->CreateTexture2D(&desc, nullptr, readback.texture.GetAddressOf());
+	if (SUCCEEDED(hr))
+		hr = device->CreateRenderTargetView(readback.texture.Get(), nullptr,
+			readback.render_target_view.GetAddressOf());
+
+	desc.Usage = D3D11_USAGE_STAGING;
+	desc.BindFlags = 0;
+	desc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
+	if (SUCCEEDED(hr))
+		hr = device->CreateTexture2D(&desc, nullptr, readback.staging.GetAddressOf());
+
+	if (FAILED(hr)) {
+		readback = AlphaMaskReadback();
+		return false;
+	}
+
+	readback.cells_x = cells_x;
+	readback.cells_y = cells_y;
+	return true;
+}
+
 void GPUDriverD3D11::UpdateCommandList(const CommandList& list)
 {
+	if (capture_.is_open())
+		capture_.UpdateCommandList(list);
+
 	if (list.size) {
 		command_list_.resize(list.size);
 		memcpy(&command_list_[0], list.commands, sizeof(Command) * list.size);
+		command_list_hash_ = HashCommandList(list.commands, list.size);
+	}
+}
+
+void GPUDriverD3D11::set_msaa_policy(const MSAAPolicyConfig& config) {
+	MSAAPolicyConfig clamped = config;
+
+#if ENABLE_MSAA
+	// Step down to the highest sample count the device supports for our format.
+	while (clamped.max_samples > 1) {
+		UINT quality_levels = 0;
+		context_->device()->CheckMultisampleQualityLevels(DXGI_FORMAT_B8G8R8A8_UNORM,
+			clamped.max_samples, &quality_levels);
+		if (quality_levels)
+			break;
+		clamped.max_samples /= 2;
+	}
+#else
+	clamped.max_samples = 1;
+#endif
+
+	// Without ID3D11DeviceContext1 there are no atlas pages to leave small targets for.
+	clamped.atlas_region_size = immediate_context1_ ? kAtlasMaxRegionSize : 0;
+
+	msaa_policy_.set_config(clamped);
+}
+
+MSAAReport GPUDriverD3D11::msaa_report() const {
+	MSAAReport report;
+	report.overhead_bytes = msaa_policy_.used_bytes();
+	report.budget_bytes = msaa_policy_.config().memory_budget;
+	report.resolves = resolve_count_;
+	report.skipped_resolves = skipped_resolve_count_;
+
+	for (auto& i : textures_) {
+		if (!i.second.is_render_target)
+			continue;
+
+		MSAAReport::Entry entry;
+		entry.texture_id = i.first;
+		entry.width = i.second.width;
+		entry.height = i.second.height;
+		entry.samples = i.second.samples;
+		entry.in_atlas = i.second.in_atlas;
+		entry.overhead_bytes = i.second.in_atlas ? 0
+			: MSAAPolicy::OverheadBytes(i.second.width, i.second.height, i.second.samples);
+		report.entries.push_back(entry);
+	}
+
+	return report;
+}
+
+void GPUDriverD3D11::LogMSAAReport() const {
+	MSAAReport report = msaa_report();
+
+	std::ostringstream info;
+	info << "MSAA memory: " << report.overhead_bytes / 1024 << " KB of " << report.budget_bytes / 1024
+		<< " KB budget, " << report.resolves << " resolves, " << report.skipped_resolves
+		<< " skipped (target unchanged)" << std::endl;
+
+	for (auto& entry : report.entries) {
+		info << "  texture " << entry.texture_id << " " << entry.width << "x" << entry.height << " "
+			<< entry.samples << "x" << (entry.in_atlas ? " (atlas)" : "") << ": "
+			<< entry.overhead_bytes / 1024 << " KB" << std::endl;
+	}
+
+	UL_LOG_INFO(info.str().c_str());
+}
+
+bool GPUDriverD3D11::PlaceInAtlas(uint32_t texture_id) {
+	auto i = textures_.find(texture_id);
+	if (i == textures_.end() || !i->second.is_render_target)
+		return false;
+
+	auto& entry = i->second;
+	if (entry.evicted)
+		return false;
+
+	if (entry.in_atlas) {
+		bool lost = entry.atlas_contents_lost;
+		entry.atlas_contents_lost = false;
+		return lost;
+	}
+
+	if (entry.atlas_rejected)
+		return false;
+
+	// A multisampled target would need a multisampled page, resolved whole for every read.
+	if (entry.samples > 1 || !IsAtlasCandidate(entry.width, entry.height)) {
+		entry.atlas_rejected = true;
+		return false;
+	}
+
+	std::vector<uint32_t> moved;
+	if (!atlas_.Allocate(texture_id, entry.width, entry.height, moved))
+		return false;
+
+	if (!EnsureAtlasPages()) {
+		atlas_.Free(texture_id);
+		entry.atlas_rejected = true;
+		return false;
+	}
+
+	// The standalone texture is released here, that's where the savings come from.
+	resource_generation_++;
+	entry.in_atlas = true;
+	AttachToAtlasPage(texture_id);
+	ClearAtlasRegion(*atlas_.Find(texture_id));
+
+	for (uint32_t moved_id : moved) {
+		auto& moved_entry = textures_[moved_id];
+		moved_entry.atlas_contents_lost = true;
+		AttachToAtlasPage(moved_id);
+		ClearAtlasRegion(*atlas_.Find(moved_id));
+	}
+
+	if (moved.size() || atlas_.region_count() == 1) {
+		AtlasStats stats = atlas_stats();
+		std::ostringstream info;
+		info << "Render target atlas: " << stats.textures << " textures in " << stats.pages
+			<< " pages, saving " << stats.saved_bytes / 1024 << " KB (" << stats.repacks << " repacks)";
+		UL_LOG_INFO(info.str().c_str());
+	}
+
+	return true;
+}
+
+bool GPUDriverD3D11::IsAtlasCandidate(uint32_t width, uint32_t height) const {
+	// ClearView on atlas regions needs ID3D11DeviceContext1.
+	return immediate_context1_ && atlas_.Accepts(width, height);
+}
+
+Rect GPUDriverD3D11::MapAtlasUV(uint32_t texture_id, const Rect& uv) {
+	auto i = textures_.find(texture_id);
+	if (i == textures_.end() || !i->second.in_atlas)
+		return uv;
+
+	auto region = atlas_.Find(texture_id);
+	auto& page = atlas_pages_[region->page];
+	float page_width = (float)page.width;
+	float page_height = (float)page.height;
+	float width = (float)i->second.width;
+	float height = (float)i->second.height;
+
+	return {
+		(region->x + uv.left * width) / page_width,
+		(region->y + uv.top * height) / page_height,
+		(region->x + uv.right * width) / page_width,
+		(region->y + uv.bottom * height) / page_height
+	};
+}
+
+AtlasStats GPUDriverD3D11::atlas_stats() const {
+	AtlasStats stats;
+	stats.pages = 0;
+	for (auto& page : atlas_pages_) {
+		if (page.texture)
+			stats.pages++;
+	}
+
+	stats.textures = (uint32_t)atlas_.region_count();
+	stats.repacks = atlas_.repack_count();
+	stats.page_bytes = atlas_.page_bytes();
+	stats.standalone_bytes = atlas_.standalone_bytes();
+	stats.saved_bytes = (int64_t)stats.standalone_bytes - (int64_t)stats.page_bytes;
+	return stats;
+}
+
+const RenderTargetAtlas::Region* GPUDriverD3D11::GetAtlasRegion(uint32_t render_buffer_id) {
+	auto i = render_targets_.find(render_buffer_id);
+	if (i == render_targets_.end())
+		return nullptr;
+
+	auto j = textures_.find(i->second.render_target_texture_id);
+	if (j == textures_.end() || !j->second.in_atlas)
+		return nullptr;
+
+	return atlas_.Find(j->first);
+}
+
+bool GPUDriverD3D11::EnsureAtlasPages() {
+	if (atlas_pages_.size() < atlas_.page_count())
+		atlas_pages_.resize(atlas_.page_count());
+
+	for (uint32_t n = 0; n < atlas_pages_.size(); n++) {
+		uint32_t width = atlas_.page_width(n);
+		uint32_t height = atlas_.page_height(n);
+		if (atlas_pages_[n].width == width && atlas_pages_[n].height == height)
+			continue;
+
+		if (!ResizeAtlasPage(n, width, height))
+			return false;
+	}
+
+	return true;
+}
+
+bool GPUDriverD3D11::ResizeAtlasPage(uint32_t page_index, uint32_t width, uint32_t height) {
+	auto& page = atlas_pages_[page_index];
+	uint64_t key = ResidencyTracker::Key(ResidencyKind::AtlasPage, page_index);
+
+	// The last region left, give the memory back.
+	if (!width || !height) {
+		page = AtlasPage();
+		residency_.Remove(key);
+		return true;
+	}
+
+	AtlasPage resized;
+	resized.width = width;
+	resized.height = height;
+
+	D3D11_TEXTURE2D_DESC desc;
+	ZeroMemory(&desc, sizeof(desc));
+	desc.Width = width;
+	desc.Height = height;
+	desc.MipLevels = desc.ArraySize = 1;
+	desc.Format = DXGI_FORMAT_B8G8R8A8_UNORM;
+	desc.SampleDesc.Count = 1;
+	desc.Usage = D3D11_USAGE_DEFAULT;
+	desc.BindFlags = D3D11_BIND_RENDER_TARGET | D3D11_BIND_SHADER_RESOURCE;
+
+	HRESULT hr = context_->device()->CreateTexture2D(&desc, NULL, resized.texture.GetAddressOf());
+	if (FAILED(hr))
+		return false;
+
+	D3D11_RENDER_TARGET_VIEW_DESC rtv_desc;
+	ZeroMemory(&rtv_desc, sizeof(rtv_desc));
+	rtv_desc.Format = desc.Format;
+	rtv_desc.ViewDimension = D3D11_RTV_DIMENSION_TEXTURE2D;
+
+	hr = context_->device()->CreateRenderTargetView(resized.texture.Get(), &rtv_desc,
+		resized.render_target_view.GetAddressOf());
+	if (FAILED(hr))
+		return false;
+
+	D3D11_SHADER_RESOURCE_VIEW_DESC srv_desc;
+	ZeroMemory(&srv_desc, sizeof(srv_desc));
+	srv_desc.Format = desc.Format;
+	srv_desc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
+	srv_desc.Texture2D.MostDetailedMip = 0;
+	srv_desc.Texture2D.MipLevels = 1;
+
+	hr = context_->device()->CreateShaderResourceView(resized.texture.Get(), &srv_desc,
+		resized.texture_srv.GetAddressOf());
+	if (FAILED(hr))
+		return false;
+
+	float color[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+	context_->immediate_context()->ClearRenderTargetView(resized.render_target_view.Get(), color);
+
+	// Regions keep their place when a page grows, carry their contents over.
+	if (page.texture) {
+		D3D11_BOX box = { 0, 0, 0, page.width < width ? page.width : width,
+			page.height < height ? page.height : height, 1 };
+		context_->immediate_context()->CopySubresourceRegion(resized.texture.Get(), 0, 0, 0, 0,
+			page.texture.Get(), 0, &box);
+		residency_.Resize(key, EstimateRenderTargetBytes(width, height, 1));
 	}
+	else {
+		residency_.Add(key, ResidencyKind::AtlasPage, EstimateRenderTargetBytes(width, height, 1));
+	}
+
+	page = resized;
+	resource_generation_++;
+
+	for (auto& i : textures_) {
+		auto region = i.second.in_atlas ? atlas_.Find(i.first) : nullptr;
+		if (region && region->page == page_index)
+			AttachToAtlasPage(i.first);
+	}
+
+	return true;
+}
+
+void GPUDriverD3D11::AttachToAtlasPage(uint32_t texture_id) {
+	auto& entry = textures_[texture_id];
+	auto& page = atlas_pages_[atlas_.Find(texture_id)->page];
+
+	entry.texture = page.texture;
+	entry.texture_srv = page.texture_srv;
+	entry.resolve_texture.Reset();
+	entry.resolve_texture_srv.Reset();
+	entry.needs_resolve = false;
+	entry.samples = 1;
+	entry.is_msaa_render_target = false;
+
+	// The page carries the memory cost now.
+	msaa_policy_.Release(texture_id);
+	residency_.Resize(ResidencyTracker::Key(ResidencyKind::RenderTarget, texture_id), 0);
+
+	for (auto& i : render_targets_) {
+		if (i.second.render_target_texture_id == texture_id)
+			i.second.render_target_view = page.render_target_view;
+	}
+}
+
+void GPUDriverD3D11::ClearAtlasRegion(const RenderTargetAtlas::Region& region) {
+	auto& page = atlas_pages_[region.page];
+
+	float color[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+	D3D11_RECT rect = { (LONG)region.x, (LONG)region.y, (LONG)(region.x + region.width),
+		(LONG)(region.y + region.height) };
+	immediate_context1_->ClearView(page.render_target_view.Get(), color, &rect, 1);
+}
+
+bool GPUDriverD3D11::StartCapture(const char* path) {
+	if (!capture_.Open(path)) {
+		MessageBoxW(nullptr, L"GPUDriverD3D11::StartCapture, unable to open capture file.", L"Error",
+			MB_OK);
+		return false;
+	}
+
+	UL_LOG_INFO((std::string("Capturing GPU commands to ") + path).c_str());
+	return true;
+}
+
+void GPUDriverD3D11::StopCapture() {
+	if (!capture_.is_open())
+		return;
+
+	std::ostringstream info;
+	info << "GPU command capture stopped: " << capture_.frame_count() << " frames, "
+		<< capture_.bytes_written() / 1024 << " KB";
+	UL_LOG_INFO(info.str().c_str());
+
+	capture_.Close();
+}
+
+void GPUDriverD3D11::SetRenderTargetHidden(uint32_t texture_id, bool hidden) {
+	residency_.SetHidden(ResidencyTracker::Key(ResidencyKind::RenderTarget, texture_id), hidden);
+}
+
+bool GPUDriverD3D11::EnsureResident(uint32_t texture_id) {
+	auto i = textures_.find(texture_id);
+	if (i == textures_.end() || !i->second.is_render_target)
+		return false;
+
+	if (i->second.evicted)
+		RestoreRenderTarget(texture_id);
+
+	bool lost = i->second.residency_contents_lost;
+	i->second.residency_contents_lost = false;
+	return lost;
+}
+
+void GPUDriverD3D11::EnforceResidencyBudget() {
+	residency_.set_now(GetTickCount64());
+
+	std::vector<uint64_t> keys;
+	residency_.CollectEvictions(keys);
+	if (keys.empty())
+		return;
+
+	for (uint64_t key : keys)
+		EvictRenderTarget((uint32_t)key);
+
+	LogResidencyStats();
+}
+
+void GPUDriverD3D11::LogResidencyStats() const {
+	ResidencyStats stats = residency_stats();
+
+	std::ostringstream info;
+	info << "GPU residency: " << stats.resident_bytes / 1024 << " KB of " << stats.budget_bytes / 1024
+		<< " KB budget (peak " << stats.peak_bytes / 1024 << " KB), "
+		<< stats.bytes_by_kind[(size_t)ResidencyKind::RenderTarget] / 1024 << " KB render targets, "
+		<< stats.bytes_by_kind[(size_t)ResidencyKind::AtlasPage] / 1024 << " KB atlas pages, "
+		<< stats.bytes_by_kind[(size_t)ResidencyKind::Texture] / 1024 << " KB textures, "
+		<< stats.bytes_by_kind[(size_t)ResidencyKind::Geometry] / 1024 << " KB geometry; "
+		<< stats.evicted_count << " evicted now, " << stats.evictions << " evictions ("
+		<< stats.evicted_bytes / 1024 << " KB), " << stats.restores << " restores";
+	UL_LOG_INFO(info.str().c_str());
+}
+
+void GPUDriverD3D11::EvictRenderTarget(uint32_t texture_id) {
+	auto i = textures_.find(texture_id);
+	if (i == textures_.end() || i->second.evicted)
+		return;
+
+	auto& entry = i->second;
+	if (entry.in_atlas) {
+		atlas_.Free(texture_id);
+		entry.in_atlas = false;
+		entry.atlas_contents_lost = false;
+		EnsureAtlasPages();
+	}
+
+	entry.texture.Reset();
+	entry.texture_srv.Reset();
+	entry.resolve_texture.Reset();
+	entry.resolve_texture_srv.Reset();
+	entry.needs_resolve = false;
+	entry.evicted = true;
+	msaa_policy_.Release(texture_id);
+
+	for (auto& j : render_targets_) {
+		if (j.second.render_target_texture_id == texture_id)
+			j.second.render_target_view.Reset();
+	}
+
+	residency_.MarkEvicted(ResidencyTracker::Key(ResidencyKind::RenderTarget, texture_id));
+	resource_generation_++;
+}
+
+void GPUDriverD3D11::RestoreRenderTarget(uint32_t texture_id) {
+	auto& entry = textures_[texture_id];
+
+	CreateRenderTargetTexture(texture_id, entry);
+	entry.evicted = false;
+	entry.residency_contents_lost = true;
+	// Let PlaceInAtlas try again, there may be room now.
+	entry.atlas_rejected = false;
+
+	float color[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+	for (auto& j : render_targets_) {
+		if (j.second.render_target_texture_id != texture_id)
+			continue;
+
+		HRESULT hr = CreateTextureRenderTargetView(entry,
+			j.second.render_target_view.ReleaseAndGetAddressOf());
+		if (SUCCEEDED(hr))
+			context_->immediate_context()->ClearRenderTargetView(j.second.render_target_view.Get(), color);
+	}
+
+	residency_.MarkRestored(ResidencyTracker::Key(ResidencyKind::RenderTarget, texture_id),
+		EstimateRenderTargetBytes(entry.width, entry.height, entry.samples));
+	resource_generation_++;
 }
 
 void GPUDriverD3D11::LoadVertexShader(const char* path,
@@ -674,17 +1947,222 @@ void GPUDriverD3D11::LoadShaders() {
 			vertex_layout_2f_4ub_2f_2f_28f_.GetAddressOf());
 		LoadCompiledPixelShader(fill_fxc, fill_fxc_len, shader_fill.second.GetAddressOf());
 	}
+
+	if (!Application::instance()->settings().fill_shader_permutations)
+		return;
+
+	// Draws use the uber-shader until the specialized ones are ready.
+	std::string fill_source;
+	if (Application::instance()->settings().load_shaders_from_file_system) {
+		auto fs = ultralight::Platform::instance().file_system();
+		auto buffer = fs ? fs->OpenFile("shaders/hlsl/ps/fill.hlsl") : nullptr;
+		if (buffer)
+			fill_source.assign((const char*)buffer->data(), buffer->size());
+	}
+	else {
+		fill_source.assign((const char*)fill_hlsl, fill_hlsl_len);
+	}
+
+	if (!fill_source.empty()) {
+		fill_variant_thread_ = std::thread(&GPUDriverD3D11::CompileFillVariants, this,
+			std::move(fill_source));
+	}
+}
+
+void GPUDriverD3D11::CompileFillVariants(std::string source) {
+	for (size_t i = (size_t)FillVariant::Solid; i < (size_t)FillVariant::Count; i++) {
+		std::string fill_type = std::to_string(GetFillType((FillVariant)i));
+		const D3D_SHADER_MACRO defines[] = { { "FILL_TYPE", fill_type.c_str() }, { nullptr, nullptr } };
+
+		// A variant that fails to build is simply never used, the uber-shader covers it.
+		ComPtr<ID3DBlob> ps_blob;
+		HRESULT hr = CompileShaderFromSource(source.data(), source.size(), "fill.hlsl", "PS", "ps_4_0",
+			ps_blob.GetAddressOf(), defines);
+		if (SUCCEEDED(hr)) {
+			context_->device()->CreatePixelShader(ps_blob->GetBufferPointer(),
+				ps_blob->GetBufferSize(), nullptr, fill_variant_shaders_[i].GetAddressOf());
+		}
+	}
+
+	fill_variants_ready_ = true;
+}
+
+void GPUDriverD3D11::LogRenderPassStats() const {
+	const RenderPassStats& stats = render_pass_graph_.total_stats();
+	const RenderPassStats& frame = render_pass_graph_.frame_stats();
+
+	std::ostringstream info;
+	info << "Render passes: " << stats.passes << " submitted, " << stats.merged_passes
+		<< " after merging over " << stats.frames << " command lists; " << stats.dropped_clears
+		<< " of " << stats.clears << " clears dropped; " << frame.unsampled_targets
+		<< " render buffers written but never sampled in the last list";
+	UL_LOG_INFO(info.str().c_str());
+}
+
+void GPUDriverD3D11::LogFillVariants() const {
+	const uint64_t* histogram = fill_classifier_.histogram();
+
+	uint64_t total = 0;
+	for (size_t i = 0; i < (size_t)FillVariant::Count; i++)
+		total += histogram[i];
+
+	if (!total)
+		return;
+
+	std::ostringstream info;
+	info << "Fill shader variants" << (fill_variants_ready_ ? "" : " (still compiling)") << ": "
+		<< (total - histogram[(size_t)FillVariant::Uber]) * 100 / total << "% of draws specialized;";
+	for (size_t i = 0; i < (size_t)FillVariant::Count; i++)
+		info << " " << GetFillVariantName((FillVariant)i) << " " << histogram[i];
+	UL_LOG_INFO(info.str().c_str());
 }
 
-void GPUDriverD3D11::BindShader(ShaderType shader) {
+void GPUDriverD3D11::WarmUpShaders() {
+	LoadCompositeShader();
+	LoadAlphaMaskShader();
+}
+
+void GPUDriverD3D11::LoadCompositeShader() {
+	if (composite_vertex_shader_)
+		return;
+
+	HRESULT hr;
+
+	ComPtr<ID3DBlob> vs_blob;
+	hr = CompileShaderFromSource(composite_hlsl, sizeof(composite_hlsl) - 1, "composite.hlsl", "VS",
+		"vs_4_0", vs_blob.GetAddressOf());
+	if (FAILED(hr)) {
+		MessageBoxW(nullptr, L"GPUDriverD3D11::LoadCompositeShader, vertex shader could not be compiled.",
+			L"Error", MB_OK);
+		return;
+	}
+
+	ComPtr<ID3DBlob> ps_blob;
+	hr = CompileShaderFromSource(composite_hlsl, sizeof(composite_hlsl) - 1, "composite.hlsl", "PS",
+		"ps_4_0", ps_blob.GetAddressOf());
+	if (FAILED(hr)) {
+		MessageBoxW(nullptr, L"GPUDriverD3D11::LoadCompositeShader, pixel shader could not be compiled.",
+			L"Error", MB_OK);
+		return;
+	}
+
+	const D3D11_INPUT_ELEMENT_DESC layout_composite[] = {
+	  { "POSITION", 0, DXGI_FORMAT_R32G32_FLOAT, 0, 0, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+	  { "TEXCOORD", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, offsetof(CompositeBatch::Instance, rect),
+		D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+	  { "TEXCOORD", 1, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, offsetof(CompositeBatch::Instance, uv),
+		D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+	  { "TEXCOORD", 2, DXGI_FORMAT_R32_FLOAT, 1, offsetof(CompositeBatch::Instance, opacity),
+		D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+	  { "TEXCOORD", 3, DXGI_FORMAT_R32_UINT, 1, offsetof(CompositeBatch::Instance, texture_slot),
+		D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+	  { "TEXCOORD", 4, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, offsetof(CompositeBatch::Instance, transform),
+		D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+	};
+
+	LoadCompiledVertexShader((unsigned char*)vs_blob->GetBufferPointer(),
+		(unsigned int)vs_blob->GetBufferSize(), composite_vertex_shader_.GetAddressOf(),
+		layout_composite, ARRAYSIZE(layout_composite), composite_vertex_layout_.GetAddressOf());
+	LoadCompiledPixelShader((unsigned char*)ps_blob->GetBufferPointer(),
+		(unsigned int)ps_blob->GetBufferSize(), composite_pixel_shader_.GetAddressOf());
+
+	// Unit quad as a triangle strip, expanded to each overlay's rect in the vertex shader.
+	DirectX::XMFLOAT2 quad[4] = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 0.0f, 1.0f }, { 1.0f, 1.0f } };
+
+	D3D11_BUFFER_DESC quad_desc;
+	ZeroMemory(&quad_desc, sizeof(quad_desc));
+	quad_desc.Usage = D3D11_USAGE_IMMUTABLE;
+	quad_desc.ByteWidth = sizeof(quad);
+	quad_desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+
+	D3D11_SUBRESOURCE_DATA quad_data;
+	ZeroMemory(&quad_data, sizeof(quad_data));
+	quad_data.pSysMem = quad;
+
+	hr = context_->device()->CreateBuffer(&quad_desc, &quad_data, composite_quad_buffer_.GetAddressOf());
+	if (FAILED(hr)) {
+		MessageBoxW(nullptr, L"GPUDriverD3D11::LoadCompositeShader, unable to create quad buffer.",
+			L"Error", MB_OK);
+	}
+
+	D3D11_BUFFER_DESC cb_desc;
+	ZeroMemory(&cb_desc, sizeof(cb_desc));
+	cb_desc.Usage = D3D11_USAGE_DYNAMIC;
+	cb_desc.ByteWidth = sizeof(CompositeUniforms);
+	cb_desc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+	cb_desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+	hr = context_->device()->CreateBuffer(&cb_desc, nullptr, composite_constant_buffer_.GetAddressOf());
+	if (FAILED(hr)) {
+		MessageBoxW(nullptr, L"GPUDriverD3D11::LoadCompositeShader, unable to create constant buffer.",
+			L"Error", MB_OK);
+	}
+}
+
+void GPUDriverD3D11::LoadAlphaMaskShader() {
+	if (alpha_mask_vertex_shader_)
+		return;
+
+	HRESULT hr;
+
+	ComPtr<ID3DBlob> vs_blob;
+	hr = CompileShaderFromSource(alpha_mask_hlsl, sizeof(alpha_mask_hlsl) - 1, "alpha_mask.hlsl",
+		"VS", "vs_4_0", vs_blob.GetAddressOf());
+	if (FAILED(hr)) {
+		MessageBoxW(nullptr, L"GPUDriverD3D11::LoadAlphaMaskShader, vertex shader could not be compiled.",
+			L"Error", MB_OK);
+		return;
+	}
+
+	ComPtr<ID3DBlob> ps_blob;
+	hr = CompileShaderFromSource(alpha_mask_hlsl, sizeof(alpha_mask_hlsl) - 1, "alpha_mask.hlsl",
+		"PS", "ps_4_0", ps_blob.GetAddressOf());
+	if (FAILED(hr)) {
+		MessageBoxW(nullptr, L"GPUDriverD3D11::LoadAlphaMaskShader, pixel shader could not be compiled.",
+			L"Error", MB_OK);
+		return;
+	}
+
+	// No input layout, the vertex shader only reads SV_VertexID.
+	hr = context_->device()->CreateVertexShader(vs_blob->GetBufferPointer(), vs_blob->GetBufferSize(),
+		nullptr, alpha_mask_vertex_shader_.GetAddressOf());
+	if (FAILED(hr)) {
+		MessageBoxW(nullptr, L"GPUDriverD3D11::LoadAlphaMaskShader, vertex shader could not be created.",
+			L"Error", MB_OK);
+		return;
+	}
+
+	LoadCompiledPixelShader((unsigned char*)ps_blob->GetBufferPointer(),
+		(unsigned int)ps_blob->GetBufferSize(), alpha_mask_pixel_shader_.GetAddressOf());
+
+	D3D11_BUFFER_DESC cb_desc;
+	ZeroMemory(&cb_desc, sizeof(cb_desc));
+	cb_desc.Usage = D3D11_USAGE_DYNAMIC;
+	cb_desc.ByteWidth = sizeof(AlphaMaskUniforms);
+	cb_desc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+	cb_desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+	hr = context_->device()->CreateBuffer(&cb_desc, nullptr, alpha_mask_constant_buffer_.GetAddressOf());
+	if (FAILED(hr)) {
+		MessageBoxW(nullptr, L"GPUDriverD3D11::LoadAlphaMaskShader, unable to create constant buffer.",
+			L"Error", MB_OK);
+	}
+}
+
+void GPUDriverD3D11::BindShader(ShaderType shader, FillVariant fill_variant) {
 	LoadShaders();
 
 	ShaderType shader_type = (ShaderType)shader;
 	switch (shader_type) {
 	case ShaderType::Fill: {
 		auto& shader = shaders_[ShaderType::Fill];
+		ID3D11PixelShader* pixel_shader = shader.second.Get();
+		if (fill_variant != FillVariant::Uber && fill_variants_ready_
+			&& fill_variant_shaders_[(size_t)fill_variant])
+			pixel_shader = fill_variant_shaders_[(size_t)fill_variant].Get();
+
 		context_->immediate_context()->VSSetShader(shader.first.Get(), nullptr, 0);
-		context_->immediate_context()->PSSetShader(shader.second.Get(), nullptr, 0);
+		context_->immediate_context()->PSSetShader(pixel_shader, nullptr, 0);
 		break;
 	}
 	case ShaderType::FillPath: {
@@ -709,21 +2187,46 @@ void GPUDriverD3D11::BindVertexLayout(VertexBufferFormat format) {
 	};
 }
 
-void GPUDriverD3D11::BindGeometry(uint32_t id) {
+const GPUDriverD3D11::GeometryEntry* GPUDriverD3D11::BindGeometry(uint32_t id) {
 	auto i = geometry_.find(id);
 	if (i == geometry_.end())
-		return;
+		return nullptr;
 
 	auto immediate_ctx = context_->immediate_context();
 
+	// All geometry of a format shares one arena, so consecutive draws rarely rebind anything.
+	// Only dynamic geometry has buffers of its own.
 	auto& geometry = i->second;
-	UINT stride = geometry.format == VertexBufferFormat::_2f_4ub_2f ? sizeof(::Vertex_2f_4ub_2f)
-		: sizeof(::Vertex_2f_4ub_2f_2f_28f);
-	UINT offset = 0;
-	immediate_ctx->IASetVertexBuffers(0, 1, geometry.vertexBuffer.GetAddressOf(), &stride, &offset);
-	immediate_ctx->IASetIndexBuffer(geometry.indexBuffer.Get(), DXGI_FORMAT_R32_UINT, 0);
-	immediate_ctx->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-	BindVertexLayout(geometry.format);
+	auto& arena = vertex_arenas_[(size_t)geometry.format];
+	bool dynamic = geometry.usage == UsageClass::Dynamic;
+	ID3D11Buffer* vertex_buffer = dynamic ? geometry.dynamic_vertex_buffer.Get() : arena.buffer.Get();
+	ID3D11Buffer* index_buffer = dynamic ? geometry.dynamic_index_buffer.Get()
+		: index_arena_.buffer.Get();
+
+	if (vertex_buffer != bound_vertex_buffer_) {
+		UINT stride = arena.element_size;
+		UINT offset = 0;
+		immediate_ctx->IASetVertexBuffers(0, 1, &vertex_buffer, &stride, &offset);
+		immediate_ctx->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+		BindVertexLayout(geometry.format);
+		bound_vertex_buffer_ = vertex_buffer;
+	}
+
+	if (index_buffer != bound_index_buffer_) {
+		immediate_ctx->IASetIndexBuffer(index_buffer, DXGI_FORMAT_R32_UINT, 0);
+		bound_index_buffer_ = index_buffer;
+	}
+
+	return &geometry;
+}
+
+uint32_t GPUDriverD3D11::GetRenderBufferTexture(uint32_t render_buffer_id) const {
+	auto i = render_targets_.find(render_buffer_id);
+	if (i != render_targets_.end())
+		return i->second.render_target_texture_id;
+
+	// Swap chain buffers have no texture id, keep them apart from real ones.
+	return 0x80000000u | render_buffer_id;
 }
 
 ID3D11RenderTargetView* GPUDriverD3D11::GetRenderTargetView(uint32_t render_buffer_id) {
@@ -731,9 +2234,6 @@ ID3D11RenderTargetView* GPUDriverD3D11::GetRenderTargetView(uint32_t render_buff
 
 	auto i = render_targets_.find(render_buffer_id);
 	if (i != render_targets_.end()) {
-		target = i->second.render_target_view.Get();
-
-#if ENABLE_MSAA
 		auto j = textures_.find(i->second.render_target_texture_id);
 		if (j == textures_.end()) {
 			MessageBoxW(nullptr,
@@ -742,12 +2242,18 @@ ID3D11RenderTargetView* GPUDriverD3D11::GetRenderTargetView(uint32_t render_buff
 			return nullptr;
 		}
 
+		// A hidden view may still render, bring its texture back (contents are lost).
+		if (j->second.evicted)
+			RestoreRenderTarget(j->first);
+
+		residency_.Touch(ResidencyTracker::Key(ResidencyKind::RenderTarget, j->first));
+		target = i->second.render_target_view.Get();
+		j->second.render_count++;
+
 		// Flag the MSAA render target texture for Resolve when we bind it to
 		// a shader for reading later.
-		if (j->second.is_msaa_render_target) {
+		if (j->second.is_msaa_render_target)
 			j->second.needs_resolve = true;
-		}
-#endif
 	}
 	else {
 		// Couldn't find the render buffer id in our local render target map.
@@ -807,15 +2313,15 @@ ComPtr<ID3D11Buffer> GPUDriverD3D11::GetConstantBuffer() {
 	return constant_buffer_;
 }
 
-void GPUDriverD3D11::SetViewport(uint32_t width, uint32_t height) {
+void GPUDriverD3D11::SetViewport(uint32_t width, uint32_t height, uint32_t x, uint32_t y) {
 	D3D11_VIEWPORT vp;
 	ZeroMemory(&vp, sizeof(vp));
 	vp.Width = (float)width;
 	vp.Height = (float)height;
 	vp.MinDepth = 0.0f;
 	vp.MaxDepth = 1.0f;
-	vp.TopLeftX = 0;
-	vp.TopLeftY = 0;
+	vp.TopLeftX = (float)x;
+	vp.TopLeftY = (float)y;
 	context_->immediate_context()->RSSetViewports(1, &vp);
 }
 
@@ -1,12 +1,31 @@
 #pragma  once
-#include <d3d11.h>
+#include <d3d11_1.h>
+#include <atomic>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
 #include <vector>
 #include <wrl/client.h>
 
 #include <Ultralight/platform/GPUDriver.h>
 
+#include "AlphaMask.h"
+#include "ArenaAllocator.h"
+#include "AtlasPacker.h"
+#include "CommandStream.h"
+#include "CompositeBatch.h"
+#include "DrawCuller.h"
+#include "FillClassifier.h"
+#include "FrameReuse.h"
+#include "MSAAPolicy.h"
+#include "RenderPassGraph.h"
+#include "ResidencyTracker.h"
+#include "UploadQueue.h"
+#include "UsagePolicy.h"
+
 #pragma comment (lib, "D3DCompiler.lib")
 
 using namespace ultralight;
@@ -14,6 +33,37 @@ using Microsoft::WRL::ComPtr;
 
 class GPUContextD3D11;
 
+struct AtlasStats {
+	uint32_t pages;
+	uint32_t textures;
+	uint32_t repacks;
+	uint64_t page_bytes;        // memory held by atlas pages, as allocated
+	uint64_t standalone_bytes;  // memory the atlased textures would need on their own
+	int64_t saved_bytes;
+};
+
+struct UsageStats {
+	UsageClassStats textures;
+	UsageClassStats geometry;
+};
+
+struct MSAAReport {
+	struct Entry {
+		uint32_t texture_id;
+		uint32_t width;
+		uint32_t height;
+		uint32_t samples;
+		bool in_atlas;
+		uint64_t overhead_bytes;  // multisampled surface on top of the resolve texture
+	};
+
+	std::vector<Entry> entries;
+	uint64_t overhead_bytes;
+	uint64_t budget_bytes;
+	uint32_t resolves;
+	uint32_t skipped_resolves;
+};
+
 class GPUDriverD3D11 : public GPUDriver {
 public:
 	GPUDriverD3D11(GPUContextD3D11* context);
@@ -34,26 +84,173 @@ public:
 	virtual void DrawGeometry(uint32_t geometry_id,
 		uint32_t indices_count,
 		uint32_t indices_offset,
-		const ultralight::GPUState& state);
+		const ultralight::GPUState& state,
+		FillVariant fill_variant = FillVariant::Uber);
 
 	virtual bool HasCommandsPending() { return !command_list_.empty(); };
 
+	///
+	/// Replay the pending command list. Skipped when it is identical to the last one and no
+	/// resource changed in between, since it would redraw the same pixels.
+	///
+	/// Commands run in render pass order, see RenderPassGraph.
+	///
 	virtual void DrawCommandList();
 
 	virtual int batch_count() const { return batch_count_; };
 
+	///
+	/// Draws of the last replayed command list that were dropped because they couldn't touch
+	/// any pixel (empty scissor rect or outside the viewport).
+	///
+	virtual uint32_t culled_count() const { return culler_.culled_count(); }
+
+	virtual const FrameReuse& replay_reuse() const { return replay_reuse_; }
+
+	///
+	/// How many replayed draws could use each specialized fill shader, see FillClassifier.
+	///
+	virtual void LogFillVariants() const;
+
+	virtual const RenderPassStats& render_pass_stats() const {
+		return render_pass_graph_.total_stats();
+	}
+
+	virtual void LogRenderPassStats() const;
+
+	///
+	/// Changes whenever a resource changes or a command list is replayed, ie, whenever the
+	/// contents of any texture the compositor samples may have changed.
+	///
+	virtual uint64_t content_generation() const { return resource_generation_ + replayed_lists_; }
+
+	///
+	/// Composite a batch of overlay quads into a render buffer.
+	///
+	/// Issues one instanced draw per CompositeBatch::Draw, binding each draw's textures to
+	/// consecutive slots.
+	///
+	virtual void DrawCompositeBatch(uint32_t render_buffer_id, uint32_t viewport_width,
+		uint32_t viewport_height, const CompositeBatch& batch);
+
+	///
+	/// Move a view's render target texture into a shared atlas page if it is small enough.
+	/// Multisampled render targets are never placed, atlas pages are single-sample.
+	///
+	/// Only call this for textures that are sampled by the compositor alone (view render
+	/// targets), Ultralight's own uv coordinates are not remapped.
+	///
+	/// @return Returns true if the texture contents were discarded (newly placed or moved by a
+	///         repack) and the view has to be repainted.
+	///
+	virtual bool PlaceInAtlas(uint32_t texture_id);
+
+	///
+	/// Map uv coordinates of a texture into its atlas page. Identity for standalone textures.
+	///
+	virtual Rect MapAtlasUV(uint32_t texture_id, const Rect& uv);
+
+	virtual AtlasStats atlas_stats() const;
+
+	///
+	/// Configure how render targets pick their antialiasing level. Only affects textures
+	/// created afterwards. The sample count is clamped to what the device supports.
+	///
+	virtual void set_msaa_policy(const MSAAPolicyConfig& config);
+
+	///
+	/// Per render target MSAA memory overhead and resolve counters.
+	///
+	virtual MSAAReport msaa_report() const;
+
+	virtual void LogMSAAReport() const;
+
+	virtual void set_residency_config(const ResidencyConfig& config) { residency_.set_config(config); }
+
+	///
+	/// Mark a view's render target as belonging to a hidden overlay, making it a candidate for
+	/// eviction by EnforceResidencyBudget.
+	///
+	virtual void SetRenderTargetHidden(uint32_t texture_id, bool hidden);
+
+	///
+	/// Recreate a render target if it was evicted.
+	///
+	/// @return Returns true if the texture contents were discarded since the last call and the
+	///         view has to be repainted.
+	///
+	virtual bool EnsureResident(uint32_t texture_id);
+
+	///
+	/// Evict hidden render targets that have been idle too long or, when over the memory budget,
+	/// least recently used first. Call once per frame.
+	///
+	virtual void EnforceResidencyBudget();
+
+	virtual ResidencyStats residency_stats() const { return residency_.stats(); }
+
+	virtual void LogResidencyStats() const;
+
+	///
+	/// Record every resource update and command list from now on into a binary stream that
+	/// CommandStreamReplayer can feed to any GPUDriver, one frame per DrawCommandList().
+	///
+	/// Resources created before the capture started are not in the stream, start it before
+	/// creating any views to get a self-contained capture.
+	///
+	virtual bool StartCapture(const char* path);
+
+	virtual void StopCapture();
+
+	virtual bool is_capturing() const { return capture_.is_open(); }
+
+	///
+	/// Compile the shaders that are built from HLSL source at runtime (compositor, alpha mask)
+	/// ahead of their first frame. May run on a startup thread before the driver is in use.
+	///
+	virtual void WarmUpShaders();
+
+	///
+	/// How many textures and geometry buffers are in each usage class and how many updates each
+	/// class received, see UsagePolicy.
+	///
+	virtual UsageStats usage_stats() const;
+
+	virtual void LogUsageStats() const;
+
+	///
+	/// Log the counters worth watching over a session: command list reuse, usage classes, fill
+	/// variants and render passes.
+	///
+	virtual void LogStats() const;
+
+	virtual UploadQueueStats upload_stats() const { return upload_queue_.stats(); }
+
+	///
+	/// Refresh the hit test mask of a render target's top-left width x height pixels.
+	///
+	/// The texture is downsampled on the GPU to one texel per AlphaMask cell, copied to a
+	/// staging texture and mapped on a later call once the GPU is done, so this never stalls and
+	/// reads back 1/16th of the pixels. Nothing is copied unless the target was drawn to since
+	/// the last request. Call once per frame after DrawCommandList().
+	///
+	/// @return Returns true if mask was updated.
+	///
+	virtual bool UpdateAlphaMask(uint32_t texture_id, uint32_t width, uint32_t height,
+		AlphaMask& mask);
+
 	///
   /// Called before any state (eg, CreateTexture(), UpdateTexture(), DestroyTexture(), etc.) is
   /// updated during a call to Renderer::Render().
   ///
   /// This is a good time to prepare the GPU for any state updates.
   ///
-	virtual void BeginSynchronize() override {};
+	virtual void BeginSynchronize() override;
 
 	///
 	/// Called after all state has been updated during a call to Renderer::Render().
 	///
-	virtual void EndSynchronize() override {};
+	virtual void EndSynchronize() override;
 
 	///
 	/// Get the next available texture ID.
@@ -70,6 +267,8 @@ public:
 	///
 	/// Create a texture with a certain ID and optional bitmap.
 	///
+	/// Bitmap textures are created on the upload thread, draws that sample them wait for it.
+	///
 	/// @param texture_id  The texture ID to use for the new texture.
 	///
 	/// @param bitmap      The bitmap to initialize the texture with (can be empty).
@@ -85,6 +284,9 @@ public:
 	///
 	/// Update an existing non-RTT texture with new bitmap data.
 	///
+	/// Only dynamic textures are written in place, others are replaced by a new texture created
+	/// on the upload thread.
+	///
 	/// @param texture_id  The texture to update.
 	///
 	/// @param bitmap      The new bitmap data.
@@ -197,6 +399,11 @@ protected:
 	std::vector<ultralight::Command> command_list_;
 	int batch_count_;
 
+	uint64_t command_list_hash_ = 0;
+	uint64_t resource_generation_ = 0;
+	uint64_t replayed_lists_ = 0;
+	FrameReuse replay_reuse_;
+
 	void LoadVertexShader(const char* path, ID3D11VertexShader** ppVertexShader,
 		const D3D11_INPUT_ELEMENT_DESC* pInputElementDescs, UINT NumElements,
 		ID3D11InputLayout** ppInputLayout);
@@ -208,13 +415,22 @@ protected:
 	void LoadCompiledPixelShader(unsigned char* data, unsigned int len,
 		ID3D11PixelShader** ppPixelShader);
 	void LoadShaders();
-	void BindShader(ShaderType shader);
+	void LoadCompositeShader();
+	void LoadAlphaMaskShader();
+	void BindShader(ShaderType shader, FillVariant fill_variant = FillVariant::Uber);
+	void CompileFillVariants(std::string source);
 	void BindVertexLayout(VertexBufferFormat format);
-	void BindGeometry(uint32_t id);
 	ID3D11RenderTargetView* GetRenderTargetView(uint32_t render_buffer_id);
+	uint32_t GetRenderBufferTexture(uint32_t render_buffer_id) const;
 	ComPtr<ID3D11SamplerState> GetSamplerState();
 	ComPtr<ID3D11Buffer> GetConstantBuffer();
-	void SetViewport(uint32_t width, uint32_t height);
+	void SetViewport(uint32_t width, uint32_t height, uint32_t x = 0, uint32_t y = 0);
+	bool IsAtlasCandidate(uint32_t width, uint32_t height) const;
+	const RenderTargetAtlas::Region* GetAtlasRegion(uint32_t render_buffer_id);
+	bool EnsureAtlasPages();
+	bool ResizeAtlasPage(uint32_t page_index, uint32_t width, uint32_t height);
+	void AttachToAtlasPage(uint32_t texture_id);
+	void ClearAtlasRegion(const RenderTargetAtlas::Region& region);
 	void UpdateConstantBuffer(const GPUState& state);
 	Matrix ApplyProjection(const Matrix4x4& transform, float screen_width, float screen_height);
 
@@ -224,28 +440,188 @@ protected:
 	ComPtr<ID3D11SamplerState> sampler_state_;
 	ComPtr<ID3D11Buffer> constant_buffer_;
 
+	ComPtr<ID3D11VertexShader> composite_vertex_shader_;
+	ComPtr<ID3D11PixelShader> composite_pixel_shader_;
+	ComPtr<ID3D11InputLayout> composite_vertex_layout_;
+	ComPtr<ID3D11Buffer> composite_quad_buffer_;
+	ComPtr<ID3D11Buffer> composite_instance_buffer_;
+	UINT composite_instance_capacity_ = 0;
+	ComPtr<ID3D11Buffer> composite_constant_buffer_;
+
+	// Downsampled copies of render targets for hit testing, see UpdateAlphaMask
+	struct AlphaMaskReadback {
+		ComPtr<ID3D11Texture2D> texture;
+		ComPtr<ID3D11RenderTargetView> render_target_view;
+		ComPtr<ID3D11Texture2D> staging;
+		uint32_t cells_x = 0;
+		uint32_t cells_y = 0;
+		uint32_t source_width = 0;
+		uint32_t source_height = 0;
+		uint64_t render_count = 0;  // of the source texture when last requested
+		bool pending = false;
+	};
+	std::map<uint32_t, AlphaMaskReadback> alpha_masks_;
+
+	ComPtr<ID3D11VertexShader> alpha_mask_vertex_shader_;
+	ComPtr<ID3D11PixelShader> alpha_mask_pixel_shader_;
+	ComPtr<ID3D11Buffer> alpha_mask_constant_buffer_;
+
+	bool CreateAlphaMaskReadback(AlphaMaskReadback& readback, uint32_t cells_x, uint32_t cells_y);
+
+	// Geometry lives in shared per-format vertex arenas and one index arena, see StoreGeometry
 	struct GeometryEntry {
 		VertexBufferFormat format;
-		ComPtr<ID3D11Buffer> vertexBuffer;
-		ComPtr<ID3D11Buffer> indexBuffer;
+		uint32_t first_vertex = 0;
+		uint32_t vertex_count = 0;
+		uint32_t first_index = 0;
+		uint32_t index_count = 0;
+
+		// Geometry updated most frames moves out of the arenas into its own dynamic buffers
+		UsageClass usage = UsageClass::Default;
+		ComPtr<ID3D11Buffer> dynamic_vertex_buffer;
+		ComPtr<ID3D11Buffer> dynamic_index_buffer;
 	};
 	typedef std::map<uint32_t, GeometryEntry> GeometryMap;
 	GeometryMap geometry_;
 
+	struct GeometryArena {
+		ComPtr<ID3D11Buffer> buffer;
+		ArenaAllocator allocator;  // in elements (vertices or indices)
+		UINT element_size = 0;
+		UINT bind_flags = 0;
+	};
+
+	static const uint32_t kArenaInitialVertices = 16 * 1024;
+	static const uint32_t kArenaInitialIndices = 64 * 1024;
+
+	GeometryArena vertex_arenas_[2];  // indexed by VertexBufferFormat
+	GeometryArena index_arena_;
+	ID3D11Buffer* bound_vertex_buffer_ = nullptr;
+	ID3D11Buffer* bound_index_buffer_ = nullptr;
+
+	const GeometryEntry* BindGeometry(uint32_t id);
+	bool StoreGeometry(GeometryEntry& geometry, const VertexBuffer& vertices,
+		const IndexBuffer& indices);
+	bool AllocateInArena(GeometryArena& arena, uint32_t count, uint32_t& offset);
+	bool StoreDynamicGeometry(GeometryEntry& geometry, const VertexBuffer& vertices,
+		const IndexBuffer& indices);
+	bool DemoteGeometry(GeometryEntry& geometry);
+	DrawCuller culler_;
+	FillClassifier fill_classifier_;
+
+	RenderPassGraph render_pass_graph_;
+	std::vector<uint32_t> pass_commands_;          // command list indices in pass order
+	std::vector<FillVariant> command_fill_variants_;  // per command list index
+	std::set<uint32_t> composited_textures_;       // sampled by DrawCompositeBatch
+
+	// Specialized fill pixel shaders, compiled on a background thread, see LoadShaders
+	ComPtr<ID3D11PixelShader> fill_variant_shaders_[(size_t)FillVariant::Count];
+	std::atomic<bool> fill_variants_ready_{ false };
+	std::thread fill_variant_thread_;
+
 	struct TextureEntry {
 		ComPtr<ID3D11Texture2D> texture;
 		ComPtr<ID3D11ShaderResourceView> texture_srv;
 
-		// These members are only used when MSAA is enabled
+		uint32_t width = 0;
+		uint32_t height = 0;
+		bool is_render_target = false;
+		uint32_t samples = 1;
+		uint64_t render_count = 0;  // times bound as a render target
+		UsageClass usage = UsageClass::Immutable;  // of bitmap textures, see UpdateTexture
+		uint64_t pending_upload = 0;  // fence of the upload that will replace texture
+
+		// These members are only used when the render target is multisampled
 		bool is_msaa_render_target = false;
 		bool needs_resolve = false;
 		ComPtr<ID3D11Texture2D> resolve_texture;
 		ComPtr<ID3D11ShaderResourceView> resolve_texture_srv;
+
+		// Set when the texture lives in a shared atlas page, see PlaceInAtlas
+		bool in_atlas = false;
+		bool atlas_contents_lost = false;
+		bool atlas_rejected = false;
+
+		// Set while the render target is evicted, see EnforceResidencyBudget
+		bool evicted = false;
+		bool residency_contents_lost = false;
 	};
 
 	typedef std::map<uint32_t, TextureEntry> TextureMap;
 	TextureMap textures_;
 
+	void CreateRenderTargetTexture(uint32_t texture_id, TextureEntry& texture_entry);
+	HRESULT CreateTextureRenderTargetView(const TextureEntry& texture_entry,
+		ID3D11RenderTargetView** render_target_view);
+	HRESULT CreateBitmapTexture(TextureEntry& texture_entry, DXGI_FORMAT format, UsageClass usage,
+		const D3D11_SUBRESOURCE_DATA* data);
+	void DemoteTexture(TextureEntry& texture_entry);
+	void SubmitUpload(uint32_t texture_id, TextureEntry& texture_entry, RefPtr<Bitmap> bitmap,
+		UsageClass usage);
+	void WaitForUpload(uint64_t fence);
+	void ApplyUploads();
+	void EvictRenderTarget(uint32_t texture_id);
+	void RestoreRenderTarget(uint32_t texture_id);
+
+	// Estimated GPU memory of everything above, see EnforceResidencyBudget
+	ResidencyTracker residency_;
+
+	CommandStreamWriter capture_;
+
+	UsagePolicy texture_usage_;
+	UsagePolicy geometry_usage_;
+
+	// Creates bitmap textures on the upload thread, the device is free-threaded.
+	class TextureUploader : public UploadDevice {
+	public:
+		struct Result {
+			uint32_t texture_id;
+			UsageClass usage;
+			ComPtr<ID3D11Texture2D> texture;  // null if creation failed
+			ComPtr<ID3D11ShaderResourceView> texture_srv;
+		};
+
+		explicit TextureUploader(ID3D11Device* device) : device_(device) {}
+
+		virtual void Execute(const UploadJob& job) override;
+
+		// Everything created since the last call, keyed by fence.
+		void TakeResults(std::map<uint64_t, Result>& results);
+
+	protected:
+		ID3D11Device* device_;
+		std::mutex mutex_;
+		std::map<uint64_t, Result> results_;
+	};
+
+	static const size_t kUploadStagingBytes = 32 * 1024 * 1024;
+
+	TextureUploader uploader_;
+	UploadQueue upload_queue_;  // after uploader_, its thread must stop first
+
+	// Pages are always single-sample, multisampled targets stay standalone so a small
+	// region never costs a whole multisampled page and its resolve.
+	struct AtlasPage {
+		ComPtr<ID3D11Texture2D> texture;
+		ComPtr<ID3D11ShaderResourceView> texture_srv;
+		ComPtr<ID3D11RenderTargetView> render_target_view;
+		uint32_t width = 0;
+		uint32_t height = 0;
+	};
+
+	static const uint32_t kAtlasMaxPageSize = 2048;
+	static const uint32_t kAtlasMaxPages = 4;
+	static const uint32_t kAtlasMaxRegionSize = 512;
+
+	RenderTargetAtlas atlas_;
+	std::vector<AtlasPage> atlas_pages_;
+
+	MSAAPolicy msaa_policy_;
+	uint32_t resolve_count_ = 0;
+	uint32_t skipped_resolve_count_ = 0;
+	// Needed for ClearView, the atlas is disabled when the runtime lacks D3D 11.1.
+	ComPtr<ID3D11DeviceContext1> immediate_context1_;
+
 	struct RenderTargetEntry {
 		ComPtr<ID3D11RenderTargetView> render_target_view;
 		uint32_t render_target_texture_id;
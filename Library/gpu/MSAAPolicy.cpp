@@ -0,0 +1,49 @@
+#include "MSAAPolicy.h"
+
+uint32_t MSAAPolicy::PreferredSamples(uint32_t width, uint32_t height) const
+{
+	if (width <= config_.atlas_region_size && height <= config_.atlas_region_size)
+		return 1;
+
+	uint64_t area = (uint64_t)width * height;
+	uint32_t samples = config_.max_samples;
+
+	if (area > config_.large_area)
+		samples /= 2;
+	if (area > config_.huge_area)
+		samples /= 2;
+
+	return samples < 2 ? 1 : samples;
+}
+
+uint32_t MSAAPolicy::Acquire(uint64_t id, uint32_t width, uint32_t height)
+{
+	Release(id);
+
+	uint32_t samples = PreferredSamples(width, height);
+	while (samples > 1 && used_bytes_ + OverheadBytes(width, height, samples) > config_.memory_budget)
+		samples /= 2;
+
+	uint64_t overhead = OverheadBytes(width, height, samples);
+	if (overhead) {
+		charges_[id] = overhead;
+		used_bytes_ += overhead;
+	}
+
+	return samples;
+}
+
+void MSAAPolicy::Release(uint64_t id)
+{
+	auto i = charges_.find(id);
+	if (i == charges_.end())
+		return;
+
+	used_bytes_ -= i->second;
+	charges_.erase(i);
+}
+
+uint64_t MSAAPolicy::OverheadBytes(uint32_t width, uint32_t height, uint32_t samples)
+{
+	return samples > 1 ? (uint64_t)width * height * 4 * samples : 0;
+}
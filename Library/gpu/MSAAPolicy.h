@@ -0,0 +1,50 @@
+#pragma once
+#include <stdint.h>
+#include <map>
+
+struct MSAAPolicyConfig {
+	// Highest sample count handed out (1 = off, 2, 4 or 8).
+	uint32_t max_samples = 8;
+
+	// Extra GPU memory all multisampled surfaces together may use.
+	uint64_t memory_budget = 256ull * 1024 * 1024;
+
+	// Views with more pixels than these step down one and two levels respectively.
+	uint64_t large_area = 1280 * 720;
+	uint64_t huge_area = 1920 * 1080;
+
+	// Targets no wider and no taller than this stay single-sample, the driver packs them into
+	// shared atlas pages which can't be multisampled. 0 disables this.
+	uint32_t atlas_region_size = 0;
+};
+
+// Picks an antialiasing level per render target from its size and a global memory budget.
+//
+// Small widgets get the configured maximum unless they fit in the render target atlas, large
+// views step down since their MSAA surface is expensive and their edges are mostly axis
+// aligned anyway. Whatever is picked is then halved until the surface fits in the remaining
+// budget.
+class MSAAPolicy {
+public:
+	void set_config(const MSAAPolicyConfig& config) { config_ = config; }
+
+	const MSAAPolicyConfig& config() const { return config_; }
+
+	// Sample count a view of this size should get, ignoring the budget.
+	uint32_t PreferredSamples(uint32_t width, uint32_t height) const;
+
+	// Pick a sample count for the surface |id| and charge its overhead to the budget.
+	uint32_t Acquire(uint64_t id, uint32_t width, uint32_t height);
+
+	void Release(uint64_t id);
+
+	uint64_t used_bytes() const { return used_bytes_; }
+
+	// Bytes a multisampled surface costs on top of its single-sample resolve texture.
+	static uint64_t OverheadBytes(uint32_t width, uint32_t height, uint32_t samples);
+
+protected:
+	MSAAPolicyConfig config_;
+	uint64_t used_bytes_ = 0;
+	std::map<uint64_t, uint64_t> charges_;
+};
@@ -0,0 +1,102 @@
+#include "OcclusionCuller.h"
+
+#include <algorithm>
+
+static IntRect Intersect(const IntRect& a, const IntRect& b)
+{
+	return {
+		std::max(a.left, b.left),
+		std::max(a.top, b.top),
+		std::min(a.right, b.right),
+		std::min(a.bottom, b.bottom)
+	};
+}
+
+// Append the parts of rect outside hole, at most four.
+static void Subtract(const IntRect& rect, const IntRect& hole, std::vector<IntRect>& out)
+{
+	IntRect overlap = Intersect(rect, hole);
+	if (!overlap.IsValid()) {
+		out.push_back(rect);
+		return;
+	}
+
+	if (rect.top < overlap.top)
+		out.push_back({ rect.left, rect.top, rect.right, overlap.top });
+	if (overlap.bottom < rect.bottom)
+		out.push_back({ rect.left, overlap.bottom, rect.right, rect.bottom });
+	if (rect.left < overlap.left)
+		out.push_back({ rect.left, overlap.top, overlap.left, overlap.bottom });
+	if (overlap.right < rect.right)
+		out.push_back({ overlap.right, overlap.top, rect.right, overlap.bottom });
+}
+
+void OcclusionCuller::Begin(int viewport_width, int viewport_height)
+{
+	viewport_ = { 0, 0, viewport_width, viewport_height };
+	items_.clear();
+}
+
+void OcclusionCuller::Add(const IntRect& bounds, bool opaque)
+{
+	items_.push_back({ bounds, opaque });
+}
+
+void OcclusionCuller::Cull()
+{
+	results_.assign(items_.size(), Result::Visible);
+	occluders_.clear();
+	frame_stats_ = OcclusionStats();
+	frame_stats_.frames = 1;
+	frame_stats_.overlays = items_.size();
+
+	// Top first, so every overlay is tested against everything drawn over it.
+	for (size_t i = items_.size(); i-- > 0;) {
+		IntRect visible = Intersect(items_[i].bounds, viewport_);
+
+		if (!visible.IsValid()) {
+			results_[i] = Result::Offscreen;
+			frame_stats_.offscreen++;
+			continue;
+		}
+
+		if (IsCovered(visible, occluders_)) {
+			results_[i] = Result::Occluded;
+			frame_stats_.occluded++;
+			continue;
+		}
+
+		if (items_[i].opaque)
+			occluders_.push_back(visible);
+	}
+
+	total_stats_.frames++;
+	total_stats_.overlays += frame_stats_.overlays;
+	total_stats_.offscreen += frame_stats_.offscreen;
+	total_stats_.occluded += frame_stats_.occluded;
+}
+
+bool OcclusionCuller::IsCovered(const IntRect& rect, const std::vector<IntRect>& occluders)
+{
+	if (occluders.empty())
+		return false;
+
+	fragments_.clear();
+	fragments_.push_back(rect);
+
+	for (auto& occluder : occluders) {
+		next_fragments_.clear();
+		for (auto& fragment : fragments_)
+			Subtract(fragment, occluder, next_fragments_);
+
+		if (next_fragments_.empty())
+			return true;
+
+		if (next_fragments_.size() > kMaxFragments)
+			return false;
+
+		fragments_.swap(next_fragments_);
+	}
+
+	return false;
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include <stdint.h>
+#include <vector>
+
+#include <Ultralight/Geometry.h>
+
+using namespace ultralight;
+
+struct OcclusionStats {
+	uint64_t frames = 0;
+	uint64_t overlays = 0;
+	uint64_t offscreen = 0;  // entirely outside the window
+	uint64_t occluded = 0;   // fully covered by opaque overlays drawn on top
+};
+
+// Finds overlays that don't have to be rendered or composited: those entirely outside the
+// window and those whose visible part is fully covered by opaque overlays drawn after them.
+//
+// Coverage is exact for any union of opaque rects, the uncovered part of each overlay is kept
+// as a list of disjoint rects. Past kMaxFragments the overlay is assumed visible.
+class OcclusionCuller {
+public:
+	enum class Result : uint8_t {
+		Visible,
+		Offscreen,
+		Occluded,
+	};
+
+	static const size_t kMaxFragments = 64;
+
+	void Begin(int viewport_width, int viewport_height);
+
+	// Overlays in draw order, bottom first. bounds are in window pixels.
+	void Add(const IntRect& bounds, bool opaque);
+
+	void Cull();
+
+	Result result(size_t index) const { return results_[index]; }
+
+	bool is_culled(size_t index) const { return results_[index] != Result::Visible; }
+
+	const OcclusionStats& frame_stats() const { return frame_stats_; }
+
+	const OcclusionStats& total_stats() const { return total_stats_; }
+
+protected:
+	struct Item {
+		IntRect bounds;
+		bool opaque;
+	};
+
+	// Is rect fully covered by the union of occluders?
+	bool IsCovered(const IntRect& rect, const std::vector<IntRect>& occluders);
+
+	IntRect viewport_ = IntRect::MakeEmpty();
+	std::vector<Item> items_;
+	std::vector<Result> results_;
+	std::vector<IntRect> occluders_;
+	std::vector<IntRect> fragments_;
+	std::vector<IntRect> next_fragments_;
+	OcclusionStats frame_stats_;
+	OcclusionStats total_stats_;
+};
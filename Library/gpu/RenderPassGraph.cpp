@@ -0,0 +1,161 @@
+#include "RenderPassGraph.h"
+
+#include <algorithm>
+#include <map>
+
+void RenderPassGraph::Begin()
+{
+	passes_.clear();
+	frame_ = RenderPassStats();
+}
+
+void RenderPassGraph::AddClear(uint32_t target, uint32_t command)
+{
+	Op op = { command, { 0, 0 }, true, false };
+	Add(target, op);
+}
+
+void RenderPassGraph::AddDraw(uint32_t target, uint32_t command, uint32_t sampled_1,
+	uint32_t sampled_2, bool covers_target)
+{
+	Op op = { command, { sampled_1, sampled_2 }, false, covers_target };
+	Add(target, op);
+}
+
+void RenderPassGraph::Add(uint32_t target, const Op& op)
+{
+	if (passes_.empty() || passes_.back().target != target) {
+		Pass pass;
+		pass.target = target;
+		pass.pending_predecessors = 0;
+		passes_.push_back(std::move(pass));
+	}
+
+	passes_.back().ops.push_back(op);
+}
+
+bool RenderPassGraph::Samples(const Pass& pass, uint32_t target) const
+{
+	for (auto& op : pass.ops) {
+		if (op.sampled[0] == target || op.sampled[1] == target)
+			return true;
+	}
+
+	return false;
+}
+
+void RenderPassGraph::Build(std::vector<uint32_t>& commands, const std::set<uint32_t>& sampled_later)
+{
+	commands.clear();
+	unsampled_targets_.clear();
+
+	// A later pass depends on an earlier one if they write the same target, or one of them
+	// samples what the other writes.
+	size_t count = passes_.size();
+	for (size_t j = 0; j < count; j++) {
+		for (size_t i = 0; i < j; i++) {
+			if (passes_[i].target == passes_[j].target || Samples(passes_[j], passes_[i].target)
+				|| Samples(passes_[i], passes_[j].target)) {
+				passes_[i].successors.push_back((uint32_t)j);
+				passes_[j].pending_predecessors++;
+			}
+		}
+	}
+
+	// Emit in submission order, except that a ready pass on the current target goes first.
+	std::vector<uint32_t> order;
+	std::vector<bool> emitted(count, false);
+	uint32_t current_target = 0;
+	bool has_current = false;
+
+	while (order.size() < count) {
+		size_t next = count;
+		for (size_t i = 0; i < count; i++) {
+			if (emitted[i] || passes_[i].pending_predecessors)
+				continue;
+
+			if (next == count)
+				next = i;
+
+			if (has_current && passes_[i].target == current_target) {
+				next = i;
+				break;
+			}
+		}
+
+		emitted[next] = true;
+		order.push_back((uint32_t)next);
+		for (uint32_t successor : passes_[next].successors)
+			passes_[successor].pending_predecessors--;
+
+		if (!has_current || passes_[next].target != current_target)
+			frame_.merged_passes++;
+
+		current_target = passes_[next].target;
+		has_current = true;
+	}
+
+	// Walk the ops in their final order, a clear nothing has read yet is dropped when its
+	// target is cleared again or fully overwritten.
+	struct Output {
+		uint32_t command;
+		bool dropped;
+	};
+
+	std::vector<Output> output;
+	std::map<uint32_t, size_t> pending_clears;  // target -> index in output
+	std::set<uint32_t> written;
+	std::set<uint32_t> sampled;
+
+	for (uint32_t pass_index : order) {
+		const Pass& pass = passes_[pass_index];
+		written.insert(pass.target);
+
+		for (const Op& op : pass.ops) {
+			for (uint32_t id : op.sampled) {
+				if (id) {
+					pending_clears.erase(id);
+					sampled.insert(id);
+				}
+			}
+
+			auto pending = pending_clears.find(pass.target);
+			if (pending != pending_clears.end()) {
+				if (op.is_clear || op.covers_target) {
+					output[pending->second].dropped = true;
+					frame_.dropped_clears++;
+				}
+				pending_clears.erase(pending);
+			}
+
+			if (op.is_clear) {
+				frame_.clears++;
+				pending_clears[pass.target] = output.size();
+			}
+
+			Output out = { op.command, false };
+			output.push_back(out);
+		}
+	}
+
+	for (auto& out : output) {
+		if (!out.dropped)
+			commands.push_back(out.command);
+	}
+
+	for (uint32_t target : written) {
+		if (!sampled.count(target) && !sampled_later.count(target))
+			unsampled_targets_.push_back(target);
+	}
+
+	frame_.frames = 1;
+	frame_.passes = (uint32_t)count;
+	frame_.unsampled_targets = (uint32_t)unsampled_targets_.size();
+
+	total_.frames++;
+	total_.passes += frame_.passes;
+	total_.merged_passes += frame_.merged_passes;
+	total_.clears += frame_.clears;
+	total_.dropped_clears += frame_.dropped_clears;
+	total_.unsampled_targets += frame_.unsampled_targets;
+}
@@ -0,0 +1,67 @@
+#pragma once
+#include <stdint.h>
+#include <set>
+#include <vector>
+
+struct RenderPassStats {
+	uint32_t frames;
+	uint32_t passes;             // runs of commands on one render buffer, as submitted
+	uint32_t merged_passes;      // runs left after reordering
+	uint32_t clears;
+	uint32_t dropped_clears;     // cleared again or fully overwritten before anything read them
+	uint32_t unsampled_targets;  // written but read by neither a later pass nor the compositor
+};
+
+// Per-frame graph of render passes over one command list.
+//
+// A pass is a run of commands drawing into the same render buffer. Passes are reordered so
+// that passes on the same render buffer run back to back, as long as no pass reads (samples)
+// a render buffer another pass writes in between. Clears whose result is cleared again or
+// covered by an opaque draw before anything samples it are dropped.
+//
+// Render buffers are identified by the texture they draw into, so sampling ties passes
+// together. Ids are opaque, 0 means none.
+class RenderPassGraph {
+public:
+	void Begin();
+
+	void AddClear(uint32_t target, uint32_t command);
+
+	// covers_target: the draw replaces every pixel of the target, whatever was there before.
+	void AddDraw(uint32_t target, uint32_t command, uint32_t sampled_1, uint32_t sampled_2,
+		bool covers_target);
+
+	// Fill commands with the command indices to run, in order. sampled_later holds targets
+	// read after this command list, eg, by the compositor.
+	void Build(std::vector<uint32_t>& commands, const std::set<uint32_t>& sampled_later);
+
+	// Targets the last Build found were never sampled.
+	const std::vector<uint32_t>& unsampled_targets() const { return unsampled_targets_; }
+
+	const RenderPassStats& frame_stats() const { return frame_; }
+
+	const RenderPassStats& total_stats() const { return total_; }
+
+protected:
+	struct Op {
+		uint32_t command;
+		uint32_t sampled[2];
+		bool is_clear;
+		bool covers_target;
+	};
+
+	struct Pass {
+		uint32_t target;
+		std::vector<Op> ops;
+		std::vector<uint32_t> successors;
+		uint32_t pending_predecessors;
+	};
+
+	void Add(uint32_t target, const Op& op);
+	bool Samples(const Pass& pass, uint32_t target) const;
+
+	std::vector<Pass> passes_;
+	std::vector<uint32_t> unsampled_targets_;
+	RenderPassStats frame_ = {};
+	RenderPassStats total_ = {};
+};
@@ -0,0 +1,121 @@
+#include "RenderScheduler.h"
+
+#include <algorithm>
+
+// Weight of the newest sample in each view's smoothed render time.
+static const double kCostSmoothing = 0.25;
+
+const double RenderScheduler::kMaxDeferral = 0.1;
+
+// Slack so a view isn't pushed to the next frame by timer jitter.
+static const double kDueTolerance = 0.001;
+
+bool RenderScheduler::IsDue(uint32_t id, double max_fps, double now) const
+{
+	if (max_fps <= 0.0)
+		return true;
+
+	auto i = views_.find(id);
+	if (i == views_.end() || !i->second.rendered)
+		return true;
+
+	return now - i->second.last_render + kDueTolerance >= 1.0 / max_fps;
+}
+
+void RenderScheduler::Begin(double now)
+{
+	now_ = now;
+	candidates_.clear();
+	scheduled_.clear();
+}
+
+void RenderScheduler::Add(uint32_t id, double max_fps, uint32_t priority)
+{
+	Candidate candidate;
+	candidate.id = id;
+	candidate.priority = priority;
+	candidate.order = (uint32_t)candidates_.size();
+	candidate.due = IsDue(id, max_fps, now_);
+
+	// Never rendered views have waited the longest.
+	auto i = views_.find(id);
+	candidate.waiting = i != views_.end() && i->second.rendered ? now_ - i->second.last_render
+		: 1e9;
+
+	// Don't let a busy focused view starve the others.
+	if (i != views_.end() && i->second.deferred && now_ - i->second.deferred_since >= kMaxDeferral)
+		candidate.priority = UINT32_MAX;
+
+	candidates_.push_back(candidate);
+}
+
+const std::vector<uint32_t>& RenderScheduler::Schedule()
+{
+	stats_.frames++;
+	stats_.candidates += candidates_.size();
+
+	std::vector<Candidate> queue;
+	queue.reserve(candidates_.size());
+	for (auto& candidate : candidates_) {
+		if (candidate.due)
+			queue.push_back(candidate);
+		else
+			stats_.deferred_rate++;
+	}
+
+	std::sort(queue.begin(), queue.end(), [](const Candidate& a, const Candidate& b) {
+		if (a.priority != b.priority)
+			return a.priority > b.priority;
+		if (a.waiting != b.waiting)
+			return a.waiting > b.waiting;
+		return a.order < b.order;
+	});
+
+	double spent_ms = 0.0;
+	std::vector<uint32_t> taken;
+	for (auto& candidate : queue) {
+		double cost_ms = cost(candidate.id);
+		if (budget_ms_ > 0.0 && !taken.empty() && spent_ms + cost_ms > budget_ms_) {
+			ViewState& view = views_[candidate.id];
+			if (!view.deferred) {
+				view.deferred = true;
+				view.deferred_since = now_;
+			}
+			stats_.deferred_budget++;
+			continue;
+		}
+
+		spent_ms += cost_ms;
+		taken.push_back(candidate.order);
+	}
+
+	std::sort(taken.begin(), taken.end());
+	for (uint32_t order : taken)
+		scheduled_.push_back(candidates_[order].id);
+
+	stats_.scheduled += scheduled_.size();
+	return scheduled_;
+}
+
+void RenderScheduler::EndFrame(double render_ms)
+{
+	if (scheduled_.empty())
+		return;
+
+	double share_ms = render_ms / scheduled_.size();
+
+	for (uint32_t id : scheduled_) {
+		ViewState& view = views_[id];
+		view.cost_ms = view.rendered ? view.cost_ms + (share_ms - view.cost_ms) * kCostSmoothing
+			: share_ms;
+		view.last_render = now_;
+		view.rendered = true;
+		view.deferred = false;
+	}
+}
+
+double RenderScheduler::cost(uint32_t id) const
+{
+	auto i = views_.find(id);
+	return i != views_.end() ? i->second.cost_ms : 0.0;
+}
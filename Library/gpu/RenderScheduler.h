@@ -0,0 +1,77 @@
+#pragma once
+#include <stdint.h>
+#include <map>
+#include <vector>
+
+struct RenderSchedulerStats {
+	uint64_t frames = 0;
+	uint64_t candidates = 0;      // dirty views offered to Schedule
+	uint64_t scheduled = 0;
+	uint64_t deferred_rate = 0;   // rendered too recently for their refresh rate cap
+	uint64_t deferred_budget = 0; // didn't fit the frame's time budget
+};
+
+// Picks which dirty views go into a window's RenderOnly call.
+//
+// A view is due once 1 / max_fps seconds passed since it was last rendered (max_fps <= 0 is
+// uncapped). Due views are taken by priority, then by how long they have been waiting, until
+// their estimated render times fill the frame budget. The first view is always taken so every
+// frame makes progress, deferred views climb the queue as they wait and jump ahead of every
+// priority once they were held back for kMaxDeferral seconds.
+//
+// Costs are learned from EndFrame: the frame's render time is split evenly among the views it
+// rendered and smoothed per view. Times are in seconds on any monotonic clock, budgets and costs
+// in milliseconds.
+class RenderScheduler {
+public:
+	static const double kMaxDeferral;
+
+	// 0 = unlimited.
+	void set_budget(double budget_ms) { budget_ms_ = budget_ms; }
+
+	double budget() const { return budget_ms_; }
+
+	bool IsDue(uint32_t id, double max_fps, double now) const;
+
+	void Begin(double now);
+
+	// A dirty view, higher priorities (eg, focused, under the mouse) are rendered first.
+	void Add(uint32_t id, double max_fps, uint32_t priority);
+
+	// The ids to render this frame, in Add order.
+	const std::vector<uint32_t>& Schedule();
+
+	// Report the time RenderOnly took for the scheduled views.
+	void EndFrame(double render_ms);
+
+	void Remove(uint32_t id) { views_.erase(id); }
+
+	// Smoothed render time of a view, 0 until it was rendered once.
+	double cost(uint32_t id) const;
+
+	const RenderSchedulerStats& stats() const { return stats_; }
+
+protected:
+	struct ViewState {
+		double last_render = 0.0;
+		double cost_ms = 0.0;
+		double deferred_since = 0.0;
+		bool rendered = false;
+		bool deferred = false;
+	};
+
+	struct Candidate {
+		uint32_t id;
+		uint32_t priority;
+		uint32_t order;  // of Add
+		double waiting;  // seconds since the last render
+		bool due;
+	};
+
+	double budget_ms_ = 0.0;
+	double now_ = 0.0;
+	std::map<uint32_t, ViewState> views_;
+	std::vector<Candidate> candidates_;
+	std::vector<uint32_t> scheduled_;
+	RenderSchedulerStats stats_;
+};
@@ -0,0 +1,134 @@
+#include "ResidencyTracker.h"
+
+#include <algorithm>
+
+void ResidencyTracker::Add(uint64_t key, ResidencyKind kind, uint64_t bytes)
+{
+	Remove(key);
+
+	Entry entry = { kind, bytes, now_ms_, false, false };
+	entries_[key] = entry;
+
+	resident_bytes_ += bytes;
+	peak_bytes_ = std::max(peak_bytes_, resident_bytes_);
+}
+
+void ResidencyTracker::Remove(uint64_t key)
+{
+	auto i = entries_.find(key);
+	if (i == entries_.end())
+		return;
+
+	if (!i->second.evicted)
+		resident_bytes_ -= i->second.bytes;
+
+	entries_.erase(i);
+}
+
+void ResidencyTracker::Resize(uint64_t key, uint64_t bytes)
+{
+	auto i = entries_.find(key);
+	if (i == entries_.end() || i->second.evicted)
+		return;
+
+	resident_bytes_ = resident_bytes_ - i->second.bytes + bytes;
+	peak_bytes_ = std::max(peak_bytes_, resident_bytes_);
+	i->second.bytes = bytes;
+}
+
+void ResidencyTracker::Touch(uint64_t key)
+{
+	auto i = entries_.find(key);
+	if (i != entries_.end())
+		i->second.last_used_ms = now_ms_;
+}
+
+void ResidencyTracker::SetHidden(uint64_t key, bool hidden)
+{
+	auto i = entries_.find(key);
+	if (i == entries_.end())
+		return;
+
+	// The idle timeout counts from when the resource was hidden.
+	if (hidden && !i->second.hidden)
+		i->second.last_used_ms = now_ms_;
+
+	i->second.hidden = hidden;
+}
+
+void ResidencyTracker::MarkEvicted(uint64_t key)
+{
+	auto i = entries_.find(key);
+	if (i == entries_.end() || i->second.evicted)
+		return;
+
+	i->second.evicted = true;
+	resident_bytes_ -= i->second.bytes;
+	evicted_bytes_ += i->second.bytes;
+	evictions_++;
+}
+
+void ResidencyTracker::MarkRestored(uint64_t key, uint64_t bytes)
+{
+	auto i = entries_.find(key);
+	if (i == entries_.end() || !i->second.evicted)
+		return;
+
+	i->second.evicted = false;
+	i->second.bytes = bytes;
+	i->second.last_used_ms = now_ms_;
+	resident_bytes_ += bytes;
+	peak_bytes_ = std::max(peak_bytes_, resident_bytes_);
+	restores_++;
+}
+
+bool ResidencyTracker::is_evicted(uint64_t key) const
+{
+	auto i = entries_.find(key);
+	return i != entries_.end() && i->second.evicted;
+}
+
+void ResidencyTracker::CollectEvictions(std::vector<uint64_t>& keys) const
+{
+	keys.clear();
+
+	std::vector<std::pair<uint64_t, uint64_t>> candidates;  // (last used, key)
+	for (auto& i : entries_) {
+		const Entry& entry = i.second;
+		if (entry.hidden && !entry.evicted && entry.last_used_ms < now_ms_)
+			candidates.push_back(std::make_pair(entry.last_used_ms, i.first));
+	}
+
+	std::sort(candidates.begin(), candidates.end());
+
+	uint64_t resident = resident_bytes_;
+	for (auto& candidate : candidates) {
+		bool timed_out = now_ms_ - candidate.first >= config_.idle_timeout_ms;
+		if (!timed_out && resident <= config_.budget_bytes)
+			break;
+
+		keys.push_back(candidate.second);
+		resident -= entries_.find(candidate.second)->second.bytes;
+	}
+}
+
+ResidencyStats ResidencyTracker::stats() const
+{
+	ResidencyStats stats = {};
+	stats.budget_bytes = config_.budget_bytes;
+	stats.resident_bytes = resident_bytes_;
+	stats.peak_bytes = peak_bytes_;
+	stats.resource_count = (uint32_t)entries_.size();
+	stats.evictions = evictions_;
+	stats.evicted_bytes = evicted_bytes_;
+	stats.restores = restores_;
+
+	for (auto& i : entries_) {
+		if (i.second.evicted)
+			stats.evicted_count++;
+		else
+			stats.bytes_by_kind[(size_t)i.second.kind] += i.second.bytes;
+	}
+
+	return stats;
+}
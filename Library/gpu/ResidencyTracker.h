@@ -0,0 +1,84 @@
+#pragma once
+#include <stdint.h>
+#include <map>
+#include <vector>
+
+enum class ResidencyKind : uint8_t {
+	Texture,
+	RenderTarget,
+	Geometry,
+	AtlasPage,
+};
+
+struct ResidencyConfig {
+	// Estimated GPU memory all tracked resources together may use before hidden render
+	// targets are evicted early.
+	uint64_t budget_bytes = 512ull * 1024 * 1024;
+
+	// Hidden render targets nobody has drawn into or sampled for this long are evicted even
+	// under budget.
+	uint64_t idle_timeout_ms = 5000;
+};
+
+struct ResidencyStats {
+	uint64_t budget_bytes;
+	uint64_t resident_bytes;
+	uint64_t peak_bytes;
+	uint64_t bytes_by_kind[4];  // indexed by ResidencyKind
+	uint32_t resource_count;
+	uint32_t evicted_count;     // currently evicted
+	uint32_t evictions;         // total since startup
+	uint64_t evicted_bytes;     // total since startup
+	uint32_t restores;
+};
+
+// Keeps estimated GPU memory per resource and decides what to evict.
+//
+// Only resources explicitly marked hidden are ever evicted, everything else (Ultralight's
+// images, geometry, intermediate layers) has no way to be regenerated on demand.
+class ResidencyTracker {
+public:
+	static uint64_t Key(ResidencyKind kind, uint32_t id) { return ((uint64_t)kind << 32) | id; }
+
+	void set_config(const ResidencyConfig& config) { config_ = config; }
+
+	const ResidencyConfig& config() const { return config_; }
+
+	// Timestamp used by Touch(), set once per frame.
+	void set_now(uint64_t now_ms) { now_ms_ = now_ms; }
+
+	void Add(uint64_t key, ResidencyKind kind, uint64_t bytes);
+	void Remove(uint64_t key);
+	void Resize(uint64_t key, uint64_t bytes);
+
+	void Touch(uint64_t key);
+	void SetHidden(uint64_t key, bool hidden);
+
+	void MarkEvicted(uint64_t key);
+	void MarkRestored(uint64_t key, uint64_t bytes);
+	bool is_evicted(uint64_t key) const;
+
+	// Hidden resources to evict now: the ones idle past the timeout, then least recently used
+	// ones until the budget is met. Resources touched this frame are never picked.
+	void CollectEvictions(std::vector<uint64_t>& keys) const;
+
+	ResidencyStats stats() const;
+
+protected:
+	struct Entry {
+		ResidencyKind kind;
+		uint64_t bytes;
+		uint64_t last_used_ms;
+		bool hidden;
+		bool evicted;
+	};
+
+	ResidencyConfig config_;
+	std::map<uint64_t, Entry> entries_;
+	uint64_t now_ms_ = 0;
+	uint64_t resident_bytes_ = 0;
+	uint64_t peak_bytes_ = 0;
+	uint32_t evictions_ = 0;
+	uint64_t evicted_bytes_ = 0;
+	uint32_t restores_ = 0;
+};
@@ -0,0 +1,246 @@
+#include "SnapshotCodec.h"
+
+#include <string.h>
+
+#if defined(_M_X64) || defined(_M_AMD64) || defined(__SSE2__)
+#include <emmintrin.h>
+#define SNAPSHOT_SSE2 1
+#endif
+
+static const uint8_t kMagic[4] = { 'U', 'L', 'S', 'N' };
+static const uint8_t kEndMarker[8] = { 0, 0, 0, 0, 0, 0, 0, 1 };
+static const size_t kHeaderSize = 12;
+
+// Larger snapshots are rejected as corrupt.
+static const uint32_t kMaxDimension = 16384;
+
+static const uint8_t kOpIndex = 0x00;
+static const uint8_t kOpDiff = 0x40;
+static const uint8_t kOpLuma = 0x80;
+static const uint8_t kOpRun = 0xC0;
+static const uint8_t kOpRGB = 0xFE;
+static const uint8_t kOpRGBA = 0xFF;
+static const uint8_t kMask2 = 0xC0;
+static const uint32_t kMaxRun = 62;
+
+// Pixels are 0xAARRGGBB in memory order B, G, R, A.
+static inline uint8_t B(uint32_t px) { return (uint8_t)px; }
+static inline uint8_t G(uint32_t px) { return (uint8_t)(px >> 8); }
+static inline uint8_t R(uint32_t px) { return (uint8_t)(px >> 16); }
+static inline uint8_t A(uint32_t px) { return (uint8_t)(px >> 24); }
+
+static inline uint32_t MakePixel(uint8_t r, uint8_t g, uint8_t b, uint8_t a)
+{
+	return (uint32_t)b | ((uint32_t)g << 8) | ((uint32_t)r << 16) | ((uint32_t)a << 24);
+}
+
+static inline uint32_t Hash(uint32_t px)
+{
+	return (R(px) * 3 + G(px) * 5 + B(px) * 7 + A(px) * 11) % 64;
+}
+
+static inline void Write32(uint8_t* out, uint32_t value)
+{
+	out[0] = (uint8_t)value;
+	out[1] = (uint8_t)(value >> 8);
+	out[2] = (uint8_t)(value >> 16);
+	out[3] = (uint8_t)(value >> 24);
+}
+
+static inline uint32_t Read32(const uint8_t* in)
+{
+	return (uint32_t)in[0] | ((uint32_t)in[1] << 8) | ((uint32_t)in[2] << 16)
+		| ((uint32_t)in[3] << 24);
+}
+
+// Number of leading pixels equal to px, at most count.
+static uint32_t MatchRun(const uint32_t* pixels, uint32_t count, uint32_t px)
+{
+	uint32_t n = 0;
+
+#ifdef SNAPSHOT_SSE2
+	__m128i value = _mm_set1_epi32((int)px);
+	for (; n + 4 <= count; n += 4) {
+		__m128i equal = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(pixels + n)), value);
+		if (_mm_movemask_epi8(equal) != 0xFFFF)
+			break;
+	}
+#endif
+
+	while (n < count && pixels[n] == px)
+		n++;
+
+	return n;
+}
+
+static void FillPixels(uint32_t* pixels, uint32_t count, uint32_t px)
+{
+	uint32_t n = 0;
+
+#ifdef SNAPSHOT_SSE2
+	__m128i value = _mm_set1_epi32((int)px);
+	for (; n + 4 <= count; n += 4)
+		_mm_storeu_si128((__m128i*)(pixels + n), value);
+#endif
+
+	for (; n < count; n++)
+		pixels[n] = px;
+}
+
+void EncodeSnapshot(const uint8_t* pixels, uint32_t width, uint32_t height, uint32_t row_bytes,
+	std::vector<uint8_t>& out)
+{
+	size_t start = out.size();
+
+	// Worst case is an RGBA chunk per pixel.
+	out.resize(start + kHeaderSize + (size_t)width * height * 5 + sizeof(kEndMarker));
+	uint8_t* p = &out[start];
+
+	memcpy(p, kMagic, sizeof(kMagic));
+	Write32(p + 4, width);
+	Write32(p + 8, height);
+	p += kHeaderSize;
+
+	uint32_t index[64] = {};
+	uint32_t prev = MakePixel(0, 0, 0, 255);
+	uint32_t run = 0;
+
+	for (uint32_t y = 0; y < height; y++) {
+		const uint32_t* row = (const uint32_t*)(pixels + (size_t)y * row_bytes);
+
+		uint32_t x = 0;
+		while (x < width) {
+			uint32_t px = row[x];
+
+			// Runs continue across rows.
+			if (px == prev) {
+				uint32_t n = MatchRun(row + x, width - x, prev);
+				run += n;
+				x += n;
+				for (; run >= kMaxRun; run -= kMaxRun)
+					*p++ = kOpRun | (uint8_t)(kMaxRun - 1);
+				continue;
+			}
+
+			if (run) {
+				*p++ = kOpRun | (uint8_t)(run - 1);
+				run = 0;
+			}
+
+			uint32_t hash = Hash(px);
+			if (index[hash] == px) {
+				*p++ = kOpIndex | (uint8_t)hash;
+			}
+			else {
+				index[hash] = px;
+
+				if (A(px) == A(prev)) {
+					int8_t vr = (int8_t)(R(px) - R(prev));
+					int8_t vg = (int8_t)(G(px) - G(prev));
+					int8_t vb = (int8_t)(B(px) - B(prev));
+					int8_t vg_r = (int8_t)(vr - vg);
+					int8_t vg_b = (int8_t)(vb - vg);
+
+					if (vr > -3 && vr < 2 && vg > -3 && vg < 2 && vb > -3 && vb < 2) {
+						*p++ = kOpDiff | (uint8_t)((vr + 2) << 4 | (vg + 2) << 2 | (vb + 2));
+					}
+					else if (vg_r > -9 && vg_r < 8 && vg > -33 && vg < 32 && vg_b > -9 && vg_b < 8) {
+						*p++ = kOpLuma | (uint8_t)(vg + 32);
+						*p++ = (uint8_t)((vg_r + 8) << 4 | (vg_b + 8));
+					}
+					else {
+						*p++ = kOpRGB;
+						*p++ = R(px);
+						*p++ = G(px);
+						*p++ = B(px);
+					}
+				}
+				else {
+					*p++ = kOpRGBA;
+					*p++ = R(px);
+					*p++ = G(px);
+					*p++ = B(px);
+					*p++ = A(px);
+				}
+			}
+
+			prev = px;
+			x++;
+		}
+	}
+
+	if (run)
+		*p++ = kOpRun | (uint8_t)(run - 1);
+
+	memcpy(p, kEndMarker, sizeof(kEndMarker));
+	p += sizeof(kEndMarker);
+
+	out.resize(p - out.data());
+}
+
+bool DecodeSnapshot(const uint8_t* data, size_t size, uint32_t& width, uint32_t& height,
+	std::vector<uint8_t>& pixels)
+{
+	if (size < kHeaderSize + sizeof(kEndMarker) || memcmp(data, kMagic, sizeof(kMagic)))
+		return false;
+
+	width = Read32(data + 4);
+	height = Read32(data + 8);
+	if (!width || !height || width > kMaxDimension || height > kMaxDimension)
+		return false;
+
+	size_t count = (size_t)width * height;
+	pixels.resize(count * 4);
+	uint32_t* out = (uint32_t*)pixels.data();
+
+	uint32_t index[64] = {};
+	uint32_t px = MakePixel(0, 0, 0, 255);
+
+	const uint8_t* p = data + kHeaderSize;
+	// Every chunk is at most 5 bytes and must end before the end marker.
+	const uint8_t* end = data + size - sizeof(kEndMarker);
+
+	size_t i = 0;
+	while (i < count) {
+		if (p >= end)
+			return false;
+
+		uint8_t b1 = *p++;
+
+		if (b1 == kOpRGB || b1 == kOpRGBA) {
+			size_t bytes = b1 == kOpRGB ? 3 : 4;
+			if ((size_t)(end - p) < bytes)
+				return false;
+			px = MakePixel(p[0], p[1], p[2], b1 == kOpRGB ? A(px) : p[3]);
+			p += bytes;
+		}
+		else if ((b1 & kMask2) == kOpIndex) {
+			px = index[b1];
+		}
+		else if ((b1 & kMask2) == kOpDiff) {
+			px = MakePixel((uint8_t)(R(px) + ((b1 >> 4) & 3) - 2),
+				(uint8_t)(G(px) + ((b1 >> 2) & 3) - 2), (uint8_t)(B(px) + (b1 & 3) - 2), A(px));
+		}
+		else if ((b1 & kMask2) == kOpLuma) {
+			if (p >= end)
+				return false;
+			uint8_t b2 = *p++;
+			int vg = (b1 & 0x3F) - 32;
+			px = MakePixel((uint8_t)(R(px) + vg - 8 + ((b2 >> 4) & 0x0F)), (uint8_t)(G(px) + vg),
+				(uint8_t)(B(px) + vg - 8 + (b2 & 0x0F)), A(px));
+		}
+		else {
+			size_t run = (size_t)(b1 & 0x3F) + 1;
+			if (run > count - i)
+				return false;
+			FillPixels(out + i, (uint32_t)run, px);
+			i += run;
+			continue;
+		}
+
+		index[Hash(px)] = px;
+		out[i++] = px;
+	}
+
+	return p == end && !memcmp(end, kEndMarker, sizeof(kEndMarker));
+}
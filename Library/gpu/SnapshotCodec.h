@@ -0,0 +1,21 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+// Lossless codec for window snapshots, the chunk format of QOI ("Quite OK Image") over 32-bit
+// BGRA pixels: runs, a 64 entry color cache and small deltas. Mostly transparent or flat
+// widget frames shrink several times and both directions run at memory speed, runs are
+// matched and filled four pixels at a time with SSE2.
+//
+// A snapshot is a 12 byte header ("ULSN", width and height, little endian), the chunks and an
+// 8 byte end marker. Pixels are stored as given, premultiplied or not.
+
+// Append the snapshot of width x height pixels whose rows start row_bytes apart to out.
+void EncodeSnapshot(const uint8_t* pixels, uint32_t width, uint32_t height, uint32_t row_bytes,
+	std::vector<uint8_t>& out);
+
+// Decode a snapshot into tightly packed pixels (width * 4 bytes per row). Returns false if data
+// is not a complete snapshot.
+bool DecodeSnapshot(const uint8_t* data, size_t size, uint32_t& width, uint32_t& height,
+	std::vector<uint8_t>& pixels);
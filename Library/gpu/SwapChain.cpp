@@ -108,10 +108,10 @@ SwapChainD3D11::SwapChainD3D11(GPUContextD3D11* context, GPUDriverD3D11* driver,
 
 	back_buffer_width_ = width;
 	back_buffer_height_ = height;
+	sizer_.set_buffer_size(width, height);
 
-	// Initialize backbuffer with white so we don't get flash of black while loading views.
-	float color[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
-	context_->immediate_context()->ClearRenderTargetView(render_target_view(), color);
+	// No initial clear, the window only shows the back buffer after Window::Paint cleared and
+	// composited it.
 }
 
 SwapChainD3D11::~SwapChainD3D11() {}
@@ -122,25 +122,30 @@ ID3D11RenderTargetView* SwapChainD3D11::render_target_view() { return back_buffe
 
 void SwapChainD3D11::PresentFrame() { swap_chain()->Present(enable_vsync_ ? 1 : 0, 0); }
 
-void SwapChainD3D11::Resize(int width, int height) {
+void SwapChainD3D11::Resize(int width, int height, bool interactive) {
 
 	set_screen_size(width, height);
 
-	context_->immediate_context()->OMSetRenderTargets(0, 0, 0);
-	ID3D11Texture2D* back_buffer = nullptr;
-	swap_chain_->GetBuffer(0, __uuidof(ID3D11Texture2D), (LPVOID*)&back_buffer);
-	back_buffer->Release();
-
-	back_buffer_view_.Reset();
-
 	// Get the actual device width/height (may be different than screen size)
 	RECT rc;
 	::GetClientRect(hwnd_, &rc);
 	UINT client_width = rc.right - rc.left;
 	UINT client_height = rc.bottom - rc.top;
 
+	// Most steps of a drag fit in the current buffers, Window::Paint only composites and
+	// presents the client area.
+	if (!sizer_.Resize(client_width, client_height, interactive))
+		return;
+
+	context_->immediate_context()->OMSetRenderTargets(0, 0, 0);
+	back_buffer_view_.Reset();
+
+	// ResizeBuffers fails while anything still references the old buffers.
+	surface_.Reset();
+
 	HRESULT hr;
-	hr = swap_chain_->ResizeBuffers(0, client_width, client_height, DXGI_FORMAT_UNKNOWN, 0);
+	hr = swap_chain_->ResizeBuffers(0, sizer_.buffer_width(), sizer_.buffer_height(),
+		DXGI_FORMAT_UNKNOWN, 0);
 	if (FAILED(hr)) {
 		MessageBoxW(nullptr,
 			L"SwapChainD3D11::Resize, unable to resize, IDXGISwapChain::ResizeBuffers failed.",
@@ -165,6 +170,10 @@ void SwapChainD3D11::Resize(int width, int height) {
 		exit(-1);
 	}
 
+	swap_chain1_->GetBuffer(0, __uuidof(IDXGISurface1), (void**)surface_.GetAddressOf());
+	back_buffer_width_ = sizer_.buffer_width();
+	back_buffer_height_ = sizer_.buffer_height();
+
 	context_->immediate_context()->OMSetRenderTargets(1, back_buffer_view_.GetAddressOf(), nullptr);
 
 	// Setup the viewport
@@ -1,5 +1,6 @@
 #pragma once
 #include "GPUContext.h"
+#include "SwapChainSizer.h"
 
 #include <dxgi1_2.h>
 
@@ -16,7 +17,9 @@ public:
 
 	virtual void PresentFrame();
 
-	virtual void Resize(int width, int height);
+	// During an interactive resize the buffers only grow, geometrically, and may be larger than
+	// the window, which presents their top-left corner. See SwapChainSizer.
+	virtual void Resize(int width, int height, bool interactive = false);
 
 	virtual HDC GetDC();
 	virtual void ReleaseDC();
@@ -55,6 +58,7 @@ private:
 	UINT back_buffer_width_;
 	UINT back_buffer_height_;
 	int samples_ = 1;
+	SwapChainSizer sizer_;
 
 	ComPtr<IDXGISurface1> surface_;
 };
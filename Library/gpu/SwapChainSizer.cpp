@@ -0,0 +1,49 @@
+#include "SwapChainSizer.h"
+
+#include <algorithm>
+
+void SwapChainSizer::set_buffer_size(uint32_t width, uint32_t height)
+{
+	buffer_width_ = width;
+	buffer_height_ = height;
+}
+
+bool SwapChainSizer::Resize(uint32_t width, uint32_t height, bool interactive)
+{
+	requests_++;
+
+	// Minimized, keep whatever we have.
+	if (!width || !height)
+		return false;
+
+	uint32_t new_width = width;
+	uint32_t new_height = height;
+
+	if (interactive) {
+		if (width <= buffer_width_ && height <= buffer_height_)
+			return false;
+
+		new_width = Grow(buffer_width_, width);
+		new_height = Grow(buffer_height_, height);
+	}
+
+	if (new_width == buffer_width_ && new_height == buffer_height_)
+		return false;
+
+	buffer_width_ = new_width;
+	buffer_height_ = new_height;
+	reallocations_++;
+	return true;
+}
+
+uint32_t SwapChainSizer::Grow(uint32_t current, uint32_t requested)
+{
+	if (requested <= current)
+		return current;
+
+	uint32_t grown = current + current * kGrowthPercent / 100;
+	if (grown > kMaxSize)
+		grown = kMaxSize;
+
+	return std::max(requested, grown);
+}
@@ -0,0 +1,32 @@
+#pragma once
+#include <stdint.h>
+
+// Picks swap chain buffer sizes so an interactive (modal) resize reallocates rarely.
+//
+// While the user drags a window edge the buffers only ever grow, by at least kGrowthPercent,
+// and the window presents a crop of them. Once the drag ends, or for any programmatic
+// resize, the buffers are fit to the exact client size again.
+class SwapChainSizer {
+public:
+	static const uint32_t kGrowthPercent = 50;
+	static const uint32_t kMaxSize = 16384;  // D3D_FL11_0 texture limit
+
+	void set_buffer_size(uint32_t width, uint32_t height);
+
+	// Returns true if the buffers must be reallocated to buffer_width() x buffer_height().
+	bool Resize(uint32_t width, uint32_t height, bool interactive);
+
+	uint32_t buffer_width() const { return buffer_width_; }
+	uint32_t buffer_height() const { return buffer_height_; }
+
+	uint32_t requests() const { return requests_; }
+	uint32_t reallocations() const { return reallocations_; }
+
+protected:
+	static uint32_t Grow(uint32_t current, uint32_t requested);
+
+	uint32_t buffer_width_ = 0;
+	uint32_t buffer_height_ = 0;
+	uint32_t requests_ = 0;
+	uint32_t reallocations_ = 0;
+};
@@ -0,0 +1,142 @@
+#include "UploadQueue.h"
+#include <string.h>
+
+StagingArena::StagingArena(size_t capacity) : buffer_(capacity) {}
+
+uint8_t* StagingArena::Allocate(size_t size) {
+	if (!size || size > buffer_.size())
+		return nullptr;
+
+	size_t offset = 0;
+
+	if (!blocks_.empty()) {
+		size_t tail = blocks_.front().offset;
+		size_t head = blocks_.back().offset + blocks_.back().size;
+
+		if (blocks_.back().offset >= tail) {
+			// Live data is one span [tail, head), room at the end or, wrapping, at the start.
+			if (head + size <= buffer_.size())
+				offset = head;
+			else if (size <= tail)
+				offset = 0;
+			else
+				return nullptr;
+		}
+		else {
+			// Wrapped, the only room is between head and tail.
+			if (head + size > tail)
+				return nullptr;
+			offset = head;
+		}
+	}
+
+	Block block = { offset, size };
+	blocks_.push_back(block);
+	used_ += size;
+	return buffer_.data() + offset;
+}
+
+void StagingArena::Release() {
+	if (blocks_.empty())
+		return;
+
+	used_ -= blocks_.front().size;
+	blocks_.pop_front();
+}
+
+UploadQueue::UploadQueue(UploadDevice* device, size_t staging_capacity)
+	: device_(device), staging_(staging_capacity) {
+	thread_ = std::thread(&UploadQueue::Run, this);
+}
+
+UploadQueue::~UploadQueue() {
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		stopping_ = true;
+	}
+
+	work_available_.notify_one();
+	thread_.join();
+}
+
+uint64_t UploadQueue::Submit(UploadJob job, const void* pixels) {
+	std::unique_lock<std::mutex> lock(mutex_);
+
+	PendingJob pending;
+	pending.staged = job.size <= staging_.capacity();
+
+	uint8_t* copy = nullptr;
+	if (pending.staged) {
+		copy = staging_.Allocate(job.size);
+		if (!copy && job.size) {
+			stats_.stalls++;
+			work_done_.wait(lock, [&] { return (copy = staging_.Allocate(job.size)) != nullptr; });
+		}
+	}
+	else {
+		stats_.oversized++;
+		pending.heap_copy.resize(job.size);
+		copy = pending.heap_copy.data();
+	}
+
+	// Copying under the lock is fine, the worker only needs it to pop the next job.
+	if (job.size)
+		memcpy(copy, pixels, job.size);
+
+	job.fence = next_fence_++;
+	job.pixels = copy;
+	pending.job = job;
+
+	stats_.submitted++;
+	stats_.staged_bytes += job.size;
+	if (staging_.used() > stats_.peak_staging_bytes)
+		stats_.peak_staging_bytes = staging_.used();
+
+	jobs_.push_back(std::move(pending));
+	lock.unlock();
+
+	work_available_.notify_one();
+	return job.fence;
+}
+
+void UploadQueue::Wait(uint64_t fence) {
+	std::unique_lock<std::mutex> lock(mutex_);
+	work_done_.wait(lock, [&] { return completed_fence_ >= fence; });
+}
+
+uint64_t UploadQueue::completed_fence() const {
+	std::lock_guard<std::mutex> lock(mutex_);
+	return completed_fence_;
+}
+
+UploadQueueStats UploadQueue::stats() const {
+	std::lock_guard<std::mutex> lock(mutex_);
+	return stats_;
+}
+
+void UploadQueue::Run() {
+	std::unique_lock<std::mutex> lock(mutex_);
+
+	for (;;) {
+		work_available_.wait(lock, [&] { return stopping_ || !jobs_.empty(); });
+
+		// Drain what was submitted before stopping, callers may be waiting on it.
+		if (jobs_.empty())
+			return;
+
+		// The job stays at the front so its staging block can't be reused while executing.
+		const PendingJob& pending = jobs_.front();
+		lock.unlock();
+		device_->Execute(pending.job);
+		lock.lock();
+
+		if (jobs_.front().staged && jobs_.front().job.size)
+			staging_.Release();
+
+		completed_fence_ = jobs_.front().job.fence;
+		stats_.completed++;
+		jobs_.pop_front();
+
+		work_done_.notify_all();
+	}
+}
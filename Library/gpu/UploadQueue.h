@@ -0,0 +1,111 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// A texture to create on the upload thread. Everything but the pixels is opaque to the queue.
+struct UploadJob {
+	uint64_t fence = 0;
+	uint32_t id = 0;
+	uint32_t width = 0;
+	uint32_t height = 0;
+	uint32_t row_bytes = 0;
+	uint32_t format = 0;
+	uint32_t usage = 0;
+	const uint8_t* pixels = nullptr;  // deep copy, only valid during UploadDevice::Execute
+	size_t size = 0;
+};
+
+// Creates the resources, called on the upload thread in submission order.
+class UploadDevice {
+public:
+	virtual ~UploadDevice() {}
+
+	virtual void Execute(const UploadJob& job) = 0;
+};
+
+// Ring of bytes for pixel data waiting to be uploaded. Blocks are released in the order they
+// were allocated, which is the order the upload thread finishes them.
+class StagingArena {
+public:
+	explicit StagingArena(size_t capacity);
+
+	// Returns nullptr when there is no contiguous room left.
+	uint8_t* Allocate(size_t size);
+
+	// Release the oldest block.
+	void Release();
+
+	size_t capacity() const { return buffer_.size(); }
+
+	size_t used() const { return used_; }
+
+protected:
+	struct Block {
+		size_t offset;
+		size_t size;
+	};
+
+	std::vector<uint8_t> buffer_;
+	std::deque<Block> blocks_;
+	size_t used_ = 0;
+};
+
+struct UploadQueueStats {
+	uint64_t submitted;
+	uint64_t completed;
+	uint64_t staged_bytes;      // total since startup
+	size_t peak_staging_bytes;
+	uint32_t stalls;            // submissions that waited for room in the staging arena
+	uint32_t oversized;         // jobs too big for the arena, copied to their own allocation
+};
+
+// Deep-copies texture data into a staging arena and hands it to an UploadDevice on a worker
+// thread, so Renderer::Render never waits for resource creation.
+//
+// Every job gets a fence value, fences complete in submission order.
+class UploadQueue {
+public:
+	UploadQueue(UploadDevice* device, size_t staging_capacity);
+	~UploadQueue();
+
+	// Copy the pixels and queue the job. Only blocks if the staging arena is full.
+	uint64_t Submit(UploadJob job, const void* pixels);
+
+	// Block until every job up to and including this fence has executed.
+	void Wait(uint64_t fence);
+
+	bool IsComplete(uint64_t fence) const { return fence <= completed_fence(); }
+
+	uint64_t completed_fence() const;
+
+	UploadQueueStats stats() const;
+
+protected:
+	void Run();
+
+	UploadDevice* device_;
+	StagingArena staging_;
+
+	mutable std::mutex mutex_;
+	std::condition_variable work_available_;
+	std::condition_variable work_done_;
+
+	struct PendingJob {
+		UploadJob job;
+		bool staged;                   // pixels live in staging_, otherwise in heap_copy
+		std::vector<uint8_t> heap_copy;
+	};
+
+	std::deque<PendingJob> jobs_;
+	uint64_t next_fence_ = 1;
+	uint64_t completed_fence_ = 0;
+	bool stopping_ = false;
+	UploadQueueStats stats_ = {};
+
+	std::thread thread_;
+};
@@ -0,0 +1,82 @@
+#include "UsagePolicy.h"
+
+static uint32_t CountBits(uint32_t bits)
+{
+	uint32_t count = 0;
+	for (; bits; bits &= bits - 1)
+		count++;
+
+	return count;
+}
+
+void UsagePolicy::Add(uint32_t id, UsageClass usage)
+{
+	Entry entry = { usage, frame_, 0 };
+	entries_[id] = entry;
+}
+
+void UsagePolicy::Remove(uint32_t id)
+{
+	entries_.erase(id);
+}
+
+UsageClass UsagePolicy::OnUpdate(uint32_t id)
+{
+	auto i = entries_.find(id);
+	if (i == entries_.end())
+		return UsageClass::Default;
+
+	Entry& entry = i->second;
+	uint32_t age = frame_ - entry.last_update_frame;
+	entry.history = (age < 32 ? entry.history << age : 0) | 1;
+	entry.last_update_frame = frame_;
+
+	updates_[(size_t)entry.usage]++;
+
+	UsageClass usage = entry.usage;
+	if (CountBits(entry.history & ((1u << kHotFrames) - 1)) >= kHotUpdates)
+		usage = UsageClass::Dynamic;
+	else if (usage == UsageClass::Immutable)
+		usage = UsageClass::Default;
+
+	if (usage != entry.usage) {
+		entry.usage = usage;
+		promotions_++;
+	}
+
+	return usage;
+}
+
+void UsagePolicy::CollectDemotions(std::vector<uint32_t>& ids)
+{
+	ids.clear();
+
+	for (auto& i : entries_) {
+		Entry& entry = i.second;
+		if (entry.usage == UsageClass::Dynamic && frame_ - entry.last_update_frame >= kCoolFrames) {
+			entry.usage = UsageClass::Default;
+			demotions_++;
+			ids.push_back(i.first);
+		}
+	}
+}
+
+UsageClass UsagePolicy::usage_class(uint32_t id) const
+{
+	auto i = entries_.find(id);
+	return i == entries_.end() ? UsageClass::Default : i->second.usage;
+}
+
+UsageClassStats UsagePolicy::stats() const
+{
+	UsageClassStats stats = {};
+	for (auto& i : entries_)
+		stats.resources[(size_t)i.second.usage]++;
+
+	for (size_t i = 0; i < 3; i++)
+		stats.updates[i] = updates_[i];
+
+	stats.promotions = promotions_;
+	stats.demotions = demotions_;
+	return stats;
+}
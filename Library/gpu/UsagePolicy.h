@@ -0,0 +1,58 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <map>
+#include <vector>
+
+enum class UsageClass : uint8_t {
+	Immutable,  // never updated since creation
+	Default,    // updated now and then, by replacing or copying on the GPU
+	Dynamic,    // updated most frames, CPU-writable with Map(WRITE_DISCARD)
+};
+
+struct UsageClassStats {
+	uint32_t resources[3];  // indexed by UsageClass
+	uint64_t updates[3];    // updates received while in each class
+	uint32_t promotions;
+	uint32_t demotions;
+};
+
+// Watches how often resources are updated and decides which usage class they belong in.
+//
+// Resources start in the class they were created with. The first update of an immutable one
+// moves it to Default, being updated in kHotUpdates of the last kHotFrames frames moves it to
+// Dynamic, and a dynamic one that hasn't changed for kCoolFrames frames goes back to Default.
+class UsagePolicy {
+public:
+	static const uint32_t kHotFrames = 8;
+	static const uint32_t kHotUpdates = 3;
+	static const uint32_t kCoolFrames = 120;
+
+	void NextFrame() { frame_++; }
+
+	void Add(uint32_t id, UsageClass usage);
+	void Remove(uint32_t id);
+
+	// Record an update and return the class the resource should be in to receive it.
+	UsageClass OnUpdate(uint32_t id);
+
+	// Dynamic resources that cooled down, already moved to Default.
+	void CollectDemotions(std::vector<uint32_t>& ids);
+
+	UsageClass usage_class(uint32_t id) const;
+
+	UsageClassStats stats() const;
+
+protected:
+	struct Entry {
+		UsageClass usage;
+		uint32_t last_update_frame;
+		uint32_t history;  // bit n set if updated n frames before last_update_frame
+	};
+
+	std::map<uint32_t, Entry> entries_;
+	uint32_t frame_ = 0;
+	uint64_t updates_[3] = {};
+	uint32_t promotions_ = 0;
+	uint32_t demotions_ = 0;
+};
@@ -0,0 +1,59 @@
+#include "VSyncPacer.h"
+
+#include <math.h>
+
+// Measured vblanks closer than this to the prediction don't count as a resync.
+static const double kResyncTolerance = 0.0005;
+
+void VSyncPacer::SetPeriod(double period)
+{
+	if (period > 0.0)
+		period_ = period;
+}
+
+void VSyncPacer::Sync(double vblank_time, double period)
+{
+	if (period <= 0.0)
+		return;
+
+	double predicted = phase_ + floor((vblank_time - phase_) / period_ + 0.5) * period_;
+	if (fabs(vblank_time - predicted) > kResyncTolerance || fabs(period - period_) > kResyncTolerance)
+		stats_.resyncs++;
+
+	// Keep the index of the last tick on the new grid so a resync doesn't tick twice.
+	double last_tick_time = last_tick_ != INT64_MIN ? phase_ + last_tick_ * period_ : 0.0;
+
+	period_ = period;
+	phase_ = vblank_time;
+
+	if (last_tick_ != INT64_MIN)
+		last_tick_ = (int64_t)floor((last_tick_time - phase_) / period_ + 0.5);
+}
+
+bool VSyncPacer::Tick(double now, uint32_t& missed)
+{
+	missed = 0;
+
+	int64_t index = VBlankIndex(now);
+	if (last_tick_ != INT64_MIN && index <= last_tick_)
+		return false;
+
+	if (last_tick_ != INT64_MIN && index - last_tick_ > 1) {
+		missed = (uint32_t)(index - last_tick_ - 1);
+		stats_.missed += missed;
+	}
+
+	last_tick_ = index;
+	stats_.ticks++;
+	return true;
+}
+
+double VSyncPacer::TimeUntilNext(double now) const
+{
+	return phase_ + (VBlankIndex(now) + 1) * period_ - now;
+}
+
+int64_t VSyncPacer::VBlankIndex(double time) const
+{
+	return (int64_t)floor((time - phase_) / period_);
+}
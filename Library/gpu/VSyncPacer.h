@@ -0,0 +1,42 @@
+#pragma once
+#include <stdint.h>
+
+struct VSyncStats {
+	uint64_t ticks = 0;
+	uint64_t missed = 0;   // vblanks that passed without a tick
+	uint64_t resyncs = 0;  // measured vblanks that moved the phase
+};
+
+// Turns a monitor's vblank timing into display link ticks.
+//
+// The pacer predicts vblanks from the last measured one and the refresh period, Tick returns
+// true once per vblank that passed since the previous tick. When the caller polls too slowly
+// the skipped vblanks are counted as missed. Times are in seconds on any monotonic clock, so a
+// fake clock drives it the same as QueryPerformanceCounter.
+class VSyncPacer {
+public:
+	// Refresh period used until (or without) measured vblanks, eg 1 / 60.
+	void SetPeriod(double period);
+
+	// Align to a measured vblank, eg from DwmGetCompositionTimingInfo. Ignored if period <= 0.
+	void Sync(double vblank_time, double period);
+
+	// True if a vblank passed since the last tick, missed is set to the vblanks in between.
+	bool Tick(double now, uint32_t& missed);
+
+	// Seconds from now until the next predicted vblank.
+	double TimeUntilNext(double now) const;
+
+	double period() const { return period_; }
+
+	const VSyncStats& stats() const { return stats_; }
+
+protected:
+	// Index of the last vblank at or before time.
+	int64_t VBlankIndex(double time) const;
+
+	double period_ = 1.0 / 60.0;
+	double phase_ = 0.0;  // time of a known vblank
+	int64_t last_tick_ = INT64_MIN;
+	VSyncStats stats_;
+};
@@ -0,0 +1,1645 @@
+unsigned char fill_hlsl[] = {
+  0x63, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x55, 0x6E, 0x69, 0x66, 
+  0x6F, 0x72, 0x6D, 0x73, 0x20, 0x3A, 0x20, 0x72, 0x65, 0x67, 0x69, 0x73, 
+  0x74, 0x65, 0x72, 0x28, 0x62, 0x30, 0x29, 0x0A, 0x7B, 0x0A, 0x20, 0x20, 
+  0x66, 0x6C, 0x6F, 0x61, 0x74, 0x34, 0x20, 0x53, 0x74, 0x61, 0x74, 0x65, 
+  0x3B, 0x0A, 0x20, 0x20, 0x6D, 0x61, 0x74, 0x72, 0x69, 0x78, 0x20, 0x54, 
+  0x72, 0x61, 0x6E, 0x73, 0x66, 0x6F, 0x72, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 
+  0x66, 0x6C, 0x6F, 0x61, 0x74, 0x34, 0x20, 0x53, 0x63, 0x61, 0x6C, 0x61, 
+  0x72, 0x34, 0x5B, 0x32, 0x5D, 0x3B, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 
+  0x61, 0x74, 0x34, 0x20, 0x56, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x5B, 0x38, 
+  0x5D, 0x3B, 0x0A, 0x20, 0x20, 0x75, 0x69, 0x6E, 0x74, 0x20, 0x43, 0x6C, 
+  0x69, 0x70, 0x53, 0x69, 0x7A, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x6D, 0x61, 
+  0x74, 0x72, 0x69, 0x78, 0x20, 0x43, 0x6C, 0x69, 0x70, 0x5B, 0x38, 0x5D, 
+  0x3B, 0x0A, 0x7D, 0x3B, 0x0A, 0x0A, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 
+  0x53, 0x63, 0x61, 0x6C, 0x61, 0x72, 0x28, 0x69, 0x6E, 0x74, 0x20, 0x69, 
+  0x29, 0x20, 0x7B, 0x20, 0x69, 0x66, 0x20, 0x28, 0x69, 0x20, 0x3C, 0x20, 
+  0x34, 0x29, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x53, 0x63, 
+  0x61, 0x6C, 0x61, 0x72, 0x34, 0x5B, 0x30, 0x5D, 0x5B, 0x69, 0x5D, 0x3B, 
+  0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+  0x20, 0x53, 0x63, 0x61, 0x6C, 0x61, 0x72, 0x34, 0x5B, 0x31, 0x5D, 0x5B, 
+  0x69, 0x20, 0x2D, 0x20, 0x34, 0x5D, 0x3B, 0x20, 0x7D, 0x0A, 0x0A, 0x54, 
+  0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x32, 0x44, 0x20, 0x74, 0x65, 0x78, 
+  0x74, 0x75, 0x72, 0x65, 0x30, 0x20, 0x3A, 0x20, 0x72, 0x65, 0x67, 0x69, 
+  0x73, 0x74, 0x65, 0x72, 0x28, 0x74, 0x30, 0x29, 0x3B, 0x0A, 0x54, 0x65, 
+  0x78, 0x74, 0x75, 0x72, 0x65, 0x32, 0x44, 0x20, 0x74, 0x65, 0x78, 0x74, 
+  0x75, 0x72, 0x65, 0x31, 0x20, 0x3A, 0x20, 0x72, 0x65, 0x67, 0x69, 0x73, 
+  0x74, 0x65, 0x72, 0x28, 0x74, 0x31, 0x29, 0x3B, 0x0A, 0x53, 0x61, 0x6D, 
+  0x70, 0x6C, 0x65, 0x72, 0x53, 0x74, 0x61, 0x74, 0x65, 0x20, 0x73, 0x61, 
+  0x6D, 0x70, 0x6C, 0x65, 0x72, 0x30, 0x20, 0x3A, 0x20, 0x72, 0x65, 0x67, 
+  0x69, 0x73, 0x74, 0x65, 0x72, 0x28, 0x73, 0x30, 0x29, 0x3B, 0x0A, 0x0A, 
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x56, 0x53, 0x5F, 0x4F, 0x55, 
+  0x54, 0x50, 0x55, 0x54, 0x0A, 0x7B, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 
+  0x61, 0x74, 0x34, 0x20, 0x50, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 
+  0x20, 0x20, 0x20, 0x20, 0x3A, 0x20, 0x53, 0x56, 0x5F, 0x50, 0x4F, 0x53, 
+  0x49, 0x54, 0x49, 0x4F, 0x4E, 0x3B, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 
+  0x61, 0x74, 0x34, 0x20, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x20, 0x20, 
+  0x20, 0x20, 0x20, 0x20, 0x3A, 0x20, 0x43, 0x4F, 0x4C, 0x4F, 0x52, 0x30, 
+  0x3B, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x32, 0x20, 0x54, 
+  0x65, 0x78, 0x43, 0x6F, 0x6F, 0x72, 0x64, 0x20, 0x20, 0x20, 0x20, 0x3A, 
+  0x20, 0x54, 0x45, 0x58, 0x43, 0x4F, 0x4F, 0x52, 0x44, 0x30, 0x3B, 0x0A, 
+  0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x34, 0x20, 0x44, 0x61, 0x74, 
+  0x61, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3A, 0x20, 0x43, 
+  0x4F, 0x4C, 0x4F, 0x52, 0x31, 0x3B, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 
+  0x61, 0x74, 0x34, 0x20, 0x44, 0x61, 0x74, 0x61, 0x31, 0x20, 0x20, 0x20, 
+  0x20, 0x20, 0x20, 0x20, 0x3A, 0x20, 0x43, 0x4F, 0x4C, 0x4F, 0x52, 0x32, 
+  0x3B, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x34, 0x20, 0x44, 
+  0x61, 0x74, 0x61, 0x32, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3A, 
+  0x20, 0x43, 0x4F, 0x4C, 0x4F, 0x52, 0x33, 0x3B, 0x0A, 0x20, 0x20, 0x66, 
+  0x6C, 0x6F, 0x61, 0x74, 0x34, 0x20, 0x44, 0x61, 0x74, 0x61, 0x33, 0x20, 
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3A, 0x20, 0x43, 0x4F, 0x4C, 0x4F, 
+  0x52, 0x34, 0x3B, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x34, 
+  0x20, 0x44, 0x61, 0x74, 0x61, 0x34, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+  0x20, 0x3A, 0x20, 0x43, 0x4F, 0x4C, 0x4F, 0x52, 0x35, 0x3B, 0x0A, 0x20, 
+  0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x34, 0x20, 0x44, 0x61, 0x74, 0x61, 
+  0x35, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3A, 0x20, 0x43, 0x4F, 
+  0x4C, 0x4F, 0x52, 0x36, 0x3B, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 
+  0x74, 0x34, 0x20, 0x44, 0x61, 0x74, 0x61, 0x36, 0x20, 0x20, 0x20, 0x20, 
+  0x20, 0x20, 0x20, 0x3A, 0x20, 0x43, 0x4F, 0x4C, 0x4F, 0x52, 0x37, 0x3B, 
+  0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x32, 0x20, 0x4F, 0x62, 
+  0x6A, 0x65, 0x63, 0x74, 0x43, 0x6F, 0x6F, 0x72, 0x64, 0x20, 0x3A, 0x20, 
+  0x54, 0x45, 0x58, 0x43, 0x4F, 0x4F, 0x52, 0x44, 0x31, 0x3B, 0x0A, 0x7D, 
+  0x3B, 0x0A, 0x0A, 0x2F, 0x2F, 0x20, 0x53, 0x70, 0x65, 0x63, 0x69, 0x61, 
+  0x6C, 0x69, 0x7A, 0x65, 0x64, 0x20, 0x70, 0x65, 0x72, 0x6D, 0x75, 0x74, 
+  0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x63, 
+  0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 
+  0x20, 0x46, 0x49, 0x4C, 0x4C, 0x5F, 0x54, 0x59, 0x50, 0x45, 0x20, 0x64, 
+  0x65, 0x66, 0x69, 0x6E, 0x65, 0x64, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x20, 
+  0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x20, 0x69, 0x6E, 0x20, 0x50, 0x53, 
+  0x28, 0x29, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x0A, 0x2F, 0x2F, 0x20, 0x66, 
+  0x6F, 0x6C, 0x64, 0x73, 0x20, 0x61, 0x77, 0x61, 0x79, 0x20, 0x74, 0x6F, 
+  0x20, 0x61, 0x20, 0x73, 0x69, 0x6E, 0x67, 0x6C, 0x65, 0x20, 0x66, 0x69, 
+  0x6C, 0x6C, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 
+  0x0A, 0x23, 0x69, 0x66, 0x64, 0x65, 0x66, 0x20, 0x46, 0x49, 0x4C, 0x4C, 
+  0x5F, 0x54, 0x59, 0x50, 0x45, 0x0A, 0x75, 0x69, 0x6E, 0x74, 0x20, 0x46, 
+  0x69, 0x6C, 0x6C, 0x54, 0x79, 0x70, 0x65, 0x28, 0x56, 0x53, 0x5F, 0x4F, 
+  0x55, 0x54, 0x50, 0x55, 0x54, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x29, 
+  0x20, 0x7B, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x46, 0x49, 
+  0x4C, 0x4C, 0x5F, 0x54, 0x59, 0x50, 0x45, 0x3B, 0x20, 0x7D, 0x0A, 0x23, 
+  0x65, 0x6C, 0x73, 0x65, 0x0A, 0x75, 0x69, 0x6E, 0x74, 0x20, 0x46, 0x69, 
+  0x6C, 0x6C, 0x54, 0x79, 0x70, 0x65, 0x28, 0x56, 0x53, 0x5F, 0x4F, 0x55, 
+  0x54, 0x50, 0x55, 0x54, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x29, 0x20, 
+  0x7B, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x75, 0x69, 0x6E, 
+  0x74, 0x28, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2E, 0x44, 0x61, 0x74, 0x61, 
+  0x30, 0x2E, 0x78, 0x20, 0x2B, 0x20, 0x30, 0x2E, 0x35, 0x29, 0x3B, 0x20, 
+  0x7D, 0x0A, 0x23, 0x65, 0x6E, 0x64, 0x69, 0x66, 0x0A, 0x66, 0x6C, 0x6F, 
+  0x61, 0x74, 0x34, 0x20, 0x54, 0x69, 0x6C, 0x65, 0x52, 0x65, 0x63, 0x74, 
+  0x55, 0x56, 0x28, 0x29, 0x20, 0x7B, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 
+  0x6E, 0x20, 0x56, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x5B, 0x30, 0x5D, 0x3B, 
+  0x20, 0x7D, 0x0A, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x32, 0x20, 0x54, 0x69, 
+  0x6C, 0x65, 0x53, 0x69, 0x7A, 0x65, 0x28, 0x29, 0x20, 0x7B, 0x20, 0x72, 
+  0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x56, 0x65, 0x63, 0x74, 0x6F, 0x72, 
+  0x5B, 0x31, 0x5D, 0x2E, 0x7A, 0x77, 0x3B, 0x20, 0x7D, 0x0A, 0x66, 0x6C, 
+  0x6F, 0x61, 0x74, 0x32, 0x20, 0x50, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 
+  0x54, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x6F, 0x72, 0x6D, 0x41, 0x28, 0x29, 
+  0x20, 0x7B, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x56, 0x65, 
+  0x63, 0x74, 0x6F, 0x72, 0x5B, 0x32, 0x5D, 0x2E, 0x78, 0x79, 0x3B, 0x20, 
+  0x7D, 0x0A, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x32, 0x20, 0x50, 0x61, 0x74, 
+  0x74, 0x65, 0x72, 0x6E, 0x54, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x6F, 0x72, 
+  0x6D, 0x42, 0x28, 0x29, 0x20, 0x7B, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 
+  0x6E, 0x20, 0x56, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x5B, 0x32, 0x5D, 0x2E, 
+  0x7A, 0x77, 0x3B, 0x20, 0x7D, 0x0A, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x32, 
+  0x20, 0x50, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 0x54, 0x72, 0x61, 0x6E, 
+  0x73, 0x66, 0x6F, 0x72, 0x6D, 0x43, 0x28, 0x29, 0x20, 0x7B, 0x20, 0x72, 
+  0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x56, 0x65, 0x63, 0x74, 0x6F, 0x72, 
+  0x5B, 0x33, 0x5D, 0x2E, 0x78, 0x79, 0x3B, 0x20, 0x7D, 0x0A, 0x75, 0x69, 
+  0x6E, 0x74, 0x20, 0x47, 0x72, 0x61, 0x64, 0x69, 0x65, 0x6E, 0x74, 0x5F, 
+  0x4E, 0x75, 0x6D, 0x53, 0x74, 0x6F, 0x70, 0x73, 0x28, 0x56, 0x53, 0x5F, 
+  0x4F, 0x55, 0x54, 0x50, 0x55, 0x54, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 
+  0x29, 0x20, 0x7B, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x75, 
+  0x69, 0x6E, 0x74, 0x28, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2E, 0x44, 0x61, 
+  0x74, 0x61, 0x30, 0x2E, 0x79, 0x20, 0x2B, 0x20, 0x30, 0x2E, 0x35, 0x29, 
+  0x3B, 0x20, 0x7D, 0x0A, 0x62, 0x6F, 0x6F, 0x6C, 0x20, 0x47, 0x72, 0x61, 
+  0x64, 0x69, 0x65, 0x6E, 0x74, 0x5F, 0x49, 0x73, 0x52, 0x61, 0x64, 0x69, 
+  0x61, 0x6C, 0x28, 0x56, 0x53, 0x5F, 0x4F, 0x55, 0x54, 0x50, 0x55, 0x54, 
+  0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x29, 0x20, 0x7B, 0x20, 0x72, 0x65, 
+  0x74, 0x75, 0x72, 0x6E, 0x20, 0x62, 0x6F, 0x6F, 0x6C, 0x28, 0x75, 0x69, 
+  0x6E, 0x74, 0x28, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2E, 0x44, 0x61, 0x74, 
+  0x61, 0x30, 0x2E, 0x7A, 0x20, 0x2B, 0x20, 0x30, 0x2E, 0x35, 0x29, 0x29, 
+  0x3B, 0x20, 0x7D, 0x0A, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x47, 0x72, 
+  0x61, 0x64, 0x69, 0x65, 0x6E, 0x74, 0x5F, 0x52, 0x30, 0x28, 0x56, 0x53, 
+  0x5F, 0x4F, 0x55, 0x54, 0x50, 0x55, 0x54, 0x20, 0x69, 0x6E, 0x70, 0x75, 
+  0x74, 0x29, 0x20, 0x7B, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+  0x69, 0x6E, 0x70, 0x75, 0x74, 0x2E, 0x44, 0x61, 0x74, 0x61, 0x31, 0x2E, 
+  0x78, 0x3B, 0x20, 0x7D, 0x0A, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x47, 
+  0x72, 0x61, 0x64, 0x69, 0x65, 0x6E, 0x74, 0x5F, 0x52, 0x31, 0x28, 0x56, 
+  0x53, 0x5F, 0x4F, 0x55, 0x54, 0x50, 0x55, 0x54, 0x20, 0x69, 0x6E, 0x70, 
+  0x75, 0x74, 0x29, 0x20, 0x7B, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+  0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2E, 0x44, 0x61, 0x74, 0x61, 0x31, 
+  0x2E, 0x79, 0x3B, 0x20, 0x7D, 0x0A, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x32, 
+  0x20, 0x47, 0x72, 0x61, 0x64, 0x69, 0x65, 0x6E, 0x74, 0x5F, 0x50, 0x30, 
+  0x28, 0x56, 0x53, 0x5F, 0x4F, 0x55, 0x54, 0x50, 0x55, 0x54, 0x20, 0x69, 
+  0x6E, 0x70, 0x75, 0x74, 0x29, 0x20, 0x7B, 0x20, 0x72, 0x65, 0x74, 0x75, 
+  0x72, 0x6E, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2E, 0x44, 0x61, 0x74, 
+  0x61, 0x31, 0x2E, 0x78, 0x79, 0x3B, 0x20, 0x7D, 0x0A, 0x66, 0x6C, 0x6F, 
+  0x61, 0x74, 0x32, 0x20, 0x47, 0x72, 0x61, 0x64, 0x69, 0x65, 0x6E, 0x74, 
+  0x5F, 0x50, 0x31, 0x28, 0x56, 0x53, 0x5F, 0x4F, 0x55, 0x54, 0x50, 0x55, 
+  0x54, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x29, 0x20, 0x7B, 0x20, 0x72, 
+  0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2E, 
+  0x44, 0x61, 0x74, 0x61, 0x31, 0x2E, 0x7A, 0x77, 0x3B, 0x20, 0x7D, 0x0A, 
+  0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x53, 0x44, 0x46, 0x4D, 0x61, 0x78, 
+  0x44, 0x69, 0x73, 0x74, 0x61, 0x6E, 0x63, 0x65, 0x28, 0x56, 0x53, 0x5F, 
+  0x4F, 0x55, 0x54, 0x50, 0x55, 0x54, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 
+  0x29, 0x20, 0x7B, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x69, 
+  0x6E, 0x70, 0x75, 0x74, 0x2E, 0x44, 0x61, 0x74, 0x61, 0x30, 0x2E, 0x79, 
+  0x3B, 0x20, 0x7D, 0x0A, 0x0A, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 
+  0x47, 0x72, 0x61, 0x64, 0x69, 0x65, 0x6E, 0x74, 0x53, 0x74, 0x6F, 0x70, 
+  0x20, 0x7B, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x70, 0x65, 0x72, 
+  0x63, 0x65, 0x6E, 0x74, 0x3B, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x34, 
+  0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3B, 0x20, 0x7D, 0x3B, 0x0A, 0x0A, 
+  0x47, 0x72, 0x61, 0x64, 0x69, 0x65, 0x6E, 0x74, 0x53, 0x74, 0x6F, 0x70, 
+  0x20, 0x47, 0x65, 0x74, 0x47, 0x72, 0x61, 0x64, 0x69, 0x65, 0x6E, 0x74, 
+  0x53, 0x74, 0x6F, 0x70, 0x28, 0x56, 0x53, 0x5F, 0x4F, 0x55, 0x54, 0x50, 
+  0x55, 0x54, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2C, 0x20, 0x75, 0x69, 
+  0x6E, 0x74, 0x20, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x29, 0x20, 0x7B, 
+  0x0A, 0x20, 0x20, 0x47, 0x72, 0x61, 0x64, 0x69, 0x65, 0x6E, 0x74, 0x53, 
+  0x74, 0x6F, 0x70, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x3B, 0x0A, 
+  0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 
+  0x20, 0x3C, 0x20, 0x34, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+  0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x2E, 0x70, 0x65, 0x72, 0x63, 0x65, 
+  0x6E, 0x74, 0x20, 0x3D, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2E, 0x44, 
+  0x61, 0x74, 0x61, 0x32, 0x5B, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x5D, 
+  0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6F, 0x66, 
+  0x66, 0x73, 0x65, 0x74, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x0A, 0x20, 
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x2E, 
+  0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x69, 0x6E, 0x70, 0x75, 
+  0x74, 0x2E, 0x44, 0x61, 0x74, 0x61, 0x33, 0x3B, 0x0A, 0x20, 0x20, 0x20, 
+  0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6F, 0x66, 
+  0x66, 0x73, 0x65, 0x74, 0x20, 0x3D, 0x3D, 0x20, 0x31, 0x29, 0x0A, 0x20, 
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x2E, 
+  0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x69, 0x6E, 0x70, 0x75, 
+  0x74, 0x2E, 0x44, 0x61, 0x74, 0x61, 0x34, 0x3B, 0x0A, 0x20, 0x20, 0x20, 
+  0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6F, 0x66, 
+  0x66, 0x73, 0x65, 0x74, 0x20, 0x3D, 0x3D, 0x20, 0x32, 0x29, 0x0A, 0x20, 
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x2E, 
+  0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x69, 0x6E, 0x70, 0x75, 
+  0x74, 0x2E, 0x44, 0x61, 0x74, 0x61, 0x35, 0x3B, 0x0A, 0x20, 0x20, 0x20, 
+  0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6F, 0x66, 
+  0x66, 0x73, 0x65, 0x74, 0x20, 0x3D, 0x3D, 0x20, 0x33, 0x29, 0x0A, 0x20, 
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x2E, 
+  0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x69, 0x6E, 0x70, 0x75, 
+  0x74, 0x2E, 0x44, 0x61, 0x74, 0x61, 0x36, 0x3B, 0x0A, 0x20, 0x20, 0x7D, 
+  0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+  0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x2E, 0x70, 0x65, 0x72, 0x63, 0x65, 
+  0x6E, 0x74, 0x20, 0x3D, 0x20, 0x53, 0x63, 0x61, 0x6C, 0x61, 0x72, 0x28, 
+  0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x2D, 0x20, 0x34, 0x29, 0x3B, 
+  0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x2E, 
+  0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x56, 0x65, 0x63, 0x74, 
+  0x6F, 0x72, 0x5B, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x2D, 0x20, 
+  0x34, 0x5D, 0x3B, 0x0A, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x72, 0x65, 
+  0x74, 0x75, 0x72, 0x6E, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x3B, 
+  0x0A, 0x7D, 0x0A, 0x0A, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x20, 
+  0x41, 0x41, 0x5F, 0x57, 0x49, 0x44, 0x54, 0x48, 0x20, 0x30, 0x2E, 0x33, 
+  0x35, 0x34, 0x0A, 0x0A, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x61, 0x6E, 
+  0x74, 0x69, 0x61, 0x6C, 0x69, 0x61, 0x73, 0x28, 0x69, 0x6E, 0x20, 0x66, 
+  0x6C, 0x6F, 0x61, 0x74, 0x20, 0x64, 0x2C, 0x20, 0x69, 0x6E, 0x20, 0x66, 
+  0x6C, 0x6F, 0x61, 0x74, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2C, 0x20, 
+  0x69, 0x6E, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x6D, 0x65, 0x64, 
+  0x69, 0x61, 0x6E, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x72, 0x65, 0x74, 
+  0x75, 0x72, 0x6E, 0x20, 0x73, 0x6D, 0x6F, 0x6F, 0x74, 0x68, 0x73, 0x74, 
+  0x65, 0x70, 0x28, 0x6D, 0x65, 0x64, 0x69, 0x61, 0x6E, 0x20, 0x2D, 0x20, 
+  0x77, 0x69, 0x64, 0x74, 0x68, 0x2C, 0x20, 0x6D, 0x65, 0x64, 0x69, 0x61, 
+  0x6E, 0x20, 0x2B, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2C, 0x20, 0x64, 
+  0x29, 0x3B, 0x0A, 0x7D, 0x0A, 0x0A, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 
+  0x73, 0x64, 0x52, 0x65, 0x63, 0x74, 0x28, 0x66, 0x6C, 0x6F, 0x61, 0x74, 
+  0x32, 0x20, 0x70, 0x2C, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x32, 0x20, 
+  0x73, 0x69, 0x7A, 0x65, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x66, 0x6C, 
+  0x6F, 0x61, 0x74, 0x32, 0x20, 0x64, 0x20, 0x3D, 0x20, 0x61, 0x62, 0x73, 
+  0x28, 0x70, 0x29, 0x20, 0x2D, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x3B, 0x0A, 
+  0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6D, 0x69, 0x6E, 
+  0x28, 0x6D, 0x61, 0x78, 0x28, 0x64, 0x2E, 0x78, 0x2C, 0x20, 0x64, 0x2E, 
+  0x79, 0x29, 0x2C, 0x20, 0x30, 0x2E, 0x30, 0x29, 0x20, 0x2B, 0x20, 0x6C, 
+  0x65, 0x6E, 0x67, 0x74, 0x68, 0x28, 0x6D, 0x61, 0x78, 0x28, 0x64, 0x2C, 
+  0x20, 0x30, 0x2E, 0x30, 0x29, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 0x0A, 0x2F, 
+  0x2F, 0x20, 0x54, 0x68, 0x65, 0x20, 0x62, 0x65, 0x6C, 0x6F, 0x77, 0x20, 
+  0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x22, 0x73, 0x64, 
+  0x45, 0x6C, 0x6C, 0x69, 0x70, 0x73, 0x65, 0x22, 0x20, 0x69, 0x73, 0x20, 
+  0x4D, 0x49, 0x54, 0x20, 0x6C, 0x69, 0x63, 0x65, 0x6E, 0x73, 0x65, 0x64, 
+  0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x66, 0x6F, 0x6C, 0x6C, 0x6F, 0x77, 
+  0x69, 0x6E, 0x67, 0x20, 0x74, 0x65, 0x78, 0x74, 0x3A, 0x0A, 0x2F, 0x2F, 
+  0x0A, 0x2F, 0x2F, 0x20, 0x54, 0x68, 0x65, 0x20, 0x4D, 0x49, 0x54, 0x20, 
+  0x4C, 0x69, 0x63, 0x65, 0x6E, 0x73, 0x65, 0x0A, 0x2F, 0x2F, 0x20, 0x43, 
+  0x6F, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x32, 0x30, 0x31, 
+  0x33, 0x20, 0x49, 0x6E, 0x69, 0x67, 0x6F, 0x20, 0x51, 0x75, 0x69, 0x6C, 
+  0x65, 0x7A, 0x0A, 0x2F, 0x2F, 0x20, 0x50, 0x65, 0x72, 0x6D, 0x69, 0x73, 
+  0x73, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x73, 0x20, 0x68, 0x65, 0x72, 0x65, 
+  0x62, 0x79, 0x20, 0x67, 0x72, 0x61, 0x6E, 0x74, 0x65, 0x64, 0x2C, 0x20, 
+  0x66, 0x72, 0x65, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x63, 0x68, 0x61, 0x72, 
+  0x67, 0x65, 0x2C, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x70, 
+  0x65, 0x72, 0x73, 0x6F, 0x6E, 0x20, 0x6F, 0x62, 0x74, 0x61, 0x69, 0x6E, 
+  0x69, 0x6E, 0x67, 0x20, 0x61, 0x20, 0x0A, 0x2F, 0x2F, 0x20, 0x63, 0x6F, 
+  0x70, 0x79, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x73, 
+  0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x20, 
+  0x61, 0x73, 0x73, 0x6F, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x64, 
+  0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 
+  0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x28, 0x74, 0x68, 0x65, 0x20, 
+  0x22, 0x53, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x22, 0x29, 0x2C, 
+  0x0A, 0x2F, 0x2F, 0x20, 0x74, 0x6F, 0x20, 0x64, 0x65, 0x61, 0x6C, 0x20, 
+  0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x6F, 0x66, 0x74, 0x77, 
+  0x61, 0x72, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x6F, 0x75, 0x74, 0x20, 
+  0x72, 0x65, 0x73, 0x74, 0x72, 0x69, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2C, 
+  0x20, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x77, 
+  0x69, 0x74, 0x68, 0x6F, 0x75, 0x74, 0x20, 0x6C, 0x69, 0x6D, 0x69, 0x74, 
+  0x61, 0x74, 0x69, 0x6F, 0x6E, 0x0A, 0x2F, 0x2F, 0x20, 0x74, 0x68, 0x65, 
+  0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x75, 
+  0x73, 0x65, 0x2C, 0x20, 0x63, 0x6F, 0x70, 0x79, 0x2C, 0x20, 0x6D, 0x6F, 
+  0x64, 0x69, 0x66, 0x79, 0x2C, 0x20, 0x6D, 0x65, 0x72, 0x67, 0x65, 0x2C, 
+  0x20, 0x70, 0x75, 0x62, 0x6C, 0x69, 0x73, 0x68, 0x2C, 0x20, 0x64, 0x69, 
+  0x73, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x2C, 0x20, 0x73, 0x75, 
+  0x62, 0x6C, 0x69, 0x63, 0x65, 0x6E, 0x73, 0x65, 0x2C, 0x0A, 0x2F, 0x2F, 
+  0x20, 0x61, 0x6E, 0x64, 0x2F, 0x6F, 0x72, 0x20, 0x73, 0x65, 0x6C, 0x6C, 
+  0x20, 0x63, 0x6F, 0x70, 0x69, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x74, 
+  0x68, 0x65, 0x20, 0x53, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x2C, 
+  0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x70, 0x65, 0x72, 0x6D, 
+  0x69, 0x74, 0x20, 0x70, 0x65, 0x72, 0x73, 0x6F, 0x6E, 0x73, 0x20, 0x74, 
+  0x6F, 0x20, 0x77, 0x68, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 
+  0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x0A, 0x2F, 0x2F, 0x20, 0x69, 
+  0x73, 0x20, 0x66, 0x75, 0x72, 0x6E, 0x69, 0x73, 0x68, 0x65, 0x64, 0x20, 
+  0x74, 0x6F, 0x20, 0x64, 0x6F, 0x20, 0x73, 0x6F, 0x2C, 0x20, 0x73, 0x75, 
+  0x62, 0x6A, 0x65, 0x63, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 
+  0x20, 0x66, 0x6F, 0x6C, 0x6C, 0x6F, 0x77, 0x69, 0x6E, 0x67, 0x20, 0x63, 
+  0x6F, 0x6E, 0x64, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x3A, 0x20, 0x54, 
+  0x68, 0x65, 0x20, 0x61, 0x62, 0x6F, 0x76, 0x65, 0x20, 0x63, 0x6F, 0x70, 
+  0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x0A, 0x2F, 0x2F, 0x20, 0x6E, 0x6F, 
+  0x74, 0x69, 0x63, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x69, 
+  0x73, 0x20, 0x70, 0x65, 0x72, 0x6D, 0x69, 0x73, 0x73, 0x69, 0x6F, 0x6E, 
+  0x20, 0x6E, 0x6F, 0x74, 0x69, 0x63, 0x65, 0x20, 0x73, 0x68, 0x61, 0x6C, 
+  0x6C, 0x20, 0x62, 0x65, 0x20, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65, 
+  0x64, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x63, 0x6F, 0x70, 
+  0x69, 0x65, 0x73, 0x20, 0x6F, 0x72, 0x20, 0x73, 0x75, 0x62, 0x73, 0x74, 
+  0x61, 0x6E, 0x74, 0x69, 0x61, 0x6C, 0x0A, 0x2F, 0x2F, 0x20, 0x70, 0x6F, 
+  0x72, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 
+  0x65, 0x20, 0x53, 0x6F, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x2E, 0x20, 
+  0x54, 0x48, 0x45, 0x20, 0x53, 0x4F, 0x46, 0x54, 0x57, 0x41, 0x52, 0x45, 
+  0x20, 0x49, 0x53, 0x20, 0x50, 0x52, 0x4F, 0x56, 0x49, 0x44, 0x45, 0x44, 
+  0x20, 0x22, 0x41, 0x53, 0x20, 0x49, 0x53, 0x22, 0x2C, 0x20, 0x57, 0x49, 
+  0x54, 0x48, 0x4F, 0x55, 0x54, 0x20, 0x57, 0x41, 0x52, 0x52, 0x41, 0x4E, 
+  0x54, 0x59, 0x20, 0x4F, 0x46, 0x0A, 0x2F, 0x2F, 0x20, 0x41, 0x4E, 0x59, 
+  0x20, 0x4B, 0x49, 0x4E, 0x44, 0x2C, 0x20, 0x45, 0x58, 0x50, 0x52, 0x45, 
+  0x53, 0x53, 0x20, 0x4F, 0x52, 0x20, 0x49, 0x4D, 0x50, 0x4C, 0x49, 0x45, 
+  0x44, 0x2C, 0x20, 0x49, 0x4E, 0x43, 0x4C, 0x55, 0x44, 0x49, 0x4E, 0x47, 
+  0x20, 0x42, 0x55, 0x54, 0x20, 0x4E, 0x4F, 0x54, 0x20, 0x4C, 0x49, 0x4D, 
+  0x49, 0x54, 0x45, 0x44, 0x20, 0x54, 0x4F, 0x20, 0x54, 0x48, 0x45, 0x20, 
+  0x57, 0x41, 0x52, 0x52, 0x41, 0x4E, 0x54, 0x49, 0x45, 0x53, 0x20, 0x4F, 
+  0x46, 0x0A, 0x2F, 0x2F, 0x20, 0x4D, 0x45, 0x52, 0x43, 0x48, 0x41, 0x4E, 
+  0x54, 0x41, 0x42, 0x49, 0x4C, 0x49, 0x54, 0x59, 0x2C, 0x20, 0x46, 0x49, 
+  0x54, 0x4E, 0x45, 0x53, 0x53, 0x20, 0x46, 0x4F, 0x52, 0x20, 0x41, 0x20, 
+  0x50, 0x41, 0x52, 0x54, 0x49, 0x43, 0x55, 0x4C, 0x41, 0x52, 0x20, 0x50, 
+  0x55, 0x52, 0x50, 0x4F, 0x53, 0x45, 0x20, 0x41, 0x4E, 0x44, 0x20, 0x4E, 
+  0x4F, 0x4E, 0x49, 0x4E, 0x46, 0x52, 0x49, 0x4E, 0x47, 0x45, 0x4D, 0x45, 
+  0x4E, 0x54, 0x2E, 0x20, 0x49, 0x4E, 0x20, 0x4E, 0x4F, 0x0A, 0x2F, 0x2F, 
+  0x20, 0x45, 0x56, 0x45, 0x4E, 0x54, 0x20, 0x53, 0x48, 0x41, 0x4C, 0x4C, 
+  0x20, 0x54, 0x48, 0x45, 0x20, 0x41, 0x55, 0x54, 0x48, 0x4F, 0x52, 0x53, 
+  0x20, 0x4F, 0x52, 0x20, 0x43, 0x4F, 0x50, 0x59, 0x52, 0x49, 0x47, 0x48, 
+  0x54, 0x20, 0x48, 0x4F, 0x4C, 0x44, 0x45, 0x52, 0x53, 0x20, 0x42, 0x45, 
+  0x20, 0x4C, 0x49, 0x41, 0x42, 0x4C, 0x45, 0x20, 0x46, 0x4F, 0x52, 0x20, 
+  0x41, 0x4E, 0x59, 0x20, 0x43, 0x4C, 0x41, 0x49, 0x4D, 0x2C, 0x20, 0x44, 
+  0x41, 0x4D, 0x41, 0x47, 0x45, 0x53, 0x20, 0x4F, 0x52, 0x0A, 0x2F, 0x2F, 
+  0x20, 0x4F, 0x54, 0x48, 0x45, 0x52, 0x20, 0x4C, 0x49, 0x41, 0x42, 0x49, 
+  0x4C, 0x49, 0x54, 0x59, 0x2C, 0x20, 0x57, 0x48, 0x45, 0x54, 0x48, 0x45, 
+  0x52, 0x20, 0x49, 0x4E, 0x20, 0x41, 0x4E, 0x20, 0x41, 0x43, 0x54, 0x49, 
+  0x4F, 0x4E, 0x20, 0x4F, 0x46, 0x20, 0x43, 0x4F, 0x4E, 0x54, 0x52, 0x41, 
+  0x43, 0x54, 0x2C, 0x20, 0x54, 0x4F, 0x52, 0x54, 0x20, 0x4F, 0x52, 0x20, 
+  0x4F, 0x54, 0x48, 0x45, 0x52, 0x57, 0x49, 0x53, 0x45, 0x2C, 0x20, 0x41, 
+  0x52, 0x49, 0x53, 0x49, 0x4E, 0x47, 0x0A, 0x2F, 0x2F, 0x20, 0x46, 0x52, 
+  0x4F, 0x4D, 0x2C, 0x20, 0x4F, 0x55, 0x54, 0x20, 0x4F, 0x46, 0x20, 0x4F, 
+  0x52, 0x20, 0x49, 0x4E, 0x20, 0x43, 0x4F, 0x4E, 0x4E, 0x45, 0x43, 0x54, 
+  0x49, 0x4F, 0x4E, 0x20, 0x57, 0x49, 0x54, 0x48, 0x20, 0x54, 0x48, 0x45, 
+  0x20, 0x53, 0x4F, 0x46, 0x54, 0x57, 0x41, 0x52, 0x45, 0x20, 0x4F, 0x52, 
+  0x20, 0x54, 0x48, 0x45, 0x20, 0x55, 0x53, 0x45, 0x20, 0x4F, 0x52, 0x20, 
+  0x4F, 0x54, 0x48, 0x45, 0x52, 0x20, 0x44, 0x45, 0x41, 0x4C, 0x49, 0x4E, 
+  0x47, 0x53, 0x20, 0x49, 0x4E, 0x0A, 0x2F, 0x2F, 0x20, 0x54, 0x48, 0x45, 
+  0x20, 0x53, 0x4F, 0x46, 0x54, 0x57, 0x41, 0x52, 0x45, 0x2E, 0x0A, 0x0A, 
+  0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x73, 0x64, 0x45, 0x6C, 0x6C, 0x69, 
+  0x70, 0x73, 0x65, 0x28, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x32, 0x20, 0x70, 
+  0x2C, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x32, 0x20, 0x61, 0x62, 0x29, 
+  0x20, 0x7B, 0x0A, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x61, 0x62, 0x73, 
+  0x28, 0x61, 0x62, 0x2E, 0x78, 0x20, 0x2D, 0x20, 0x61, 0x62, 0x2E, 0x79, 
+  0x29, 0x20, 0x3C, 0x20, 0x30, 0x2E, 0x31, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+  0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6C, 0x65, 0x6E, 0x67, 
+  0x74, 0x68, 0x28, 0x70, 0x29, 0x20, 0x2D, 0x20, 0x61, 0x62, 0x2E, 0x78, 
+  0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x70, 0x20, 0x3D, 0x20, 0x61, 0x62, 0x73, 
+  0x28, 0x70, 0x29, 0x3B, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x2E, 0x78, 
+  0x20, 0x3E, 0x20, 0x70, 0x2E, 0x79, 0x29, 0x20, 0x7B, 0x20, 0x70, 0x20, 
+  0x3D, 0x20, 0x70, 0x2E, 0x79, 0x78, 0x3B, 0x20, 0x61, 0x62, 0x20, 0x3D, 
+  0x20, 0x61, 0x62, 0x2E, 0x79, 0x78, 0x3B, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 
+  0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x6C, 0x20, 0x3D, 0x20, 0x61, 
+  0x62, 0x2E, 0x79, 0x2A, 0x61, 0x62, 0x2E, 0x79, 0x20, 0x2D, 0x20, 0x61, 
+  0x62, 0x2E, 0x78, 0x2A, 0x61, 0x62, 0x2E, 0x78, 0x3B, 0x0A, 0x0A, 0x20, 
+  0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x6D, 0x20, 0x3D, 0x20, 0x61, 
+  0x62, 0x2E, 0x78, 0x2A, 0x70, 0x2E, 0x78, 0x20, 0x2F, 0x20, 0x6C, 0x3B, 
+  0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x6E, 0x20, 0x3D, 
+  0x20, 0x61, 0x62, 0x2E, 0x79, 0x2A, 0x70, 0x2E, 0x79, 0x20, 0x2F, 0x20, 
+  0x6C, 0x3B, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x6D, 
+  0x32, 0x20, 0x3D, 0x20, 0x6D, 0x2A, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x66, 
+  0x6C, 0x6F, 0x61, 0x74, 0x20, 0x6E, 0x32, 0x20, 0x3D, 0x20, 0x6E, 0x2A, 
+  0x6E, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 
+  0x63, 0x20, 0x3D, 0x20, 0x28, 0x6D, 0x32, 0x20, 0x2B, 0x20, 0x6E, 0x32, 
+  0x20, 0x2D, 0x20, 0x31, 0x2E, 0x30, 0x29, 0x20, 0x2F, 0x20, 0x33, 0x2E, 
+  0x30, 0x3B, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x63, 
+  0x33, 0x20, 0x3D, 0x20, 0x63, 0x2A, 0x63, 0x2A, 0x63, 0x3B, 0x0A, 0x0A, 
+  0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x71, 0x20, 0x3D, 0x20, 
+  0x63, 0x33, 0x20, 0x2B, 0x20, 0x6D, 0x32, 0x2A, 0x6E, 0x32, 0x2A, 0x32, 
+  0x2E, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 
+  0x64, 0x20, 0x3D, 0x20, 0x63, 0x33, 0x20, 0x2B, 0x20, 0x6D, 0x32, 0x2A, 
+  0x6E, 0x32, 0x3B, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 
+  0x67, 0x20, 0x3D, 0x20, 0x6D, 0x20, 0x2B, 0x20, 0x6D, 0x2A, 0x6E, 0x32, 
+  0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x63, 
+  0x6F, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x64, 0x20, 
+  0x3C, 0x20, 0x30, 0x2E, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 
+  0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x70, 0x20, 0x3D, 0x20, 0x61, 
+  0x63, 0x6F, 0x73, 0x28, 0x71, 0x20, 0x2F, 0x20, 0x63, 0x33, 0x29, 0x20, 
+  0x2F, 0x20, 0x33, 0x2E, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 
+  0x6C, 0x6F, 0x61, 0x74, 0x20, 0x73, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x73, 
+  0x28, 0x70, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6C, 0x6F, 
+  0x61, 0x74, 0x20, 0x74, 0x20, 0x3D, 0x20, 0x73, 0x69, 0x6E, 0x28, 0x70, 
+  0x29, 0x2A, 0x73, 0x71, 0x72, 0x74, 0x28, 0x33, 0x2E, 0x30, 0x29, 0x3B, 
+  0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x72, 
+  0x78, 0x20, 0x3D, 0x20, 0x73, 0x71, 0x72, 0x74, 0x28, 0x2D, 0x63, 0x2A, 
+  0x28, 0x73, 0x20, 0x2B, 0x20, 0x74, 0x20, 0x2B, 0x20, 0x32, 0x2E, 0x30, 
+  0x29, 0x20, 0x2B, 0x20, 0x6D, 0x32, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 
+  0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x72, 0x79, 0x20, 0x3D, 0x20, 
+  0x73, 0x71, 0x72, 0x74, 0x28, 0x2D, 0x63, 0x2A, 0x28, 0x73, 0x20, 0x2D, 
+  0x20, 0x74, 0x20, 0x2B, 0x20, 0x32, 0x2E, 0x30, 0x29, 0x20, 0x2B, 0x20, 
+  0x6D, 0x32, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x20, 
+  0x3D, 0x20, 0x28, 0x72, 0x79, 0x20, 0x2B, 0x20, 0x73, 0x69, 0x67, 0x6E, 
+  0x28, 0x6C, 0x29, 0x2A, 0x72, 0x78, 0x20, 0x2B, 0x20, 0x61, 0x62, 0x73, 
+  0x28, 0x67, 0x29, 0x20, 0x2F, 0x20, 0x28, 0x72, 0x78, 0x2A, 0x72, 0x79, 
+  0x29, 0x20, 0x2D, 0x20, 0x6D, 0x29, 0x20, 0x2F, 0x20, 0x32, 0x2E, 0x30, 
+  0x3B, 0x0A, 0x20, 0x20, 0x7D, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x7B, 
+  0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x68, 
+  0x20, 0x3D, 0x20, 0x32, 0x2E, 0x30, 0x2A, 0x6D, 0x2A, 0x6E, 0x2A, 0x73, 
+  0x71, 0x72, 0x74, 0x28, 0x64, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+  0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x73, 0x20, 0x3D, 0x20, 0x73, 0x69, 
+  0x67, 0x6E, 0x28, 0x71, 0x20, 0x2B, 0x20, 0x68, 0x29, 0x2A, 0x70, 0x6F, 
+  0x77, 0x28, 0x61, 0x62, 0x73, 0x28, 0x71, 0x20, 0x2B, 0x20, 0x68, 0x29, 
+  0x2C, 0x20, 0x31, 0x2E, 0x30, 0x20, 0x2F, 0x20, 0x33, 0x2E, 0x30, 0x29, 
+  0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 
+  0x75, 0x20, 0x3D, 0x20, 0x73, 0x69, 0x67, 0x6E, 0x28, 0x71, 0x20, 0x2D, 
+  0x20, 0x68, 0x29, 0x2A, 0x70, 0x6F, 0x77, 0x28, 0x61, 0x62, 0x73, 0x28, 
+  0x71, 0x20, 0x2D, 0x20, 0x68, 0x29, 0x2C, 0x20, 0x31, 0x2E, 0x30, 0x20, 
+  0x2F, 0x20, 0x33, 0x2E, 0x30, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+  0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x72, 0x78, 0x20, 0x3D, 0x20, 0x2D, 
+  0x73, 0x20, 0x2D, 0x20, 0x75, 0x20, 0x2D, 0x20, 0x63, 0x2A, 0x34, 0x2E, 
+  0x30, 0x20, 0x2B, 0x20, 0x32, 0x2E, 0x30, 0x2A, 0x6D, 0x32, 0x3B, 0x0A, 
+  0x20, 0x20, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x72, 0x79, 
+  0x20, 0x3D, 0x20, 0x28, 0x73, 0x20, 0x2D, 0x20, 0x75, 0x29, 0x2A, 0x73, 
+  0x71, 0x72, 0x74, 0x28, 0x33, 0x2E, 0x30, 0x29, 0x3B, 0x0A, 0x20, 0x20, 
+  0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x72, 0x6D, 0x20, 0x3D, 
+  0x20, 0x73, 0x71, 0x72, 0x74, 0x28, 0x72, 0x78, 0x2A, 0x72, 0x78, 0x20, 
+  0x2B, 0x20, 0x72, 0x79, 0x2A, 0x72, 0x79, 0x29, 0x3B, 0x0A, 0x20, 0x20, 
+  0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x70, 0x20, 0x3D, 0x20, 
+  0x72, 0x79, 0x20, 0x2F, 0x20, 0x73, 0x71, 0x72, 0x74, 0x28, 0x72, 0x6D, 
+  0x20, 0x2D, 0x20, 0x72, 0x78, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+  0x63, 0x6F, 0x20, 0x3D, 0x20, 0x28, 0x70, 0x20, 0x2B, 0x20, 0x32, 0x2E, 
+  0x30, 0x2A, 0x67, 0x20, 0x2F, 0x20, 0x72, 0x6D, 0x20, 0x2D, 0x20, 0x6D, 
+  0x29, 0x20, 0x2F, 0x20, 0x32, 0x2E, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x7D, 
+  0x0A, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x73, 0x69, 
+  0x20, 0x3D, 0x20, 0x73, 0x71, 0x72, 0x74, 0x28, 0x31, 0x2E, 0x30, 0x20, 
+  0x2D, 0x20, 0x63, 0x6F, 0x2A, 0x63, 0x6F, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 
+  0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x32, 0x20, 0x72, 0x20, 0x3D, 0x20, 
+  0x66, 0x6C, 0x6F, 0x61, 0x74, 0x32, 0x28, 0x61, 0x62, 0x2E, 0x78, 0x2A, 
+  0x63, 0x6F, 0x2C, 0x20, 0x61, 0x62, 0x2E, 0x79, 0x2A, 0x73, 0x69, 0x29, 
+  0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+  0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x28, 0x72, 0x20, 0x2D, 0x20, 0x70, 
+  0x29, 0x20, 0x2A, 0x20, 0x73, 0x69, 0x67, 0x6E, 0x28, 0x70, 0x2E, 0x79, 
+  0x20, 0x2D, 0x20, 0x72, 0x2E, 0x79, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 0x0A, 
+  0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x73, 0x64, 0x52, 0x6F, 0x75, 0x6E, 
+  0x64, 0x52, 0x65, 0x63, 0x74, 0x28, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x32, 
+  0x20, 0x70, 0x2C, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x32, 0x20, 0x73, 
+  0x69, 0x7A, 0x65, 0x2C, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x34, 0x20, 
+  0x72, 0x78, 0x2C, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x34, 0x20, 0x72, 
+  0x79, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 
+  0x2A, 0x3D, 0x20, 0x30, 0x2E, 0x35, 0x3B, 0x0A, 0x20, 0x20, 0x66, 0x6C, 
+  0x6F, 0x61, 0x74, 0x32, 0x20, 0x63, 0x6F, 0x72, 0x6E, 0x65, 0x72, 0x3B, 
+  0x0A, 0x0A, 0x20, 0x20, 0x63, 0x6F, 0x72, 0x6E, 0x65, 0x72, 0x20, 0x3D, 
+  0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x32, 0x28, 0x2D, 0x73, 0x69, 0x7A, 
+  0x65, 0x2E, 0x78, 0x20, 0x2B, 0x20, 0x72, 0x78, 0x2E, 0x78, 0x2C, 0x20, 
+  0x2D, 0x73, 0x69, 0x7A, 0x65, 0x2E, 0x79, 0x20, 0x2B, 0x20, 0x72, 0x79, 
+  0x2E, 0x78, 0x29, 0x3B, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x54, 0x6F, 0x70, 
+  0x2D, 0x4C, 0x65, 0x66, 0x74, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 
+  0x74, 0x32, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x3D, 0x20, 0x70, 
+  0x20, 0x2D, 0x20, 0x63, 0x6F, 0x72, 0x6E, 0x65, 0x72, 0x3B, 0x0A, 0x20, 
+  0x20, 0x69, 0x66, 0x20, 0x28, 0x64, 0x6F, 0x74, 0x28, 0x72, 0x78, 0x2E, 
+  0x78, 0x2C, 0x20, 0x72, 0x79, 0x2E, 0x78, 0x29, 0x20, 0x3E, 0x20, 0x30, 
+  0x2E, 0x30, 0x20, 0x26, 0x26, 0x20, 0x70, 0x2E, 0x78, 0x20, 0x3C, 0x20, 
+  0x63, 0x6F, 0x72, 0x6E, 0x65, 0x72, 0x2E, 0x78, 0x20, 0x26, 0x26, 0x20, 
+  0x70, 0x2E, 0x79, 0x20, 0x3C, 0x3D, 0x20, 0x63, 0x6F, 0x72, 0x6E, 0x65, 
+  0x72, 0x2E, 0x79, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 
+  0x75, 0x72, 0x6E, 0x20, 0x73, 0x64, 0x45, 0x6C, 0x6C, 0x69, 0x70, 0x73, 
+  0x65, 0x28, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x2C, 0x20, 0x66, 0x6C, 0x6F, 
+  0x61, 0x74, 0x32, 0x28, 0x72, 0x78, 0x2E, 0x78, 0x2C, 0x20, 0x72, 0x79, 
+  0x2E, 0x78, 0x29, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x63, 0x6F, 0x72, 
+  0x6E, 0x65, 0x72, 0x20, 0x3D, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x32, 
+  0x28, 0x73, 0x69, 0x7A, 0x65, 0x2E, 0x78, 0x20, 0x2D, 0x20, 0x72, 0x78, 
+  0x2E, 0x79, 0x2C, 0x20, 0x2D, 0x73, 0x69, 0x7A, 0x65, 0x2E, 0x79, 0x20, 
+  0x2B, 0x20, 0x72, 0x79, 0x2E, 0x79, 0x29, 0x3B, 0x20, 0x20, 0x20, 0x2F, 
+  0x2F, 0x20, 0x54, 0x6F, 0x70, 0x2D, 0x52, 0x69, 0x67, 0x68, 0x74, 0x0A, 
+  0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x3D, 0x20, 0x70, 0x20, 
+  0x2D, 0x20, 0x63, 0x6F, 0x72, 0x6E, 0x65, 0x72, 0x3B, 0x0A, 0x20, 0x20, 
+  0x69, 0x66, 0x20, 0x28, 0x64, 0x6F, 0x74, 0x28, 0x72, 0x78, 0x2E, 0x79, 
+  0x2C, 0x20, 0x72, 0x79, 0x2E, 0x79, 0x29, 0x20, 0x3E, 0x20, 0x30, 0x2E, 
+  0x30, 0x20, 0x26, 0x26, 0x20, 0x70, 0x2E, 0x78, 0x20, 0x3E, 0x3D, 0x20, 
+  0x63, 0x6F, 0x72, 0x6E, 0x65, 0x72, 0x2E, 0x78, 0x20, 0x26, 0x26, 0x20, 
+  0x70, 0x2E, 0x79, 0x20, 0x3C, 0x3D, 0x20, 0x63, 0x6F, 0x72, 0x6E, 0x65, 
+  0x72, 0x2E, 0x79, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 
+  0x75, 0x72, 0x6E, 0x20, 0x73, 0x64, 0x45, 0x6C, 0x6C, 0x69, 0x70, 0x73, 
+  0x65, 0x28, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x2C, 0x20, 0x66, 0x6C, 0x6F, 
+  0x61, 0x74, 0x32, 0x28, 0x72, 0x78, 0x2E, 0x79, 0x2C, 0x20, 0x72, 0x79, 
+  0x2E, 0x79, 0x29, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x63, 0x6F, 0x72, 
+  0x6E, 0x65, 0x72, 0x20, 0x3D, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x32, 
+  0x28, 0x73, 0x69, 0x7A, 0x65, 0x2E, 0x78, 0x20, 0x2D, 0x20, 0x72, 0x78, 
+  0x2E, 0x7A, 0x2C, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x2E, 0x79, 0x20, 0x2D, 
+  0x20, 0x72, 0x79, 0x2E, 0x7A, 0x29, 0x3B, 0x20, 0x20, 0x2F, 0x2F, 0x20, 
+  0x42, 0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x2D, 0x52, 0x69, 0x67, 0x68, 0x74, 
+  0x0A, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x3D, 0x20, 0x70, 
+  0x20, 0x2D, 0x20, 0x63, 0x6F, 0x72, 0x6E, 0x65, 0x72, 0x3B, 0x0A, 0x20, 
+  0x20, 0x69, 0x66, 0x20, 0x28, 0x64, 0x6F, 0x74, 0x28, 0x72, 0x78, 0x2E, 
+  0x7A, 0x2C, 0x20, 0x72, 0x79, 0x2E, 0x7A, 0x29, 0x20, 0x3E, 0x20, 0x30, 
+  0x2E, 0x30, 0x20, 0x26, 0x26, 0x20, 0x70, 0x2E, 0x78, 0x20, 0x3E, 0x3D, 
+  0x20, 0x63, 0x6F, 0x72, 0x6E, 0x65, 0x72, 0x2E, 0x78, 0x20, 0x26, 0x26, 
+  0x20, 0x70, 0x2E, 0x79, 0x20, 0x3E, 0x3D, 0x20, 0x63, 0x6F, 0x72, 0x6E, 
+  0x65, 0x72, 0x2E, 0x79, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 
+  0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 0x64, 0x45, 0x6C, 0x6C, 0x69, 0x70, 
+  0x73, 0x65, 0x28, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x2C, 0x20, 0x66, 0x6C, 
+  0x6F, 0x61, 0x74, 0x32, 0x28, 0x72, 0x78, 0x2E, 0x7A, 0x2C, 0x20, 0x72, 
+  0x79, 0x2E, 0x7A, 0x29, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x63, 0x6F, 
+  0x72, 0x6E, 0x65, 0x72, 0x20, 0x3D, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 
+  0x32, 0x28, 0x2D, 0x73, 0x69, 0x7A, 0x65, 0x2E, 0x78, 0x20, 0x2B, 0x20, 
+  0x72, 0x78, 0x2E, 0x77, 0x2C, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x2E, 0x79, 
+  0x20, 0x2D, 0x20, 0x72, 0x79, 0x2E, 0x77, 0x29, 0x3B, 0x20, 0x2F, 0x2F, 
+  0x20, 0x42, 0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x2D, 0x4C, 0x65, 0x66, 0x74, 
+  0x0A, 0x20, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x3D, 0x20, 0x70, 
+  0x20, 0x2D, 0x20, 0x63, 0x6F, 0x72, 0x6E, 0x65, 0x72, 0x3B, 0x0A, 0x20, 
+  0x20, 0x69, 0x66, 0x20, 0x28, 0x64, 0x6F, 0x74, 0x28, 0x72, 0x78, 0x2E, 
+  0x77, 0x2C, 0x20, 0x72, 0x79, 0x2E, 0x77, 0x29, 0x20, 0x3E, 0x20, 0x30, 
+  0x2E, 0x30, 0x20, 0x26, 0x26, 0x20, 0x70, 0x2E, 0x78, 0x20, 0x3C, 0x20, 
+  0x63, 0x6F, 0x72, 0x6E, 0x65, 0x72, 0x2E, 0x78, 0x20, 0x26, 0x26, 0x20, 
+  0x70, 0x2E, 0x79, 0x20, 0x3E, 0x20, 0x63, 0x6F, 0x72, 0x6E, 0x65, 0x72, 
+  0x2E, 0x79, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 
+  0x72, 0x6E, 0x20, 0x73, 0x64, 0x45, 0x6C, 0x6C, 0x69, 0x70, 0x73, 0x65, 
+  0x28, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x2C, 0x20, 0x66, 0x6C, 0x6F, 0x61, 
+  0x74, 0x32, 0x28, 0x72, 0x78, 0x2E, 0x77, 0x2C, 0x20, 0x72, 0x79, 0x2E, 
+  0x77, 0x29, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 
+  0x72, 0x6E, 0x20, 0x73, 0x64, 0x52, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2C, 
+  0x20, 0x73, 0x69, 0x7A, 0x65, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 0x0A, 0x66, 
+  0x6C, 0x6F, 0x61, 0x74, 0x34, 0x20, 0x66, 0x69, 0x6C, 0x6C, 0x53, 0x6F, 
+  0x6C, 0x69, 0x64, 0x28, 0x56, 0x53, 0x5F, 0x4F, 0x55, 0x54, 0x50, 0x55, 
+  0x54, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x29, 0x20, 0x7B, 0x0A, 0x20, 
+  0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x69, 0x6E, 0x70, 0x75, 
+  0x74, 0x2E, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3B, 0x0A, 0x7D, 0x0A, 0x0A, 
+  0x66, 0x6C, 0x6F, 0x61, 0x74, 0x34, 0x20, 0x66, 0x69, 0x6C, 0x6C, 0x49, 
+  0x6D, 0x61, 0x67, 0x65, 0x28, 0x56, 0x53, 0x5F, 0x4F, 0x55, 0x54, 0x50, 
+  0x55, 0x54, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x29, 0x20, 0x7B, 0x0A, 
+  0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x65, 0x78, 
+  0x74, 0x75, 0x72, 0x65, 0x30, 0x2E, 0x53, 0x61, 0x6D, 0x70, 0x6C, 0x65, 
+  0x28, 0x73, 0x61, 0x6D, 0x70, 0x6C, 0x65, 0x72, 0x30, 0x2C, 0x20, 0x69, 
+  0x6E, 0x70, 0x75, 0x74, 0x2E, 0x54, 0x65, 0x78, 0x43, 0x6F, 0x6F, 0x72, 
+  0x64, 0x29, 0x20, 0x2A, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2E, 0x43, 
+  0x6F, 0x6C, 0x6F, 0x72, 0x3B, 0x0A, 0x7D, 0x0A, 0x0A, 0x66, 0x6C, 0x6F, 
+  0x61, 0x74, 0x32, 0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x6F, 0x72, 
+  0x6D, 0x41, 0x66, 0x66, 0x69, 0x6E, 0x65, 0x28, 0x66, 0x6C, 0x6F, 0x61, 
+  0x74, 0x32, 0x20, 0x76, 0x61, 0x6C, 0x2C, 0x20, 0x66, 0x6C, 0x6F, 0x61, 
+  0x74, 0x32, 0x20, 0x61, 0x2C, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x32, 
+  0x20, 0x62, 0x2C, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x32, 0x20, 0x63, 
+  0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+  0x20, 0x76, 0x61, 0x6C, 0x2E, 0x78, 0x20, 0x2A, 0x20, 0x61, 0x20, 0x2B, 
+  0x20, 0x76, 0x61, 0x6C, 0x2E, 0x79, 0x20, 0x2A, 0x20, 0x62, 0x20, 0x2B, 
+  0x20, 0x63, 0x3B, 0x0A, 0x7D, 0x0A, 0x0A, 0x66, 0x6C, 0x6F, 0x61, 0x74, 
+  0x34, 0x20, 0x66, 0x69, 0x6C, 0x6C, 0x50, 0x61, 0x74, 0x74, 0x65, 0x72, 
+  0x6E, 0x49, 0x6D, 0x61, 0x67, 0x65, 0x28, 0x56, 0x53, 0x5F, 0x4F, 0x55, 
+  0x54, 0x50, 0x55, 0x54, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x29, 0x20, 
+  0x7B, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x34, 0x20, 0x74, 
+  0x69, 0x6C, 0x65, 0x5F, 0x72, 0x65, 0x63, 0x74, 0x5F, 0x75, 0x76, 0x20, 
+  0x3D, 0x20, 0x54, 0x69, 0x6C, 0x65, 0x52, 0x65, 0x63, 0x74, 0x55, 0x56, 
+  0x28, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x32, 
+  0x20, 0x74, 0x69, 0x6C, 0x65, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x3D, 
+  0x20, 0x54, 0x69, 0x6C, 0x65, 0x53, 0x69, 0x7A, 0x65, 0x28, 0x29, 0x3B, 
+  0x0A, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x32, 0x20, 0x70, 
+  0x20, 0x3D, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2E, 0x4F, 0x62, 0x6A, 
+  0x65, 0x63, 0x74, 0x43, 0x6F, 0x6F, 0x72, 0x64, 0x3B, 0x0A, 0x0A, 0x20, 
+  0x20, 0x2F, 0x2F, 0x20, 0x41, 0x70, 0x70, 0x6C, 0x79, 0x20, 0x74, 0x68, 
+  0x65, 0x20, 0x61, 0x66, 0x66, 0x69, 0x6E, 0x65, 0x20, 0x6D, 0x61, 0x74, 
+  0x72, 0x69, 0x78, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x32, 
+  0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x6F, 0x72, 0x6D, 0x65, 0x64, 
+  0x5F, 0x63, 0x6F, 0x6F, 0x72, 0x64, 0x73, 0x20, 0x3D, 0x20, 0x74, 0x72, 
+  0x61, 0x6E, 0x73, 0x66, 0x6F, 0x72, 0x6D, 0x41, 0x66, 0x66, 0x69, 0x6E, 
+  0x65, 0x28, 0x70, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x50, 0x61, 0x74, 
+  0x74, 0x65, 0x72, 0x6E, 0x54, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x6F, 0x72, 
+  0x6D, 0x41, 0x28, 0x29, 0x2C, 0x20, 0x50, 0x61, 0x74, 0x74, 0x65, 0x72, 
+  0x6E, 0x54, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x6F, 0x72, 0x6D, 0x42, 0x28, 
+  0x29, 0x2C, 0x20, 0x50, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 0x54, 0x72, 
+  0x61, 0x6E, 0x73, 0x66, 0x6F, 0x72, 0x6D, 0x43, 0x28, 0x29, 0x29, 0x3B, 
+  0x0A, 0x0A, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x43, 0x6F, 0x6E, 0x76, 0x65, 
+  0x72, 0x74, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x20, 0x74, 0x6F, 0x20, 0x75, 
+  0x76, 0x20, 0x63, 0x6F, 0x6F, 0x72, 0x64, 0x69, 0x6E, 0x61, 0x74, 0x65, 
+  0x20, 0x73, 0x70, 0x61, 0x63, 0x65, 0x0A, 0x20, 0x20, 0x74, 0x72, 0x61, 
+  0x6E, 0x73, 0x66, 0x6F, 0x72, 0x6D, 0x65, 0x64, 0x5F, 0x63, 0x6F, 0x6F, 
+  0x72, 0x64, 0x73, 0x20, 0x2F, 0x3D, 0x20, 0x74, 0x69, 0x6C, 0x65, 0x5F, 
+  0x73, 0x69, 0x7A, 0x65, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x2F, 0x2F, 0x20, 
+  0x57, 0x72, 0x61, 0x70, 0x20, 0x55, 0x56, 0x73, 0x20, 0x74, 0x6F, 0x20, 
+  0x5B, 0x30, 0x2E, 0x30, 0x2C, 0x20, 0x31, 0x2E, 0x30, 0x5D, 0x20, 0x73, 
+  0x6F, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x20, 0x72, 0x65, 
+  0x70, 0x65, 0x61, 0x74, 0x73, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 
+  0x6C, 0x79, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x32, 0x20, 
+  0x75, 0x76, 0x20, 0x3D, 0x20, 0x66, 0x72, 0x61, 0x63, 0x28, 0x74, 0x72, 
+  0x61, 0x6E, 0x73, 0x66, 0x6F, 0x72, 0x6D, 0x65, 0x64, 0x5F, 0x63, 0x6F, 
+  0x6F, 0x72, 0x64, 0x73, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x2F, 0x2F, 
+  0x20, 0x43, 0x6C, 0x69, 0x70, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x69, 0x6C, 
+  0x65, 0x2D, 0x72, 0x65, 0x63, 0x74, 0x20, 0x55, 0x56, 0x0A, 0x20, 0x20, 
+  0x75, 0x76, 0x20, 0x2A, 0x3D, 0x20, 0x74, 0x69, 0x6C, 0x65, 0x5F, 0x72, 
+  0x65, 0x63, 0x74, 0x5F, 0x75, 0x76, 0x2E, 0x7A, 0x77, 0x20, 0x2D, 0x20, 
+  0x74, 0x69, 0x6C, 0x65, 0x5F, 0x72, 0x65, 0x63, 0x74, 0x5F, 0x75, 0x76, 
+  0x2E, 0x78, 0x79, 0x3B, 0x0A, 0x20, 0x20, 0x75, 0x76, 0x20, 0x2B, 0x3D, 
+  0x20, 0x74, 0x69, 0x6C, 0x65, 0x5F, 0x72, 0x65, 0x63, 0x74, 0x5F, 0x75, 
+  0x76, 0x2E, 0x78, 0x79, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x72, 0x65, 0x74, 
+  0x75, 0x72, 0x6E, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x30, 
+  0x2E, 0x53, 0x61, 0x6D, 0x70, 0x6C, 0x65, 0x28, 0x73, 0x61, 0x6D, 0x70, 
+  0x6C, 0x65, 0x72, 0x30, 0x2C, 0x20, 0x75, 0x76, 0x29, 0x20, 0x2A, 0x20, 
+  0x69, 0x6E, 0x70, 0x75, 0x74, 0x2E, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3B, 
+  0x0A, 0x7D, 0x0A, 0x0A, 0x2F, 0x2F, 0x20, 0x47, 0x72, 0x61, 0x64, 0x69, 
+  0x65, 0x6E, 0x74, 0x20, 0x6E, 0x6F, 0x69, 0x73, 0x65, 0x20, 0x66, 0x72, 
+  0x6F, 0x6D, 0x20, 0x4A, 0x6F, 0x72, 0x67, 0x65, 0x20, 0x4A, 0x69, 0x6D, 
+  0x65, 0x6E, 0x65, 0x7A, 0x27, 0x73, 0x20, 0x70, 0x72, 0x65, 0x73, 0x65, 
+  0x6E, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x0A, 0x2F, 0x2F, 0x20, 
+  0x68, 0x74, 0x74, 0x70, 0x3A, 0x2F, 0x2F, 0x77, 0x77, 0x77, 0x2E, 0x69, 
+  0x72, 0x79, 0x6F, 0x6B, 0x75, 0x2E, 0x63, 0x6F, 0x6D, 0x2F, 0x6E, 0x65, 
+  0x78, 0x74, 0x2D, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6F, 
+  0x6E, 0x2D, 0x70, 0x6F, 0x73, 0x74, 0x2D, 0x70, 0x72, 0x6F, 0x63, 0x65, 
+  0x73, 0x73, 0x69, 0x6E, 0x67, 0x2D, 0x69, 0x6E, 0x2D, 0x63, 0x61, 0x6C, 
+  0x6C, 0x2D, 0x6F, 0x66, 0x2D, 0x64, 0x75, 0x74, 0x79, 0x2D, 0x61, 0x64, 
+  0x76, 0x61, 0x6E, 0x63, 0x65, 0x64, 0x2D, 0x77, 0x61, 0x72, 0x66, 0x61, 
+  0x72, 0x65, 0x0A, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x67, 0x72, 0x61, 
+  0x64, 0x69, 0x65, 0x6E, 0x74, 0x4E, 0x6F, 0x69, 0x73, 0x65, 0x28, 0x69, 
+  0x6E, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x32, 0x20, 0x75, 0x76, 0x29, 
+  0x0A, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 
+  0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x33, 0x20, 0x6D, 0x61, 0x67, 0x69, 
+  0x63, 0x20, 0x3D, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x33, 0x28, 0x30, 
+  0x2E, 0x30, 0x36, 0x37, 0x31, 0x31, 0x30, 0x35, 0x36, 0x2C, 0x20, 0x30, 
+  0x2E, 0x30, 0x30, 0x35, 0x38, 0x33, 0x37, 0x31, 0x35, 0x2C, 0x20, 0x35, 
+  0x32, 0x2E, 0x39, 0x38, 0x32, 0x39, 0x31, 0x38, 0x39, 0x29, 0x3B, 0x0A, 
+  0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 
+  0x72, 0x61, 0x63, 0x28, 0x6D, 0x61, 0x67, 0x69, 0x63, 0x2E, 0x7A, 0x20, 
+  0x2A, 0x20, 0x66, 0x72, 0x61, 0x63, 0x28, 0x64, 0x6F, 0x74, 0x28, 0x75, 
+  0x76, 0x2C, 0x20, 0x6D, 0x61, 0x67, 0x69, 0x63, 0x2E, 0x78, 0x79, 0x29, 
+  0x29, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 0x0A, 0x66, 0x6C, 0x6F, 0x61, 0x74, 
+  0x20, 0x72, 0x61, 0x6D, 0x70, 0x28, 0x69, 0x6E, 0x20, 0x66, 0x6C, 0x6F, 
+  0x61, 0x74, 0x20, 0x69, 0x6E, 0x4D, 0x69, 0x6E, 0x2C, 0x20, 0x69, 0x6E, 
+  0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x69, 0x6E, 0x4D, 0x61, 0x78, 
+  0x2C, 0x20, 0x69, 0x6E, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x76, 
+  0x61, 0x6C, 0x29, 0x0A, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 
+  0x74, 0x75, 0x72, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x6D, 0x70, 0x28, 0x28, 
+  0x76, 0x61, 0x6C, 0x20, 0x2D, 0x20, 0x69, 0x6E, 0x4D, 0x69, 0x6E, 0x29, 
+  0x20, 0x2F, 0x20, 0x28, 0x69, 0x6E, 0x4D, 0x61, 0x78, 0x20, 0x2D, 0x20, 
+  0x69, 0x6E, 0x4D, 0x69, 0x6E, 0x29, 0x2C, 0x20, 0x30, 0x2E, 0x30, 0x2C, 
+  0x20, 0x31, 0x2E, 0x30, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 0x0A, 0x66, 0x6C, 
+  0x6F, 0x61, 0x74, 0x34, 0x20, 0x66, 0x69, 0x6C, 0x6C, 0x50, 0x61, 0x74, 
+  0x74, 0x65, 0x72, 0x6E, 0x47, 0x72, 0x61, 0x64, 0x69, 0x65, 0x6E, 0x74, 
+  0x28, 0x56, 0x53, 0x5F, 0x4F, 0x55, 0x54, 0x50, 0x55, 0x54, 0x20, 0x69, 
+  0x6E, 0x70, 0x75, 0x74, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x66, 0x6C, 
+  0x6F, 0x61, 0x74, 0x20, 0x6E, 0x75, 0x6D, 0x5F, 0x73, 0x74, 0x6F, 0x70, 
+  0x73, 0x20, 0x3D, 0x20, 0x47, 0x72, 0x61, 0x64, 0x69, 0x65, 0x6E, 0x74, 
+  0x5F, 0x4E, 0x75, 0x6D, 0x53, 0x74, 0x6F, 0x70, 0x73, 0x28, 0x69, 0x6E, 
+  0x70, 0x75, 0x74, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x62, 0x6F, 0x6F, 0x6C, 
+  0x20, 0x69, 0x73, 0x5F, 0x72, 0x61, 0x64, 0x69, 0x61, 0x6C, 0x20, 0x3D, 
+  0x20, 0x47, 0x72, 0x61, 0x64, 0x69, 0x65, 0x6E, 0x74, 0x5F, 0x49, 0x73, 
+  0x52, 0x61, 0x64, 0x69, 0x61, 0x6C, 0x28, 0x69, 0x6E, 0x70, 0x75, 0x74, 
+  0x29, 0x3B, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x32, 0x20, 
+  0x70, 0x30, 0x20, 0x3D, 0x20, 0x47, 0x72, 0x61, 0x64, 0x69, 0x65, 0x6E, 
+  0x74, 0x5F, 0x50, 0x30, 0x28, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x29, 0x3B, 
+  0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x32, 0x20, 0x70, 0x31, 
+  0x20, 0x3D, 0x20, 0x47, 0x72, 0x61, 0x64, 0x69, 0x65, 0x6E, 0x74, 0x5F, 
+  0x50, 0x31, 0x28, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x29, 0x3B, 0x0A, 0x20, 
+  0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x34, 0x20, 0x6F, 0x75, 0x74, 0x5F, 
+  0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x66, 0x6C, 0x6F, 0x61, 
+  0x74, 0x34, 0x28, 0x30, 0x2E, 0x30, 0x2C, 0x20, 0x30, 0x2E, 0x30, 0x2C, 
+  0x20, 0x30, 0x2E, 0x30, 0x2C, 0x20, 0x30, 0x2E, 0x30, 0x29, 0x3B, 0x0A, 
+  0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x74, 0x20, 0x3D, 
+  0x20, 0x30, 0x2E, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 
+  0x69, 0x73, 0x5F, 0x72, 0x61, 0x64, 0x69, 0x61, 0x6C, 0x29, 0x20, 0x7B, 
+  0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x72, 
+  0x30, 0x20, 0x3D, 0x20, 0x70, 0x31, 0x2E, 0x78, 0x3B, 0x0A, 0x09, 0x66, 
+  0x6C, 0x6F, 0x61, 0x74, 0x20, 0x72, 0x31, 0x20, 0x3D, 0x20, 0x70, 0x31, 
+  0x2E, 0x79, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x74, 0x20, 0x3D, 0x20, 
+  0x64, 0x69, 0x73, 0x74, 0x61, 0x6E, 0x63, 0x65, 0x28, 0x69, 0x6E, 0x70, 
+  0x75, 0x74, 0x2E, 0x54, 0x65, 0x78, 0x43, 0x6F, 0x6F, 0x72, 0x64, 0x2C, 
+  0x20, 0x70, 0x30, 0x29, 0x3B, 0x0A, 0x09, 0x66, 0x6C, 0x6F, 0x61, 0x74, 
+  0x20, 0x72, 0x44, 0x65, 0x6C, 0x74, 0x61, 0x20, 0x3D, 0x20, 0x72, 0x31, 
+  0x20, 0x2D, 0x20, 0x72, 0x30, 0x3B, 0x0A, 0x09, 0x74, 0x20, 0x3D, 0x20, 
+  0x73, 0x61, 0x74, 0x75, 0x72, 0x61, 0x74, 0x65, 0x28, 0x28, 0x74, 0x20, 
+  0x2F, 0x20, 0x72, 0x44, 0x65, 0x6C, 0x74, 0x61, 0x29, 0x20, 0x2D, 0x20, 
+  0x28, 0x72, 0x30, 0x20, 0x2F, 0x20, 0x72, 0x44, 0x65, 0x6C, 0x74, 0x61, 
+  0x29, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x7D, 0x20, 0x65, 0x6C, 0x73, 0x65, 
+  0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 
+  0x32, 0x20, 0x56, 0x20, 0x3D, 0x20, 0x70, 0x31, 0x20, 0x2D, 0x20, 0x70, 
+  0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x74, 0x20, 0x3D, 0x20, 0x73, 
+  0x61, 0x74, 0x75, 0x72, 0x61, 0x74, 0x65, 0x28, 0x64, 0x6F, 0x74, 0x28, 
+  0x69, 0x6E, 0x70, 0x75, 0x74, 0x2E, 0x54, 0x65, 0x78, 0x43, 0x6F, 0x6F, 
+  0x72, 0x64, 0x20, 0x2D, 0x20, 0x70, 0x30, 0x2C, 0x20, 0x56, 0x29, 0x20, 
+  0x2F, 0x20, 0x64, 0x6F, 0x74, 0x28, 0x56, 0x2C, 0x20, 0x56, 0x29, 0x29, 
+  0x3B, 0x0A, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x47, 0x72, 0x61, 
+  0x64, 0x69, 0x65, 0x6E, 0x74, 0x53, 0x74, 0x6F, 0x70, 0x20, 0x73, 0x74, 
+  0x6F, 0x70, 0x30, 0x20, 0x3D, 0x20, 0x47, 0x65, 0x74, 0x47, 0x72, 0x61, 
+  0x64, 0x69, 0x65, 0x6E, 0x74, 0x53, 0x74, 0x6F, 0x70, 0x28, 0x69, 0x6E, 
+  0x70, 0x75, 0x74, 0x2C, 0x20, 0x30, 0x75, 0x29, 0x3B, 0x0A, 0x20, 0x20, 
+  0x47, 0x72, 0x61, 0x64, 0x69, 0x65, 0x6E, 0x74, 0x53, 0x74, 0x6F, 0x70, 
+  0x20, 0x73, 0x74, 0x6F, 0x70, 0x31, 0x20, 0x3D, 0x20, 0x47, 0x65, 0x74, 
+  0x47, 0x72, 0x61, 0x64, 0x69, 0x65, 0x6E, 0x74, 0x53, 0x74, 0x6F, 0x70, 
+  0x28, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2C, 0x20, 0x31, 0x75, 0x29, 0x3B, 
+  0x0A, 0x0A, 0x20, 0x20, 0x6F, 0x75, 0x74, 0x5F, 0x43, 0x6F, 0x6C, 0x6F, 
+  0x72, 0x20, 0x3D, 0x20, 0x6C, 0x65, 0x72, 0x70, 0x28, 0x73, 0x74, 0x6F, 
+  0x70, 0x30, 0x2E, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x2C, 0x20, 0x73, 0x74, 
+  0x6F, 0x70, 0x31, 0x2E, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x2C, 0x20, 0x72, 
+  0x61, 0x6D, 0x70, 0x28, 0x73, 0x74, 0x6F, 0x70, 0x30, 0x2E, 0x70, 0x65, 
+  0x72, 0x63, 0x65, 0x6E, 0x74, 0x2C, 0x20, 0x73, 0x74, 0x6F, 0x70, 0x31, 
+  0x2E, 0x70, 0x65, 0x72, 0x63, 0x65, 0x6E, 0x74, 0x2C, 0x20, 0x74, 0x29, 
+  0x29, 0x3B, 0x0A, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6E, 0x75, 0x6D, 
+  0x5F, 0x73, 0x74, 0x6F, 0x70, 0x73, 0x20, 0x3E, 0x20, 0x32, 0x29, 0x20, 
+  0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x47, 0x72, 0x61, 0x64, 0x69, 0x65, 
+  0x6E, 0x74, 0x53, 0x74, 0x6F, 0x70, 0x20, 0x73, 0x74, 0x6F, 0x70, 0x32, 
+  0x20, 0x3D, 0x20, 0x47, 0x65, 0x74, 0x47, 0x72, 0x61, 0x64, 0x69, 0x65, 
+  0x6E, 0x74, 0x53, 0x74, 0x6F, 0x70, 0x28, 0x69, 0x6E, 0x70, 0x75, 0x74, 
+  0x2C, 0x20, 0x32, 0x75, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6F, 
+  0x75, 0x74, 0x5F, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x6C, 
+  0x65, 0x72, 0x70, 0x28, 0x6F, 0x75, 0x74, 0x5F, 0x43, 0x6F, 0x6C, 0x6F, 
+  0x72, 0x2C, 0x20, 0x73, 0x74, 0x6F, 0x70, 0x32, 0x2E, 0x63, 0x6F, 0x6C, 
+  0x6F, 0x72, 0x2C, 0x20, 0x72, 0x61, 0x6D, 0x70, 0x28, 0x73, 0x74, 0x6F, 
+  0x70, 0x31, 0x2E, 0x70, 0x65, 0x72, 0x63, 0x65, 0x6E, 0x74, 0x2C, 0x20, 
+  0x73, 0x74, 0x6F, 0x70, 0x32, 0x2E, 0x70, 0x65, 0x72, 0x63, 0x65, 0x6E, 
+  0x74, 0x2C, 0x20, 0x74, 0x29, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+  0x69, 0x66, 0x20, 0x28, 0x6E, 0x75, 0x6D, 0x5F, 0x73, 0x74, 0x6F, 0x70, 
+  0x73, 0x20, 0x3E, 0x20, 0x33, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 
+  0x20, 0x20, 0x20, 0x47, 0x72, 0x61, 0x64, 0x69, 0x65, 0x6E, 0x74, 0x53, 
+  0x74, 0x6F, 0x70, 0x20, 0x73, 0x74, 0x6F, 0x70, 0x33, 0x20, 0x3D, 0x20, 
+  0x47, 0x65, 0x74, 0x47, 0x72, 0x61, 0x64, 0x69, 0x65, 0x6E, 0x74, 0x53, 
+  0x74, 0x6F, 0x70, 0x28, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2C, 0x20, 0x33, 
+  0x75, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6F, 0x75, 
+  0x74, 0x5F, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x6C, 0x65, 
+  0x72, 0x70, 0x28, 0x6F, 0x75, 0x74, 0x5F, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 
+  0x2C, 0x20, 0x73, 0x74, 0x6F, 0x70, 0x33, 0x2E, 0x63, 0x6F, 0x6C, 0x6F, 
+  0x72, 0x2C, 0x20, 0x72, 0x61, 0x6D, 0x70, 0x28, 0x73, 0x74, 0x6F, 0x70, 
+  0x32, 0x2E, 0x70, 0x65, 0x72, 0x63, 0x65, 0x6E, 0x74, 0x2C, 0x20, 0x73, 
+  0x74, 0x6F, 0x70, 0x33, 0x2E, 0x70, 0x65, 0x72, 0x63, 0x65, 0x6E, 0x74, 
+  0x2C, 0x20, 0x74, 0x29, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+  0x20, 0x69, 0x66, 0x20, 0x28, 0x6E, 0x75, 0x6D, 0x5F, 0x73, 0x74, 0x6F, 
+  0x70, 0x73, 0x20, 0x3E, 0x20, 0x34, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x47, 0x72, 0x61, 0x64, 0x69, 0x65, 
+  0x6E, 0x74, 0x53, 0x74, 0x6F, 0x70, 0x20, 0x73, 0x74, 0x6F, 0x70, 0x34, 
+  0x20, 0x3D, 0x20, 0x47, 0x65, 0x74, 0x47, 0x72, 0x61, 0x64, 0x69, 0x65, 
+  0x6E, 0x74, 0x53, 0x74, 0x6F, 0x70, 0x28, 0x69, 0x6E, 0x70, 0x75, 0x74, 
+  0x2C, 0x20, 0x34, 0x75, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+  0x20, 0x20, 0x20, 0x6F, 0x75, 0x74, 0x5F, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 
+  0x20, 0x3D, 0x20, 0x6C, 0x65, 0x72, 0x70, 0x28, 0x6F, 0x75, 0x74, 0x5F, 
+  0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x2C, 0x20, 0x73, 0x74, 0x6F, 0x70, 0x34, 
+  0x2E, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x2C, 0x20, 0x72, 0x61, 0x6D, 0x70, 
+  0x28, 0x73, 0x74, 0x6F, 0x70, 0x33, 0x2E, 0x70, 0x65, 0x72, 0x63, 0x65, 
+  0x6E, 0x74, 0x2C, 0x20, 0x73, 0x74, 0x6F, 0x70, 0x34, 0x2E, 0x70, 0x65, 
+  0x72, 0x63, 0x65, 0x6E, 0x74, 0x2C, 0x20, 0x74, 0x29, 0x29, 0x3B, 0x0A, 
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 
+  0x6E, 0x75, 0x6D, 0x5F, 0x73, 0x74, 0x6F, 0x70, 0x73, 0x20, 0x3E, 0x20, 
+  0x35, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+  0x20, 0x20, 0x20, 0x47, 0x72, 0x61, 0x64, 0x69, 0x65, 0x6E, 0x74, 0x53, 
+  0x74, 0x6F, 0x70, 0x20, 0x73, 0x74, 0x6F, 0x70, 0x35, 0x20, 0x3D, 0x20, 
+  0x47, 0x65, 0x74, 0x47, 0x72, 0x61, 0x64, 0x69, 0x65, 0x6E, 0x74, 0x53, 
+  0x74, 0x6F, 0x70, 0x28, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2C, 0x20, 0x35, 
+  0x75, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+  0x20, 0x20, 0x6F, 0x75, 0x74, 0x5F, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 
+  0x3D, 0x20, 0x6C, 0x65, 0x72, 0x70, 0x28, 0x6F, 0x75, 0x74, 0x5F, 0x43, 
+  0x6F, 0x6C, 0x6F, 0x72, 0x2C, 0x20, 0x73, 0x74, 0x6F, 0x70, 0x35, 0x2E, 
+  0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x2C, 0x20, 0x72, 0x61, 0x6D, 0x70, 0x28, 
+  0x73, 0x74, 0x6F, 0x70, 0x34, 0x2E, 0x70, 0x65, 0x72, 0x63, 0x65, 0x6E, 
+  0x74, 0x2C, 0x20, 0x73, 0x74, 0x6F, 0x70, 0x35, 0x2E, 0x70, 0x65, 0x72, 
+  0x63, 0x65, 0x6E, 0x74, 0x2C, 0x20, 0x74, 0x29, 0x29, 0x3B, 0x0A, 0x20, 
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 
+  0x28, 0x6E, 0x75, 0x6D, 0x5F, 0x73, 0x74, 0x6F, 0x70, 0x73, 0x20, 0x3E, 
+  0x20, 0x36, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x47, 0x72, 0x61, 0x64, 0x69, 0x65, 
+  0x6E, 0x74, 0x53, 0x74, 0x6F, 0x70, 0x20, 0x73, 0x74, 0x6F, 0x70, 0x36, 
+  0x20, 0x3D, 0x20, 0x47, 0x65, 0x74, 0x47, 0x72, 0x61, 0x64, 0x69, 0x65, 
+  0x6E, 0x74, 0x53, 0x74, 0x6F, 0x70, 0x28, 0x69, 0x6E, 0x70, 0x75, 0x74, 
+  0x2C, 0x20, 0x36, 0x75, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6F, 0x75, 0x74, 0x5F, 0x43, 
+  0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x6C, 0x65, 0x72, 0x70, 0x28, 
+  0x6F, 0x75, 0x74, 0x5F, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x2C, 0x20, 0x73, 
+  0x74, 0x6F, 0x70, 0x36, 0x2E, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x2C, 0x20, 
+  0x72, 0x61, 0x6D, 0x70, 0x28, 0x73, 0x74, 0x6F, 0x70, 0x35, 0x2E, 0x70, 
+  0x65, 0x72, 0x63, 0x65, 0x6E, 0x74, 0x2C, 0x20, 0x73, 0x74, 0x6F, 0x70, 
+  0x36, 0x2E, 0x70, 0x65, 0x72, 0x63, 0x65, 0x6E, 0x74, 0x2C, 0x20, 0x74, 
+  0x29, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+  0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+  0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 
+  0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x72, 
+  0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x34, 
+  0x28, 0x6F, 0x75, 0x74, 0x5F, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x2E, 0x72, 
+  0x67, 0x62, 0x2C, 0x20, 0x6F, 0x75, 0x74, 0x5F, 0x43, 0x6F, 0x6C, 0x6F, 
+  0x72, 0x2E, 0x61, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 0x0A, 0x76, 0x6F, 0x69, 
+  0x64, 0x20, 0x55, 0x6E, 0x70, 0x61, 0x63, 0x6B, 0x28, 0x66, 0x6C, 0x6F, 
+  0x61, 0x74, 0x34, 0x20, 0x78, 0x2C, 0x20, 0x6F, 0x75, 0x74, 0x20, 0x66, 
+  0x6C, 0x6F, 0x61, 0x74, 0x34, 0x20, 0x61, 0x2C, 0x20, 0x6F, 0x75, 0x74, 
+  0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x34, 0x20, 0x62, 0x29, 0x20, 0x7B, 
+  0x0A, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x66, 0x6C, 0x6F, 
+  0x61, 0x74, 0x20, 0x73, 0x20, 0x3D, 0x20, 0x36, 0x35, 0x35, 0x33, 0x36, 
+  0x2E, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x61, 0x20, 0x3D, 0x20, 0x66, 0x6C, 
+  0x6F, 0x6F, 0x72, 0x28, 0x78, 0x20, 0x2F, 0x20, 0x73, 0x29, 0x3B, 0x0A, 
+  0x20, 0x20, 0x62, 0x20, 0x3D, 0x20, 0x66, 0x6C, 0x6F, 0x6F, 0x72, 0x28, 
+  0x78, 0x20, 0x2D, 0x20, 0x61, 0x20, 0x2A, 0x20, 0x73, 0x29, 0x3B, 0x0A, 
+  0x7D, 0x0A, 0x0A, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x61, 0x6E, 0x74, 
+  0x69, 0x61, 0x6C, 0x69, 0x61, 0x73, 0x32, 0x28, 0x66, 0x6C, 0x6F, 0x61, 
+  0x74, 0x20, 0x64, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x72, 0x65, 0x74, 
+  0x75, 0x72, 0x6E, 0x20, 0x73, 0x6D, 0x6F, 0x6F, 0x74, 0x68, 0x73, 0x74, 
+  0x65, 0x70, 0x28, 0x2D, 0x30, 0x2E, 0x36, 0x31, 0x38, 0x30, 0x34, 0x36, 
+  0x39, 0x2C, 0x20, 0x30, 0x2E, 0x36, 0x31, 0x38, 0x30, 0x34, 0x36, 0x39, 
+  0x2C, 0x20, 0x64, 0x2F, 0x66, 0x77, 0x69, 0x64, 0x74, 0x68, 0x28, 0x64, 
+  0x29, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 0x0A, 0x2F, 0x2F, 0x20, 0x52, 0x65, 
+  0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x77, 0x6F, 0x20, 0x76, 0x61, 
+  0x6C, 0x75, 0x65, 0x73, 0x3A, 0x0A, 0x2F, 0x2F, 0x20, 0x5B, 0x30, 0x5D, 
+  0x20, 0x3D, 0x20, 0x64, 0x69, 0x73, 0x74, 0x61, 0x6E, 0x63, 0x65, 0x20, 
+  0x6F, 0x66, 0x20, 0x70, 0x20, 0x74, 0x6F, 0x20, 0x6C, 0x69, 0x6E, 0x65, 
+  0x20, 0x73, 0x65, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x0A, 0x2F, 0x2F, 
+  0x20, 0x5B, 0x31, 0x5D, 0x20, 0x3D, 0x20, 0x63, 0x6C, 0x6F, 0x73, 0x65, 
+  0x73, 0x74, 0x20, 0x74, 0x20, 0x6F, 0x6E, 0x20, 0x6C, 0x69, 0x6E, 0x65, 
+  0x20, 0x73, 0x65, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x2C, 0x20, 0x63, 0x6C, 
+  0x61, 0x6D, 0x70, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x5B, 0x30, 0x2C, 
+  0x20, 0x31, 0x5D, 0x0A, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x32, 0x20, 0x73, 
+  0x64, 0x53, 0x65, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x28, 0x69, 0x6E, 0x20, 
+  0x66, 0x6C, 0x6F, 0x61, 0x74, 0x32, 0x20, 0x70, 0x2C, 0x20, 0x69, 0x6E, 
+  0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x32, 0x20, 0x61, 0x2C, 0x20, 0x69, 
+  0x6E, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x32, 0x20, 0x62, 0x29, 0x0A, 
+  0x7B, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x32, 0x20, 0x70, 
+  0x61, 0x20, 0x3D, 0x20, 0x70, 0x20, 0x2D, 0x20, 0x61, 0x2C, 0x20, 0x62, 
+  0x61, 0x20, 0x3D, 0x20, 0x62, 0x20, 0x2D, 0x20, 0x61, 0x3B, 0x0A, 0x20, 
+  0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x74, 0x20, 0x3D, 0x20, 0x64, 
+  0x6F, 0x74, 0x28, 0x70, 0x61, 0x2C, 0x20, 0x62, 0x61, 0x29, 0x20, 0x2F, 
+  0x20, 0x64, 0x6F, 0x74, 0x28, 0x62, 0x61, 0x2C, 0x20, 0x62, 0x61, 0x29, 
+  0x3B, 0x0A, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 
+  0x6C, 0x6F, 0x61, 0x74, 0x32, 0x28, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 
+  0x28, 0x70, 0x61, 0x20, 0x2D, 0x20, 0x62, 0x61, 0x20, 0x2A, 0x20, 0x74, 
+  0x29, 0x2C, 0x20, 0x74, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 0x0A, 0x66, 0x6C, 
+  0x6F, 0x61, 0x74, 0x20, 0x74, 0x65, 0x73, 0x74, 0x43, 0x72, 0x6F, 0x73, 
+  0x73, 0x28, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x32, 0x20, 0x61, 0x2C, 0x20, 
+  0x66, 0x6C, 0x6F, 0x61, 0x74, 0x32, 0x20, 0x62, 0x2C, 0x20, 0x66, 0x6C, 
+  0x6F, 0x61, 0x74, 0x32, 0x20, 0x70, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 
+  0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x28, 0x62, 0x2E, 0x79, 0x20, 
+  0x2D, 0x20, 0x61, 0x2E, 0x79, 0x29, 0x20, 0x2A, 0x20, 0x28, 0x70, 0x2E, 
+  0x78, 0x20, 0x2D, 0x20, 0x61, 0x2E, 0x78, 0x29, 0x20, 0x2D, 0x20, 0x28, 
+  0x62, 0x2E, 0x78, 0x20, 0x2D, 0x20, 0x61, 0x2E, 0x78, 0x29, 0x20, 0x2A, 
+  0x20, 0x28, 0x70, 0x2E, 0x79, 0x20, 0x2D, 0x20, 0x61, 0x2E, 0x79, 0x29, 
+  0x3B, 0x0A, 0x7D, 0x0A, 0x0A, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x73, 
+  0x64, 0x4C, 0x69, 0x6E, 0x65, 0x28, 0x69, 0x6E, 0x20, 0x66, 0x6C, 0x6F, 
+  0x61, 0x74, 0x32, 0x20, 0x61, 0x2C, 0x20, 0x69, 0x6E, 0x20, 0x66, 0x6C, 
+  0x6F, 0x61, 0x74, 0x32, 0x20, 0x62, 0x2C, 0x20, 0x69, 0x6E, 0x20, 0x66, 
+  0x6C, 0x6F, 0x61, 0x74, 0x32, 0x20, 0x70, 0x29, 0x0A, 0x7B, 0x0A, 0x20, 
+  0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x32, 0x20, 0x70, 0x61, 0x20, 0x3D, 
+  0x20, 0x70, 0x20, 0x2D, 0x20, 0x61, 0x2C, 0x20, 0x62, 0x61, 0x20, 0x3D, 
+  0x20, 0x62, 0x20, 0x2D, 0x20, 0x61, 0x3B, 0x0A, 0x20, 0x20, 0x66, 0x6C, 
+  0x6F, 0x61, 0x74, 0x20, 0x74, 0x20, 0x3D, 0x20, 0x64, 0x6F, 0x74, 0x28, 
+  0x70, 0x61, 0x2C, 0x20, 0x62, 0x61, 0x29, 0x20, 0x2F, 0x20, 0x64, 0x6F, 
+  0x74, 0x28, 0x62, 0x61, 0x2C, 0x20, 0x62, 0x61, 0x29, 0x3B, 0x0A, 0x20, 
+  0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6C, 0x65, 0x6E, 0x67, 
+  0x74, 0x68, 0x28, 0x70, 0x61, 0x20, 0x2D, 0x20, 0x62, 0x61, 0x2A, 0x74, 
+  0x29, 0x20, 0x2A, 0x20, 0x73, 0x69, 0x67, 0x6E, 0x28, 0x74, 0x65, 0x73, 
+  0x74, 0x43, 0x72, 0x6F, 0x73, 0x73, 0x28, 0x61, 0x2C, 0x20, 0x62, 0x2C, 
+  0x20, 0x70, 0x29, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 0x0A, 0x0A, 0x66, 0x6C, 
+  0x6F, 0x61, 0x74, 0x34, 0x20, 0x62, 0x6C, 0x65, 0x6E, 0x64, 0x28, 0x66, 
+  0x6C, 0x6F, 0x61, 0x74, 0x34, 0x20, 0x73, 0x72, 0x63, 0x2C, 0x20, 0x66, 
+  0x6C, 0x6F, 0x61, 0x74, 0x34, 0x20, 0x64, 0x65, 0x73, 0x74, 0x29, 0x20, 
+  0x7B, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x34, 0x20, 0x72, 
+  0x65, 0x73, 0x75, 0x6C, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x72, 0x65, 0x73, 
+  0x75, 0x6C, 0x74, 0x2E, 0x72, 0x67, 0x62, 0x20, 0x3D, 0x20, 0x73, 0x72, 
+  0x63, 0x2E, 0x72, 0x67, 0x62, 0x20, 0x2B, 0x20, 0x64, 0x65, 0x73, 0x74, 
+  0x2E, 0x72, 0x67, 0x62, 0x20, 0x2A, 0x20, 0x28, 0x31, 0x2E, 0x30, 0x20, 
+  0x2D, 0x20, 0x73, 0x72, 0x63, 0x2E, 0x61, 0x29, 0x3B, 0x0A, 0x20, 0x20, 
+  0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x2E, 0x61, 0x20, 0x3D, 0x20, 0x73, 
+  0x72, 0x63, 0x2E, 0x61, 0x20, 0x2B, 0x20, 0x64, 0x65, 0x73, 0x74, 0x2E, 
+  0x61, 0x20, 0x2A, 0x20, 0x28, 0x31, 0x2E, 0x30, 0x20, 0x2D, 0x20, 0x73, 
+  0x72, 0x63, 0x2E, 0x61, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x72, 0x65, 0x74, 
+  0x75, 0x72, 0x6E, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x3B, 0x0A, 
+  0x7D, 0x0A, 0x0A, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x69, 0x6E, 0x6E, 
+  0x65, 0x72, 0x53, 0x74, 0x72, 0x6F, 0x6B, 0x65, 0x28, 0x66, 0x6C, 0x6F, 
+  0x61, 0x74, 0x20, 0x73, 0x74, 0x72, 0x6F, 0x6B, 0x65, 0x5F, 0x77, 0x69, 
+  0x64, 0x74, 0x68, 0x2C, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x64, 
+  0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+  0x20, 0x6D, 0x69, 0x6E, 0x28, 0x61, 0x6E, 0x74, 0x69, 0x61, 0x6C, 0x69, 
+  0x61, 0x73, 0x28, 0x2D, 0x64, 0x2C, 0x20, 0x41, 0x41, 0x5F, 0x57, 0x49, 
+  0x44, 0x54, 0x48, 0x2C, 0x20, 0x30, 0x2E, 0x30, 0x29, 0x2C, 0x20, 0x31, 
+  0x2E, 0x30, 0x20, 0x2D, 0x20, 0x61, 0x6E, 0x74, 0x69, 0x61, 0x6C, 0x69, 
+  0x61, 0x73, 0x28, 0x2D, 0x64, 0x2C, 0x20, 0x41, 0x41, 0x5F, 0x57, 0x49, 
+  0x44, 0x54, 0x48, 0x2C, 0x20, 0x73, 0x74, 0x72, 0x6F, 0x6B, 0x65, 0x5F, 
+  0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 0x0A, 
+  0x66, 0x6C, 0x6F, 0x61, 0x74, 0x34, 0x20, 0x66, 0x69, 0x6C, 0x6C, 0x52, 
+  0x6F, 0x75, 0x6E, 0x64, 0x65, 0x64, 0x52, 0x65, 0x63, 0x74, 0x28, 0x56, 
+  0x53, 0x5F, 0x4F, 0x55, 0x54, 0x50, 0x55, 0x54, 0x20, 0x69, 0x6E, 0x70, 
+  0x75, 0x74, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 
+  0x74, 0x32, 0x20, 0x70, 0x20, 0x3D, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 
+  0x2E, 0x54, 0x65, 0x78, 0x43, 0x6F, 0x6F, 0x72, 0x64, 0x3B, 0x0A, 0x20, 
+  0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x32, 0x20, 0x73, 0x69, 0x7A, 0x65, 
+  0x20, 0x3D, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2E, 0x44, 0x61, 0x74, 
+  0x61, 0x30, 0x2E, 0x7A, 0x77, 0x3B, 0x0A, 0x20, 0x20, 0x70, 0x20, 0x3D, 
+  0x20, 0x28, 0x70, 0x20, 0x2D, 0x20, 0x30, 0x2E, 0x35, 0x29, 0x20, 0x2A, 
+  0x20, 0x73, 0x69, 0x7A, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 
+  0x61, 0x74, 0x20, 0x64, 0x20, 0x3D, 0x20, 0x73, 0x64, 0x52, 0x6F, 0x75, 
+  0x6E, 0x64, 0x52, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2C, 0x20, 0x73, 0x69, 
+  0x7A, 0x65, 0x2C, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2E, 0x44, 0x61, 
+  0x74, 0x61, 0x31, 0x2C, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2E, 0x44, 
+  0x61, 0x74, 0x61, 0x32, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x2F, 0x2F, 
+  0x20, 0x46, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 
+  0x6F, 0x75, 0x6E, 0x64, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 
+  0x20, 0x61, 0x6C, 0x70, 0x68, 0x61, 0x20, 0x3D, 0x20, 0x61, 0x6E, 0x74, 
+  0x69, 0x61, 0x6C, 0x69, 0x61, 0x73, 0x28, 0x2D, 0x64, 0x2C, 0x20, 0x41, 
+  0x41, 0x5F, 0x57, 0x49, 0x44, 0x54, 0x48, 0x2C, 0x20, 0x30, 0x2E, 0x30, 
+  0x29, 0x20, 0x2A, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2E, 0x43, 0x6F, 
+  0x6C, 0x6F, 0x72, 0x2E, 0x61, 0x3B, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 
+  0x61, 0x74, 0x34, 0x20, 0x6F, 0x75, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 
+  0x20, 0x3D, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x34, 0x28, 0x69, 0x6E, 
+  0x70, 0x75, 0x74, 0x2E, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x2E, 0x72, 0x67, 
+  0x62, 0x20, 0x2A, 0x20, 0x61, 0x6C, 0x70, 0x68, 0x61, 0x2C, 0x20, 0x61, 
+  0x6C, 0x70, 0x68, 0x61, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x2F, 0x2F, 
+  0x20, 0x44, 0x72, 0x61, 0x77, 0x20, 0x73, 0x74, 0x72, 0x6F, 0x6B, 0x65, 
+  0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x73, 0x74, 0x72, 
+  0x6F, 0x6B, 0x65, 0x5F, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x3D, 0x20, 
+  0x69, 0x6E, 0x70, 0x75, 0x74, 0x2E, 0x44, 0x61, 0x74, 0x61, 0x33, 0x2E, 
+  0x78, 0x3B, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x34, 0x20, 
+  0x73, 0x74, 0x72, 0x6F, 0x6B, 0x65, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 
+  0x20, 0x3D, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2E, 0x44, 0x61, 0x74, 
+  0x61, 0x34, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 
+  0x74, 0x72, 0x6F, 0x6B, 0x65, 0x5F, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 
+  0x3E, 0x20, 0x30, 0x2E, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 
+  0x20, 0x61, 0x6C, 0x70, 0x68, 0x61, 0x20, 0x3D, 0x20, 0x69, 0x6E, 0x6E, 
+  0x65, 0x72, 0x53, 0x74, 0x72, 0x6F, 0x6B, 0x65, 0x28, 0x73, 0x74, 0x72, 
+  0x6F, 0x6B, 0x65, 0x5F, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2C, 0x20, 0x64, 
+  0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6C, 0x70, 0x68, 0x61, 
+  0x20, 0x2A, 0x3D, 0x20, 0x73, 0x74, 0x72, 0x6F, 0x6B, 0x65, 0x5F, 0x63, 
+  0x6F, 0x6C, 0x6F, 0x72, 0x2E, 0x61, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+  0x66, 0x6C, 0x6F, 0x61, 0x74, 0x34, 0x20, 0x73, 0x74, 0x72, 0x6F, 0x6B, 
+  0x65, 0x20, 0x3D, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x34, 0x28, 0x73, 
+  0x74, 0x72, 0x6F, 0x6B, 0x65, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x2E, 
+  0x72, 0x67, 0x62, 0x20, 0x2A, 0x20, 0x61, 0x6C, 0x70, 0x68, 0x61, 0x2C, 
+  0x20, 0x61, 0x6C, 0x70, 0x68, 0x61, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 
+  0x20, 0x6F, 0x75, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 
+  0x62, 0x6C, 0x65, 0x6E, 0x64, 0x28, 0x73, 0x74, 0x72, 0x6F, 0x6B, 0x65, 
+  0x2C, 0x20, 0x6F, 0x75, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x29, 0x3B, 
+  0x0A, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 
+  0x72, 0x6E, 0x20, 0x6F, 0x75, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3B, 
+  0x0A, 0x7D, 0x0A, 0x0A, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x34, 0x20, 0x66, 
+  0x69, 0x6C, 0x6C, 0x42, 0x6F, 0x78, 0x53, 0x68, 0x61, 0x64, 0x6F, 0x77, 
+  0x28, 0x56, 0x53, 0x5F, 0x4F, 0x55, 0x54, 0x50, 0x55, 0x54, 0x20, 0x69, 
+  0x6E, 0x70, 0x75, 0x74, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x66, 0x6C, 
+  0x6F, 0x61, 0x74, 0x32, 0x20, 0x70, 0x20, 0x3D, 0x20, 0x69, 0x6E, 0x70, 
+  0x75, 0x74, 0x2E, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x43, 0x6F, 0x6F, 
+  0x72, 0x64, 0x3B, 0x0A, 0x20, 0x20, 0x62, 0x6F, 0x6F, 0x6C, 0x20, 0x69, 
+  0x6E, 0x73, 0x65, 0x74, 0x20, 0x3D, 0x20, 0x62, 0x6F, 0x6F, 0x6C, 0x28, 
+  0x75, 0x69, 0x6E, 0x74, 0x28, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2E, 0x44, 
+  0x61, 0x74, 0x61, 0x30, 0x2E, 0x79, 0x20, 0x2B, 0x20, 0x30, 0x2E, 0x35, 
+  0x29, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 
+  0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x20, 0x3D, 0x20, 0x69, 0x6E, 0x70, 
+  0x75, 0x74, 0x2E, 0x44, 0x61, 0x74, 0x61, 0x30, 0x2E, 0x7A, 0x3B, 0x0A, 
+  0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x32, 0x20, 0x6F, 0x72, 0x69, 
+  0x67, 0x69, 0x6E, 0x20, 0x3D, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2E, 
+  0x44, 0x61, 0x74, 0x61, 0x31, 0x2E, 0x78, 0x79, 0x3B, 0x0A, 0x20, 0x20, 
+  0x66, 0x6C, 0x6F, 0x61, 0x74, 0x32, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 
+  0x3D, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2E, 0x44, 0x61, 0x74, 0x61, 
+  0x31, 0x2E, 0x7A, 0x77, 0x3B, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 
+  0x74, 0x32, 0x20, 0x63, 0x6C, 0x69, 0x70, 0x5F, 0x6F, 0x72, 0x69, 0x67, 
+  0x69, 0x6E, 0x20, 0x3D, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2E, 0x44, 
+  0x61, 0x74, 0x61, 0x34, 0x2E, 0x78, 0x79, 0x3B, 0x0A, 0x20, 0x20, 0x66, 
+  0x6C, 0x6F, 0x61, 0x74, 0x32, 0x20, 0x63, 0x6C, 0x69, 0x70, 0x5F, 0x73, 
+  0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2E, 
+  0x44, 0x61, 0x74, 0x61, 0x34, 0x2E, 0x7A, 0x77, 0x3B, 0x0A, 0x20, 0x20, 
+  0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x73, 0x64, 0x43, 
+  0x6C, 0x69, 0x70, 0x20, 0x3D, 0x20, 0x73, 0x64, 0x52, 0x6F, 0x75, 0x6E, 
+  0x64, 0x52, 0x65, 0x63, 0x74, 0x28, 0x70, 0x20, 0x2D, 0x20, 0x63, 0x6C, 
+  0x69, 0x70, 0x5F, 0x6F, 0x72, 0x69, 0x67, 0x69, 0x6E, 0x2C, 0x20, 0x63, 
+  0x6C, 0x69, 0x70, 0x5F, 0x73, 0x69, 0x7A, 0x65, 0x2C, 0x20, 0x69, 0x6E, 
+  0x70, 0x75, 0x74, 0x2E, 0x44, 0x61, 0x74, 0x61, 0x35, 0x2C, 0x20, 0x69, 
+  0x6E, 0x70, 0x75, 0x74, 0x2E, 0x44, 0x61, 0x74, 0x61, 0x36, 0x29, 0x3B, 
+  0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x73, 0x64, 0x52, 
+  0x65, 0x63, 0x74, 0x20, 0x3D, 0x20, 0x73, 0x64, 0x52, 0x6F, 0x75, 0x6E, 
+  0x64, 0x52, 0x65, 0x63, 0x74, 0x28, 0x70, 0x20, 0x2D, 0x20, 0x6F, 0x72, 
+  0x69, 0x67, 0x69, 0x6E, 0x2C, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x2C, 0x20, 
+  0x69, 0x6E, 0x70, 0x75, 0x74, 0x2E, 0x44, 0x61, 0x74, 0x61, 0x32, 0x2C, 
+  0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2E, 0x44, 0x61, 0x74, 0x61, 0x33, 
+  0x29, 0x3B, 0x0A, 0x20, 0x20, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 
+  0x74, 0x20, 0x63, 0x6C, 0x69, 0x70, 0x20, 0x3D, 0x20, 0x69, 0x6E, 0x73, 
+  0x65, 0x74, 0x20, 0x3F, 0x20, 0x2D, 0x73, 0x64, 0x52, 0x65, 0x63, 0x74, 
+  0x20, 0x3A, 0x20, 0x73, 0x64, 0x43, 0x6C, 0x69, 0x70, 0x3B, 0x0A, 0x20, 
+  0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x64, 0x20, 0x3D, 0x20, 0x69, 
+  0x6E, 0x73, 0x65, 0x74, 0x20, 0x3F, 0x20, 0x2D, 0x73, 0x64, 0x43, 0x6C, 
+  0x69, 0x70, 0x20, 0x3A, 0x20, 0x73, 0x64, 0x52, 0x65, 0x63, 0x74, 0x3B, 
+  0x0A, 0x0A, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x63, 0x6C, 0x69, 0x70, 
+  0x20, 0x3C, 0x20, 0x30, 0x2E, 0x30, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 
+  0x20, 0x20, 0x64, 0x69, 0x73, 0x63, 0x61, 0x72, 0x64, 0x3B, 0x0A, 0x20, 
+  0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x6C, 
+  0x6F, 0x61, 0x74, 0x34, 0x28, 0x30, 0x2E, 0x30, 0x2C, 0x20, 0x30, 0x2E, 
+  0x30, 0x2C, 0x20, 0x30, 0x2E, 0x30, 0x2C, 0x20, 0x30, 0x2E, 0x30, 0x29, 
+  0x3B, 0x0A, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 
+  0x61, 0x74, 0x20, 0x61, 0x6C, 0x70, 0x68, 0x61, 0x20, 0x3D, 0x20, 0x72, 
+  0x61, 0x64, 0x69, 0x75, 0x73, 0x20, 0x3E, 0x3D, 0x20, 0x31, 0x2E, 0x30, 
+  0x3F, 0x20, 0x70, 0x6F, 0x77, 0x28, 0x61, 0x6E, 0x74, 0x69, 0x61, 0x6C, 
+  0x69, 0x61, 0x73, 0x28, 0x2D, 0x64, 0x2C, 0x20, 0x72, 0x61, 0x64, 0x69, 
+  0x75, 0x73, 0x20, 0x2A, 0x20, 0x32, 0x20, 0x2B, 0x20, 0x30, 0x2E, 0x32, 
+  0x2C, 0x20, 0x30, 0x2E, 0x30, 0x29, 0x2C, 0x20, 0x31, 0x2E, 0x39, 0x29, 
+  0x20, 0x2A, 0x20, 0x33, 0x2E, 0x33, 0x20, 0x2F, 0x20, 0x70, 0x6F, 0x77, 
+  0x28, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x20, 0x2A, 0x20, 0x31, 0x2E, 
+  0x32, 0x2C, 0x20, 0x30, 0x2E, 0x31, 0x35, 0x29, 0x20, 0x3A, 0x0A, 0x20, 
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6E, 0x74, 0x69, 0x61, 0x6C, 
+  0x69, 0x61, 0x73, 0x28, 0x2D, 0x64, 0x2C, 0x20, 0x41, 0x41, 0x5F, 0x57, 
+  0x49, 0x44, 0x54, 0x48, 0x2C, 0x20, 0x69, 0x6E, 0x73, 0x65, 0x74, 0x20, 
+  0x3F, 0x20, 0x2D, 0x31, 0x2E, 0x30, 0x20, 0x3A, 0x20, 0x31, 0x2E, 0x30, 
+  0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x61, 0x6C, 0x70, 0x68, 0x61, 0x20, 
+  0x3D, 0x20, 0x63, 0x6C, 0x61, 0x6D, 0x70, 0x28, 0x61, 0x6C, 0x70, 0x68, 
+  0x61, 0x2C, 0x20, 0x30, 0x2E, 0x30, 0x2C, 0x20, 0x31, 0x2E, 0x30, 0x29, 
+  0x20, 0x2A, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2E, 0x43, 0x6F, 0x6C, 
+  0x6F, 0x72, 0x2E, 0x61, 0x3B, 0x0A, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 
+  0x72, 0x6E, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x34, 0x28, 0x69, 0x6E, 
+  0x70, 0x75, 0x74, 0x2E, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x2E, 0x72, 0x67, 
+  0x62, 0x20, 0x2A, 0x20, 0x61, 0x6C, 0x70, 0x68, 0x61, 0x2C, 0x20, 0x61, 
+  0x6C, 0x70, 0x68, 0x61, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 0x0A, 0x66, 0x6C, 
+  0x6F, 0x61, 0x74, 0x33, 0x20, 0x62, 0x6C, 0x65, 0x6E, 0x64, 0x4F, 0x76, 
+  0x65, 0x72, 0x6C, 0x61, 0x79, 0x28, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x33, 
+  0x20, 0x73, 0x72, 0x63, 0x2C, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x33, 
+  0x20, 0x64, 0x65, 0x73, 0x74, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x66, 
+  0x6C, 0x6F, 0x61, 0x74, 0x33, 0x20, 0x63, 0x6F, 0x6C, 0x3B, 0x0A, 0x20, 
+  0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x75, 0x69, 0x6E, 0x74, 0x20, 0x69, 
+  0x20, 0x3D, 0x20, 0x30, 0x3B, 0x20, 0x69, 0x20, 0x3C, 0x20, 0x33, 0x3B, 
+  0x20, 0x2B, 0x2B, 0x69, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 
+  0x6C, 0x5B, 0x69, 0x5D, 0x20, 0x3D, 0x20, 0x64, 0x65, 0x73, 0x74, 0x5B, 
+  0x69, 0x5D, 0x20, 0x3C, 0x20, 0x30, 0x2E, 0x35, 0x20, 0x3F, 0x20, 0x28, 
+  0x32, 0x2E, 0x30, 0x20, 0x2A, 0x20, 0x64, 0x65, 0x73, 0x74, 0x5B, 0x69, 
+  0x5D, 0x20, 0x2A, 0x20, 0x73, 0x72, 0x63, 0x5B, 0x69, 0x5D, 0x29, 0x20, 
+  0x3A, 0x20, 0x28, 0x31, 0x2E, 0x30, 0x20, 0x2D, 0x20, 0x32, 0x2E, 0x30, 
+  0x20, 0x2A, 0x20, 0x28, 0x31, 0x2E, 0x30, 0x20, 0x2D, 0x20, 0x64, 0x65, 
+  0x73, 0x74, 0x5B, 0x69, 0x5D, 0x29, 0x20, 0x2A, 0x20, 0x28, 0x31, 0x2E, 
+  0x30, 0x20, 0x2D, 0x20, 0x73, 0x72, 0x63, 0x5B, 0x69, 0x5D, 0x29, 0x29, 
+  0x3B, 0x0A, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x63, 
+  0x6F, 0x6C, 0x3B, 0x0A, 0x7D, 0x0A, 0x0A, 0x66, 0x6C, 0x6F, 0x61, 0x74, 
+  0x33, 0x20, 0x62, 0x6C, 0x65, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 
+  0x44, 0x6F, 0x64, 0x67, 0x65, 0x28, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x33, 
+  0x20, 0x73, 0x72, 0x63, 0x2C, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x33, 
+  0x20, 0x64, 0x65, 0x73, 0x74, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x66, 
+  0x6C, 0x6F, 0x61, 0x74, 0x33, 0x20, 0x63, 0x6F, 0x6C, 0x3B, 0x0A, 0x20, 
+  0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x75, 0x69, 0x6E, 0x74, 0x20, 0x69, 
+  0x20, 0x3D, 0x20, 0x30, 0x3B, 0x20, 0x69, 0x20, 0x3C, 0x20, 0x33, 0x3B, 
+  0x20, 0x2B, 0x2B, 0x69, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 
+  0x6C, 0x5B, 0x69, 0x5D, 0x20, 0x3D, 0x20, 0x28, 0x73, 0x72, 0x63, 0x5B, 
+  0x69, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 0x31, 0x2E, 0x30, 0x29, 0x20, 0x3F, 
+  0x20, 0x73, 0x72, 0x63, 0x5B, 0x69, 0x5D, 0x20, 0x3A, 0x20, 0x6D, 0x69, 
+  0x6E, 0x28, 0x64, 0x65, 0x73, 0x74, 0x5B, 0x69, 0x5D, 0x20, 0x2F, 0x20, 
+  0x28, 0x31, 0x2E, 0x30, 0x20, 0x2D, 0x20, 0x73, 0x72, 0x63, 0x5B, 0x69, 
+  0x5D, 0x29, 0x2C, 0x20, 0x31, 0x2E, 0x30, 0x29, 0x3B, 0x0A, 0x20, 0x20, 
+  0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x63, 0x6F, 0x6C, 0x3B, 0x0A, 
+  0x7D, 0x0A, 0x0A, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x33, 0x20, 0x62, 0x6C, 
+  0x65, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x42, 0x75, 0x72, 0x6E, 
+  0x28, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x33, 0x20, 0x73, 0x72, 0x63, 0x2C, 
+  0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x33, 0x20, 0x64, 0x65, 0x73, 0x74, 
+  0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x33, 
+  0x20, 0x63, 0x6F, 0x6C, 0x3B, 0x0A, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 
+  0x28, 0x75, 0x69, 0x6E, 0x74, 0x20, 0x69, 0x20, 0x3D, 0x20, 0x30, 0x3B, 
+  0x20, 0x69, 0x20, 0x3C, 0x20, 0x33, 0x3B, 0x20, 0x2B, 0x2B, 0x69, 0x29, 
+  0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x5B, 0x69, 0x5D, 0x20, 
+  0x3D, 0x20, 0x28, 0x73, 0x72, 0x63, 0x5B, 0x69, 0x5D, 0x20, 0x3D, 0x3D, 
+  0x20, 0x30, 0x2E, 0x30, 0x29, 0x20, 0x3F, 0x20, 0x73, 0x72, 0x63, 0x5B, 
+  0x69, 0x5D, 0x20, 0x3A, 0x20, 0x6D, 0x61, 0x78, 0x28, 0x28, 0x31, 0x2E, 
+  0x30, 0x20, 0x2D, 0x20, 0x28, 0x28, 0x31, 0x2E, 0x30, 0x20, 0x2D, 0x20, 
+  0x64, 0x65, 0x73, 0x74, 0x5B, 0x69, 0x5D, 0x29, 0x20, 0x2F, 0x20, 0x73, 
+  0x72, 0x63, 0x5B, 0x69, 0x5D, 0x29, 0x29, 0x2C, 0x20, 0x30, 0x2E, 0x30, 
+  0x29, 0x3B, 0x0A, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+  0x63, 0x6F, 0x6C, 0x3B, 0x0A, 0x7D, 0x0A, 0x0A, 0x66, 0x6C, 0x6F, 0x61, 
+  0x74, 0x33, 0x20, 0x62, 0x6C, 0x65, 0x6E, 0x64, 0x48, 0x61, 0x72, 0x64, 
+  0x4C, 0x69, 0x67, 0x68, 0x74, 0x28, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x33, 
+  0x20, 0x73, 0x72, 0x63, 0x2C, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x33, 
+  0x20, 0x64, 0x65, 0x73, 0x74, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x66, 
+  0x6C, 0x6F, 0x61, 0x74, 0x33, 0x20, 0x63, 0x6F, 0x6C, 0x3B, 0x0A, 0x20, 
+  0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x75, 0x69, 0x6E, 0x74, 0x20, 0x69, 
+  0x20, 0x3D, 0x20, 0x30, 0x3B, 0x20, 0x69, 0x20, 0x3C, 0x20, 0x33, 0x3B, 
+  0x20, 0x2B, 0x2B, 0x69, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 
+  0x6C, 0x5B, 0x69, 0x5D, 0x20, 0x3D, 0x20, 0x64, 0x65, 0x73, 0x74, 0x5B, 
+  0x69, 0x5D, 0x20, 0x3C, 0x20, 0x30, 0x2E, 0x35, 0x20, 0x3F, 0x20, 0x28, 
+  0x32, 0x2E, 0x30, 0x20, 0x2A, 0x20, 0x64, 0x65, 0x73, 0x74, 0x5B, 0x69, 
+  0x5D, 0x20, 0x2A, 0x20, 0x73, 0x72, 0x63, 0x5B, 0x69, 0x5D, 0x29, 0x20, 
+  0x3A, 0x20, 0x28, 0x31, 0x2E, 0x30, 0x20, 0x2D, 0x20, 0x32, 0x2E, 0x30, 
+  0x20, 0x2A, 0x20, 0x28, 0x31, 0x2E, 0x30, 0x20, 0x2D, 0x20, 0x64, 0x65, 
+  0x73, 0x74, 0x5B, 0x69, 0x5D, 0x29, 0x20, 0x2A, 0x20, 0x28, 0x31, 0x2E, 
+  0x30, 0x20, 0x2D, 0x20, 0x73, 0x72, 0x63, 0x5B, 0x69, 0x5D, 0x29, 0x29, 
+  0x3B, 0x0A, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x63, 
+  0x6F, 0x6C, 0x3B, 0x0A, 0x7D, 0x0A, 0x0A, 0x66, 0x6C, 0x6F, 0x61, 0x74, 
+  0x33, 0x20, 0x62, 0x6C, 0x65, 0x6E, 0x64, 0x53, 0x6F, 0x66, 0x74, 0x4C, 
+  0x69, 0x67, 0x68, 0x74, 0x28, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x33, 0x20, 
+  0x73, 0x72, 0x63, 0x2C, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x33, 0x20, 
+  0x64, 0x65, 0x73, 0x74, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x66, 0x6C, 
+  0x6F, 0x61, 0x74, 0x33, 0x20, 0x63, 0x6F, 0x6C, 0x3B, 0x0A, 0x20, 0x20, 
+  0x66, 0x6F, 0x72, 0x20, 0x28, 0x75, 0x69, 0x6E, 0x74, 0x20, 0x69, 0x20, 
+  0x3D, 0x20, 0x30, 0x3B, 0x20, 0x69, 0x20, 0x3C, 0x20, 0x33, 0x3B, 0x20, 
+  0x2B, 0x2B, 0x69, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 
+  0x5B, 0x69, 0x5D, 0x20, 0x3D, 0x20, 0x28, 0x73, 0x72, 0x63, 0x5B, 0x69, 
+  0x5D, 0x20, 0x3C, 0x20, 0x30, 0x2E, 0x35, 0x29, 0x20, 0x3F, 0x20, 0x28, 
+  0x32, 0x2E, 0x30, 0x20, 0x2A, 0x20, 0x64, 0x65, 0x73, 0x74, 0x5B, 0x69, 
+  0x5D, 0x20, 0x2A, 0x20, 0x73, 0x72, 0x63, 0x5B, 0x69, 0x5D, 0x20, 0x2B, 
+  0x20, 0x64, 0x65, 0x73, 0x74, 0x5B, 0x69, 0x5D, 0x20, 0x2A, 0x20, 0x64, 
+  0x65, 0x73, 0x74, 0x5B, 0x69, 0x5D, 0x20, 0x2A, 0x20, 0x28, 0x31, 0x2E, 
+  0x30, 0x20, 0x2D, 0x20, 0x32, 0x2E, 0x30, 0x20, 0x2A, 0x20, 0x73, 0x72, 
+  0x63, 0x5B, 0x69, 0x5D, 0x29, 0x29, 0x20, 0x3A, 0x20, 0x28, 0x73, 0x71, 
+  0x72, 0x74, 0x28, 0x64, 0x65, 0x73, 0x74, 0x5B, 0x69, 0x5D, 0x29, 0x20, 
+  0x2A, 0x20, 0x28, 0x32, 0x2E, 0x30, 0x20, 0x2A, 0x20, 0x73, 0x72, 0x63, 
+  0x5B, 0x69, 0x5D, 0x20, 0x2D, 0x20, 0x31, 0x2E, 0x30, 0x29, 0x20, 0x2B, 
+  0x20, 0x32, 0x2E, 0x30, 0x20, 0x2A, 0x20, 0x64, 0x65, 0x73, 0x74, 0x5B, 
+  0x69, 0x5D, 0x20, 0x2A, 0x20, 0x28, 0x31, 0x2E, 0x30, 0x20, 0x2D, 0x20, 
+  0x73, 0x72, 0x63, 0x5B, 0x69, 0x5D, 0x29, 0x29, 0x3B, 0x0A, 0x20, 0x20, 
+  0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x63, 0x6F, 0x6C, 0x3B, 0x0A, 
+  0x7D, 0x0A, 0x0A, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x33, 0x20, 0x72, 0x67, 
+  0x62, 0x32, 0x68, 0x73, 0x6C, 0x28, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 
+  0x33, 0x20, 0x63, 0x6F, 0x6C, 0x20, 0x29, 0x0A, 0x7B, 0x0A, 0x20, 0x20, 
+  0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 
+  0x65, 0x70, 0x73, 0x20, 0x3D, 0x20, 0x30, 0x2E, 0x30, 0x30, 0x30, 0x30, 
+  0x30, 0x30, 0x31, 0x3B, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 
+  0x20, 0x6D, 0x69, 0x6E, 0x63, 0x20, 0x3D, 0x20, 0x6D, 0x69, 0x6E, 0x28, 
+  0x20, 0x63, 0x6F, 0x6C, 0x2E, 0x72, 0x2C, 0x20, 0x6D, 0x69, 0x6E, 0x28, 
+  0x63, 0x6F, 0x6C, 0x2E, 0x67, 0x2C, 0x20, 0x63, 0x6F, 0x6C, 0x2E, 0x62, 
+  0x29, 0x20, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 
+  0x20, 0x6D, 0x61, 0x78, 0x63, 0x20, 0x3D, 0x20, 0x6D, 0x61, 0x78, 0x28, 
+  0x20, 0x63, 0x6F, 0x6C, 0x2E, 0x72, 0x2C, 0x20, 0x6D, 0x61, 0x78, 0x28, 
+  0x63, 0x6F, 0x6C, 0x2E, 0x67, 0x2C, 0x20, 0x63, 0x6F, 0x6C, 0x2E, 0x62, 
+  0x29, 0x20, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 
+  0x33, 0x20, 0x6D, 0x61, 0x73, 0x6B, 0x20, 0x3D, 0x20, 0x73, 0x74, 0x65, 
+  0x70, 0x28, 0x63, 0x6F, 0x6C, 0x2E, 0x67, 0x72, 0x72, 0x2C, 0x63, 0x6F, 
+  0x6C, 0x2E, 0x72, 0x67, 0x62, 0x29, 0x20, 0x2A, 0x20, 0x73, 0x74, 0x65, 
+  0x70, 0x28, 0x63, 0x6F, 0x6C, 0x2E, 0x62, 0x62, 0x67, 0x2C, 0x63, 0x6F, 
+  0x6C, 0x2E, 0x72, 0x67, 0x62, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x66, 0x6C, 
+  0x6F, 0x61, 0x74, 0x33, 0x20, 0x68, 0x20, 0x3D, 0x20, 0x6D, 0x61, 0x73, 
+  0x6B, 0x20, 0x2A, 0x20, 0x28, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x33, 0x28, 
+  0x30, 0x2E, 0x30, 0x2C, 0x32, 0x2E, 0x30, 0x2C, 0x34, 0x2E, 0x30, 0x29, 
+  0x20, 0x2B, 0x20, 0x28, 0x63, 0x6F, 0x6C, 0x2E, 0x67, 0x62, 0x72, 0x2D, 
+  0x63, 0x6F, 0x6C, 0x2E, 0x62, 0x72, 0x67, 0x29, 0x2F, 0x28, 0x6D, 0x61, 
+  0x78, 0x63, 0x2D, 0x6D, 0x69, 0x6E, 0x63, 0x20, 0x2B, 0x20, 0x65, 0x70, 
+  0x73, 0x29, 0x29, 0x20, 0x2F, 0x20, 0x36, 0x2E, 0x30, 0x3B, 0x0A, 0x20, 
+  0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x6C, 0x6F, 0x61, 
+  0x74, 0x33, 0x28, 0x66, 0x72, 0x61, 0x63, 0x28, 0x20, 0x31, 0x2E, 0x30, 
+  0x20, 0x2B, 0x20, 0x68, 0x2E, 0x78, 0x20, 0x2B, 0x20, 0x68, 0x2E, 0x79, 
+  0x20, 0x2B, 0x20, 0x68, 0x2E, 0x7A, 0x20, 0x29, 0x2C, 0x20, 0x20, 0x20, 
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+  0x20, 0x2F, 0x2F, 0x20, 0x48, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x6D, 
+  0x61, 0x78, 0x63, 0x2D, 0x6D, 0x69, 0x6E, 0x63, 0x29, 0x2F, 0x28, 0x31, 
+  0x2E, 0x30, 0x2D, 0x61, 0x62, 0x73, 0x28, 0x6D, 0x69, 0x6E, 0x63, 0x2B, 
+  0x6D, 0x61, 0x78, 0x63, 0x2D, 0x31, 0x2E, 0x30, 0x29, 0x20, 0x2B, 0x20, 
+  0x65, 0x70, 0x73, 0x29, 0x2C, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x53, 
+  0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x6D, 0x69, 0x6E, 0x63, 0x2B, 0x6D, 
+  0x61, 0x78, 0x63, 0x29, 0x2A, 0x30, 0x2E, 0x35, 0x20, 0x29, 0x3B, 0x20, 
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+  0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x4C, 0x0A, 0x7D, 0x0A, 0x0A, 0x66, 
+  0x6C, 0x6F, 0x61, 0x74, 0x33, 0x20, 0x68, 0x73, 0x6C, 0x32, 0x72, 0x67, 
+  0x62, 0x28, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x33, 0x20, 0x63, 0x20, 
+  0x29, 0x0A, 0x7B, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x33, 
+  0x20, 0x72, 0x67, 0x62, 0x20, 0x3D, 0x20, 0x63, 0x6C, 0x61, 0x6D, 0x70, 
+  0x28, 0x20, 0x61, 0x62, 0x73, 0x28, 0x66, 0x6D, 0x6F, 0x64, 0x28, 0x63, 
+  0x2E, 0x78, 0x2A, 0x36, 0x2E, 0x30, 0x2B, 0x66, 0x6C, 0x6F, 0x61, 0x74, 
+  0x33, 0x28, 0x30, 0x2E, 0x30, 0x2C, 0x34, 0x2E, 0x30, 0x2C, 0x32, 0x2E, 
+  0x30, 0x29, 0x2C, 0x36, 0x2E, 0x30, 0x29, 0x2D, 0x33, 0x2E, 0x30, 0x29, 
+  0x2D, 0x31, 0x2E, 0x30, 0x2C, 0x20, 0x30, 0x2E, 0x30, 0x2C, 0x20, 0x31, 
+  0x2E, 0x30, 0x20, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 
+  0x72, 0x6E, 0x20, 0x63, 0x2E, 0x7A, 0x20, 0x2B, 0x20, 0x63, 0x2E, 0x79, 
+  0x20, 0x2A, 0x20, 0x28, 0x72, 0x67, 0x62, 0x2D, 0x30, 0x2E, 0x35, 0x29, 
+  0x2A, 0x28, 0x31, 0x2E, 0x30, 0x2D, 0x61, 0x62, 0x73, 0x28, 0x32, 0x2E, 
+  0x30, 0x2A, 0x63, 0x2E, 0x7A, 0x2D, 0x31, 0x2E, 0x30, 0x29, 0x29, 0x3B, 
+  0x0A, 0x7D, 0x0A, 0x0A, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x33, 0x20, 0x62, 
+  0x6C, 0x65, 0x6E, 0x64, 0x48, 0x75, 0x65, 0x28, 0x66, 0x6C, 0x6F, 0x61, 
+  0x74, 0x33, 0x20, 0x73, 0x72, 0x63, 0x2C, 0x20, 0x66, 0x6C, 0x6F, 0x61, 
+  0x74, 0x33, 0x20, 0x64, 0x65, 0x73, 0x74, 0x29, 0x20, 0x7B, 0x0A, 0x20, 
+  0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x33, 0x20, 0x62, 0x61, 0x73, 0x65, 
+  0x48, 0x53, 0x4C, 0x20, 0x3D, 0x20, 0x72, 0x67, 0x62, 0x32, 0x68, 0x73, 
+  0x6C, 0x28, 0x64, 0x65, 0x73, 0x74, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x72, 
+  0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x68, 0x73, 0x6C, 0x32, 0x72, 0x67, 
+  0x62, 0x28, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x33, 0x28, 0x72, 0x67, 0x62, 
+  0x32, 0x68, 0x73, 0x6C, 0x28, 0x73, 0x72, 0x63, 0x29, 0x2E, 0x72, 0x2C, 
+  0x20, 0x62, 0x61, 0x73, 0x65, 0x48, 0x53, 0x4C, 0x2E, 0x67, 0x2C, 0x20, 
+  0x62, 0x61, 0x73, 0x65, 0x48, 0x53, 0x4C, 0x2E, 0x62, 0x29, 0x29, 0x3B, 
+  0x0A, 0x7D, 0x0A, 0x0A, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x33, 0x20, 0x62, 
+  0x6C, 0x65, 0x6E, 0x64, 0x53, 0x61, 0x74, 0x75, 0x72, 0x61, 0x74, 0x69, 
+  0x6F, 0x6E, 0x28, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x33, 0x20, 0x73, 0x72, 
+  0x63, 0x2C, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x33, 0x20, 0x64, 0x65, 
+  0x73, 0x74, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 
+  0x74, 0x33, 0x20, 0x62, 0x61, 0x73, 0x65, 0x48, 0x53, 0x4C, 0x20, 0x3D, 
+  0x20, 0x72, 0x67, 0x62, 0x32, 0x68, 0x73, 0x6C, 0x28, 0x64, 0x65, 0x73, 
+  0x74, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+  0x20, 0x68, 0x73, 0x6C, 0x32, 0x72, 0x67, 0x62, 0x28, 0x66, 0x6C, 0x6F, 
+  0x61, 0x74, 0x33, 0x28, 0x62, 0x61, 0x73, 0x65, 0x48, 0x53, 0x4C, 0x2E, 
+  0x72, 0x2C, 0x20, 0x72, 0x67, 0x62, 0x32, 0x68, 0x73, 0x6C, 0x28, 0x73, 
+  0x72, 0x63, 0x29, 0x2E, 0x67, 0x2C, 0x20, 0x62, 0x61, 0x73, 0x65, 0x48, 
+  0x53, 0x4C, 0x2E, 0x62, 0x29, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 0x0A, 0x66, 
+  0x6C, 0x6F, 0x61, 0x74, 0x33, 0x20, 0x62, 0x6C, 0x65, 0x6E, 0x64, 0x43, 
+  0x6F, 0x6C, 0x6F, 0x72, 0x28, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x33, 0x20, 
+  0x73, 0x72, 0x63, 0x2C, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x33, 0x20, 
+  0x64, 0x65, 0x73, 0x74, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x66, 0x6C, 
+  0x6F, 0x61, 0x74, 0x33, 0x20, 0x62, 0x6C, 0x65, 0x6E, 0x64, 0x48, 0x53, 
+  0x4C, 0x20, 0x3D, 0x20, 0x72, 0x67, 0x62, 0x32, 0x68, 0x73, 0x6C, 0x28, 
+  0x73, 0x72, 0x63, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 
+  0x72, 0x6E, 0x20, 0x68, 0x73, 0x6C, 0x32, 0x72, 0x67, 0x62, 0x28, 0x66, 
+  0x6C, 0x6F, 0x61, 0x74, 0x33, 0x28, 0x62, 0x6C, 0x65, 0x6E, 0x64, 0x48, 
+  0x53, 0x4C, 0x2E, 0x72, 0x2C, 0x20, 0x62, 0x6C, 0x65, 0x6E, 0x64, 0x48, 
+  0x53, 0x4C, 0x2E, 0x67, 0x2C, 0x20, 0x72, 0x67, 0x62, 0x32, 0x68, 0x73, 
+  0x6C, 0x28, 0x64, 0x65, 0x73, 0x74, 0x29, 0x2E, 0x62, 0x29, 0x29, 0x3B, 
+  0x0A, 0x7D, 0x0A, 0x0A, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x33, 0x20, 0x62, 
+  0x6C, 0x65, 0x6E, 0x64, 0x4C, 0x75, 0x6D, 0x69, 0x6E, 0x6F, 0x73, 0x69, 
+  0x74, 0x79, 0x28, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x33, 0x20, 0x73, 0x72, 
+  0x63, 0x2C, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x33, 0x20, 0x64, 0x65, 
+  0x73, 0x74, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 
+  0x74, 0x33, 0x20, 0x62, 0x61, 0x73, 0x65, 0x48, 0x53, 0x4C, 0x20, 0x3D, 
+  0x20, 0x72, 0x67, 0x62, 0x32, 0x68, 0x73, 0x6C, 0x28, 0x64, 0x65, 0x73, 
+  0x74, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+  0x20, 0x68, 0x73, 0x6C, 0x32, 0x72, 0x67, 0x62, 0x28, 0x66, 0x6C, 0x6F, 
+  0x61, 0x74, 0x33, 0x28, 0x62, 0x61, 0x73, 0x65, 0x48, 0x53, 0x4C, 0x2E, 
+  0x72, 0x2C, 0x20, 0x62, 0x61, 0x73, 0x65, 0x48, 0x53, 0x4C, 0x2E, 0x67, 
+  0x2C, 0x20, 0x72, 0x67, 0x62, 0x32, 0x68, 0x73, 0x6C, 0x28, 0x73, 0x72, 
+  0x63, 0x29, 0x2E, 0x62, 0x29, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 0x0A, 0x66, 
+  0x6C, 0x6F, 0x61, 0x74, 0x34, 0x20, 0x66, 0x69, 0x6C, 0x6C, 0x42, 0x6C, 
+  0x65, 0x6E, 0x64, 0x28, 0x56, 0x53, 0x5F, 0x4F, 0x55, 0x54, 0x50, 0x55, 
+  0x54, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x29, 0x20, 0x7B, 0x20, 0x0A, 
+  0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x75, 0x69, 0x6E, 0x74, 
+  0x20, 0x42, 0x6C, 0x65, 0x6E, 0x64, 0x4F, 0x70, 0x5F, 0x43, 0x6C, 0x65, 
+  0x61, 0x72, 0x20, 0x3D, 0x20, 0x30, 0x75, 0x3B, 0x0A, 0x20, 0x20, 0x63, 
+  0x6F, 0x6E, 0x73, 0x74, 0x20, 0x75, 0x69, 0x6E, 0x74, 0x20, 0x42, 0x6C, 
+  0x65, 0x6E, 0x64, 0x4F, 0x70, 0x5F, 0x53, 0x6F, 0x75, 0x72, 0x63, 0x65, 
+  0x20, 0x3D, 0x20, 0x31, 0x75, 0x3B, 0x0A, 0x20, 0x20, 0x63, 0x6F, 0x6E, 
+  0x73, 0x74, 0x20, 0x75, 0x69, 0x6E, 0x74, 0x20, 0x42, 0x6C, 0x65, 0x6E, 
+  0x64, 0x4F, 0x70, 0x5F, 0x4F, 0x76, 0x65, 0x72, 0x20, 0x3D, 0x20, 0x32, 
+  0x75, 0x3B, 0x0A, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x75, 
+  0x69, 0x6E, 0x74, 0x20, 0x42, 0x6C, 0x65, 0x6E, 0x64, 0x4F, 0x70, 0x5F, 
+  0x49, 0x6E, 0x20, 0x3D, 0x20, 0x33, 0x75, 0x3B, 0x0A, 0x20, 0x20, 0x63, 
+  0x6F, 0x6E, 0x73, 0x74, 0x20, 0x75, 0x69, 0x6E, 0x74, 0x20, 0x42, 0x6C, 
+  0x65, 0x6E, 0x64, 0x4F, 0x70, 0x5F, 0x4F, 0x75, 0x74, 0x20, 0x3D, 0x20, 
+  0x34, 0x75, 0x3B, 0x0A, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 
+  0x75, 0x69, 0x6E, 0x74, 0x20, 0x42, 0x6C, 0x65, 0x6E, 0x64, 0x4F, 0x70, 
+  0x5F, 0x41, 0x74, 0x6F, 0x70, 0x20, 0x3D, 0x20, 0x35, 0x75, 0x3B, 0x0A, 
+  0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x75, 0x69, 0x6E, 0x74, 
+  0x20, 0x42, 0x6C, 0x65, 0x6E, 0x64, 0x4F, 0x70, 0x5F, 0x44, 0x65, 0x73, 
+  0x74, 0x4F, 0x76, 0x65, 0x72, 0x20, 0x3D, 0x20, 0x36, 0x75, 0x3B, 0x0A, 
+  0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x75, 0x69, 0x6E, 0x74, 
+  0x20, 0x42, 0x6C, 0x65, 0x6E, 0x64, 0x4F, 0x70, 0x5F, 0x44, 0x65, 0x73, 
+  0x74, 0x49, 0x6E, 0x20, 0x3D, 0x20, 0x37, 0x75, 0x3B, 0x0A, 0x20, 0x20, 
+  0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x75, 0x69, 0x6E, 0x74, 0x20, 0x42, 
+  0x6C, 0x65, 0x6E, 0x64, 0x4F, 0x70, 0x5F, 0x44, 0x65, 0x73, 0x74, 0x4F, 
+  0x75, 0x74, 0x20, 0x3D, 0x20, 0x38, 0x75, 0x3B, 0x0A, 0x20, 0x20, 0x63, 
+  0x6F, 0x6E, 0x73, 0x74, 0x20, 0x75, 0x69, 0x6E, 0x74, 0x20, 0x42, 0x6C, 
+  0x65, 0x6E, 0x64, 0x4F, 0x70, 0x5F, 0x44, 0x65, 0x73, 0x74, 0x41, 0x74, 
+  0x6F, 0x70, 0x20, 0x3D, 0x20, 0x39, 0x75, 0x3B, 0x0A, 0x20, 0x20, 0x63, 
+  0x6F, 0x6E, 0x73, 0x74, 0x20, 0x75, 0x69, 0x6E, 0x74, 0x20, 0x42, 0x6C, 
+  0x65, 0x6E, 0x64, 0x4F, 0x70, 0x5F, 0x58, 0x4F, 0x52, 0x20, 0x3D, 0x20, 
+  0x31, 0x30, 0x75, 0x3B, 0x0A, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 
+  0x20, 0x75, 0x69, 0x6E, 0x74, 0x20, 0x42, 0x6C, 0x65, 0x6E, 0x64, 0x4F, 
+  0x70, 0x5F, 0x44, 0x61, 0x72, 0x6B, 0x65, 0x6E, 0x20, 0x3D, 0x20, 0x31, 
+  0x31, 0x75, 0x3B, 0x0A, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 
+  0x75, 0x69, 0x6E, 0x74, 0x20, 0x42, 0x6C, 0x65, 0x6E, 0x64, 0x4F, 0x70, 
+  0x5F, 0x41, 0x64, 0x64, 0x20, 0x3D, 0x20, 0x31, 0x32, 0x75, 0x3B, 0x0A, 
+  0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x75, 0x69, 0x6E, 0x74, 
+  0x20, 0x42, 0x6C, 0x65, 0x6E, 0x64, 0x4F, 0x70, 0x5F, 0x44, 0x69, 0x66, 
+  0x66, 0x65, 0x72, 0x65, 0x6E, 0x63, 0x65, 0x20, 0x3D, 0x20, 0x31, 0x33, 
+  0x75, 0x3B, 0x0A, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x75, 
+  0x69, 0x6E, 0x74, 0x20, 0x42, 0x6C, 0x65, 0x6E, 0x64, 0x4F, 0x70, 0x5F, 
+  0x4D, 0x75, 0x6C, 0x74, 0x69, 0x70, 0x6C, 0x79, 0x20, 0x3D, 0x20, 0x31, 
+  0x34, 0x75, 0x3B, 0x0A, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 
+  0x75, 0x69, 0x6E, 0x74, 0x20, 0x42, 0x6C, 0x65, 0x6E, 0x64, 0x4F, 0x70, 
+  0x5F, 0x53, 0x63, 0x72, 0x65, 0x65, 0x6E, 0x20, 0x3D, 0x20, 0x31, 0x35, 
+  0x75, 0x3B, 0x0A, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x75, 
+  0x69, 0x6E, 0x74, 0x20, 0x42, 0x6C, 0x65, 0x6E, 0x64, 0x4F, 0x70, 0x5F, 
+  0x4F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x79, 0x20, 0x3D, 0x20, 0x31, 0x36, 
+  0x75, 0x3B, 0x0A, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x75, 
+  0x69, 0x6E, 0x74, 0x20, 0x42, 0x6C, 0x65, 0x6E, 0x64, 0x4F, 0x70, 0x5F, 
+  0x4C, 0x69, 0x67, 0x68, 0x74, 0x65, 0x6E, 0x20, 0x3D, 0x20, 0x31, 0x37, 
+  0x75, 0x3B, 0x0A, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x75, 
+  0x69, 0x6E, 0x74, 0x20, 0x42, 0x6C, 0x65, 0x6E, 0x64, 0x4F, 0x70, 0x5F, 
+  0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x44, 0x6F, 0x64, 0x67, 0x65, 0x20, 0x3D, 
+  0x20, 0x31, 0x38, 0x75, 0x3B, 0x0A, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 
+  0x74, 0x20, 0x75, 0x69, 0x6E, 0x74, 0x20, 0x42, 0x6C, 0x65, 0x6E, 0x64, 
+  0x4F, 0x70, 0x5F, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x42, 0x75, 0x72, 0x6E, 
+  0x20, 0x3D, 0x20, 0x31, 0x39, 0x75, 0x3B, 0x0A, 0x20, 0x20, 0x63, 0x6F, 
+  0x6E, 0x73, 0x74, 0x20, 0x75, 0x69, 0x6E, 0x74, 0x20, 0x42, 0x6C, 0x65, 
+  0x6E, 0x64, 0x4F, 0x70, 0x5F, 0x48, 0x61, 0x72, 0x64, 0x4C, 0x69, 0x67, 
+  0x68, 0x74, 0x20, 0x3D, 0x20, 0x32, 0x30, 0x75, 0x3B, 0x0A, 0x20, 0x20, 
+  0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x75, 0x69, 0x6E, 0x74, 0x20, 0x42, 
+  0x6C, 0x65, 0x6E, 0x64, 0x4F, 0x70, 0x5F, 0x53, 0x6F, 0x66, 0x74, 0x4C, 
+  0x69, 0x67, 0x68, 0x74, 0x20, 0x3D, 0x20, 0x32, 0x31, 0x75, 0x3B, 0x0A, 
+  0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x75, 0x69, 0x6E, 0x74, 
+  0x20, 0x42, 0x6C, 0x65, 0x6E, 0x64, 0x4F, 0x70, 0x5F, 0x45, 0x78, 0x63, 
+  0x6C, 0x75, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x32, 0x32, 0x75, 
+  0x3B, 0x0A, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x75, 0x69, 
+  0x6E, 0x74, 0x20, 0x42, 0x6C, 0x65, 0x6E, 0x64, 0x4F, 0x70, 0x5F, 0x48, 
+  0x75, 0x65, 0x20, 0x3D, 0x20, 0x32, 0x33, 0x75, 0x3B, 0x0A, 0x20, 0x20, 
+  0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x75, 0x69, 0x6E, 0x74, 0x20, 0x42, 
+  0x6C, 0x65, 0x6E, 0x64, 0x4F, 0x70, 0x5F, 0x53, 0x61, 0x74, 0x75, 0x72, 
+  0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x32, 0x34, 0x75, 0x3B, 
+  0x0A, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x75, 0x69, 0x6E, 
+  0x74, 0x20, 0x42, 0x6C, 0x65, 0x6E, 0x64, 0x4F, 0x70, 0x5F, 0x43, 0x6F, 
+  0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x32, 0x35, 0x75, 0x3B, 0x0A, 0x20, 
+  0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x75, 0x69, 0x6E, 0x74, 0x20, 
+  0x42, 0x6C, 0x65, 0x6E, 0x64, 0x4F, 0x70, 0x5F, 0x4C, 0x75, 0x6D, 0x69, 
+  0x6E, 0x6F, 0x73, 0x69, 0x74, 0x79, 0x20, 0x3D, 0x20, 0x32, 0x36, 0x75, 
+  0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x34, 0x20, 
+  0x73, 0x72, 0x63, 0x20, 0x3D, 0x20, 0x66, 0x69, 0x6C, 0x6C, 0x49, 0x6D, 
+  0x61, 0x67, 0x65, 0x28, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x29, 0x3B, 0x0A, 
+  0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x34, 0x20, 0x64, 0x65, 0x73, 
+  0x74, 0x20, 0x3D, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x31, 
+  0x2E, 0x53, 0x61, 0x6D, 0x70, 0x6C, 0x65, 0x28, 0x73, 0x61, 0x6D, 0x70, 
+  0x6C, 0x65, 0x72, 0x30, 0x2C, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2E, 
+  0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x43, 0x6F, 0x6F, 0x72, 0x64, 0x29, 
+  0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x28, 
+  0x75, 0x69, 0x6E, 0x74, 0x28, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2E, 0x44, 
+  0x61, 0x74, 0x61, 0x30, 0x2E, 0x79, 0x20, 0x2B, 0x20, 0x30, 0x2E, 0x35, 
+  0x29, 0x29, 0x0A, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x63, 0x61, 0x73, 
+  0x65, 0x20, 0x42, 0x6C, 0x65, 0x6E, 0x64, 0x4F, 0x70, 0x5F, 0x43, 0x6C, 
+  0x65, 0x61, 0x72, 0x3A, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+  0x66, 0x6C, 0x6F, 0x61, 0x74, 0x34, 0x28, 0x30, 0x2E, 0x30, 0x2C, 0x20, 
+  0x30, 0x2E, 0x30, 0x2C, 0x20, 0x30, 0x2E, 0x30, 0x2C, 0x20, 0x30, 0x2E, 
+  0x30, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x42, 
+  0x6C, 0x65, 0x6E, 0x64, 0x4F, 0x70, 0x5F, 0x53, 0x6F, 0x75, 0x72, 0x63, 
+  0x65, 0x3A, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 0x72, 
+  0x63, 0x3B, 0x0A, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x42, 0x6C, 
+  0x65, 0x6E, 0x64, 0x4F, 0x70, 0x5F, 0x4F, 0x76, 0x65, 0x72, 0x3A, 0x20, 
+  0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 0x72, 0x63, 0x20, 0x2B, 
+  0x20, 0x64, 0x65, 0x73, 0x74, 0x20, 0x2A, 0x20, 0x28, 0x31, 0x2E, 0x30, 
+  0x20, 0x2D, 0x20, 0x73, 0x72, 0x63, 0x2E, 0x61, 0x29, 0x3B, 0x0A, 0x20, 
+  0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x42, 0x6C, 0x65, 0x6E, 0x64, 0x4F, 
+  0x70, 0x5F, 0x49, 0x6E, 0x3A, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+  0x20, 0x73, 0x72, 0x63, 0x20, 0x2A, 0x20, 0x64, 0x65, 0x73, 0x74, 0x2E, 
+  0x61, 0x3B, 0x0A, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x42, 0x6C, 
+  0x65, 0x6E, 0x64, 0x4F, 0x70, 0x5F, 0x4F, 0x75, 0x74, 0x3A, 0x20, 0x72, 
+  0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 0x72, 0x63, 0x20, 0x2A, 0x20, 
+  0x28, 0x31, 0x2E, 0x30, 0x20, 0x2D, 0x20, 0x64, 0x65, 0x73, 0x74, 0x2E, 
+  0x61, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x42, 
+  0x6C, 0x65, 0x6E, 0x64, 0x4F, 0x70, 0x5F, 0x41, 0x74, 0x6F, 0x70, 0x3A, 
+  0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 0x72, 0x63, 0x20, 
+  0x2A, 0x20, 0x64, 0x65, 0x73, 0x74, 0x2E, 0x61, 0x20, 0x2B, 0x20, 0x64, 
+  0x65, 0x73, 0x74, 0x20, 0x2A, 0x20, 0x28, 0x31, 0x2E, 0x30, 0x20, 0x2D, 
+  0x20, 0x73, 0x72, 0x63, 0x2E, 0x61, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x63, 
+  0x61, 0x73, 0x65, 0x20, 0x42, 0x6C, 0x65, 0x6E, 0x64, 0x4F, 0x70, 0x5F, 
+  0x44, 0x65, 0x73, 0x74, 0x4F, 0x76, 0x65, 0x72, 0x3A, 0x20, 0x72, 0x65, 
+  0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 0x72, 0x63, 0x20, 0x2A, 0x20, 0x28, 
+  0x31, 0x2E, 0x30, 0x20, 0x2D, 0x20, 0x64, 0x65, 0x73, 0x74, 0x2E, 0x61, 
+  0x29, 0x20, 0x2B, 0x20, 0x64, 0x65, 0x73, 0x74, 0x3B, 0x0A, 0x20, 0x20, 
+  0x63, 0x61, 0x73, 0x65, 0x20, 0x42, 0x6C, 0x65, 0x6E, 0x64, 0x4F, 0x70, 
+  0x5F, 0x44, 0x65, 0x73, 0x74, 0x49, 0x6E, 0x3A, 0x20, 0x72, 0x65, 0x74, 
+  0x75, 0x72, 0x6E, 0x20, 0x64, 0x65, 0x73, 0x74, 0x20, 0x2A, 0x20, 0x73, 
+  0x72, 0x63, 0x2E, 0x61, 0x3B, 0x0A, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 
+  0x20, 0x42, 0x6C, 0x65, 0x6E, 0x64, 0x4F, 0x70, 0x5F, 0x44, 0x65, 0x73, 
+  0x74, 0x4F, 0x75, 0x74, 0x3A, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+  0x20, 0x64, 0x65, 0x73, 0x74, 0x20, 0x2A, 0x20, 0x28, 0x31, 0x2E, 0x30, 
+  0x20, 0x2D, 0x20, 0x73, 0x72, 0x63, 0x2E, 0x61, 0x29, 0x3B, 0x0A, 0x20, 
+  0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x42, 0x6C, 0x65, 0x6E, 0x64, 0x4F, 
+  0x70, 0x5F, 0x44, 0x65, 0x73, 0x74, 0x41, 0x74, 0x6F, 0x70, 0x3A, 0x20, 
+  0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 0x72, 0x63, 0x20, 0x2A, 
+  0x20, 0x28, 0x31, 0x2E, 0x30, 0x20, 0x2D, 0x20, 0x64, 0x65, 0x73, 0x74, 
+  0x2E, 0x61, 0x29, 0x20, 0x2B, 0x20, 0x64, 0x65, 0x73, 0x74, 0x20, 0x2A, 
+  0x20, 0x73, 0x72, 0x63, 0x2E, 0x61, 0x3B, 0x0A, 0x20, 0x20, 0x63, 0x61, 
+  0x73, 0x65, 0x20, 0x42, 0x6C, 0x65, 0x6E, 0x64, 0x4F, 0x70, 0x5F, 0x58, 
+  0x4F, 0x52, 0x3A, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 
+  0x61, 0x74, 0x75, 0x72, 0x61, 0x74, 0x65, 0x28, 0x73, 0x72, 0x63, 0x20, 
+  0x2A, 0x20, 0x28, 0x31, 0x2E, 0x30, 0x20, 0x2D, 0x20, 0x64, 0x65, 0x73, 
+  0x74, 0x2E, 0x61, 0x29, 0x20, 0x2B, 0x20, 0x64, 0x65, 0x73, 0x74, 0x20, 
+  0x2A, 0x20, 0x28, 0x31, 0x2E, 0x30, 0x20, 0x2D, 0x20, 0x73, 0x72, 0x63, 
+  0x2E, 0x61, 0x29, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 
+  0x20, 0x42, 0x6C, 0x65, 0x6E, 0x64, 0x4F, 0x70, 0x5F, 0x44, 0x61, 0x72, 
+  0x6B, 0x65, 0x6E, 0x3A, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+  0x66, 0x6C, 0x6F, 0x61, 0x74, 0x34, 0x28, 0x6D, 0x69, 0x6E, 0x28, 0x73, 
+  0x72, 0x63, 0x2E, 0x72, 0x67, 0x62, 0x2C, 0x20, 0x64, 0x65, 0x73, 0x74, 
+  0x2E, 0x72, 0x67, 0x62, 0x29, 0x20, 0x2A, 0x20, 0x73, 0x72, 0x63, 0x2E, 
+  0x61, 0x2C, 0x20, 0x64, 0x65, 0x73, 0x74, 0x2E, 0x61, 0x20, 0x2A, 0x20, 
+  0x73, 0x72, 0x63, 0x2E, 0x61, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x63, 0x61, 
+  0x73, 0x65, 0x20, 0x42, 0x6C, 0x65, 0x6E, 0x64, 0x4F, 0x70, 0x5F, 0x41, 
+  0x64, 0x64, 0x3A, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 
+  0x61, 0x74, 0x75, 0x72, 0x61, 0x74, 0x65, 0x28, 0x73, 0x72, 0x63, 0x20, 
+  0x2B, 0x20, 0x64, 0x65, 0x73, 0x74, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x63, 
+  0x61, 0x73, 0x65, 0x20, 0x42, 0x6C, 0x65, 0x6E, 0x64, 0x4F, 0x70, 0x5F, 
+  0x44, 0x69, 0x66, 0x66, 0x65, 0x72, 0x65, 0x6E, 0x63, 0x65, 0x3A, 0x20, 
+  0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 
+  0x34, 0x28, 0x61, 0x62, 0x73, 0x28, 0x64, 0x65, 0x73, 0x74, 0x2E, 0x72, 
+  0x67, 0x62, 0x20, 0x2D, 0x20, 0x73, 0x72, 0x63, 0x2E, 0x72, 0x67, 0x62, 
+  0x29, 0x20, 0x2A, 0x20, 0x73, 0x72, 0x63, 0x2E, 0x61, 0x2C, 0x20, 0x64, 
+  0x65, 0x73, 0x74, 0x2E, 0x61, 0x20, 0x2A, 0x20, 0x73, 0x72, 0x63, 0x2E, 
+  0x61, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x42, 
+  0x6C, 0x65, 0x6E, 0x64, 0x4F, 0x70, 0x5F, 0x4D, 0x75, 0x6C, 0x74, 0x69, 
+  0x70, 0x6C, 0x79, 0x3A, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+  0x66, 0x6C, 0x6F, 0x61, 0x74, 0x34, 0x28, 0x73, 0x72, 0x63, 0x2E, 0x72, 
+  0x67, 0x62, 0x20, 0x2A, 0x20, 0x64, 0x65, 0x73, 0x74, 0x2E, 0x72, 0x67, 
+  0x62, 0x20, 0x2A, 0x20, 0x73, 0x72, 0x63, 0x2E, 0x61, 0x2C, 0x20, 0x64, 
+  0x65, 0x73, 0x74, 0x2E, 0x61, 0x20, 0x2A, 0x20, 0x73, 0x72, 0x63, 0x2E, 
+  0x61, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x42, 
+  0x6C, 0x65, 0x6E, 0x64, 0x4F, 0x70, 0x5F, 0x53, 0x63, 0x72, 0x65, 0x65, 
+  0x6E, 0x3A, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x6C, 
+  0x6F, 0x61, 0x74, 0x34, 0x28, 0x28, 0x31, 0x2E, 0x30, 0x20, 0x2D, 0x20, 
+  0x28, 0x28, 0x31, 0x2E, 0x30, 0x20, 0x2D, 0x20, 0x64, 0x65, 0x73, 0x74, 
+  0x2E, 0x72, 0x67, 0x62, 0x29, 0x20, 0x2A, 0x20, 0x28, 0x31, 0x2E, 0x30, 
+  0x20, 0x2D, 0x20, 0x73, 0x72, 0x63, 0x2E, 0x72, 0x67, 0x62, 0x29, 0x29, 
+  0x29, 0x20, 0x2A, 0x20, 0x73, 0x72, 0x63, 0x2E, 0x61, 0x2C, 0x20, 0x64, 
+  0x65, 0x73, 0x74, 0x2E, 0x61, 0x20, 0x2A, 0x20, 0x73, 0x72, 0x63, 0x2E, 
+  0x61, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x42, 
+  0x6C, 0x65, 0x6E, 0x64, 0x4F, 0x70, 0x5F, 0x4F, 0x76, 0x65, 0x72, 0x6C, 
+  0x61, 0x79, 0x3A, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 
+  0x6C, 0x6F, 0x61, 0x74, 0x34, 0x28, 0x62, 0x6C, 0x65, 0x6E, 0x64, 0x4F, 
+  0x76, 0x65, 0x72, 0x6C, 0x61, 0x79, 0x28, 0x73, 0x72, 0x63, 0x2E, 0x72, 
+  0x67, 0x62, 0x2C, 0x20, 0x64, 0x65, 0x73, 0x74, 0x2E, 0x72, 0x67, 0x62, 
+  0x29, 0x20, 0x2A, 0x20, 0x73, 0x72, 0x63, 0x2E, 0x61, 0x2C, 0x20, 0x64, 
+  0x65, 0x73, 0x74, 0x2E, 0x61, 0x20, 0x2A, 0x20, 0x73, 0x72, 0x63, 0x2E, 
+  0x61, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x42, 
+  0x6C, 0x65, 0x6E, 0x64, 0x4F, 0x70, 0x5F, 0x4C, 0x69, 0x67, 0x68, 0x74, 
+  0x65, 0x6E, 0x3A, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 
+  0x6C, 0x6F, 0x61, 0x74, 0x34, 0x28, 0x6D, 0x61, 0x78, 0x28, 0x73, 0x72, 
+  0x63, 0x2E, 0x72, 0x67, 0x62, 0x2C, 0x20, 0x64, 0x65, 0x73, 0x74, 0x2E, 
+  0x72, 0x67, 0x62, 0x29, 0x20, 0x2A, 0x20, 0x73, 0x72, 0x63, 0x2E, 0x61, 
+  0x2C, 0x20, 0x64, 0x65, 0x73, 0x74, 0x2E, 0x61, 0x20, 0x2A, 0x20, 0x73, 
+  0x72, 0x63, 0x2E, 0x61, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x63, 0x61, 0x73, 
+  0x65, 0x20, 0x42, 0x6C, 0x65, 0x6E, 0x64, 0x4F, 0x70, 0x5F, 0x43, 0x6F, 
+  0x6C, 0x6F, 0x72, 0x44, 0x6F, 0x64, 0x67, 0x65, 0x3A, 0x20, 0x72, 0x65, 
+  0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x34, 0x28, 
+  0x62, 0x6C, 0x65, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x44, 0x6F, 
+  0x64, 0x67, 0x65, 0x28, 0x73, 0x72, 0x63, 0x2E, 0x72, 0x67, 0x62, 0x2C, 
+  0x20, 0x64, 0x65, 0x73, 0x74, 0x2E, 0x72, 0x67, 0x62, 0x29, 0x20, 0x2A, 
+  0x20, 0x73, 0x72, 0x63, 0x2E, 0x61, 0x2C, 0x20, 0x64, 0x65, 0x73, 0x74, 
+  0x2E, 0x61, 0x20, 0x2A, 0x20, 0x73, 0x72, 0x63, 0x2E, 0x61, 0x29, 0x3B, 
+  0x0A, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x42, 0x6C, 0x65, 0x6E, 
+  0x64, 0x4F, 0x70, 0x5F, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x42, 0x75, 0x72, 
+  0x6E, 0x3A, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x6C, 
+  0x6F, 0x61, 0x74, 0x34, 0x28, 0x62, 0x6C, 0x65, 0x6E, 0x64, 0x43, 0x6F, 
+  0x6C, 0x6F, 0x72, 0x42, 0x75, 0x72, 0x6E, 0x28, 0x73, 0x72, 0x63, 0x2E, 
+  0x72, 0x67, 0x62, 0x2C, 0x20, 0x64, 0x65, 0x73, 0x74, 0x2E, 0x72, 0x67, 
+  0x62, 0x29, 0x20, 0x2A, 0x20, 0x73, 0x72, 0x63, 0x2E, 0x61, 0x2C, 0x20, 
+  0x64, 0x65, 0x73, 0x74, 0x2E, 0x61, 0x20, 0x2A, 0x20, 0x73, 0x72, 0x63, 
+  0x2E, 0x61, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 
+  0x42, 0x6C, 0x65, 0x6E, 0x64, 0x4F, 0x70, 0x5F, 0x48, 0x61, 0x72, 0x64, 
+  0x4C, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 
+  0x6E, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x34, 0x28, 0x62, 0x6C, 0x65, 
+  0x6E, 0x64, 0x4F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x79, 0x28, 0x64, 0x65, 
+  0x73, 0x74, 0x2E, 0x72, 0x67, 0x62, 0x2C, 0x20, 0x73, 0x72, 0x63, 0x2E, 
+  0x72, 0x67, 0x62, 0x29, 0x20, 0x2A, 0x20, 0x73, 0x72, 0x63, 0x2E, 0x61, 
+  0x2C, 0x20, 0x64, 0x65, 0x73, 0x74, 0x2E, 0x61, 0x20, 0x2A, 0x20, 0x73, 
+  0x72, 0x63, 0x2E, 0x61, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x63, 0x61, 0x73, 
+  0x65, 0x20, 0x42, 0x6C, 0x65, 0x6E, 0x64, 0x4F, 0x70, 0x5F, 0x53, 0x6F, 
+  0x66, 0x74, 0x4C, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20, 0x72, 0x65, 0x74, 
+  0x75, 0x72, 0x6E, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x34, 0x28, 0x62, 
+  0x6C, 0x65, 0x6E, 0x64, 0x53, 0x6F, 0x66, 0x74, 0x4C, 0x69, 0x67, 0x68, 
+  0x74, 0x28, 0x73, 0x72, 0x63, 0x2E, 0x72, 0x67, 0x62, 0x2C, 0x20, 0x64, 
+  0x65, 0x73, 0x74, 0x2E, 0x72, 0x67, 0x62, 0x29, 0x20, 0x2A, 0x20, 0x73, 
+  0x72, 0x63, 0x2E, 0x61, 0x2C, 0x20, 0x64, 0x65, 0x73, 0x74, 0x2E, 0x61, 
+  0x20, 0x2A, 0x20, 0x73, 0x72, 0x63, 0x2E, 0x61, 0x29, 0x3B, 0x0A, 0x20, 
+  0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x42, 0x6C, 0x65, 0x6E, 0x64, 0x4F, 
+  0x70, 0x5F, 0x45, 0x78, 0x63, 0x6C, 0x75, 0x73, 0x69, 0x6F, 0x6E, 0x3A, 
+  0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x6C, 0x6F, 0x61, 
+  0x74, 0x34, 0x28, 0x28, 0x64, 0x65, 0x73, 0x74, 0x2E, 0x72, 0x67, 0x62, 
+  0x20, 0x2B, 0x20, 0x73, 0x72, 0x63, 0x2E, 0x72, 0x67, 0x62, 0x20, 0x2D, 
+  0x20, 0x32, 0x2E, 0x30, 0x20, 0x2A, 0x20, 0x64, 0x65, 0x73, 0x74, 0x2E, 
+  0x72, 0x67, 0x62, 0x20, 0x2A, 0x20, 0x73, 0x72, 0x63, 0x2E, 0x72, 0x67, 
+  0x62, 0x29, 0x20, 0x2A, 0x20, 0x73, 0x72, 0x63, 0x2E, 0x61, 0x2C, 0x20, 
+  0x64, 0x65, 0x73, 0x74, 0x2E, 0x61, 0x20, 0x2A, 0x20, 0x73, 0x72, 0x63, 
+  0x2E, 0x61, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 
+  0x42, 0x6C, 0x65, 0x6E, 0x64, 0x4F, 0x70, 0x5F, 0x48, 0x75, 0x65, 0x3A, 
+  0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x6C, 0x6F, 0x61, 
+  0x74, 0x34, 0x28, 0x62, 0x6C, 0x65, 0x6E, 0x64, 0x48, 0x75, 0x65, 0x28, 
+  0x73, 0x72, 0x63, 0x2E, 0x72, 0x67, 0x62, 0x2C, 0x20, 0x64, 0x65, 0x73, 
+  0x74, 0x2E, 0x72, 0x67, 0x62, 0x29, 0x20, 0x2A, 0x20, 0x73, 0x72, 0x63, 
+  0x2E, 0x61, 0x2C, 0x20, 0x64, 0x65, 0x73, 0x74, 0x2E, 0x61, 0x20, 0x2A, 
+  0x20, 0x73, 0x72, 0x63, 0x2E, 0x61, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x63, 
+  0x61, 0x73, 0x65, 0x20, 0x42, 0x6C, 0x65, 0x6E, 0x64, 0x4F, 0x70, 0x5F, 
+  0x53, 0x61, 0x74, 0x75, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 
+  0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 
+  0x34, 0x28, 0x62, 0x6C, 0x65, 0x6E, 0x64, 0x53, 0x61, 0x74, 0x75, 0x72, 
+  0x61, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x73, 0x72, 0x63, 0x2E, 0x72, 0x67, 
+  0x62, 0x2C, 0x20, 0x64, 0x65, 0x73, 0x74, 0x2E, 0x72, 0x67, 0x62, 0x29, 
+  0x20, 0x2A, 0x20, 0x73, 0x72, 0x63, 0x2E, 0x61, 0x2C, 0x20, 0x64, 0x65, 
+  0x73, 0x74, 0x2E, 0x61, 0x20, 0x2A, 0x20, 0x73, 0x72, 0x63, 0x2E, 0x61, 
+  0x29, 0x3B, 0x0A, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x42, 0x6C, 
+  0x65, 0x6E, 0x64, 0x4F, 0x70, 0x5F, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 
+  0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x6C, 0x6F, 0x61, 
+  0x74, 0x34, 0x28, 0x62, 0x6C, 0x65, 0x6E, 0x64, 0x43, 0x6F, 0x6C, 0x6F, 
+  0x72, 0x28, 0x73, 0x72, 0x63, 0x2E, 0x72, 0x67, 0x62, 0x2C, 0x20, 0x64, 
+  0x65, 0x73, 0x74, 0x2E, 0x72, 0x67, 0x62, 0x29, 0x20, 0x2A, 0x20, 0x73, 
+  0x72, 0x63, 0x2E, 0x61, 0x2C, 0x20, 0x64, 0x65, 0x73, 0x74, 0x2E, 0x61, 
+  0x20, 0x2A, 0x20, 0x73, 0x72, 0x63, 0x2E, 0x61, 0x29, 0x3B, 0x0A, 0x20, 
+  0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x42, 0x6C, 0x65, 0x6E, 0x64, 0x4F, 
+  0x70, 0x5F, 0x4C, 0x75, 0x6D, 0x69, 0x6E, 0x6F, 0x73, 0x69, 0x74, 0x79, 
+  0x3A, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x6C, 0x6F, 
+  0x61, 0x74, 0x34, 0x28, 0x62, 0x6C, 0x65, 0x6E, 0x64, 0x4C, 0x75, 0x6D, 
+  0x69, 0x6E, 0x6F, 0x73, 0x69, 0x74, 0x79, 0x28, 0x73, 0x72, 0x63, 0x2E, 
+  0x72, 0x67, 0x62, 0x2C, 0x20, 0x64, 0x65, 0x73, 0x74, 0x2E, 0x72, 0x67, 
+  0x62, 0x29, 0x20, 0x2A, 0x20, 0x73, 0x72, 0x63, 0x2E, 0x61, 0x2C, 0x20, 
+  0x64, 0x65, 0x73, 0x74, 0x2E, 0x61, 0x20, 0x2A, 0x20, 0x73, 0x72, 0x63, 
+  0x2E, 0x61, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 
+  0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 0x72, 0x63, 0x3B, 0x0A, 
+  0x7D, 0x0A, 0x0A, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x34, 0x20, 0x66, 0x69, 
+  0x6C, 0x6C, 0x4D, 0x61, 0x73, 0x6B, 0x28, 0x56, 0x53, 0x5F, 0x4F, 0x55, 
+  0x54, 0x50, 0x55, 0x54, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x29, 0x20, 
+  0x7B, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x34, 0x20, 0x63, 
+  0x6F, 0x6C, 0x20, 0x3D, 0x20, 0x66, 0x69, 0x6C, 0x6C, 0x49, 0x6D, 0x61, 
+  0x67, 0x65, 0x28, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x29, 0x3B, 0x0A, 0x20, 
+  0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x61, 0x6C, 0x70, 0x68, 0x61, 
+  0x20, 0x3D, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x31, 0x2E, 
+  0x53, 0x61, 0x6D, 0x70, 0x6C, 0x65, 0x28, 0x73, 0x61, 0x6D, 0x70, 0x6C, 
+  0x65, 0x72, 0x30, 0x2C, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2E, 0x4F, 
+  0x62, 0x6A, 0x65, 0x63, 0x74, 0x43, 0x6F, 0x6F, 0x72, 0x64, 0x29, 0x2E, 
+  0x61, 0x3B, 0x0A, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+  0x66, 0x6C, 0x6F, 0x61, 0x74, 0x34, 0x28, 0x63, 0x6F, 0x6C, 0x2E, 0x72, 
+  0x67, 0x62, 0x20, 0x2A, 0x20, 0x61, 0x6C, 0x70, 0x68, 0x61, 0x2C, 0x20, 
+  0x63, 0x6F, 0x6C, 0x2E, 0x61, 0x20, 0x2A, 0x20, 0x61, 0x6C, 0x70, 0x68, 
+  0x61, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 0x0A, 0x66, 0x6C, 0x6F, 0x61, 0x74, 
+  0x34, 0x20, 0x47, 0x65, 0x74, 0x43, 0x6F, 0x6C, 0x28, 0x69, 0x6E, 0x20, 
+  0x6D, 0x61, 0x74, 0x72, 0x69, 0x78, 0x20, 0x6D, 0x2C, 0x20, 0x75, 0x69, 
+  0x6E, 0x74, 0x20, 0x69, 0x29, 0x20, 0x7B, 0x20, 0x72, 0x65, 0x74, 0x75, 
+  0x72, 0x6E, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x34, 0x28, 0x6D, 0x5B, 
+  0x30, 0x5D, 0x5B, 0x69, 0x5D, 0x2C, 0x20, 0x6D, 0x5B, 0x31, 0x5D, 0x5B, 
+  0x69, 0x5D, 0x2C, 0x20, 0x6D, 0x5B, 0x32, 0x5D, 0x5B, 0x69, 0x5D, 0x2C, 
+  0x20, 0x6D, 0x5B, 0x33, 0x5D, 0x5B, 0x69, 0x5D, 0x29, 0x3B, 0x20, 0x7D, 
+  0x0A, 0x0A, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x20, 0x56, 0x49, 
+  0x53, 0x55, 0x41, 0x4C, 0x49, 0x5A, 0x45, 0x5F, 0x43, 0x4C, 0x49, 0x50, 
+  0x20, 0x30, 0x0A, 0x0A, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x61, 0x70, 0x70, 
+  0x6C, 0x79, 0x43, 0x6C, 0x69, 0x70, 0x28, 0x56, 0x53, 0x5F, 0x4F, 0x55, 
+  0x54, 0x50, 0x55, 0x54, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2C, 0x20, 
+  0x69, 0x6E, 0x6F, 0x75, 0x74, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x34, 
+  0x20, 0x6F, 0x75, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x29, 0x20, 0x7B, 
+  0x0A, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x75, 0x69, 0x6E, 0x74, 
+  0x20, 0x69, 0x20, 0x3D, 0x20, 0x30, 0x3B, 0x20, 0x69, 0x20, 0x3C, 0x20, 
+  0x43, 0x6C, 0x69, 0x70, 0x53, 0x69, 0x7A, 0x65, 0x3B, 0x20, 0x69, 0x2B, 
+  0x2B, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x74, 
+  0x72, 0x69, 0x78, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x3D, 0x20, 0x43, 
+  0x6C, 0x69, 0x70, 0x5B, 0x69, 0x5D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+  0x66, 0x6C, 0x6F, 0x61, 0x74, 0x32, 0x20, 0x6F, 0x72, 0x69, 0x67, 0x69, 
+  0x6E, 0x20, 0x3D, 0x20, 0x47, 0x65, 0x74, 0x43, 0x6F, 0x6C, 0x28, 0x64, 
+  0x61, 0x74, 0x61, 0x2C, 0x20, 0x30, 0x29, 0x2E, 0x78, 0x79, 0x3B, 0x0A, 
+  0x20, 0x20, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x32, 0x20, 0x73, 
+  0x69, 0x7A, 0x65, 0x20, 0x3D, 0x20, 0x47, 0x65, 0x74, 0x43, 0x6F, 0x6C, 
+  0x28, 0x64, 0x61, 0x74, 0x61, 0x2C, 0x20, 0x30, 0x29, 0x2E, 0x7A, 0x77, 
+  0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x34, 
+  0x20, 0x72, 0x61, 0x64, 0x69, 0x69, 0x5F, 0x78, 0x2C, 0x20, 0x72, 0x61, 
+  0x64, 0x69, 0x69, 0x5F, 0x79, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x55, 
+  0x6E, 0x70, 0x61, 0x63, 0x6B, 0x28, 0x47, 0x65, 0x74, 0x43, 0x6F, 0x6C, 
+  0x28, 0x64, 0x61, 0x74, 0x61, 0x2C, 0x20, 0x31, 0x29, 0x2C, 0x20, 0x72, 
+  0x61, 0x64, 0x69, 0x69, 0x5F, 0x78, 0x2C, 0x20, 0x72, 0x61, 0x64, 0x69, 
+  0x69, 0x5F, 0x79, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 
+  0x6F, 0x6C, 0x20, 0x69, 0x6E, 0x76, 0x65, 0x72, 0x73, 0x65, 0x20, 0x3D, 
+  0x20, 0x62, 0x6F, 0x6F, 0x6C, 0x28, 0x47, 0x65, 0x74, 0x43, 0x6F, 0x6C, 
+  0x28, 0x64, 0x61, 0x74, 0x61, 0x2C, 0x20, 0x33, 0x29, 0x2E, 0x7A, 0x29, 
+  0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 
+  0x32, 0x20, 0x70, 0x20, 0x3D, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2E, 
+  0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x43, 0x6F, 0x6F, 0x72, 0x64, 0x3B, 
+  0x0A, 0x20, 0x20, 0x20, 0x20, 0x70, 0x20, 0x3D, 0x20, 0x74, 0x72, 0x61, 
+  0x6E, 0x73, 0x66, 0x6F, 0x72, 0x6D, 0x41, 0x66, 0x66, 0x69, 0x6E, 0x65, 
+  0x28, 0x70, 0x2C, 0x20, 0x47, 0x65, 0x74, 0x43, 0x6F, 0x6C, 0x28, 0x64, 
+  0x61, 0x74, 0x61, 0x2C, 0x20, 0x32, 0x29, 0x2E, 0x78, 0x79, 0x2C, 0x20, 
+  0x47, 0x65, 0x74, 0x43, 0x6F, 0x6C, 0x28, 0x64, 0x61, 0x74, 0x61, 0x2C, 
+  0x20, 0x32, 0x29, 0x2E, 0x7A, 0x77, 0x2C, 0x20, 0x47, 0x65, 0x74, 0x43, 
+  0x6F, 0x6C, 0x28, 0x64, 0x61, 0x74, 0x61, 0x2C, 0x20, 0x33, 0x29, 0x2E, 
+  0x78, 0x79, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x70, 0x20, 0x2D, 
+  0x3D, 0x20, 0x6F, 0x72, 0x69, 0x67, 0x69, 0x6E, 0x3B, 0x0A, 0x20, 0x20, 
+  0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x64, 0x5F, 0x63, 0x6C, 
+  0x69, 0x70, 0x20, 0x3D, 0x20, 0x73, 0x64, 0x52, 0x6F, 0x75, 0x6E, 0x64, 
+  0x52, 0x65, 0x63, 0x74, 0x28, 0x70, 0x2C, 0x20, 0x73, 0x69, 0x7A, 0x65, 
+  0x2C, 0x20, 0x72, 0x61, 0x64, 0x69, 0x69, 0x5F, 0x78, 0x2C, 0x20, 0x72, 
+  0x61, 0x64, 0x69, 0x69, 0x5F, 0x79, 0x29, 0x20, 0x2A, 0x20, 0x28, 0x69, 
+  0x6E, 0x76, 0x65, 0x72, 0x73, 0x65, 0x20, 0x3F, 0x20, 0x2D, 0x31, 0x2E, 
+  0x30, 0x20, 0x3A, 0x20, 0x31, 0x2E, 0x30, 0x29, 0x3B, 0x0A, 0x0A, 0x23, 
+  0x69, 0x66, 0x20, 0x56, 0x49, 0x53, 0x55, 0x41, 0x4C, 0x49, 0x5A, 0x45, 
+  0x5F, 0x43, 0x4C, 0x49, 0x50, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 
+  0x20, 0x28, 0x61, 0x62, 0x73, 0x28, 0x64, 0x5F, 0x63, 0x6C, 0x69, 0x70, 
+  0x29, 0x20, 0x3C, 0x20, 0x33, 0x2E, 0x30, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+  0x20, 0x20, 0x20, 0x6F, 0x75, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 
+  0x3D, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x34, 0x28, 0x30, 0x2E, 0x39, 
+  0x2C, 0x20, 0x31, 0x2E, 0x30, 0x2C, 0x20, 0x30, 0x2E, 0x30, 0x2C, 0x20, 
+  0x31, 0x2E, 0x30, 0x29, 0x3B, 0x0A, 0x23, 0x65, 0x6C, 0x73, 0x65, 0x0A, 
+  0x20, 0x20, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x61, 0x6C, 
+  0x70, 0x68, 0x61, 0x20, 0x3D, 0x20, 0x61, 0x6E, 0x74, 0x69, 0x61, 0x6C, 
+  0x69, 0x61, 0x73, 0x32, 0x28, 0x2D, 0x64, 0x5F, 0x63, 0x6C, 0x69, 0x70, 
+  0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6F, 0x75, 0x74, 0x43, 0x6F, 
+  0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x34, 
+  0x28, 0x6F, 0x75, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x2E, 0x72, 0x67, 
+  0x62, 0x20, 0x2A, 0x20, 0x61, 0x6C, 0x70, 0x68, 0x61, 0x2C, 0x20, 0x6F, 
+  0x75, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x2E, 0x61, 0x20, 0x2A, 0x20, 
+  0x61, 0x6C, 0x70, 0x68, 0x61, 0x29, 0x3B, 0x0A, 0x23, 0x65, 0x6E, 0x64, 
+  0x69, 0x66, 0x0A, 0x20, 0x20, 0x7D, 0x0A, 0x7D, 0x0A, 0x0A, 0x66, 0x6C, 
+  0x6F, 0x61, 0x74, 0x34, 0x20, 0x66, 0x69, 0x6C, 0x6C, 0x47, 0x6C, 0x79, 
+  0x70, 0x68, 0x28, 0x56, 0x53, 0x5F, 0x4F, 0x55, 0x54, 0x50, 0x55, 0x54, 
+  0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 
+  0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x61, 0x6C, 0x70, 0x68, 0x61, 0x20, 
+  0x3D, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x30, 0x2E, 0x53, 
+  0x61, 0x6D, 0x70, 0x6C, 0x65, 0x28, 0x73, 0x61, 0x6D, 0x70, 0x6C, 0x65, 
+  0x72, 0x30, 0x2C, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2E, 0x54, 0x65, 
+  0x78, 0x43, 0x6F, 0x6F, 0x72, 0x64, 0x29, 0x2E, 0x61, 0x20, 0x2A, 0x20, 
+  0x69, 0x6E, 0x70, 0x75, 0x74, 0x2E, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x2E, 
+  0x61, 0x3B, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x20, 0x66, 
+  0x69, 0x6C, 0x6C, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x5F, 0x6C, 0x75, 
+  0x6D, 0x61, 0x20, 0x3D, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2E, 0x44, 
+  0x61, 0x74, 0x61, 0x30, 0x2E, 0x79, 0x3B, 0x0A, 0x20, 0x20, 0x66, 0x6C, 
+  0x6F, 0x61, 0x74, 0x20, 0x63, 0x6F, 0x72, 0x72, 0x65, 0x63, 0x74, 0x65, 
+  0x64, 0x5F, 0x61, 0x6C, 0x70, 0x68, 0x61, 0x20, 0x3D, 0x20, 0x74, 0x65, 
+  0x78, 0x74, 0x75, 0x72, 0x65, 0x31, 0x2E, 0x53, 0x61, 0x6D, 0x70, 0x6C, 
+  0x65, 0x28, 0x73, 0x61, 0x6D, 0x70, 0x6C, 0x65, 0x72, 0x30, 0x2C, 0x20, 
+  0x66, 0x6C, 0x6F, 0x61, 0x74, 0x32, 0x28, 0x61, 0x6C, 0x70, 0x68, 0x61, 
+  0x2C, 0x20, 0x66, 0x69, 0x6C, 0x6C, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 
+  0x5F, 0x6C, 0x75, 0x6D, 0x61, 0x29, 0x29, 0x2E, 0x61, 0x3B, 0x0A, 0x0A, 
+  0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x6C, 0x6F, 
+  0x61, 0x74, 0x34, 0x28, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2E, 0x43, 0x6F, 
+  0x6C, 0x6F, 0x72, 0x2E, 0x72, 0x67, 0x62, 0x20, 0x2A, 0x20, 0x63, 0x6F, 
+  0x72, 0x72, 0x65, 0x63, 0x74, 0x65, 0x64, 0x5F, 0x61, 0x6C, 0x70, 0x68, 
+  0x61, 0x2C, 0x20, 0x63, 0x6F, 0x72, 0x72, 0x65, 0x63, 0x74, 0x65, 0x64, 
+  0x5F, 0x61, 0x6C, 0x70, 0x68, 0x61, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 0x0A, 
+  0x66, 0x6C, 0x6F, 0x61, 0x74, 0x34, 0x20, 0x50, 0x53, 0x28, 0x56, 0x53, 
+  0x5F, 0x4F, 0x55, 0x54, 0x50, 0x55, 0x54, 0x20, 0x69, 0x6E, 0x70, 0x75, 
+  0x74, 0x29, 0x20, 0x3A, 0x20, 0x53, 0x56, 0x5F, 0x54, 0x61, 0x72, 0x67, 
+  0x65, 0x74, 0x0A, 0x7B, 0x0A, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 
+  0x20, 0x75, 0x69, 0x6E, 0x74, 0x20, 0x46, 0x69, 0x6C, 0x6C, 0x54, 0x79, 
+  0x70, 0x65, 0x5F, 0x53, 0x6F, 0x6C, 0x69, 0x64, 0x20, 0x3D, 0x20, 0x30, 
+  0x75, 0x3B, 0x0A, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x75, 
+  0x69, 0x6E, 0x74, 0x20, 0x46, 0x69, 0x6C, 0x6C, 0x54, 0x79, 0x70, 0x65, 
+  0x5F, 0x49, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x3D, 0x20, 0x31, 0x75, 0x3B, 
+  0x0A, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x75, 0x69, 0x6E, 
+  0x74, 0x20, 0x46, 0x69, 0x6C, 0x6C, 0x54, 0x79, 0x70, 0x65, 0x5F, 0x50, 
+  0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 0x5F, 0x49, 0x6D, 0x61, 0x67, 0x65, 
+  0x20, 0x3D, 0x20, 0x32, 0x75, 0x3B, 0x0A, 0x20, 0x20, 0x63, 0x6F, 0x6E, 
+  0x73, 0x74, 0x20, 0x75, 0x69, 0x6E, 0x74, 0x20, 0x46, 0x69, 0x6C, 0x6C, 
+  0x54, 0x79, 0x70, 0x65, 0x5F, 0x50, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 
+  0x5F, 0x47, 0x72, 0x61, 0x64, 0x69, 0x65, 0x6E, 0x74, 0x20, 0x3D, 0x20, 
+  0x33, 0x75, 0x3B, 0x0A, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 
+  0x75, 0x69, 0x6E, 0x74, 0x20, 0x46, 0x69, 0x6C, 0x6C, 0x54, 0x79, 0x70, 
+  0x65, 0x5F, 0x52, 0x45, 0x53, 0x45, 0x52, 0x56, 0x45, 0x44, 0x5F, 0x31, 
+  0x20, 0x3D, 0x20, 0x34, 0x75, 0x3B, 0x0A, 0x20, 0x20, 0x63, 0x6F, 0x6E, 
+  0x73, 0x74, 0x20, 0x75, 0x69, 0x6E, 0x74, 0x20, 0x46, 0x69, 0x6C, 0x6C, 
+  0x54, 0x79, 0x70, 0x65, 0x5F, 0x52, 0x45, 0x53, 0x45, 0x52, 0x56, 0x45, 
+  0x44, 0x5F, 0x32, 0x20, 0x3D, 0x20, 0x35, 0x75, 0x3B, 0x0A, 0x20, 0x20, 
+  0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x75, 0x69, 0x6E, 0x74, 0x20, 0x46, 
+  0x69, 0x6C, 0x6C, 0x54, 0x79, 0x70, 0x65, 0x5F, 0x52, 0x45, 0x53, 0x45, 
+  0x52, 0x56, 0x45, 0x44, 0x5F, 0x33, 0x20, 0x3D, 0x20, 0x36, 0x75, 0x3B, 
+  0x0A, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x75, 0x69, 0x6E, 
+  0x74, 0x20, 0x46, 0x69, 0x6C, 0x6C, 0x54, 0x79, 0x70, 0x65, 0x5F, 0x52, 
+  0x6F, 0x75, 0x6E, 0x64, 0x65, 0x64, 0x5F, 0x52, 0x65, 0x63, 0x74, 0x20, 
+  0x3D, 0x20, 0x37, 0x75, 0x3B, 0x0A, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 
+  0x74, 0x20, 0x75, 0x69, 0x6E, 0x74, 0x20, 0x46, 0x69, 0x6C, 0x6C, 0x54, 
+  0x79, 0x70, 0x65, 0x5F, 0x42, 0x6F, 0x78, 0x5F, 0x53, 0x68, 0x61, 0x64, 
+  0x6F, 0x77, 0x20, 0x3D, 0x20, 0x38, 0x75, 0x3B, 0x0A, 0x20, 0x20, 0x63, 
+  0x6F, 0x6E, 0x73, 0x74, 0x20, 0x75, 0x69, 0x6E, 0x74, 0x20, 0x46, 0x69, 
+  0x6C, 0x6C, 0x54, 0x79, 0x70, 0x65, 0x5F, 0x42, 0x6C, 0x65, 0x6E, 0x64, 
+  0x20, 0x3D, 0x20, 0x39, 0x75, 0x3B, 0x0A, 0x20, 0x20, 0x63, 0x6F, 0x6E, 
+  0x73, 0x74, 0x20, 0x75, 0x69, 0x6E, 0x74, 0x20, 0x46, 0x69, 0x6C, 0x6C, 
+  0x54, 0x79, 0x70, 0x65, 0x5F, 0x4D, 0x61, 0x73, 0x6B, 0x20, 0x3D, 0x20, 
+  0x31, 0x30, 0x75, 0x3B, 0x0A, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 
+  0x20, 0x75, 0x69, 0x6E, 0x74, 0x20, 0x46, 0x69, 0x6C, 0x6C, 0x54, 0x79, 
+  0x70, 0x65, 0x5F, 0x47, 0x6C, 0x79, 0x70, 0x68, 0x20, 0x3D, 0x20, 0x31, 
+  0x31, 0x75, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 
+  0x34, 0x20, 0x6F, 0x75, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 
+  0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2E, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 
+  0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x20, 
+  0x28, 0x46, 0x69, 0x6C, 0x6C, 0x54, 0x79, 0x70, 0x65, 0x28, 0x69, 0x6E, 
+  0x70, 0x75, 0x74, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 
+  0x63, 0x61, 0x73, 0x65, 0x20, 0x46, 0x69, 0x6C, 0x6C, 0x54, 0x79, 0x70, 
+  0x65, 0x5F, 0x53, 0x6F, 0x6C, 0x69, 0x64, 0x3A, 0x20, 0x6F, 0x75, 0x74, 
+  0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x66, 0x69, 0x6C, 0x6C, 
+  0x53, 0x6F, 0x6C, 0x69, 0x64, 0x28, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x29, 
+  0x3B, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x63, 
+  0x61, 0x73, 0x65, 0x20, 0x46, 0x69, 0x6C, 0x6C, 0x54, 0x79, 0x70, 0x65, 
+  0x5F, 0x49, 0x6D, 0x61, 0x67, 0x65, 0x3A, 0x20, 0x6F, 0x75, 0x74, 0x43, 
+  0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x66, 0x69, 0x6C, 0x6C, 0x49, 
+  0x6D, 0x61, 0x67, 0x65, 0x28, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x29, 0x3B, 
+  0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x63, 0x61, 
+  0x73, 0x65, 0x20, 0x46, 0x69, 0x6C, 0x6C, 0x54, 0x79, 0x70, 0x65, 0x5F, 
+  0x50, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 0x5F, 0x49, 0x6D, 0x61, 0x67, 
+  0x65, 0x3A, 0x20, 0x6F, 0x75, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 
+  0x3D, 0x20, 0x66, 0x69, 0x6C, 0x6C, 0x50, 0x61, 0x74, 0x74, 0x65, 0x72, 
+  0x6E, 0x49, 0x6D, 0x61, 0x67, 0x65, 0x28, 0x69, 0x6E, 0x70, 0x75, 0x74, 
+  0x29, 0x3B, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 
+  0x63, 0x61, 0x73, 0x65, 0x20, 0x46, 0x69, 0x6C, 0x6C, 0x54, 0x79, 0x70, 
+  0x65, 0x5F, 0x50, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 0x5F, 0x47, 0x72, 
+  0x61, 0x64, 0x69, 0x65, 0x6E, 0x74, 0x3A, 0x20, 0x6F, 0x75, 0x74, 0x43, 
+  0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x66, 0x69, 0x6C, 0x6C, 0x50, 
+  0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 0x47, 0x72, 0x61, 0x64, 0x69, 0x65, 
+  0x6E, 0x74, 0x28, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x29, 0x3B, 0x20, 0x62, 
+  0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 
+  0x20, 0x46, 0x69, 0x6C, 0x6C, 0x54, 0x79, 0x70, 0x65, 0x5F, 0x52, 0x6F, 
+  0x75, 0x6E, 0x64, 0x65, 0x64, 0x5F, 0x52, 0x65, 0x63, 0x74, 0x3A, 0x20, 
+  0x6F, 0x75, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x66, 
+  0x69, 0x6C, 0x6C, 0x52, 0x6F, 0x75, 0x6E, 0x64, 0x65, 0x64, 0x52, 0x65, 
+  0x63, 0x74, 0x28, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x29, 0x3B, 0x20, 0x62, 
+  0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 
+  0x20, 0x46, 0x69, 0x6C, 0x6C, 0x54, 0x79, 0x70, 0x65, 0x5F, 0x42, 0x6F, 
+  0x78, 0x5F, 0x53, 0x68, 0x61, 0x64, 0x6F, 0x77, 0x3A, 0x20, 0x6F, 0x75, 
+  0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x66, 0x69, 0x6C, 
+  0x6C, 0x42, 0x6F, 0x78, 0x53, 0x68, 0x61, 0x64, 0x6F, 0x77, 0x28, 0x69, 
+  0x6E, 0x70, 0x75, 0x74, 0x29, 0x3B, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 
+  0x3B, 0x0A, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x46, 0x69, 0x6C, 
+  0x6C, 0x54, 0x79, 0x70, 0x65, 0x5F, 0x42, 0x6C, 0x65, 0x6E, 0x64, 0x3A, 
+  0x20, 0x6F, 0x75, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 
+  0x66, 0x69, 0x6C, 0x6C, 0x42, 0x6C, 0x65, 0x6E, 0x64, 0x28, 0x69, 0x6E, 
+  0x70, 0x75, 0x74, 0x29, 0x3B, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 
+  0x0A, 0x20, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x46, 0x69, 0x6C, 0x6C, 
+  0x54, 0x79, 0x70, 0x65, 0x5F, 0x4D, 0x61, 0x73, 0x6B, 0x3A, 0x20, 0x6F, 
+  0x75, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x66, 0x69, 
+  0x6C, 0x6C, 0x4D, 0x61, 0x73, 0x6B, 0x28, 0x69, 0x6E, 0x70, 0x75, 0x74, 
+  0x29, 0x3B, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 
+  0x63, 0x61, 0x73, 0x65, 0x20, 0x46, 0x69, 0x6C, 0x6C, 0x54, 0x79, 0x70, 
+  0x65, 0x5F, 0x47, 0x6C, 0x79, 0x70, 0x68, 0x3A, 0x20, 0x6F, 0x75, 0x74, 
+  0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x66, 0x69, 0x6C, 0x6C, 
+  0x47, 0x6C, 0x79, 0x70, 0x68, 0x28, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x29, 
+  0x3B, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x0A, 0x20, 0x20, 0x7D, 
+  0x0A, 0x0A, 0x20, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x79, 0x43, 0x6C, 0x69, 
+  0x70, 0x28, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2C, 0x20, 0x6F, 0x75, 0x74, 
+  0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x72, 
+  0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6F, 0x75, 0x74, 0x43, 0x6F, 0x6C, 
+  0x6F, 0x72, 0x3B, 0x0A, 0x7D, 0x0A, 
+};
+unsigned int fill_hlsl_len = 19698;
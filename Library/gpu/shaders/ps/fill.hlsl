@@ -29,7 +29,13 @@ struct VS_OUTPUT
   float2 ObjectCoord : TEXCOORD1;
 };
 
+// Specialized permutations are compiled with FILL_TYPE defined, the switch in PS() then
+// folds away to a single fill function.
+#ifdef FILL_TYPE
+uint FillType(VS_OUTPUT input) { return FILL_TYPE; }
+#else
 uint FillType(VS_OUTPUT input) { return uint(input.Data0.x + 0.5); }
+#endif
 float4 TileRectUV() { return Vector[0]; }
 float2 TileSize() { return Vector[1].zw; }
 float2 PatternTransformA() { return Vector[2].xy; }
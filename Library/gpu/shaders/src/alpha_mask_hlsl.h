@@ -0,0 +1,35 @@
+#pragma once
+
+// Hit test mask shader, see GPUDriverD3D11::UpdateAlphaMask. Compiled with D3DCompile like
+// the composite shader.
+//
+// A fullscreen triangle covers the mask, each output texel is the largest alpha of the
+// CellSize x CellSize block of the source region it stands for.
+static const char alpha_mask_hlsl[] = R"(
+cbuffer AlphaMaskUniforms : register(b0)
+{
+  int4 SourceRect;  // x, y, right, bottom in texels of the bound texture
+  int4 CellSize;
+};
+
+Texture2D source : register(t0);
+
+float4 VS(uint id : SV_VertexID) : SV_POSITION
+{
+  float2 uv = float2((id << 1) & 2, id & 2);
+  return float4(uv.x * 2.0 - 1.0, 1.0 - uv.y * 2.0, 0.0, 1.0);
+}
+
+float PS(float4 pos : SV_POSITION) : SV_Target
+{
+  int2 base = SourceRect.xy + int2(pos.xy) * CellSize.x;
+  int2 limit = SourceRect.zw - 1;
+  float alpha = 0.0;
+
+  for (int y = 0; y < CellSize.x; y++)
+    for (int x = 0; x < CellSize.x; x++)
+      alpha = max(alpha, source.Load(int3(min(base + int2(x, y), limit), 0)).a);
+
+  return alpha;
+}
+)";
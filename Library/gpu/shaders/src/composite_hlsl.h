@@ -0,0 +1,70 @@
+#pragma once
+
+// Overlay compositing shader. It is tiny so we compile it with D3DCompile when the
+// driver first composites instead of shipping a prebuilt fxc blob.
+//
+// The vertex stage expands a unit quad (slot 0) with per-instance rect, uv, transform,
+// opacity and texture slot (slot 1), see CompositeBatch::Instance.
+static const char composite_hlsl[] = R"(
+cbuffer CompositeUniforms : register(b0)
+{
+  float4 ViewportSize;
+};
+
+Texture2D texture0 : register(t0);
+Texture2D texture1 : register(t1);
+Texture2D texture2 : register(t2);
+Texture2D texture3 : register(t3);
+Texture2D texture4 : register(t4);
+Texture2D texture5 : register(t5);
+Texture2D texture6 : register(t6);
+Texture2D texture7 : register(t7);
+SamplerState sampler0 : register(s0);
+
+struct VS_OUTPUT
+{
+  float4 Position                 : SV_POSITION;
+  float2 TexCoord                 : TEXCOORD0;
+  float  Opacity                  : TEXCOORD1;
+  nointerpolation uint TextureSlot : TEXCOORD2;
+};
+
+VS_OUTPUT VS(float2 Corner      : POSITION,
+             float4 Rect        : TEXCOORD0,
+             float4 UV          : TEXCOORD1,
+             float  Opacity     : TEXCOORD2,
+             uint   TextureSlot : TEXCOORD3,
+             float4 Transform   : TEXCOORD4)
+{
+  VS_OUTPUT output;
+  float2 center = (Rect.xy + Rect.zw) * 0.5;
+  float2 offset = lerp(Rect.xy, Rect.zw, Corner) - center;
+  float2 pos = center + float2(dot(Transform.xy, offset), dot(Transform.zw, offset));
+  output.Position = float4(pos.x / ViewportSize.x * 2.0 - 1.0, 1.0 - pos.y / ViewportSize.y * 2.0, 0.0, 1.0);
+  output.TexCoord = lerp(UV.xy, UV.zw, Corner);
+  output.Opacity = Opacity;
+  output.TextureSlot = TextureSlot;
+  return output;
+}
+
+float4 SampleSlot(uint slot, float2 uv)
+{
+  switch (slot)
+  {
+  case 0: return texture0.Sample(sampler0, uv);
+  case 1: return texture1.Sample(sampler0, uv);
+  case 2: return texture2.Sample(sampler0, uv);
+  case 3: return texture3.Sample(sampler0, uv);
+  case 4: return texture4.Sample(sampler0, uv);
+  case 5: return texture5.Sample(sampler0, uv);
+  case 6: return texture6.Sample(sampler0, uv);
+  default: return texture7.Sample(sampler0, uv);
+  }
+}
+
+// View textures are premultiplied so opacity scales every channel.
+float4 PS(VS_OUTPUT input) : SV_Target
+{
+  return SampleSlot(input.TextureSlot, input.TexCoord) * input.Opacity;
+}
+)";
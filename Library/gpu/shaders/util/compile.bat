@@ -9,4 +9,7 @@ bin2header fill.fxc
 bin2header fill_path.fxc
 bin2header v2f_c4f_t2f.fxc
 bin2header v2f_c4f_t2f_t2f_d28f.fxc
+copy ..\ps\fill.hlsl fill.hlsl
+bin2header fill.hlsl
+del fill.hlsl
 del *.fxc
\ No newline at end of file
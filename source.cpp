@@ -16,9 +16,10 @@ int WINAPI wWinMain(
 	settings.developer_name = "deathcrafter";
 	//settings.force_cpu_render = true;
 
+	// Fully transparent pixels are click-through (Settings::alpha_hit_testing), pages no longer
+	// need a barely visible background to take input.
 	Config config;
-	config.user_stylesheet = "html, body { background: #00000001; }";
-	
+
 	auto app = Application::Create(settings, config);
 
 	auto window = Window::Create(app->main_monitor(), 400, 60, false, WS_POPUP);
@@ -0,0 +1,70 @@
+// Times AlphaMask::Update against a plain per-pixel loop, run by hand:
+//
+//   AlphaMaskBenchmark [width height iterations]
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <vector>
+
+#include "gpu/AlphaMask.h"
+
+// What Update computes, one pixel at a time.
+static void ReferenceUpdate(const uint8_t* pixels, uint32_t row_bytes, uint32_t width,
+	uint32_t height, std::vector<uint8_t>& cells)
+{
+	uint32_t cells_x = (width + AlphaMask::kCellSize - 1) / AlphaMask::kCellSize;
+	cells.assign((size_t)cells_x * ((height + AlphaMask::kCellSize - 1) / AlphaMask::kCellSize), 0);
+
+	for (uint32_t y = 0; y < height; y++) {
+		const uint8_t* row = pixels + (size_t)y * row_bytes;
+		uint8_t* out = &cells[(size_t)(y / AlphaMask::kCellSize) * cells_x];
+		for (uint32_t x = 0; x < width; x++) {
+			uint8_t alpha = row[x * 4 + 3];
+			if (alpha > out[x / AlphaMask::kCellSize])
+				out[x / AlphaMask::kCellSize] = alpha;
+		}
+	}
+}
+
+template<typename F>
+static double TimeMs(int iterations, F f)
+{
+	auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < iterations; i++)
+		f();
+	auto end = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::milli>(end - start).count() / iterations;
+}
+
+int main(int argc, char** argv)
+{
+	uint32_t width = argc > 2 ? (uint32_t)atoi(argv[1]) : 1920;
+	uint32_t height = argc > 2 ? (uint32_t)atoi(argv[2]) : 1080;
+	int iterations = argc > 3 ? atoi(argv[3]) : 200;
+
+	std::vector<uint8_t> pixels((size_t)width * height * 4);
+	srand(1);
+	for (auto& byte : pixels)
+		byte = (uint8_t)rand();
+
+	AlphaMask mask;
+	mask.Resize(width, height);
+	double update_ms = TimeMs(iterations, [&] {
+		mask.Update(pixels.data(), width * 4, 0, 0, width, height);
+	});
+
+	std::vector<uint8_t> cells;
+	double reference_ms = TimeMs(iterations, [&] {
+		ReferenceUpdate(pixels.data(), width * 4, width, height, cells);
+	});
+
+	// A 64 x 64 dirty rect, eg, a blinking caret or a hover effect.
+	double dirty_ms = TimeMs(iterations * 10, [&] {
+		mask.Update(pixels.data(), width * 4, 100, 100, 164, 164);
+	});
+
+	double megapixels = (double)width * height / 1e6;
+	printf("%ux%u full update: %.3f ms (%.0f MP/s), per-pixel loop: %.3f ms, 64x64 dirty: %.4f ms\n",
+		width, height, update_ms, megapixels / update_ms * 1000.0, reference_ms, dirty_ms);
+	return 0;
+}
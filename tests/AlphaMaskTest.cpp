@@ -0,0 +1,114 @@
+#include "Test.h"
+
+#include <random>
+#include <vector>
+
+#include "gpu/AlphaMask.h"
+
+// Largest alpha of the cell holding x, y, straight from the pixels.
+static uint8_t CellAlpha(const std::vector<uint8_t>& pixels, uint32_t row_bytes, uint32_t width,
+	uint32_t height, uint32_t x, uint32_t y)
+{
+	uint8_t max_alpha = 0;
+	uint32_t cell_x = x / AlphaMask::kCellSize * AlphaMask::kCellSize;
+	uint32_t cell_y = y / AlphaMask::kCellSize * AlphaMask::kCellSize;
+	for (uint32_t py = cell_y; py < cell_y + AlphaMask::kCellSize && py < height; py++) {
+		for (uint32_t px = cell_x; px < cell_x + AlphaMask::kCellSize && px < width; px++) {
+			uint8_t alpha = pixels[py * row_bytes + px * 4 + 3];
+			if (alpha > max_alpha)
+				max_alpha = alpha;
+		}
+	}
+	return max_alpha;
+}
+
+static bool MatchesPixels(const AlphaMask& mask, const std::vector<uint8_t>& pixels,
+	uint32_t row_bytes, uint8_t threshold)
+{
+	for (uint32_t y = 0; y < mask.height(); y++) {
+		for (uint32_t x = 0; x < mask.width(); x++) {
+			uint8_t alpha = CellAlpha(pixels, row_bytes, mask.width(), mask.height(), x, y);
+			if (mask.Test(x, y, threshold) != (alpha > threshold))
+				return false;
+		}
+	}
+	return true;
+}
+
+TEST(StartsOpaque)
+{
+	AlphaMask mask;
+	mask.Resize(10, 7);
+	CHECK(mask.cells_x() == 3 && mask.cells_y() == 2);
+	CHECK(mask.Test(0, 0, 254));
+	CHECK(mask.Test(9, 6, 254));
+	CHECK(!mask.Test(10, 0, 0));
+	CHECK(!mask.Test(0, 7, 0));
+	CHECK(!mask.Test(-1, 0, 0));
+}
+
+// Odd sizes and padded rows take both the vector and the scalar path.
+TEST(MatchesPixelsFuzz)
+{
+	std::mt19937 random(40);
+
+	for (int round = 0; round < 100; round++) {
+		uint32_t width = random() % 300 + 1;
+		uint32_t height = random() % 200 + 1;
+		uint32_t row_bytes = width * 4 + random() % 3 * 4;
+		std::vector<uint8_t> pixels((size_t)row_bytes * height);
+		for (auto& byte : pixels)
+			byte = random() % 8 == 0 ? (uint8_t)random() : 0;
+
+		AlphaMask mask;
+		mask.Resize(width, height);
+		mask.Update(pixels.data(), row_bytes, 0, 0, width, height);
+		CHECK(MatchesPixels(mask, pixels, row_bytes, 0));
+		CHECK(MatchesPixels(mask, pixels, row_bytes, 100));
+
+		// Clear a random dirty rect and update just that.
+		int left = random() % width, top = random() % height;
+		int right = left + 1 + random() % (width - left);
+		int bottom = top + 1 + random() % (height - top);
+		for (int y = top; y < bottom; y++) {
+			for (int x = left; x < right; x++)
+				pixels[y * row_bytes + x * 4 + 3] = 0;
+		}
+		mask.Update(pixels.data(), row_bytes, left, top, right, bottom);
+		CHECK(MatchesPixels(mask, pixels, row_bytes, 0));
+	}
+}
+
+TEST(UpdateOnlyTouchesDirtyCells)
+{
+	AlphaMask mask;
+	mask.Resize(64, 64);
+	std::vector<uint8_t> pixels(64 * 64 * 4, 0);
+
+	mask.Update(pixels.data(), 64 * 4, 8, 8, 12, 12);
+	CHECK(!mask.Test(8, 8, 0));
+	CHECK(mask.Test(7, 7, 0));
+	CHECK(mask.Test(12, 12, 0));
+	CHECK(mask.updated_cells() == 1);
+
+	// Clamped to the mask, empty rects are ignored.
+	mask.Update(pixels.data(), 64 * 4, -10, -10, 2, 2);
+	CHECK(!mask.Test(0, 0, 0));
+	mask.Update(pixels.data(), 64 * 4, 30, 30, 30, 40);
+	CHECK(mask.Test(30, 30, 0));
+}
+
+TEST(SetCells)
+{
+	AlphaMask mask;
+	mask.Resize(8, 8);
+	uint8_t cells[2 * 3] = { 0, 200, 9, 50, 0, 9 };  // 2 x 2 cells, rows padded to 3 bytes
+	mask.SetCells(cells, 3);
+
+	CHECK(!mask.Test(0, 0, 0));
+	CHECK(mask.Test(4, 0, 100));
+	CHECK(!mask.Test(0, 4, 50));
+	CHECK(mask.Test(0, 4, 49));
+	CHECK(!mask.Test(7, 7, 0));
+	CHECK(mask.updated_cells() == 4);
+}
@@ -0,0 +1,124 @@
+#include "Test.h"
+
+#include <map>
+#include <random>
+#include <vector>
+
+#include "gpu/ArenaAllocator.h"
+
+TEST(AllocatesBestFit)
+{
+	ArenaAllocator arena(100);
+	uint32_t a, b, c, d;
+	CHECK(arena.Allocate(10, a) && a == 0);
+	CHECK(arena.Allocate(20, b) && b == 10);
+	CHECK(arena.Allocate(5, c) && c == 30);
+	CHECK(arena.Allocate(30, d) && d == 35);
+
+	// Free 10 at 0 and 5 at 30, a 4 element request takes the smaller hole.
+	arena.Free(a);
+	arena.Free(c);
+	uint32_t e;
+	CHECK(arena.Allocate(4, e) && e == 30);
+	CHECK(arena.allocation_size(e) == 4);
+	CHECK(arena.allocation_size(31) == 0);
+	CHECK(arena.used() == 20 + 30 + 4);
+
+	CHECK(!arena.Allocate(0, e));
+	CHECK(!arena.Allocate(36, e));
+}
+
+TEST(FreeMergesNeighbours)
+{
+	ArenaAllocator arena(30);
+	uint32_t a, b, c;
+	arena.Allocate(10, a);
+	arena.Allocate(10, b);
+	arena.Allocate(10, c);
+	CHECK(arena.largest_free_block() == 0);
+
+	arena.Free(a);
+	arena.Free(c);
+	CHECK(arena.largest_free_block() == 10);
+	CHECK(arena.fragmentation() == 0.5);
+
+	arena.Free(b);
+	CHECK(arena.largest_free_block() == 30);
+	CHECK(arena.fragmentation() == 0.0);
+	CHECK(arena.allocation_count() == 0);
+
+	// Double and unknown frees are ignored.
+	arena.Free(b);
+	arena.Free(7);
+	CHECK(arena.used() == 0);
+}
+
+TEST(GrowKeepsOffsets)
+{
+	ArenaAllocator arena;
+	uint32_t a;
+	CHECK(!arena.Allocate(1, a));
+
+	arena.Grow(16);
+	CHECK(arena.Allocate(12, a) && a == 0);
+	arena.Grow(8);
+	CHECK(arena.capacity() == 16);
+
+	// The trailing 4 free elements merge with the new space.
+	arena.Grow(32);
+	CHECK(arena.largest_free_block() == 20);
+	uint32_t b;
+	CHECK(arena.Allocate(20, b) && b == 12);
+	CHECK(arena.allocation_size(a) == 12);
+
+	arena.Grow(40);
+	CHECK(arena.largest_free_block() == 8);
+}
+
+TEST(Fuzz)
+{
+	std::mt19937 random(34);
+	ArenaAllocator arena(4096);
+	std::map<uint32_t, uint32_t> live;  // offset -> size
+	uint32_t used = 0;
+
+	for (int step = 0; step < 20000; step++) {
+		if (!live.empty() && random() % 2) {
+			auto i = live.begin();
+			std::advance(i, random() % live.size());
+			arena.Free(i->first);
+			used -= i->second;
+			live.erase(i);
+		}
+		else {
+			uint32_t size = random() % 64 + 1;
+			uint32_t offset;
+			if (!arena.Allocate(size, offset)) {
+				CHECK(arena.largest_free_block() < size);
+				if (arena.capacity() < 65536)
+					arena.Grow(arena.capacity() * 2);
+				continue;
+			}
+
+			CHECK(offset + size <= arena.capacity());
+			auto next = live.lower_bound(offset);
+			if (next != live.end())
+				CHECK(offset + size <= next->first);
+			if (next != live.begin()) {
+				auto prev = std::prev(next);
+				CHECK(prev->first + prev->second <= offset);
+			}
+
+			live[offset] = size;
+			used += size;
+		}
+
+		CHECK(arena.used() == used);
+		CHECK(arena.allocation_count() == live.size());
+		CHECK(arena.largest_free_block() <= arena.capacity() - used);
+	}
+
+	for (auto& i : live)
+		arena.Free(i.first);
+	CHECK(arena.largest_free_block() == arena.capacity());
+}
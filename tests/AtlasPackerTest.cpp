@@ -0,0 +1,251 @@
+#include "Test.h"
+
+#include <algorithm>
+#include <map>
+#include <random>
+
+#include "gpu/AtlasPacker.h"
+#include "gpu/MSAAPolicy.h"
+
+struct Box {
+	uint32_t x, y, width, height;
+};
+
+static bool Overlaps(const Box& a, const Box& b)
+{
+	return a.x < b.x + b.width && b.x < a.x + a.width && a.y < b.y + b.height && b.y < a.y + a.height;
+}
+
+TEST(SkylineFuzz)
+{
+	std::mt19937 random(27);
+
+	for (int round = 0; round < 50; round++) {
+		SkylinePacker packer(512, 512);
+		std::vector<Box> boxes;
+		uint64_t area = 0;
+		uint32_t extent_width = 0, extent_height = 0;
+
+		for (int i = 0; i < 200; i++) {
+			uint32_t width = random() % 96 + 1;
+			uint32_t height = random() % 96 + 1;
+			Box box = { 0, 0, width, height };
+			if (!packer.Insert(width, height, box.x, box.y))
+				continue;
+
+			CHECK(box.x + width <= 512 && box.y + height <= 512);
+			for (auto& other : boxes)
+				CHECK(!Overlaps(box, other));
+
+			boxes.push_back(box);
+			area += (uint64_t)width * height;
+			extent_width = std::max(extent_width, box.x + width);
+			extent_height = std::max(extent_height, box.y + height);
+		}
+
+		CHECK(packer.used_area() == area);
+		CHECK(packer.extent_width() == extent_width);
+		CHECK(packer.extent_height() == extent_height);
+		// Random sizes up to 96 px should still fill a good part of the page.
+		CHECK(area > 512 * 512 / 2);
+	}
+}
+
+TEST(SkylineRejectsEmptyAndOversized)
+{
+	SkylinePacker packer(64, 64);
+	uint32_t x, y;
+	CHECK(!packer.Insert(0, 10, x, y));
+	CHECK(!packer.Insert(65, 10, x, y));
+	CHECK(!packer.Insert(10, 65, x, y));
+	CHECK(packer.Insert(64, 64, x, y) && x == 0 && y == 0);
+	CHECK(!packer.Insert(1, 1, x, y));
+
+	packer.Reset();
+	CHECK(packer.used_area() == 0 && packer.extent_width() == 0 && packer.extent_height() == 0);
+	CHECK(packer.Insert(1, 1, x, y));
+}
+
+// Regions must be inside their page's texture and, with their padding, apart from each other.
+static void CheckAtlas(const RenderTargetAtlas& atlas, const std::vector<uint32_t>& live)
+{
+	for (uint32_t id : live) {
+		const RenderTargetAtlas::Region* region = atlas.Find(id);
+		REQUIRE(region);
+		REQUIRE(region->page < atlas.page_count());
+		CHECK(region->x >= 1 && region->y >= 1);
+		CHECK(region->x + region->width + 1 <= atlas.page_width(region->page));
+		CHECK(region->y + region->height + 1 <= atlas.page_height(region->page));
+		CHECK(atlas.page_width(region->page) <= atlas.max_page_size());
+		CHECK(atlas.page_height(region->page) <= atlas.max_page_size());
+		CHECK(atlas.page_width(region->page) % RenderTargetAtlas::kPageGranularity == 0);
+
+		Box padded = { region->x - 1, region->y - 1, region->width + 2, region->height + 2 };
+		for (uint32_t other_id : live) {
+			const RenderTargetAtlas::Region* other = atlas.Find(other_id);
+			if (other_id == id || other->page != region->page)
+				continue;
+			Box other_padded = { other->x - 1, other->y - 1, other->width + 2, other->height + 2 };
+			CHECK(!Overlaps(padded, other_padded));
+		}
+	}
+
+	CHECK(atlas.region_count() == live.size());
+}
+
+TEST(AtlasFuzz)
+{
+	std::mt19937 random(2048);
+	RenderTargetAtlas atlas(1024, 3, 256);
+	std::vector<uint32_t> live;
+	uint32_t next_id = 1;
+	uint32_t repacks = 0;
+
+	for (int step = 0; step < 3000; step++) {
+		if (!live.empty() && random() % 3 == 0) {
+			size_t index = random() % live.size();
+			atlas.Free(live[index]);
+			CHECK(!atlas.Find(live[index]));
+			live.erase(live.begin() + index);
+		}
+		else {
+			uint32_t width = random() % 300 + 1;
+			uint32_t height = random() % 300 + 1;
+			std::vector<uint32_t> moved;
+			bool allocated = atlas.Allocate(next_id, width, height, moved);
+
+			CHECK(!allocated || atlas.Accepts(width, height));
+			if (allocated) {
+				const RenderTargetAtlas::Region* region = atlas.Find(next_id);
+				CHECK(region->width == width && region->height == height);
+				live.push_back(next_id);
+			}
+			for (uint32_t id : moved)
+				CHECK(std::find(live.begin(), live.end(), id) != live.end());
+			if (!moved.empty())
+				repacks++;
+			next_id++;
+		}
+
+		CheckAtlas(atlas, live);
+	}
+
+	CHECK(atlas.repack_count() >= repacks);
+
+	for (uint32_t id : live)
+		atlas.Free(id);
+	for (uint32_t page = 0; page < atlas.page_count(); page++)
+		CHECK(atlas.page_width(page) == 0 && atlas.page_height(page) == 0);
+	CHECK(atlas.page_bytes() == 0);
+}
+
+TEST(AtlasResizeKeepsId)
+{
+	RenderTargetAtlas atlas(2048, 1, 512);
+	std::vector<uint32_t> moved;
+	CHECK(atlas.Allocate(1, 100, 50, moved));
+	CHECK(atlas.Allocate(1, 100, 50, moved));
+	CHECK(atlas.region_count() == 1);
+	CHECK(atlas.Allocate(1, 200, 80, moved));
+	CHECK(atlas.region_count() == 1);
+	CHECK(atlas.Find(1)->width == 200 && atlas.Find(1)->height == 80);
+	CHECK(!atlas.Accepts(513, 10));
+	CHECK(!atlas.Allocate(2, 513, 10, moved));
+}
+
+// The case that used to cost a whole 2048 x 2048 page: 400 x 60 widgets.
+TEST(AtlasWidgetsSaveMemory)
+{
+	RenderTargetAtlas atlas(2048, 4, 512);
+	std::vector<uint32_t> moved;
+
+	CHECK(atlas.Allocate(1, 400, 60, moved));
+	CHECK(atlas.page_width(0) < 512 && atlas.page_height(0) <= 64);
+	// Alone it can't save anything, but it must not cost more than its own texture.
+	CHECK(atlas.page_bytes() <= atlas.standalone_bytes());
+
+	for (uint32_t id = 2; id <= 12; id++) {
+		CHECK(atlas.Allocate(id, 400, 60, moved));
+		if (id >= 3)
+			CHECK((int64_t)atlas.standalone_bytes() - (int64_t)atlas.page_bytes() > 0);
+	}
+	CHECK(atlas.page_count() == 1);
+	CHECK(atlas.standalone_bytes() == 12 * RenderTargetAtlas::AllocationBytes(400, 60));
+
+	// Mixed small widgets share a page too.
+	RenderTargetAtlas mixed(2048, 4, 512);
+	CHECK(mixed.Allocate(1, 400, 60, moved));
+	CHECK(mixed.Allocate(2, 120, 40, moved));
+	CHECK(mixed.Allocate(3, 120, 40, moved));
+	CHECK(mixed.Allocate(4, 64, 64, moved));
+	CHECK(mixed.standalone_bytes() > mixed.page_bytes());
+}
+
+TEST(AllocationGranularity)
+{
+	CHECK(RenderTargetAtlas::AllocationBytes(0, 0) == 0);
+	CHECK(RenderTargetAtlas::AllocationBytes(1, 1) == RenderTargetAtlas::kAllocationGranularity);
+	CHECK(RenderTargetAtlas::AllocationBytes(128, 128) == 64 * 1024);
+	CHECK(RenderTargetAtlas::AllocationBytes(128, 129) == 128 * 1024);
+}
+
+// Mirrors GPUDriverD3D11's CreateRenderTargetTexture and PlaceInAtlas, with its atlas limits and
+// the MSAA settings Application passes by default.
+class AtlasDriver {
+public:
+	AtlasDriver() : atlas_(2048, 4, 512)
+	{
+		MSAAPolicyConfig config;
+		config.atlas_region_size = 512;
+		msaa_.set_config(config);
+	}
+
+	uint32_t CreateRenderTarget(uint32_t width, uint32_t height)
+	{
+		uint32_t id = next_id_++;
+		samples_[id] = atlas_.Accepts(width, height) ? 1 : msaa_.Acquire(id, width, height);
+		return id;
+	}
+
+	bool PlaceInAtlas(uint32_t id, uint32_t width, uint32_t height)
+	{
+		std::vector<uint32_t> moved;
+		return samples_[id] == 1 && atlas_.Allocate(id, width, height, moved);
+	}
+
+	uint32_t samples(uint32_t id) const { return samples_.at(id); }
+
+	const RenderTargetAtlas& atlas() const { return atlas_; }
+
+	const MSAAPolicy& msaa() const { return msaa_; }
+
+protected:
+	RenderTargetAtlas atlas_;
+	MSAAPolicy msaa_;
+	uint32_t next_id_ = 1;
+	std::map<uint32_t, uint32_t> samples_;
+};
+
+TEST(SmallViewsReachAtlasWithDefaultSettings)
+{
+	AtlasDriver driver;
+
+	uint32_t widget = driver.CreateRenderTarget(400, 60);
+	CHECK(driver.samples(widget) == 1);
+	CHECK(driver.PlaceInAtlas(widget, 400, 60));
+	CHECK(driver.atlas().Find(widget) != nullptr);
+	CHECK(driver.msaa().used_bytes() == 0);
+
+	// Larger views are still multisampled and stay standalone.
+	uint32_t view = driver.CreateRenderTarget(1280, 720);
+	CHECK(driver.samples(view) == 8);
+	CHECK(!driver.PlaceInAtlas(view, 1280, 720));
+	CHECK(driver.msaa().used_bytes() == MSAAPolicy::OverheadBytes(1280, 720, 8));
+
+	for (int i = 0; i < 10; i++) {
+		uint32_t id = driver.CreateRenderTarget(120, 40);
+		CHECK(driver.PlaceInAtlas(id, 120, 40));
+	}
+	CHECK(driver.atlas().region_count() == 11);
+	CHECK(driver.atlas().standalone_bytes() > driver.atlas().page_bytes());
+}
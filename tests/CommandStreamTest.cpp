@@ -0,0 +1,319 @@
+#include "Test.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <string>
+
+#include "gpu/CommandStream.h"
+
+// Records what a replay hands the driver.
+class RecordingDriver : public GPUDriver {
+public:
+	void BeginSynchronize() override { calls += "B"; }
+	void EndSynchronize() override { calls += "E"; }
+	uint32_t NextTextureId() override { return 0; }
+
+	void CreateTexture(uint32_t texture_id, RefPtr<Bitmap> bitmap) override
+	{
+		calls += "T";
+		last_texture_id = texture_id;
+		last_bitmap = bitmap;
+	}
+
+	void UpdateTexture(uint32_t texture_id, RefPtr<Bitmap> bitmap) override
+	{
+		calls += "U";
+		last_texture_id = texture_id;
+		last_bitmap = bitmap;
+	}
+
+	void DestroyTexture(uint32_t) override { calls += "t"; }
+	uint32_t NextRenderBufferId() override { return 0; }
+
+	void CreateRenderBuffer(uint32_t, const RenderBuffer& buffer) override
+	{
+		calls += "R";
+		last_buffer = buffer;
+	}
+
+	void DestroyRenderBuffer(uint32_t) override { calls += "r"; }
+	uint32_t NextGeometryId() override { return 0; }
+
+	void CreateGeometry(uint32_t, const VertexBuffer& vertices, const IndexBuffer& indices) override
+	{
+		calls += "G";
+		vertex_bytes.assign(vertices.data, vertices.data + vertices.size);
+		index_bytes.assign(indices.data, indices.data + indices.size);
+	}
+
+	void UpdateGeometry(uint32_t, const VertexBuffer&, const IndexBuffer&) override { calls += "g"; }
+	void DestroyGeometry(uint32_t) override { calls += "x"; }
+
+	void UpdateCommandList(const CommandList& list) override
+	{
+		calls += "C";
+		commands.assign(list.commands, list.commands + list.size);
+	}
+
+	std::string calls;
+	uint32_t last_texture_id = 0;
+	RefPtr<Bitmap> last_bitmap;
+	RenderBuffer last_buffer = {};
+	std::vector<uint8_t> vertex_bytes;
+	std::vector<uint8_t> index_bytes;
+	std::vector<Command> commands;
+};
+
+static std::string CapturePath(const char* name)
+{
+	return std::string("CommandStreamTest_") + name + ".ulcs";
+}
+
+static std::vector<uint8_t> ReadFile(const std::string& path)
+{
+	std::vector<uint8_t> bytes;
+	FILE* file = fopen(path.c_str(), "rb");
+	if (!file)
+		return bytes;
+	int c;
+	while ((c = fgetc(file)) != EOF)
+		bytes.push_back((uint8_t)c);
+	fclose(file);
+	return bytes;
+}
+
+static void WriteFile(const std::string& path, const std::vector<uint8_t>& bytes)
+{
+	FILE* file = fopen(path.c_str(), "wb");
+	fwrite(bytes.data(), 1, bytes.size(), file);
+	fclose(file);
+}
+
+// A draw with something in most fields, so a field the stream drops shows up as a mismatch.
+static Command SampleCommand(uint32_t geometry_id)
+{
+	Command command = MakeCommand(CommandType::DrawGeometry, 3, geometry_id);
+	command.indices_count = 6;
+	command.indices_offset = 12;
+	command.gpu_state.viewport_width = 400;
+	command.gpu_state.viewport_height = 60;
+	command.gpu_state.enable_blend = true;
+	command.gpu_state.shader_type = ShaderType::FillPath;
+	command.gpu_state.texture_1_id = 7;
+	command.gpu_state.uniform_scalar[2] = 0.5f;
+	command.gpu_state.uniform_vector[1].y = 2.0f;
+	command.gpu_state.clip_size = 1;
+	command.gpu_state.clip[0].data[0] = 1.0f;
+	command.gpu_state.enable_scissor = true;
+	command.gpu_state.scissor_rect = { 1, 2, 30, 40 };
+	return command;
+}
+
+TEST(RoundTrip)
+{
+	std::string path = CapturePath("round_trip");
+	uint8_t pixels[2 * 8] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+	uint8_t vertices[5] = { 1, 2, 3, 4, 5 };
+	uint8_t indices[3] = { 9, 8, 7 };
+
+	CommandStreamWriter writer;
+	REQUIRE(writer.Open(path.c_str()));
+	writer.BeginSynchronize();
+	writer.CreateTexture(4, Bitmap::Create(2, 2, BitmapFormat::BGRA8_UNORM_SRGB, 8, pixels, sizeof(pixels)).get());
+	RenderBuffer buffer = { 4, 400, 60, true, false };
+	writer.CreateRenderBuffer(3, buffer);
+	VertexBuffer vertex_buffer = { VertexBufferFormat::_2f_4ub_2f, sizeof(vertices), vertices };
+	IndexBuffer index_buffer = { sizeof(indices), indices };
+	writer.CreateGeometry(5, vertex_buffer, index_buffer);
+	writer.EndSynchronize();
+	Command commands[2] = { SampleCommand(5), SampleCommand(6) };
+	writer.UpdateCommandList({ 2, commands });
+	writer.DrawCommandList();
+	writer.DestroyTexture(4);
+	writer.DrawCommandList();
+	writer.Close();
+	CHECK(writer.frame_count() == 2);
+
+	CommandStreamReplayer replayer;
+	RecordingDriver driver;
+	REQUIRE(replayer.Open(path.c_str()));
+	CHECK(replayer.ReplayFrame(driver));
+	CHECK(driver.calls == "BTRGEC");
+	CHECK(driver.last_texture_id == 4);
+	REQUIRE(driver.last_bitmap);
+	CHECK(driver.last_bitmap->width() == 2 && driver.last_bitmap->row_bytes() == 8);
+	CHECK(memcmp(driver.last_bitmap->LockPixels(), pixels, sizeof(pixels)) == 0);
+	CHECK(driver.last_buffer.texture_id == 4 && driver.last_buffer.width == 400);
+	CHECK(driver.last_buffer.has_stencil_buffer && !driver.last_buffer.has_depth_buffer);
+	CHECK(driver.vertex_bytes == std::vector<uint8_t>(vertices, vertices + sizeof(vertices)));
+	CHECK(driver.index_bytes == std::vector<uint8_t>(indices, indices + sizeof(indices)));
+
+	REQUIRE(driver.commands.size() == 2);
+	const Command& command = driver.commands[1];
+	CHECK(command.geometry_id == 6 && command.indices_count == 6 && command.indices_offset == 12);
+	CHECK(command.gpu_state.shader_type == ShaderType::FillPath);
+	CHECK(command.gpu_state.enable_blend && !command.gpu_state.enable_texturing);
+	CHECK(command.gpu_state.uniform_scalar[2] == 0.5f);
+	CHECK(command.gpu_state.uniform_vector[1].y == 2.0f);
+	CHECK(command.gpu_state.clip_size == 1 && command.gpu_state.clip[0].data[0] == 1.0f);
+	CHECK(command.gpu_state.scissor_rect.right == 30 && command.gpu_state.scissor_rect.bottom == 40);
+
+	CHECK(replayer.ReplayFrame(driver));
+	CHECK(driver.calls == "BTRGECt");
+	CHECK(!replayer.ReplayFrame(driver));
+	CHECK(!replayer.has_error());
+	CHECK(replayer.frame_count() == 2);
+
+	remove(path.c_str());
+}
+
+TEST(RejectsBadHeader)
+{
+	std::string path = CapturePath("bad_header");
+	WriteFile(path, { 'U', 'L', 'C', 'X', 1, 0, 0, 0 });
+	CommandStreamReplayer replayer;
+	CHECK(!replayer.Open(path.c_str()));
+	CHECK(replayer.has_error());
+	remove(path.c_str());
+}
+
+template<typename T>
+static void Append(std::vector<uint8_t>& bytes, T value)
+{
+	size_t offset = bytes.size();
+	bytes.resize(offset + sizeof(T));
+	memcpy(bytes.data() + offset, &value, sizeof(T));
+}
+
+// The stream's header, followed by one record of |type| with |payload|.
+static std::vector<uint8_t> Record(CommandRecord type, const std::vector<uint8_t>& payload)
+{
+	std::vector<uint8_t> bytes = { 'U', 'L', 'C', 'S', CommandStreamWriter::kVersion, 0, 0, 0 };
+	uint32_t size = (uint32_t)payload.size();
+	bytes.push_back((uint8_t)type);
+	Append(bytes, size);
+	bytes.insert(bytes.end(), payload.begin(), payload.end());
+	return bytes;
+}
+
+static bool ReplayFails(const char* name, const std::vector<uint8_t>& bytes, RecordingDriver& driver)
+{
+	std::string path = CapturePath(name);
+	WriteFile(path, bytes);
+	CommandStreamReplayer replayer;
+	bool opened = replayer.Open(path.c_str());
+	bool replayed = opened && replayer.ReplayFrame(driver);
+	remove(path.c_str());
+	return opened && !replayed && replayer.has_error();
+}
+
+TEST(RejectsCorruptCommandCount)
+{
+	std::vector<uint8_t> payload;
+	Append<uint32_t>(payload, 0x40000000);
+	payload.resize(payload.size() + 300);
+
+	RecordingDriver driver;
+	CHECK(ReplayFails("count", Record(CommandRecord::UpdateCommandList, payload), driver));
+	CHECK(driver.calls.empty());
+}
+
+TEST(RejectsCorruptCommand)
+{
+	std::string path = CapturePath("command");
+	Command command = SampleCommand(1);
+	CommandStreamWriter writer;
+	REQUIRE(writer.Open(path.c_str()));
+	writer.UpdateCommandList({ 1, &command });
+	writer.Close();
+
+	// Type byte of the only command, right after the record header and the count.
+	std::vector<uint8_t> bytes = ReadFile(path);
+	remove(path.c_str());
+	REQUIRE(bytes.size() > 17);
+	bytes[8 + 5 + 4] = 0x7f;
+
+	RecordingDriver driver;
+	CHECK(ReplayFails("command", bytes, driver));
+	CHECK(driver.calls.empty());
+}
+
+TEST(RejectsTruncatedCommand)
+{
+	std::string path = CapturePath("truncated");
+	Command command = SampleCommand(1);
+	CommandStreamWriter writer;
+	REQUIRE(writer.Open(path.c_str()));
+	writer.UpdateCommandList({ 1, &command });
+	writer.Close();
+
+	std::vector<uint8_t> bytes = ReadFile(path);
+	remove(path.c_str());
+	REQUIRE(bytes.size() > 17);
+
+	// Cut the command short at every length, with a record size that agrees.
+	std::vector<uint8_t> payload(bytes.begin() + 13, bytes.end());
+	for (size_t length = 4; length < payload.size(); length++) {
+		RecordingDriver driver;
+		std::vector<uint8_t> truncated(payload.begin(), payload.begin() + length);
+		if (!ReplayFails("truncated", Record(CommandRecord::UpdateCommandList, truncated), driver)) {
+			CHECK(!"truncated command replayed");
+			break;
+		}
+		CHECK(driver.calls.empty());
+	}
+}
+
+static std::vector<uint8_t> BitmapPayload(uint32_t width, uint32_t height, uint8_t format,
+	uint32_t row_bytes, uint32_t size)
+{
+	std::vector<uint8_t> payload;
+	Append<uint32_t>(payload, 1);
+	Append(payload, width);
+	Append(payload, height);
+	Append(payload, format);
+	Append<uint8_t>(payload, 0);
+	Append(payload, row_bytes);
+	Append(payload, size);
+	payload.resize(payload.size() + size);
+	return payload;
+}
+
+TEST(RejectsCorruptBitmaps)
+{
+	const uint8_t a8 = (uint8_t)BitmapFormat::A8_UNORM;
+	const uint8_t bgra = (uint8_t)BitmapFormat::BGRA8_UNORM_SRGB;
+	RecordingDriver driver;
+
+	// Rows narrower than the width, pixels smaller than the rows, an unknown format, no size,
+	// and a dimension that doesn't fit any texture.
+	CHECK(ReplayFails("row_bytes", Record(CommandRecord::CreateTexture, BitmapPayload(16, 4, bgra, 32, 128)), driver));
+	CHECK(ReplayFails("size", Record(CommandRecord::CreateTexture, BitmapPayload(16, 4, bgra, 64, 128)), driver));
+	CHECK(ReplayFails("format", Record(CommandRecord::CreateTexture, BitmapPayload(16, 4, 9, 64, 256)), driver));
+	CHECK(ReplayFails("empty", Record(CommandRecord::CreateTexture, BitmapPayload(0, 4, a8, 16, 64)), driver));
+	CHECK(ReplayFails("huge", Record(CommandRecord::CreateTexture, BitmapPayload(20000, 1, a8, 20000, 20000)), driver));
+
+	// Payload shorter than the size it claims.
+	std::vector<uint8_t> truncated = BitmapPayload(16, 4, a8, 16, 64);
+	truncated.resize(truncated.size() - 1);
+	CHECK(ReplayFails("truncated", Record(CommandRecord::CreateTexture, truncated), driver));
+	CHECK(driver.calls.empty());
+
+	// A valid one still goes through.
+	std::vector<uint8_t> bytes = Record(CommandRecord::CreateTexture, BitmapPayload(16, 4, a8, 16, 64));
+	std::vector<uint8_t> end = Record(CommandRecord::DrawCommandList, {});
+	bytes.insert(bytes.end(), end.begin() + 8, end.end());
+	std::string path = CapturePath("valid_bitmap");
+	WriteFile(path, bytes);
+	CommandStreamReplayer replayer;
+	REQUIRE(replayer.Open(path.c_str()));
+	CHECK(replayer.ReplayFrame(driver));
+	CHECK(driver.calls == "T");
+	remove(path.c_str());
+}
+
+TEST(RejectsUnknownRecord)
+{
+	RecordingDriver driver;
+	CHECK(ReplayFails("record", Record((CommandRecord)99, {}), driver));
+}
@@ -0,0 +1,110 @@
+#include "Test.h"
+
+#include <math.h>
+
+#include "gpu/CompositeAnimation.h"
+
+static bool Near(float a, float b, float epsilon = 1e-4f)
+{
+	return fabsf(a - b) < epsilon;
+}
+
+TEST(EasingEndpoints)
+{
+	Easing easings[] = { Easing::Linear, Easing::EaseIn, Easing::EaseOut, Easing::EaseInOut };
+	for (Easing easing : easings) {
+		CHECK(ApplyEasing(easing, 0.0f) == 0.0f);
+		CHECK(Near(ApplyEasing(easing, 1.0f), 1.0f));
+	}
+
+	CHECK(ApplyEasing(Easing::EaseIn, 0.5f) < 0.5f);
+	CHECK(ApplyEasing(Easing::EaseOut, 0.5f) > 0.5f);
+	CHECK(Near(ApplyEasing(Easing::EaseInOut, 0.5f), 0.5f));
+}
+
+TEST(TimelineTweens)
+{
+	CompositeTimeline timeline;
+	CompositeTransform to;
+	to.opacity = 0.0f;
+	to.translate_x = 100.0f;
+
+	timeline.AnimateTo(to, 1.0, Easing::Linear, 10.0);
+	CHECK(timeline.is_animating());
+	CHECK(timeline.target() == to);
+
+	CHECK(timeline.Tick(10.5));
+	CHECK(Near(timeline.value().opacity, 0.5f));
+	CHECK(Near(timeline.value().translate_x, 50.0f));
+	CHECK(!timeline.Tick(10.5));
+
+	// Overshooting lands exactly on the target and stops.
+	CHECK(timeline.Tick(12.0));
+	CHECK(!timeline.is_animating());
+	CHECK(timeline.value() == to);
+	CHECK(!timeline.Tick(13.0));
+}
+
+TEST(RetargetStartsFromCurrentValue)
+{
+	CompositeTimeline timeline;
+	CompositeTransform to;
+	to.translate_y = 100.0f;
+	timeline.AnimateTo(to, 1.0, Easing::Linear, 0.0);
+	timeline.Tick(0.5);
+
+	CompositeTransform back;
+	timeline.AnimateTo(back, 1.0, Easing::Linear, 0.5);
+	CHECK(!timeline.Tick(0.5));
+	CHECK(Near(timeline.value().translate_y, 50.0f));
+	timeline.Tick(1.0);
+	CHECK(Near(timeline.value().translate_y, 25.0f));
+
+	// Ticks before the start hold the start value.
+	timeline.AnimateTo(to, 1.0, Easing::Linear, 5.0);
+	timeline.Tick(4.0);
+	CHECK(Near(timeline.value().translate_y, 25.0f));
+}
+
+TEST(ZeroDurationAndSetJump)
+{
+	CompositeTimeline timeline;
+	CompositeTransform to;
+	to.scale_x = 2.0f;
+	timeline.AnimateTo(to, 0.0, Easing::Linear, 0.0);
+	CHECK(!timeline.is_animating());
+	CHECK(timeline.value() == to);
+
+	timeline.AnimateTo(CompositeTransform(), 1.0, Easing::EaseOut, 0.0);
+	timeline.Set(to);
+	CHECK(!timeline.is_animating());
+	CHECK(!timeline.Tick(0.5));
+	CHECK(timeline.value() == to);
+}
+
+TEST(UnprojectInvertsTransform)
+{
+	CompositeTransform transform;
+	transform.rotation = 0.7f;
+	transform.scale_x = 2.0f;
+	transform.scale_y = 0.5f;
+	transform.translate_x = 13.0f;
+	transform.translate_y = -4.0f;
+
+	float m[4];
+	transform.GetMatrix(m);
+
+	// Forward map a point of a 200 x 100 quad the way the compositor does, then back.
+	float width = 200.0f, height = 100.0f, local_x = 30.0f, local_y = 70.0f;
+	float dx = local_x - width / 2, dy = local_y - height / 2;
+	float x = width / 2 + transform.translate_x + m[0] * dx + m[1] * dy;
+	float y = height / 2 + transform.translate_y + m[2] * dx + m[3] * dy;
+
+	CHECK(transform.Unproject(width, height, x, y));
+	CHECK(Near(x, local_x, 1e-3f) && Near(y, local_y, 1e-3f));
+
+	CompositeTransform collapsed;
+	collapsed.scale_x = 0.0f;
+	x = y = 1.0f;
+	CHECK(!collapsed.Unproject(width, height, x, y));
+}
@@ -0,0 +1,118 @@
+#include "Test.h"
+
+#include "gpu/CompositeBatch.h"
+
+static const Rect kRect = { 10.0f, 20.0f, 110.0f, 70.0f };
+static const Rect kUV = { 0.0f, 0.0f, 1.0f, 1.0f };
+
+TEST(InstanceCopiesQuad)
+{
+	CompositeBatch batch;
+	float matrix[4] = { 0.0f, -1.0f, 1.0f, 0.0f };
+	Rect uv = { 0.25f, 0.5f, 0.75f, 1.0f };
+	batch.Add(7, kRect, uv, 0.5f, matrix);
+
+	REQUIRE(batch.instances().size() == 1);
+	const CompositeBatch::Instance& instance = batch.instances()[0];
+	CHECK(instance.rect[0] == 10.0f && instance.rect[1] == 20.0f);
+	CHECK(instance.rect[2] == 110.0f && instance.rect[3] == 70.0f);
+	CHECK(instance.uv[0] == 0.25f && instance.uv[1] == 0.5f);
+	CHECK(instance.uv[2] == 0.75f && instance.uv[3] == 1.0f);
+	CHECK(instance.transform[0] == 0.0f && instance.transform[1] == -1.0f);
+	CHECK(instance.transform[2] == 1.0f && instance.transform[3] == 0.0f);
+	CHECK(instance.opacity == 0.5f);
+	CHECK(instance.texture_slot == 0);
+
+	REQUIRE(batch.draws().size() == 1);
+	CHECK(batch.draws()[0].texture_ids[0] == 7);
+}
+
+TEST(DefaultsToIdentityAndClampsOpacity)
+{
+	CompositeBatch batch;
+	batch.Add(1, kRect, kUV, 3.0f);
+
+	REQUIRE(batch.instances().size() == 1);
+	const CompositeBatch::Instance& instance = batch.instances()[0];
+	CHECK(instance.transform[0] == 1.0f && instance.transform[1] == 0.0f);
+	CHECK(instance.transform[2] == 0.0f && instance.transform[3] == 1.0f);
+	CHECK(instance.opacity == 1.0f);
+}
+
+TEST(SkipsInvisibleQuads)
+{
+	CompositeBatch batch;
+	batch.Add(0, kRect, kUV, 1.0f);
+	batch.Add(1, { 10.0f, 20.0f, 10.0f, 70.0f }, kUV, 1.0f);
+	batch.Add(1, { 10.0f, 70.0f, 110.0f, 20.0f }, kUV, 1.0f);
+	batch.Add(1, kRect, kUV, 0.0f);
+
+	CHECK(batch.empty());
+	CHECK(batch.draws().empty());
+}
+
+TEST(SharesSlotsWithinDraw)
+{
+	CompositeBatch batch;
+	batch.Add(1, kRect, kUV, 1.0f);
+	batch.Add(2, kRect, kUV, 1.0f);
+	batch.Add(1, kRect, kUV, 1.0f);
+
+	REQUIRE(batch.draws().size() == 1);
+	const CompositeBatch::Draw& draw = batch.draws()[0];
+	CHECK(draw.first_instance == 0);
+	CHECK(draw.instance_count == 3);
+	CHECK(draw.texture_count == 2);
+	CHECK(batch.instances()[0].texture_slot == 0);
+	CHECK(batch.instances()[1].texture_slot == 1);
+	CHECK(batch.instances()[2].texture_slot == 0);
+}
+
+TEST(StartsNewDrawWhenSlotsRunOut)
+{
+	CompositeBatch batch;
+	uint32_t textures = CompositeBatch::kMaxTextureSlots + 3;
+	for (uint32_t id = 1; id <= textures; id++)
+		batch.Add(id, kRect, kUV, 1.0f);
+
+	// A texture of the first draw comes back after the split, z-order keeps it in the second.
+	batch.Add(1, kRect, kUV, 1.0f);
+
+	REQUIRE(batch.draws().size() == 2);
+	const CompositeBatch::Draw& first = batch.draws()[0];
+	const CompositeBatch::Draw& second = batch.draws()[1];
+	CHECK(first.first_instance == 0);
+	CHECK(first.instance_count == CompositeBatch::kMaxTextureSlots);
+	CHECK(first.texture_count == CompositeBatch::kMaxTextureSlots);
+	CHECK(second.first_instance == CompositeBatch::kMaxTextureSlots);
+	CHECK(second.instance_count == 4);
+	CHECK(second.texture_count == 4);
+	CHECK(second.texture_ids[3] == 1);
+	CHECK(batch.instances().back().texture_slot == 3);
+}
+
+TEST(InstancesStayInAddOrder)
+{
+	CompositeBatch batch;
+	for (uint32_t i = 0; i < 40; i++) {
+		Rect rect = { (float)i, 0.0f, (float)i + 1.0f, 1.0f };
+		batch.Add(i % 11 + 1, rect, kUV, 1.0f);
+	}
+
+	REQUIRE(batch.instances().size() == 40);
+	uint32_t covered = 0;
+	for (auto& draw : batch.draws()) {
+		CHECK(draw.first_instance == covered);
+		for (uint32_t i = draw.first_instance; i < draw.first_instance + draw.instance_count; i++) {
+			const CompositeBatch::Instance& instance = batch.instances()[i];
+			CHECK(instance.rect[0] == (float)i);
+			CHECK(instance.texture_slot < draw.texture_count);
+			CHECK(draw.texture_ids[instance.texture_slot] == i % 11 + 1);
+		}
+		covered += draw.instance_count;
+	}
+	CHECK(covered == 40);
+
+	batch.Clear();
+	CHECK(batch.empty() && batch.draws().empty());
+}
@@ -0,0 +1,165 @@
+#include "Test.h"
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <thread>
+
+#include "DirectoryIndex.h"
+
+// An in-memory tree: directory (relative to the root) -> its entries.
+class FakeTree {
+public:
+	void AddFile(const std::string& dir, const std::string& name, uint64_t size)
+	{
+		DirectoryEntry entry;
+		entry.name = name;
+		entry.size = size;
+		Add(dir, entry);
+	}
+
+	void AddDirectory(const std::string& dir, const std::string& name, bool is_link = false)
+	{
+		DirectoryEntry entry;
+		entry.name = name;
+		entry.is_directory = true;
+		entry.is_link = is_link;
+		Add(dir, entry);
+	}
+
+	DirectoryIndex::Lister lister()
+	{
+		return [this](const std::string& dir, std::vector<DirectoryEntry>& entries) {
+			std::lock_guard<std::mutex> lock(mutex_);
+			listed.push_back(dir);
+			auto i = dirs_.find(dir);
+			if (i == dirs_.end())
+				return false;
+			entries = i->second;
+			return true;
+		};
+	}
+
+	std::vector<std::string> listed;
+
+protected:
+	void Add(const std::string& dir, const DirectoryEntry& entry)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		dirs_[dir].push_back(entry);
+	}
+
+	std::mutex mutex_;
+	std::map<std::string, std::vector<DirectoryEntry>> dirs_;
+};
+
+// app.html, assets/{Logo.PNG, fonts/}, and linked -> a junction whose target is also listable.
+static void MakeApp(FakeTree& tree)
+{
+	tree.AddFile("", "app.html", 120);
+	tree.AddDirectory("", "assets");
+	tree.AddDirectory("", "linked", true);
+	tree.AddFile("assets", "Logo.PNG", 4096);
+	tree.AddDirectory("assets", "fonts");
+	tree.AddFile("assets/fonts", "ui.ttf", 70000);
+	tree.AddFile("linked", "loop.js", 1);
+}
+
+typedef DirectoryIndex::Lookup Lookup;
+
+TEST(Normalize)
+{
+	CHECK(DirectoryIndex::Normalize("a\\b/./c//d", true) == "a/b/c/d");
+	CHECK(DirectoryIndex::Normalize("a/b/../c", true) == "a/c");
+	CHECK(DirectoryIndex::Normalize("Assets/Logo.PNG", false) == "assets/logo.png");
+	CHECK(DirectoryIndex::Normalize("Assets/Logo.PNG", true) == "Assets/Logo.PNG");
+	CHECK(DirectoryIndex::Normalize("../outside", true).empty());
+	CHECK(DirectoryIndex::Normalize("a/../../outside", true).empty());
+	CHECK(DirectoryIndex::Normalize("C:/app.html", true).empty());
+	CHECK(DirectoryIndex::Normalize("/app.html", true).empty());
+	CHECK(DirectoryIndex::Normalize("\\\\server\\share", true).empty());
+}
+
+TEST(FindsIndexedPaths)
+{
+	FakeTree tree;
+	MakeApp(tree);
+	DirectoryIndex index(tree.lister(), false);
+
+	CHECK(!index.is_ready());
+	CHECK(index.Find("app.html") == Lookup::Unknown);
+
+	index.Build();
+	CHECK(index.is_ready());
+
+	FileInfo info;
+	CHECK(index.Find("app.html", &info) == Lookup::Found);
+	CHECK(info.size == 120 && !info.is_directory);
+	CHECK(index.Find("ASSETS\\logo.png", &info) == Lookup::Found && info.size == 4096);
+	CHECK(index.Find("assets/fonts", &info) == Lookup::Found && info.is_directory);
+	CHECK(index.Find("./assets/fonts/../fonts/ui.ttf") == Lookup::Found);
+	CHECK(index.Find("assets/missing.png") == Lookup::Missing);
+	CHECK(index.Find("nowhere/missing.png") == Lookup::Missing);
+
+	// Paths the index can't answer.
+	CHECK(index.Find("C:/app.html") == Lookup::Unknown);
+	CHECK(index.Find("../app.html") == Lookup::Unknown);
+	CHECK(index.Find("assets/\xc3\x89t\xc3\xa9.png") == Lookup::Unknown);
+
+	DirectoryIndexStats stats = index.stats();
+	CHECK(stats.builds == 1);
+	CHECK(stats.entries == 6);
+	CHECK(stats.lookups == 10);
+	CHECK(stats.unknown == 4);
+}
+
+TEST(CaseSensitive)
+{
+	FakeTree tree;
+	MakeApp(tree);
+	DirectoryIndex index(tree.lister(), true);
+	index.Build();
+
+	CHECK(index.Find("assets/Logo.PNG") == Lookup::Found);
+	CHECK(index.Find("assets/logo.png") == Lookup::Missing);
+	CHECK(index.Find("assets/\xc3\x89t\xc3\xa9.png") == Lookup::Missing);
+}
+
+TEST(LinkedDirectoriesAreUnknown)
+{
+	FakeTree tree;
+	MakeApp(tree);
+	DirectoryIndex index(tree.lister(), false);
+	index.Build();
+
+	// Recorded, never listed.
+	CHECK(std::find(tree.listed.begin(), tree.listed.end(), "linked") == tree.listed.end());
+	FileInfo info;
+	CHECK(index.Find("linked", &info) == Lookup::Found);
+	CHECK(info.is_directory && info.is_link);
+
+	// Anything below it may or may not exist.
+	CHECK(index.Find("linked/loop.js") == Lookup::Unknown);
+	CHECK(index.Find("Linked/deeper/still/x.js") == Lookup::Unknown);
+
+	// Ordinary directories still answer Missing.
+	CHECK(index.Find("assets/fonts/missing.ttf") == Lookup::Missing);
+}
+
+TEST(InvalidateRebuildsInBackground)
+{
+	FakeTree tree;
+	MakeApp(tree);
+	DirectoryIndex index(tree.lister(), false);
+	index.Build();
+	CHECK(index.Find("new.js") == Lookup::Missing);
+
+	tree.AddFile("", "new.js", 10);
+	index.Invalidate();
+	while (!index.is_ready())
+		std::this_thread::yield();
+
+	CHECK(index.Find("new.js") == Lookup::Found);
+	CHECK(index.stats().builds == 2);
+	CHECK(index.stats().entries == 7);
+}
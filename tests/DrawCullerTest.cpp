@@ -0,0 +1,189 @@
+#include "Test.h"
+
+#include <string.h>
+
+#include "gpu/DrawCuller.h"
+
+// Two quads in one geometry, like Ultralight packs them: 0..6 at (10, 10)-(50, 30) and
+// 6..12 at (500, 500)-(520, 520).
+static void SetQuads(DrawCuller& culler, uint32_t geometry_id)
+{
+	Vertex_2f_4ub_2f vertices[8];
+	memset(vertices, 0, sizeof(vertices));
+	float positions[8][2] = { { 10, 10 }, { 50, 10 }, { 10, 30 }, { 50, 30 },
+		{ 500, 500 }, { 520, 500 }, { 500, 520 }, { 520, 520 } };
+	for (int i = 0; i < 8; i++) {
+		vertices[i].pos[0] = positions[i][0];
+		vertices[i].pos[1] = positions[i][1];
+	}
+
+	IndexType indices[12] = { 0, 1, 2, 2, 1, 3, 4, 5, 6, 6, 5, 7 };
+	VertexBuffer vertex_buffer = { VertexBufferFormat::_2f_4ub_2f, sizeof(vertices), (uint8_t*)vertices };
+	IndexBuffer index_buffer = { sizeof(indices), (uint8_t*)indices };
+	culler.SetGeometry(geometry_id, vertex_buffer, index_buffer);
+}
+
+static Command Draw(uint32_t geometry_id, uint32_t offset, uint32_t count = 6)
+{
+	Command command = MakeCommand(CommandType::DrawGeometry, 0, geometry_id);
+	command.indices_offset = offset;
+	command.indices_count = count;
+	command.gpu_state.viewport_width = 100;
+	command.gpu_state.viewport_height = 100;
+	float* m = command.gpu_state.transform.data;
+	m[0] = m[5] = m[10] = m[15] = 1.0f;
+	return command;
+}
+
+TEST(CullsRangesOutsideViewport)
+{
+	DrawCuller culler;
+	SetQuads(culler, 1);
+	culler.BeginFrame();
+
+	CHECK(culler.IsVisible(Draw(1, 0)));
+	CHECK(!culler.IsVisible(Draw(1, 6)));
+	// The whole geometry's bounds overlap the viewport.
+	CHECK(culler.IsVisible(Draw(1, 0, 12)));
+	CHECK(culler.culled_count() == 1);
+
+	// Translated into view.
+	Command moved = Draw(1, 6);
+	moved.gpu_state.transform.data[12] = -480.0f;
+	moved.gpu_state.transform.data[13] = -480.0f;
+	CHECK(culler.IsVisible(moved));
+
+	culler.BeginFrame();
+	CHECK(culler.culled_count() == 0);
+}
+
+TEST(RespectsScissorAndMargin)
+{
+	DrawCuller culler;
+	SetQuads(culler, 1);
+
+	Command command = Draw(1, 0);
+	command.gpu_state.enable_scissor = true;
+	command.gpu_state.scissor_rect = { 60, 0, 100, 100 };
+	CHECK(!culler.IsVisible(command));
+
+	// Antialiased edges reach a pixel past the geometry.
+	command.gpu_state.scissor_rect = { 50, 0, 100, 100 };
+	CHECK(culler.IsVisible(command));
+
+	command.gpu_state.scissor_rect = { 20, 20, 20, 40 };
+	CHECK(!culler.IsVisible(command));
+}
+
+TEST(NeverCullsWhatItCantBound)
+{
+	DrawCuller culler;
+	SetQuads(culler, 1);
+
+	// Perspective transforms, unknown geometry, out of range indices and non-draw commands.
+	Command perspective = Draw(1, 6);
+	perspective.gpu_state.transform.data[3] = 0.001f;
+	CHECK(culler.IsVisible(perspective));
+	CHECK(culler.IsVisible(Draw(2, 6)));
+	CHECK(culler.IsVisible(Draw(1, 10, 6)));
+
+	Command clear = Draw(1, 6);
+	clear.command_type = CommandType::ClearRenderBuffer;
+	CHECK(culler.IsVisible(clear));
+
+	culler.RemoveGeometry(1);
+	CHECK(culler.IsVisible(Draw(1, 6)));
+}
+
+TEST(UpdatedGeometryDropsCachedBounds)
+{
+	DrawCuller culler;
+	SetQuads(culler, 1);
+	CHECK(!culler.IsVisible(Draw(1, 6)));
+
+	// Same layout, now the second quad is in view.
+	Vertex_2f_4ub_2f vertices[8];
+	memset(vertices, 0, sizeof(vertices));
+	IndexType indices[12] = { 0, 1, 2, 2, 1, 3, 4, 5, 6, 6, 5, 7 };
+	VertexBuffer vertex_buffer = { VertexBufferFormat::_2f_4ub_2f, sizeof(vertices), (uint8_t*)vertices };
+	IndexBuffer index_buffer = { sizeof(indices), (uint8_t*)indices };
+	culler.SetGeometry(1, vertex_buffer, index_buffer);
+	CHECK(culler.IsVisible(Draw(1, 6)));
+}
+
+TEST(CoversTarget)
+{
+	DrawCuller culler;
+	SetQuads(culler, 1);
+
+	// The first quad scaled and moved to cover (0, 0)-(100, 100).
+	Command command = Draw(1, 0);
+	float* m = command.gpu_state.transform.data;
+	m[0] = 2.5f;
+	m[12] = -25.0f;
+	m[5] = 5.0f;
+	m[13] = -50.0f;
+	CHECK(culler.CoversTarget(command, 100, 100));
+	CHECK(culler.CoversTarget(command, 64, 80));
+
+	// A texture larger than the viewport keeps texels the draw can't reach.
+	CHECK(!culler.CoversTarget(command, 128, 100));
+	CHECK(!culler.CoversTarget(command, 100, 101));
+	command.gpu_state.viewport_width = 128;
+	CHECK(!culler.CoversTarget(command, 128, 100));
+	m[0] = 3.5f;
+	m[12] = -35.0f;
+	CHECK(culler.CoversTarget(command, 128, 100));
+	command.gpu_state.viewport_width = 100;
+	m[0] = 2.5f;
+	m[12] = -25.0f;
+
+	// Short of the right edge.
+	m[0] = 2.4f;
+	CHECK(!culler.CoversTarget(command, 100, 100));
+	m[0] = 2.5f;
+
+	// Rotated, not a quad, a partial scissor.
+	m[1] = 0.1f;
+	CHECK(!culler.CoversTarget(command, 100, 100));
+	m[1] = 0.0f;
+	command.indices_count = 3;
+	CHECK(!culler.CoversTarget(command, 100, 100));
+	command.indices_count = 6;
+	command.gpu_state.enable_scissor = true;
+	command.gpu_state.scissor_rect = { 0, 0, 50, 100 };
+	CHECK(!culler.CoversTarget(command, 100, 100));
+	command.gpu_state.scissor_rect = { 0, 0, 100, 100 };
+	CHECK(culler.CoversTarget(command, 100, 100));
+}
+
+TEST(MatchesComparesEveryByte)
+{
+	DrawCuller culler;
+	Vertex_2f_4ub_2f vertices[4];
+	memset(vertices, 0, sizeof(vertices));
+	IndexType indices[6] = { 0, 1, 2, 2, 1, 3 };
+	VertexBuffer vertex_buffer = { VertexBufferFormat::_2f_4ub_2f, sizeof(vertices), (uint8_t*)vertices };
+	IndexBuffer index_buffer = { sizeof(indices), (uint8_t*)indices };
+
+	CHECK(!culler.Matches(1, vertex_buffer, index_buffer));
+	culler.SetGeometry(1, vertex_buffer, index_buffer);
+	CHECK(culler.Matches(1, vertex_buffer, index_buffer));
+
+	// A color the culler itself doesn't look at still counts.
+	vertices[3].color[2] = 7;
+	CHECK(!culler.Matches(1, vertex_buffer, index_buffer));
+	vertices[3].color[2] = 0;
+
+	indices[5] = 0;
+	CHECK(!culler.Matches(1, vertex_buffer, index_buffer));
+	indices[5] = 3;
+
+	IndexBuffer shorter = { sizeof(IndexType) * 3, (uint8_t*)indices };
+	CHECK(!culler.Matches(1, vertex_buffer, shorter));
+	VertexBuffer other_format = { VertexBufferFormat::_2f_4ub_2f_2f_28f, sizeof(vertices), (uint8_t*)vertices };
+	CHECK(!culler.Matches(1, other_format, index_buffer));
+
+	culler.RemoveGeometry(1);
+	CHECK(!culler.Matches(1, vertex_buffer, index_buffer));
+}
@@ -0,0 +1,114 @@
+#include "Test.h"
+
+#include <string.h>
+#include <vector>
+
+#include "gpu/FillClassifier.h"
+
+// One vertex per entry of |fill_types|, indices are 0..n-1 so a range covers the same vertices.
+static void SetFillTypes(FillClassifier& classifier, uint32_t geometry_id,
+	const std::vector<float>& fill_types)
+{
+	std::vector<Vertex_2f_4ub_2f_2f_28f> vertices(fill_types.size());
+	memset(vertices.data(), 0, vertices.size() * sizeof(Vertex_2f_4ub_2f_2f_28f));
+	std::vector<IndexType> indices(fill_types.size());
+	for (size_t i = 0; i < fill_types.size(); i++) {
+		vertices[i].data0[0] = fill_types[i];
+		indices[i] = (IndexType)i;
+	}
+
+	VertexBuffer vertex_buffer = { VertexBufferFormat::_2f_4ub_2f_2f_28f,
+		(uint32_t)(vertices.size() * sizeof(Vertex_2f_4ub_2f_2f_28f)), (uint8_t*)vertices.data() };
+	IndexBuffer index_buffer = { (uint32_t)(indices.size() * sizeof(IndexType)), (uint8_t*)indices.data() };
+	classifier.SetGeometry(geometry_id, vertex_buffer, index_buffer);
+}
+
+static Command Draw(uint32_t geometry_id, uint32_t offset, uint32_t count,
+	ShaderType shader_type = ShaderType::Fill)
+{
+	Command command = MakeCommand(CommandType::DrawGeometry, 0, geometry_id);
+	command.indices_offset = offset;
+	command.indices_count = count;
+	command.gpu_state.shader_type = shader_type;
+	return command;
+}
+
+TEST(VariantNamesAndTypes)
+{
+	CHECK(GetFillType(FillVariant::Solid) == 0);
+	CHECK(GetFillType(FillVariant::Gradient) == 3);
+	CHECK(GetFillType(FillVariant::BoxShadow) == 8);
+	CHECK(strcmp(GetFillVariantName(FillVariant::Uber), "uber") == 0);
+	CHECK(strcmp(GetFillVariantName(FillVariant::RoundedRect), "rounded rect") == 0);
+}
+
+TEST(UniformRangesGetTheirVariant)
+{
+	FillClassifier classifier;
+	// Solid quad, image quad, box shadow quad.
+	SetFillTypes(classifier, 1, { 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 8, 8, 8, 8, 8, 8 });
+
+	CHECK(classifier.Classify(Draw(1, 0, 6)) == FillVariant::Solid);
+	CHECK(classifier.Classify(Draw(1, 6, 6)) == FillVariant::Image);
+	CHECK(classifier.Classify(Draw(1, 12, 6)) == FillVariant::BoxShadow);
+
+	// Mixed and out of range.
+	CHECK(classifier.Classify(Draw(1, 3, 6)) == FillVariant::Uber);
+	CHECK(classifier.Classify(Draw(1, 15, 6)) == FillVariant::Uber);
+	CHECK(classifier.Classify(Draw(1, 0, 0)) == FillVariant::Uber);
+}
+
+TEST(TypesWithoutVariantUseUber)
+{
+	FillClassifier classifier;
+	// 4 has no specialized variant, float noise rounds to the nearest type.
+	SetFillTypes(classifier, 1, { 4, 4, 4, 2.9999f, 3.0001f, 3 });
+	CHECK(classifier.Classify(Draw(1, 0, 3)) == FillVariant::Uber);
+	CHECK(classifier.Classify(Draw(1, 3, 3)) == FillVariant::Gradient);
+}
+
+TEST(OnlyFillDrawsAreSpecialized)
+{
+	FillClassifier classifier;
+	SetFillTypes(classifier, 1, { 0, 0, 0 });
+	CHECK(classifier.Classify(Draw(1, 0, 3, ShaderType::FillPath)) == FillVariant::Uber);
+	CHECK(classifier.Classify(Draw(2, 0, 3)) == FillVariant::Uber);
+
+	Command clear = Draw(1, 0, 3);
+	clear.command_type = CommandType::ClearRenderBuffer;
+	CHECK(classifier.Classify(clear) == FillVariant::Uber);
+
+	// Path geometry isn't tracked at all.
+	VertexBuffer path = { VertexBufferFormat::_2f_4ub_2f, 0, nullptr };
+	IndexBuffer no_indices = { 0, nullptr };
+	classifier.SetGeometry(3, path, no_indices);
+	CHECK(classifier.Classify(Draw(3, 0, 3)) == FillVariant::Uber);
+
+	classifier.RemoveGeometry(1);
+	CHECK(classifier.Classify(Draw(1, 0, 3)) == FillVariant::Uber);
+}
+
+TEST(UpdatesReplaceCachedRanges)
+{
+	FillClassifier classifier;
+	SetFillTypes(classifier, 1, { 0, 0, 0 });
+	CHECK(classifier.Classify(Draw(1, 0, 3)) == FillVariant::Solid);
+	SetFillTypes(classifier, 1, { 7, 7, 7 });
+	CHECK(classifier.Classify(Draw(1, 0, 3)) == FillVariant::RoundedRect);
+}
+
+TEST(Histogram)
+{
+	FillClassifier classifier;
+	SetFillTypes(classifier, 1, { 0, 0, 0, 1, 1, 1 });
+	classifier.Classify(Draw(1, 0, 3));
+	classifier.Classify(Draw(1, 0, 3));
+	classifier.Classify(Draw(1, 3, 3));
+	classifier.Classify(Draw(1, 0, 6));
+
+	const uint64_t* histogram = classifier.histogram();
+	CHECK(histogram[(size_t)FillVariant::Solid] == 2);
+	CHECK(histogram[(size_t)FillVariant::Image] == 1);
+	CHECK(histogram[(size_t)FillVariant::Uber] == 1);
+	CHECK(histogram[(size_t)FillVariant::Gradient] == 0);
+}
@@ -0,0 +1,71 @@
+#include "Test.h"
+
+#include "gpu/FrameReuse.h"
+
+TEST(HashBytesIsFnv1a)
+{
+	CHECK(HashBytes("", 0) == 14695981039346656037ull);
+	CHECK(HashBytes("a", 1) == 0xaf63dc4c8601ec8cull);
+	CHECK(HashBytes("foobar", 6) == 0x85944171f73967e8ull);
+	CHECK(HashValue<uint32_t>(1) != HashValue<uint32_t>(2));
+}
+
+TEST(HashCommandListDependsOnContents)
+{
+	Command commands[3] = {
+		MakeCommand(CommandType::ClearRenderBuffer, 1),
+		MakeCommand(CommandType::DrawGeometry, 1, 10),
+		MakeCommand(CommandType::DrawGeometry, 1, 11),
+	};
+
+	uint64_t signature = HashCommandList(commands, 3);
+	CHECK(signature != 0);
+	CHECK(HashCommandList(commands, 3) == signature);
+	CHECK(HashCommandList(commands, 2) != signature);
+
+	commands[2].gpu_state.uniform_scalar[0] = 1.0f;
+	CHECK(HashCommandList(commands, 3) != signature);
+
+	CHECK(HashCommandList(commands, 0) != 0);
+}
+
+TEST(DrawIntoUnclearedBufferIsNotReusable)
+{
+	Command commands[3] = {
+		MakeCommand(CommandType::ClearRenderBuffer, 1),
+		MakeCommand(CommandType::DrawGeometry, 1, 10),
+		MakeCommand(CommandType::DrawGeometry, 2, 10),
+	};
+
+	CHECK(HashCommandList(commands, 2) != 0);
+	CHECK(HashCommandList(commands, 3) == 0);
+
+	// Clearing after drawing doesn't help, the draw blends over the previous frame.
+	Command late[2] = {
+		MakeCommand(CommandType::DrawGeometry, 1, 10),
+		MakeCommand(CommandType::ClearRenderBuffer, 1),
+	};
+	CHECK(HashCommandList(late, 2) == 0);
+}
+
+TEST(MatchesPreviousFrameOnly)
+{
+	FrameReuse reuse;
+	CHECK(!reuse.Matches(5));
+	CHECK(reuse.Matches(5));
+	CHECK(reuse.Matches(5));
+	CHECK(!reuse.Matches(6));
+	CHECK(!reuse.Matches(5));
+	CHECK(reuse.frames() == 5);
+	CHECK(reuse.skipped() == 2);
+	CHECK(reuse.skip_ratio() == 2.0 / 5);
+
+	// 0 is "not reusable".
+	CHECK(!reuse.Matches(0));
+	CHECK(!reuse.Matches(0));
+
+	reuse.Matches(7);
+	reuse.Invalidate();
+	CHECK(!reuse.Matches(7));
+	CHECK(reuse.Matches(7));
+}
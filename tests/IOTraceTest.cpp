@@ -0,0 +1,181 @@
+#include "Test.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#include "IOTrace.h"
+
+TEST(RecordsFirstAccessesInWindow)
+{
+	IOTraceRecorder recorder(100);
+	CHECK(recorder.Record(IOTraceEntry::Open, "app.html", 1000));
+	CHECK(recorder.Record(IOTraceEntry::Exists, "a.js", 1005));
+	CHECK(recorder.Record(IOTraceEntry::Open, "a.js", 1010));
+	CHECK(recorder.Record(IOTraceEntry::Open, "a.js", 1011));
+	CHECK(recorder.Record(IOTraceEntry::Open, "bad\tpath", 1012));
+	CHECK(recorder.Record(IOTraceEntry::Open, "", 1013));
+	CHECK(!recorder.is_finished(1100));
+	CHECK(!recorder.Record(IOTraceEntry::Open, "late.js", 1200));
+	CHECK(recorder.is_finished(1200));
+
+	const std::vector<IOTraceEntry>& entries = recorder.entries();
+	REQUIRE(entries.size() == 3);
+	CHECK(entries[0].path == "app.html" && entries[0].time_ms == 0);
+	CHECK(entries[1].op == IOTraceEntry::Exists);
+	CHECK(entries[2].op == IOTraceEntry::Open && entries[2].time_ms == 10);
+}
+
+TEST(SerializeRoundTrips)
+{
+	IOTraceRecorder recorder(1000);
+	recorder.Record(IOTraceEntry::Open, "app.html", 0);
+	recorder.Record(IOTraceEntry::Exists, "assets/a b.js", 2.5);
+
+	std::string text = recorder.Serialize();
+	CHECK(text == "open\t0\tapp.html\nexists\t2.5\tassets/a b.js\n");
+
+	std::vector<IOTraceEntry> entries;
+	REQUIRE(IOTraceRecorder::Parse(text, entries));
+	REQUIRE(entries.size() == 2);
+	CHECK(entries[1].op == IOTraceEntry::Exists);
+	CHECK(entries[1].time_ms == 2.5);
+	CHECK(entries[1].path == "assets/a b.js");
+
+	// CRLF and blank lines are fine, unknown ops and missing fields are not.
+	CHECK(IOTraceRecorder::Parse("open\t1\tx\r\n\r\n", entries) && entries.size() == 1 && entries[0].path == "x");
+	CHECK(!IOTraceRecorder::Parse("bogus\t1\tx\n", entries));
+	CHECK(!IOTraceRecorder::Parse("open\t1\n", entries));
+	CHECK(!IOTraceRecorder::Parse("open\t1\t\n", entries));
+}
+
+// Loads "contents of <path>", blocking on paths listed in |held| until Release.
+class GatedLoader {
+public:
+	bool Load(const std::string& path, std::vector<uint8_t>& data)
+	{
+		std::unique_lock<std::mutex> lock(mutex_);
+		loaded_paths.push_back(path);
+		changed_.notify_all();
+		changed_.wait(lock, [&]() { return !held.count(path); });
+
+		if (path == "missing")
+			return false;
+		std::string contents = "contents of " + path;
+		data.assign(contents.begin(), contents.end());
+		return true;
+	}
+
+	// Block until the loader was called for path.
+	void WaitForLoad(const std::string& path)
+	{
+		std::unique_lock<std::mutex> lock(mutex_);
+		changed_.wait(lock, [&]() {
+			return std::find(loaded_paths.begin(), loaded_paths.end(), path) != loaded_paths.end();
+		});
+	}
+
+	void Release(const std::string& path)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		held.erase(path);
+		changed_.notify_all();
+	}
+
+	IOPrefetcher::Loader loader()
+	{
+		return [this](const std::string& path, std::vector<uint8_t>& data) { return Load(path, data); };
+	}
+
+	std::set<std::string> held;
+	std::vector<std::string> loaded_paths;
+
+protected:
+	std::mutex mutex_;
+	std::condition_variable changed_;
+};
+
+static std::string Text(const std::vector<uint8_t>& data)
+{
+	return std::string(data.begin(), data.end());
+}
+
+static void WaitForLoaded(const IOPrefetcher& prefetcher, uint32_t count)
+{
+	while (prefetcher.stats().loaded < count)
+		std::this_thread::yield();
+}
+
+TEST(PrefetchesAndHandsOutOnce)
+{
+	GatedLoader loader;
+	IOPrefetcher prefetcher(loader.loader(), 1 << 20);
+	prefetcher.Start({ "a", "b", "missing", "unused", "a" }, 3);
+	WaitForLoaded(prefetcher, 3);
+	loader.WaitForLoad("missing");
+
+	std::vector<uint8_t> data;
+	CHECK(prefetcher.Take("a", data) && Text(data) == "contents of a");
+	CHECK(!prefetcher.Take("a", data));
+	CHECK(prefetcher.Take("b", data) && Text(data) == "contents of b");
+	CHECK(!prefetcher.Take("missing", data));
+	CHECK(!prefetcher.Take("not in trace", data));
+
+	PrefetchStats stats = prefetcher.stats();
+	CHECK(stats.files == 4);
+	CHECK(stats.loaded == 3);
+	CHECK(stats.hits == 2);
+	CHECK(stats.misses == 3);
+	CHECK(stats.wasted == 1 && stats.wasted_bytes == 18);
+	CHECK(stats.waits == 0);
+}
+
+TEST(TakeWaitsForReadInFlight)
+{
+	GatedLoader loader;
+	loader.held.insert("slow");
+	IOPrefetcher prefetcher(loader.loader(), 1 << 20);
+	prefetcher.Start({ "slow" }, 1);
+	loader.WaitForLoad("slow");
+
+	std::thread releaser([&]() {
+		while (prefetcher.stats().waits == 0)
+			std::this_thread::yield();
+		loader.Release("slow");
+	});
+
+	std::vector<uint8_t> data;
+	CHECK(prefetcher.Take("slow", data) && Text(data) == "contents of slow");
+	releaser.join();
+	CHECK(prefetcher.stats().waits == 1);
+}
+
+TEST(QueuedFilesTakenEarlyAreNotRead)
+{
+	GatedLoader loader;
+	loader.held.insert("first");
+	{
+		IOPrefetcher prefetcher(loader.loader(), 1 << 20);
+		prefetcher.Start({ "first", "second" }, 1);
+		loader.WaitForLoad("first");
+
+		std::vector<uint8_t> data;
+		CHECK(!prefetcher.Take("second", data));
+		loader.Release("first");
+	}
+	CHECK(loader.loaded_paths == std::vector<std::string>({ "first" }));
+}
+
+TEST(StopsAtByteBudget)
+{
+	GatedLoader loader;
+	{
+		// Each file is 13 bytes, the third starts past the budget.
+		IOPrefetcher prefetcher(loader.loader(), 20);
+		prefetcher.Start({ "x", "y", "z" }, 1);
+		WaitForLoaded(prefetcher, 2);
+	}
+	CHECK(loader.loaded_paths == std::vector<std::string>({ "x", "y" }));
+}
@@ -0,0 +1,137 @@
+#include "Test.h"
+
+#include <map>
+
+#include "gpu/MSAAPolicy.h"
+
+TEST(PreferredSamplesByArea)
+{
+	MSAAPolicy policy;
+	CHECK(policy.PreferredSamples(400, 60) == 8);
+	CHECK(policy.PreferredSamples(1280, 720) == 8);
+	CHECK(policy.PreferredSamples(1281, 720) == 4);
+	CHECK(policy.PreferredSamples(1920, 1080) == 4);
+	CHECK(policy.PreferredSamples(3840, 2160) == 2);
+
+	MSAAPolicyConfig config;
+	config.max_samples = 2;
+	policy.set_config(config);
+	CHECK(policy.PreferredSamples(400, 60) == 2);
+	CHECK(policy.PreferredSamples(1920, 1080) == 1);
+	CHECK(policy.PreferredSamples(3840, 2160) == 1);
+
+	config.max_samples = 1;
+	policy.set_config(config);
+	CHECK(policy.PreferredSamples(1, 1) == 1);
+}
+
+TEST(AtlasSizedTargetsStaySingleSample)
+{
+	MSAAPolicy policy;
+	MSAAPolicyConfig config;
+	config.atlas_region_size = 512;
+	policy.set_config(config);
+
+	CHECK(policy.PreferredSamples(400, 60) == 1);
+	CHECK(policy.PreferredSamples(512, 512) == 1);
+	CHECK(policy.PreferredSamples(513, 512) == 8);
+	CHECK(policy.PreferredSamples(300, 600) == 8);
+	CHECK(policy.PreferredSamples(1920, 1080) == 4);
+
+	// They take nothing from the budget.
+	CHECK(policy.Acquire(1, 400, 60) == 1);
+	CHECK(policy.used_bytes() == 0);
+	CHECK(policy.Acquire(2, 800, 600) == 8);
+	CHECK(policy.used_bytes() == MSAAPolicy::OverheadBytes(800, 600, 8));
+}
+
+TEST(OverheadBytes)
+{
+	CHECK(MSAAPolicy::OverheadBytes(100, 100, 1) == 0);
+	CHECK(MSAAPolicy::OverheadBytes(100, 100, 4) == 100 * 100 * 4 * 4);
+}
+
+// Stands in for the driver: creates and destroys render targets through the policy.
+class MockDriver {
+public:
+	explicit MockDriver(MSAAPolicy& policy) : policy_(policy) {}
+
+	uint32_t CreateRenderTarget(uint32_t width, uint32_t height)
+	{
+		uint32_t id = next_id_++;
+		samples_[id] = policy_.Acquire(id, width, height);
+		return id;
+	}
+
+	void ResizeRenderTarget(uint32_t id, uint32_t width, uint32_t height)
+	{
+		samples_[id] = policy_.Acquire(id, width, height);
+	}
+
+	void DestroyRenderTarget(uint32_t id)
+	{
+		policy_.Release(id);
+		samples_.erase(id);
+	}
+
+	uint32_t samples(uint32_t id) const { return samples_.at(id); }
+
+protected:
+	MSAAPolicy& policy_;
+	uint32_t next_id_ = 1;
+	std::map<uint32_t, uint32_t> samples_;
+};
+
+TEST(BudgetHalvesSamples)
+{
+	MSAAPolicy policy;
+	MSAAPolicyConfig config;
+	config.memory_budget = MSAAPolicy::OverheadBytes(800, 800, 8) + MSAAPolicy::OverheadBytes(800, 800, 2);
+	policy.set_config(config);
+	MockDriver driver(policy);
+
+	uint32_t first = driver.CreateRenderTarget(800, 800);
+	CHECK(driver.samples(first) == 8);
+
+	// Only room for 2x left.
+	uint32_t second = driver.CreateRenderTarget(800, 800);
+	CHECK(driver.samples(second) == 2);
+
+	// Budget exhausted, falls back to single-sample and charges nothing.
+	uint32_t third = driver.CreateRenderTarget(800, 800);
+	CHECK(driver.samples(third) == 1);
+	CHECK(policy.used_bytes() == config.memory_budget);
+
+	// Freed memory goes to the next target.
+	driver.DestroyRenderTarget(first);
+	CHECK(policy.used_bytes() == MSAAPolicy::OverheadBytes(800, 800, 2));
+	uint32_t fourth = driver.CreateRenderTarget(800, 800);
+	CHECK(driver.samples(fourth) == 8);
+
+	driver.DestroyRenderTarget(second);
+	driver.DestroyRenderTarget(third);
+	driver.DestroyRenderTarget(fourth);
+	CHECK(policy.used_bytes() == 0);
+}
+
+TEST(ResizeReleasesOldCharge)
+{
+	MSAAPolicy policy;
+	MockDriver driver(policy);
+
+	uint32_t id = driver.CreateRenderTarget(400, 60);
+	CHECK(policy.used_bytes() == MSAAPolicy::OverheadBytes(400, 60, 8));
+
+	driver.ResizeRenderTarget(id, 1920, 1080);
+	CHECK(driver.samples(id) == 4);
+	CHECK(policy.used_bytes() == MSAAPolicy::OverheadBytes(1920, 1080, 4));
+
+	driver.ResizeRenderTarget(id, 400, 60);
+	CHECK(policy.used_bytes() == MSAAPolicy::OverheadBytes(400, 60, 8));
+
+	// Releasing twice, or an unknown id, is harmless.
+	driver.DestroyRenderTarget(id);
+	policy.Release(id);
+	policy.Release(12345);
+	CHECK(policy.used_bytes() == 0);
+}
@@ -0,0 +1,125 @@
+#include "Test.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "gpu/OcclusionCuller.h"
+
+typedef OcclusionCuller::Result Result;
+
+TEST(CullsCoveredAndOffscreen)
+{
+	OcclusionCuller culler;
+	culler.Begin(100, 100);
+	culler.Add({ 0, 0, 50, 50 }, false);     // covered by the next two opaque ones together
+	culler.Add({ 200, 0, 300, 50 }, true);   // outside the window
+	culler.Add({ 0, 0, 30, 50 }, true);
+	culler.Add({ 30, 0, 60, 50 }, true);
+	culler.Add({ 10, 10, 20, 20 }, false);
+	culler.Cull();
+
+	CHECK(culler.result(0) == Result::Occluded);
+	CHECK(culler.result(1) == Result::Offscreen);
+	CHECK(culler.result(2) == Result::Visible);
+	CHECK(culler.result(3) == Result::Visible);
+	CHECK(culler.result(4) == Result::Visible);
+	CHECK(culler.is_culled(0) && !culler.is_culled(4));
+	CHECK(culler.frame_stats().overlays == 5);
+	CHECK(culler.frame_stats().occluded == 1 && culler.frame_stats().offscreen == 1);
+}
+
+TEST(TransparentOverlaysAndGapsDontOcclude)
+{
+	OcclusionCuller culler;
+	culler.Begin(100, 100);
+	culler.Add({ 0, 0, 50, 50 }, true);
+	culler.Add({ 0, 0, 50, 50 }, false);
+	culler.Add({ 0, 0, 25, 50 }, true);
+	culler.Add({ 26, 0, 50, 50 }, true);
+	culler.Cull();
+	CHECK(culler.result(0) == Result::Visible);
+}
+
+TEST(OnlyTheOnscreenPartMustBeCovered)
+{
+	OcclusionCuller culler;
+	culler.Begin(100, 100);
+	culler.Add({ -50, -50, 100, 100 }, true);
+	culler.Add({ 0, 0, 100, 100 }, true);
+	culler.Cull();
+	CHECK(culler.result(0) == Result::Occluded);
+
+	// Totals add up over frames.
+	culler.Begin(10, 10);
+	culler.Add({ 20, 20, 30, 30 }, true);
+	culler.Cull();
+	CHECK(culler.total_stats().frames == 2);
+	CHECK(culler.total_stats().occluded == 1);
+	CHECK(culler.total_stats().offscreen == 1);
+}
+
+TEST(TooManyFragmentsStaysVisible)
+{
+	OcclusionCuller culler;
+	culler.Begin(1000, 1000);
+	culler.Add({ 0, 0, 1000, 1000 }, true);
+	for (int i = 0; i < 100; i++)
+		culler.Add({ i * 10, i * 10, i * 10 + 5, i * 10 + 5 }, true);
+	culler.Cull();
+	CHECK(culler.result(0) == Result::Visible);
+}
+
+// Random layouts against a per-pixel answer. The culler may keep a covered overlay when it runs
+// out of fragments, but must never cull a visible one.
+TEST(MatchesPixelCoverage)
+{
+	std::mt19937 random(43);
+	const int size = 64;
+	int matches = 0, total = 0;
+
+	for (int round = 0; round < 500; round++) {
+		std::vector<IntRect> bounds;
+		std::vector<bool> opaque;
+		int count = random() % 8 + 1;
+		for (int i = 0; i < count; i++) {
+			int left = (int)(random() % 80) - 8, top = (int)(random() % 80) - 8;
+			bounds.push_back({ left, top, left + (int)(random() % 48) + 1, top + (int)(random() % 48) + 1 });
+			opaque.push_back(random() % 4 != 0);
+		}
+
+		OcclusionCuller culler;
+		culler.Begin(size, size);
+		for (int i = 0; i < count; i++)
+			culler.Add(bounds[i], opaque[i]);
+		culler.Cull();
+
+		// Walk top down, painting opaque pixels as they are passed.
+		std::vector<bool> covered(size * size, false);
+		for (int i = count; i-- > 0;) {
+			bool onscreen = false, visible = false;
+			for (int y = std::max(bounds[i].top, 0); y < std::min(bounds[i].bottom, size); y++) {
+				for (int x = std::max(bounds[i].left, 0); x < std::min(bounds[i].right, size); x++) {
+					onscreen = true;
+					visible |= !covered[y * size + x];
+				}
+			}
+
+			Result expected = !onscreen ? Result::Offscreen : visible ? Result::Visible : Result::Occluded;
+			Result actual = culler.result(i);
+			CHECK(actual == expected || (actual == Result::Visible && expected == Result::Occluded));
+			matches += actual == expected;
+			total++;
+
+			if (opaque[i] && visible) {
+				for (int y = std::max(bounds[i].top, 0); y < std::min(bounds[i].bottom, size); y++) {
+					for (int x = std::max(bounds[i].left, 0); x < std::min(bounds[i].right, size); x++)
+						covered[y * size + x] = true;
+				}
+			}
+		}
+	}
+
+	// A handful of overlays never runs out of fragments.
+	CHECK(matches == total);
+}
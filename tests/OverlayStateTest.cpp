@@ -0,0 +1,347 @@
+#include "Test.h"
+
+#include <memory>
+#include <vector>
+
+#include "OverlayState.h"
+
+// An overlay reduced to what OverlayManager::Render looks at, with a view that is dirty or not.
+struct TestOverlay {
+	explicit TestOverlay(const bool& window_visible, TestOverlay* source = nullptr) :
+		state([&window_visible]() { return window_visible; }, source ? &source->state : nullptr) {}
+
+	OverlayState state;
+	bool view_dirty = true;
+	int renders = 0;
+	int composites = 0;
+};
+
+// The selection OverlayManager::Render makes, returns how many views it passes to RenderOnly.
+static size_t RenderFrame(const std::vector<TestOverlay*>& overlays)
+{
+	for (auto overlay : overlays) {
+		// Overlay::Resume marks the view dirty so it catches up in one frame.
+		if (overlay->state.UpdateSuspension() && !overlay->state.is_suspended()
+			&& !overlay->state.is_mirror())
+			overlay->view_dirty = true;
+	}
+
+	size_t rendered = 0;
+	for (auto overlay : overlays) {
+		if (!overlay->state.NeedsRender() || !overlay->view_dirty)
+			continue;
+
+		overlay->state.OnRender();
+		overlay->view_dirty = false;
+		overlay->renders++;
+		rendered++;
+	}
+
+	return rendered;
+}
+
+// OverlayManager::PrepareComposite, returns how many quads are drawn.
+static size_t CompositeFrame(const std::vector<TestOverlay*>& overlays)
+{
+	size_t drawn = 0;
+	for (auto overlay : overlays) {
+		if (!overlay->state.is_drawn())
+			continue;
+
+		overlay->state.OnComposite();
+		overlay->composites++;
+		drawn++;
+	}
+
+	return drawn;
+}
+
+static bool NeedsRepaint(const TestOverlay& overlay)
+{
+	return overlay.state.NeedsRepaint(overlay.view_dirty, false);
+}
+
+TEST(HideAndShowOverlay)
+{
+	bool window_visible = true;
+	TestOverlay overlay(window_visible);
+	CHECK(!overlay.state.ShouldSuspend());
+	CHECK(!overlay.state.UpdateSuspension());
+	CHECK(overlay.state.is_drawn());
+
+	overlay.state.Hide();
+	CHECK(overlay.state.suspension_pending());
+	CHECK(overlay.state.UpdateSuspension());
+	CHECK(overlay.state.is_suspended());
+	CHECK(!overlay.state.NeedsRender());
+	CHECK(!overlay.state.is_drawn());
+	CHECK(!overlay.state.UpdateSuspension());
+	CHECK(!overlay.state.suspension_pending());
+
+	overlay.state.set_needs_update(false);
+	overlay.state.Show();
+	CHECK(overlay.state.needs_update());
+	CHECK(overlay.state.suspension_pending());
+	CHECK(overlay.state.UpdateSuspension());
+	CHECK(!overlay.state.is_suspended());
+	CHECK(overlay.state.NeedsRender());
+}
+
+TEST(HideAndShowWindow)
+{
+	bool window_visible = true;
+	TestOverlay overlay(window_visible);
+
+	window_visible = false;
+	CHECK(overlay.state.UpdateSuspension());
+	CHECK(overlay.state.is_suspended());
+	CHECK(!overlay.state.is_hidden());
+
+	// Showing the window doesn't resume an overlay that was hidden meanwhile.
+	overlay.state.Hide();
+	window_visible = true;
+	CHECK(!overlay.state.UpdateSuspension());
+	CHECK(overlay.state.is_suspended());
+
+	overlay.state.set_needs_update(false);
+	overlay.state.Show();
+	CHECK(overlay.state.UpdateSuspension());
+	CHECK(!overlay.state.is_suspended());
+	CHECK(overlay.state.needs_update());
+}
+
+TEST(SingleCatchUpFrame)
+{
+	bool window_visible = true;
+	TestOverlay overlay(window_visible);
+	std::vector<TestOverlay*> overlays = { &overlay };
+	CHECK(RenderFrame(overlays) == 1);
+	CHECK(RenderFrame(overlays) == 0);
+
+	// Changes made while hidden aren't rendered.
+	overlay.state.Hide();
+	for (int frame = 0; frame < 5; frame++) {
+		overlay.view_dirty = frame % 2 == 0;
+		CHECK(RenderFrame(overlays) == 0);
+	}
+	CHECK(overlay.renders == 1);
+
+	// One frame brings the view up to date, then it's idle again.
+	overlay.state.Show();
+	CHECK(RenderFrame(overlays) == 1);
+	CHECK(RenderFrame(overlays) == 0);
+	CHECK(RenderFrame(overlays) == 0);
+	CHECK(overlay.renders == 2);
+
+	// Also when nothing changed while hidden, the page may have throttled itself.
+	overlay.state.Hide();
+	RenderFrame(overlays);
+	overlay.state.Show();
+	CHECK(RenderFrame(overlays) == 1);
+	CHECK(overlay.renders == 3);
+}
+
+TEST(ShownMirrorKeepsHiddenSourceAwake)
+{
+	bool window_visible = true;
+	bool mirror_window_visible = true;
+	TestOverlay source(window_visible);
+	TestOverlay mirror(mirror_window_visible, &source);
+	CHECK(mirror.state.is_mirror());
+	CHECK(mirror.state.source() == &source.state);
+
+	source.state.Hide();
+	CHECK(!source.state.UpdateSuspension());
+	CHECK(!source.state.is_suspended());
+	CHECK(source.state.NeedsRender());
+	CHECK(!source.state.is_drawn());
+
+	// The source's window renders the view, the mirror only composites it.
+	std::vector<TestOverlay*> overlays = { &source, &mirror };
+	CHECK(RenderFrame(overlays) == 1);
+	CHECK(mirror.renders == 0);
+
+	// Nothing shows the view anymore.
+	mirror_window_visible = false;
+	CHECK(source.state.suspension_pending());
+	RenderFrame(overlays);
+	CHECK(source.state.is_suspended());
+	CHECK(mirror.state.is_suspended());
+
+	mirror_window_visible = true;
+	source.view_dirty = false;
+	CHECK(RenderFrame(overlays) == 1);
+	CHECK(!source.state.is_suspended());
+
+	// An occluded source still renders for a mirror that is on screen.
+	source.state.Show();
+	source.state.set_occluded(true);
+	CHECK(source.state.NeedsRender());
+	mirror.state.set_occluded(true);
+	CHECK(!source.state.NeedsRender());
+}
+
+TEST(RenderOnlySkipsHiddenViews)
+{
+	bool window_visible = true;
+	std::vector<std::unique_ptr<TestOverlay>> owned;
+	std::vector<TestOverlay*> overlays;
+	for (int i = 0; i < 10; i++) {
+		owned.emplace_back(new TestOverlay(window_visible));
+		overlays.push_back(owned.back().get());
+	}
+
+	// Two of ten shown, every view changes every frame.
+	for (int i = 2; i < 10; i++)
+		overlays[i]->state.Hide();
+
+	size_t rendered = 0;
+	size_t skipped = 0;
+	for (int frame = 0; frame < 60; frame++) {
+		for (auto overlay : overlays)
+			overlay->view_dirty = true;
+		size_t count = RenderFrame(overlays);
+		rendered += count;
+		skipped += overlays.size() - count;
+	}
+	CHECK(rendered == 2 * 60);
+	CHECK(skipped == 8 * 60);
+
+	// A hidden window skips all of them.
+	window_visible = false;
+	overlays[0]->view_dirty = true;
+	CHECK(RenderFrame(overlays) == 0);
+	CHECK(overlays[0]->view_dirty);
+}
+
+TEST(MirrorRecompositesNewContents)
+{
+	bool window_visible = true;
+	TestOverlay source(window_visible);
+	TestOverlay mirror(window_visible, &source);
+	std::vector<TestOverlay*> overlays = { &source, &mirror };
+	CHECK(NeedsRepaint(mirror));
+
+	RenderFrame(overlays);
+	CompositeFrame(overlays);
+	CHECK(!NeedsRepaint(source));
+	CHECK(!NeedsRepaint(mirror));
+	CHECK(mirror.state.content_version() == source.state.content_version());
+
+	// The mirror's own view flag doesn't matter, the source's render does.
+	mirror.view_dirty = true;
+	CHECK(!NeedsRepaint(mirror));
+	source.view_dirty = true;
+	CHECK(NeedsRepaint(source));
+	RenderFrame(overlays);
+	CHECK(!NeedsRepaint(source));
+	CHECK(NeedsRepaint(mirror));
+
+	// Until the new contents were composited, also when that waits for the mirror to be uncovered.
+	mirror.state.set_occluded(true);
+	CHECK(!NeedsRepaint(mirror));
+	CompositeFrame(overlays);
+	CHECK(!mirror.state.needs_update());
+	mirror.state.set_occluded(false);
+	CHECK(NeedsRepaint(mirror));
+	CompositeFrame(overlays);
+	CHECK(!NeedsRepaint(mirror));
+}
+
+TEST(MirrorKeepsHiddenSourceAlive)
+{
+	bool window_visible = true;
+	TestOverlay source(window_visible);
+	TestOverlay mirror(window_visible, &source);
+	std::vector<TestOverlay*> overlays = { &source, &mirror };
+
+	source.state.Hide();
+	RenderFrame(overlays);
+	CHECK(CompositeFrame(overlays) == 1);
+	CHECK(!source.state.is_suspended());
+	CHECK(source.composites == 0);
+
+	// The hidden source still renders for the mirror.
+	source.view_dirty = true;
+	CHECK(NeedsRepaint(source));
+	CHECK(RenderFrame(overlays) == 1);
+	CHECK(NeedsRepaint(mirror));
+	CHECK(CompositeFrame(overlays) == 1);
+	CHECK(mirror.composites == 2);
+}
+
+TEST(MirrorOfMirrorShowsOriginal)
+{
+	bool window_visible = true;
+	TestOverlay source(window_visible);
+	std::unique_ptr<TestOverlay> mirror(new TestOverlay(window_visible, &source));
+	TestOverlay mirror_of_mirror(window_visible, mirror.get());
+	CHECK(mirror_of_mirror.state.source() == &source.state);
+	CHECK(source.state.mirrors().size() == 2);
+	CHECK(mirror->state.mirrors().empty());
+
+	// Destroying the middle mirror doesn't affect the other one.
+	mirror.reset();
+	CHECK(source.state.mirrors().size() == 1);
+	CHECK(source.state.mirrors()[0] == &mirror_of_mirror.state);
+
+	source.state.Hide();
+	CHECK(!source.state.ShouldSuspend());
+	mirror_of_mirror.state.Hide();
+	CHECK(source.state.ShouldSuspend());
+}
+
+TEST(SuspendingMirrorLeavesSourceAlone)
+{
+	bool window_visible = true;
+	bool mirror_window_visible = true;
+	TestOverlay source(window_visible);
+	TestOverlay mirror(mirror_window_visible, &source);
+	std::vector<TestOverlay*> overlays = { &source, &mirror };
+	RenderFrame(overlays);
+	CompositeFrame(overlays);
+
+	mirror_window_visible = false;
+	CHECK(!source.state.suspension_pending());
+	RenderFrame(overlays);
+	CHECK(mirror.state.is_suspended());
+	CHECK(!source.state.is_suspended());
+	CHECK(source.state.NeedsRender());
+	CHECK(!mirror.state.NeedsRepaint(true, true));
+
+	// Resuming the mirror doesn't mark the shared view dirty.
+	mirror_window_visible = true;
+	CHECK(RenderFrame(overlays) == 0);
+	CHECK(!mirror.state.is_suspended());
+	CHECK(!source.view_dirty);
+	CHECK(source.renders == 1);
+}
+
+TEST(MirrorsShareOneView)
+{
+	const size_t kMirrors = 8;
+	bool window_visible = true;
+	TestOverlay source(window_visible);
+	std::vector<std::unique_ptr<TestOverlay>> mirrors;
+	std::vector<TestOverlay*> overlays = { &source };
+	for (size_t i = 0; i < kMirrors; i++) {
+		mirrors.emplace_back(new TestOverlay(window_visible, &source));
+		overlays.push_back(mirrors.back().get());
+	}
+
+	// Every overlay that isn't a mirror owns a view and its render target.
+	size_t views = 0;
+	for (auto overlay : overlays)
+		views += overlay->state.is_mirror() ? 0 : 1;
+	CHECK(views == 1);
+
+	for (int frame = 0; frame < 10; frame++) {
+		for (auto overlay : overlays)
+			overlay->view_dirty = true;
+		CHECK(RenderFrame(overlays) == 1);
+		CHECK(CompositeFrame(overlays) == kMirrors + 1);
+	}
+	CHECK(source.renders == 10);
+	for (auto& mirror : mirrors)
+		CHECK(mirror->renders == 0 && mirror->composites == 10);
+}
@@ -0,0 +1,94 @@
+#include "Test.h"
+
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+#include "PhaseGraph.h"
+
+// a (main) -> b, c; d has no dependencies; e (main) waits for b, c and d.
+struct Startup {
+	PhaseGraph graph;
+	std::mutex mutex;
+	std::vector<std::string> order;
+	std::vector<std::thread::id> threads;
+
+	Startup()
+	{
+		PhaseGraph::Phase a = graph.Add("a", Step(0, 5), {}, true);
+		PhaseGraph::Phase b = graph.Add("b", Step(1, 30), { a });
+		PhaseGraph::Phase c = graph.Add("c", Step(2, 30), { a });
+		PhaseGraph::Phase d = graph.Add("d", Step(3, 30));
+		graph.Add("e", Step(4, 1), { b, c, d }, true);
+		threads.resize(5);
+	}
+
+	std::function<void()> Step(size_t phase, int ms)
+	{
+		return [this, phase, ms]() {
+			std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+			std::lock_guard<std::mutex> lock(mutex);
+			order.push_back(graph.timings()[phase].name);
+			threads[phase] = std::this_thread::get_id();
+		};
+	}
+
+	const PhaseTiming& timing(size_t phase) const { return graph.timings()[phase]; }
+};
+
+TEST(SerialRunsInAddOrder)
+{
+	Startup startup;
+	startup.graph.Run(false);
+
+	CHECK(startup.order == std::vector<std::string>({ "a", "b", "c", "d", "e" }));
+	for (size_t phase = 0; phase < 5; phase++) {
+		CHECK(startup.threads[phase] == std::this_thread::get_id());
+		CHECK(startup.timing(phase).main_thread);
+		if (phase)
+			CHECK(startup.timing(phase).start_ms >= startup.timing(phase - 1).end_ms);
+	}
+	CHECK(startup.timing(4).end_ms >= 95.0);
+}
+
+TEST(ParallelRespectsDependencies)
+{
+	Startup startup;
+	startup.graph.Run(true);
+
+	REQUIRE(startup.order.size() == 5);
+	CHECK(startup.order.back() == "e");
+
+	// Dependencies finished before their dependents started.
+	CHECK(startup.timing(1).start_ms >= startup.timing(0).end_ms);
+	CHECK(startup.timing(2).start_ms >= startup.timing(0).end_ms);
+	for (size_t phase = 1; phase < 4; phase++)
+		CHECK(startup.timing(4).start_ms >= startup.timing(phase).end_ms);
+
+	// Main thread phases stay on the calling thread, the others don't.
+	CHECK(startup.threads[0] == std::this_thread::get_id());
+	CHECK(startup.threads[4] == std::this_thread::get_id());
+	CHECK(startup.threads[1] != std::this_thread::get_id());
+	CHECK(!startup.timing(1).main_thread);
+
+	// b, c and d ran at the same time.
+	CHECK(startup.timing(2).start_ms < startup.timing(1).end_ms);
+	CHECK(startup.timing(3).start_ms < startup.timing(1).end_ms);
+}
+
+TEST(Report)
+{
+	PhaseGraph graph;
+	graph.Add("window", []() {}, {}, true);
+	graph.Add("fonts", []() {});
+	graph.Run(true);
+
+	std::string report = graph.Report();
+	CHECK(report.find("window: ") == 0);
+	CHECK(report.find(" ms (main)\nfonts: ") != std::string::npos);
+	CHECK(report.find("\ntotal: ") != std::string::npos);
+
+	PhaseGraph empty;
+	empty.Run(true);
+	CHECK(empty.Report() == "total: 0.00 ms");
+}
@@ -0,0 +1,121 @@
+#include "Test.h"
+
+#include "gpu/RenderPassGraph.h"
+
+typedef std::vector<uint32_t> Commands;
+
+TEST(MergesIndependentPassesOnOneTarget)
+{
+	RenderPassGraph graph;
+	graph.Begin();
+	graph.AddDraw(1, 0, 0, 0, false);
+	graph.AddDraw(2, 1, 0, 0, false);
+	graph.AddDraw(1, 2, 0, 0, false);
+	graph.AddDraw(2, 3, 0, 0, false);
+
+	Commands commands;
+	graph.Build(commands, { 1, 2 });
+	CHECK(commands == Commands({ 0, 2, 1, 3 }));
+	CHECK(graph.frame_stats().passes == 4);
+	CHECK(graph.frame_stats().merged_passes == 2);
+}
+
+TEST(KeepsOrderAcrossSampling)
+{
+	RenderPassGraph graph;
+	graph.Begin();
+	// Target 2 samples target 1 in between two passes on target 1.
+	graph.AddDraw(1, 0, 0, 0, false);
+	graph.AddDraw(2, 1, 1, 0, false);
+	graph.AddDraw(1, 2, 0, 0, false);
+
+	Commands commands;
+	graph.Build(commands, { 2 });
+	CHECK(commands == Commands({ 0, 1, 2 }));
+	CHECK(graph.frame_stats().merged_passes == 3);
+
+	// Same when the later pass samples what the middle one writes.
+	graph.Begin();
+	graph.AddDraw(1, 0, 0, 0, false);
+	graph.AddDraw(2, 1, 0, 0, false);
+	graph.AddDraw(1, 2, 0, 2, false);
+	graph.Build(commands, {});
+	CHECK(commands == Commands({ 0, 1, 2 }));
+}
+
+TEST(DropsOverwrittenClears)
+{
+	RenderPassGraph graph;
+	Commands commands;
+
+	graph.Begin();
+	graph.AddClear(1, 0);
+	graph.AddClear(1, 1);
+	graph.AddDraw(1, 2, 0, 0, false);
+	graph.Build(commands, { 1 });
+	CHECK(commands == Commands({ 1, 2 }));
+	CHECK(graph.frame_stats().clears == 2);
+	CHECK(graph.frame_stats().dropped_clears == 1);
+
+	// A draw covering the whole target makes the clear useless.
+	graph.Begin();
+	graph.AddClear(1, 0);
+	graph.AddDraw(1, 1, 0, 0, true);
+	graph.Build(commands, { 1 });
+	CHECK(commands == Commands({ 1 }));
+
+	// A blended draw needs it.
+	graph.Begin();
+	graph.AddClear(1, 0);
+	graph.AddDraw(1, 1, 0, 0, false);
+	graph.AddDraw(1, 2, 0, 0, true);
+	graph.Build(commands, { 1 });
+	CHECK(commands == Commands({ 0, 1, 2 }));
+}
+
+TEST(KeepsClearsThatWereSampled)
+{
+	RenderPassGraph graph;
+	Commands commands;
+
+	graph.Begin();
+	graph.AddClear(1, 0);
+	graph.AddDraw(2, 1, 1, 0, false);
+	graph.AddClear(1, 2);
+	graph.Build(commands, { 1, 2 });
+	CHECK(commands == Commands({ 0, 1, 2 }));
+	CHECK(graph.frame_stats().dropped_clears == 0);
+}
+
+TEST(ReportsUnsampledTargets)
+{
+	RenderPassGraph graph;
+	Commands commands;
+
+	graph.Begin();
+	graph.AddDraw(1, 0, 0, 0, false);
+	graph.AddDraw(2, 1, 1, 0, false);
+	graph.AddDraw(3, 2, 0, 0, false);
+	graph.Build(commands, { 2 });
+	CHECK(graph.unsampled_targets() == Commands({ 3 }));
+	CHECK(graph.frame_stats().unsampled_targets == 1);
+
+	graph.Begin();
+	graph.AddDraw(1, 0, 0, 0, false);
+	graph.Build(commands, { 1 });
+	CHECK(graph.unsampled_targets().empty());
+
+	CHECK(graph.total_stats().frames == 2);
+	CHECK(graph.total_stats().passes == 4);
+	CHECK(graph.total_stats().unsampled_targets == 1);
+}
+
+TEST(EmptyFrame)
+{
+	RenderPassGraph graph;
+	Commands commands = { 5 };
+	graph.Begin();
+	graph.Build(commands, {});
+	CHECK(commands.empty());
+	CHECK(graph.frame_stats().passes == 0);
+}
@@ -0,0 +1,125 @@
+#include "Test.h"
+
+#include "gpu/RenderScheduler.h"
+
+TEST(RateCap)
+{
+	// A 30 fps view, frames every 1 / 120 s.
+	RenderScheduler scheduler;
+	size_t renders = 0;
+	for (int frame = 0; frame < 120; frame++) {
+		scheduler.Begin(frame / 120.0);
+		scheduler.Add(1, 30, 0);
+		renders += scheduler.Schedule().size();
+		scheduler.EndFrame(1.0);
+	}
+	CHECK(renders == 30);
+	CHECK(scheduler.stats().deferred_rate == 90);
+
+	// Uncapped and never rendered views are always due.
+	CHECK(scheduler.IsDue(2, 30, 0.0));
+	CHECK(scheduler.IsDue(1, 0, 0.0));
+}
+
+TEST(BudgetTakesPriorityThenWaiting)
+{
+	RenderScheduler scheduler;
+	scheduler.set_budget(5);
+
+	// Nothing is known about costs yet, everything goes.
+	scheduler.Begin(0);
+	scheduler.Add(1, 0, 0);
+	scheduler.Add(2, 0, 0);
+	scheduler.Add(3, 0, 0);
+	CHECK(scheduler.Schedule().size() == 3);
+	scheduler.EndFrame(12);
+	CHECK(scheduler.cost(1) == 4);
+
+	// 4 ms each in a 5 ms budget: one per frame, higher priority first.
+	scheduler.Begin(0.01);
+	scheduler.Add(1, 0, 0);
+	scheduler.Add(2, 0, 2);
+	scheduler.Add(3, 0, 0);
+	std::vector<uint32_t> scheduled = scheduler.Schedule();
+	CHECK(scheduled == std::vector<uint32_t>({ 2 }));
+	scheduler.EndFrame(4);
+
+	// Then whoever waited the longest, ties broken by Add order.
+	scheduler.Begin(0.02);
+	scheduler.Add(1, 0, 0);
+	scheduler.Add(3, 0, 0);
+	scheduled = scheduler.Schedule();
+	CHECK(scheduled == std::vector<uint32_t>({ 1 }));
+	scheduler.EndFrame(4);
+
+	scheduler.Begin(0.03);
+	scheduler.Add(1, 0, 0);
+	scheduler.Add(3, 0, 0);
+	scheduled = scheduler.Schedule();
+	CHECK(scheduled == std::vector<uint32_t>({ 3 }));
+	scheduler.EndFrame(4);
+
+	CHECK(scheduler.stats().deferred_budget == 4);
+}
+
+TEST(ScheduledInAddOrder)
+{
+	RenderScheduler scheduler;
+	scheduler.Begin(0);
+	scheduler.Add(5, 0, 0);
+	scheduler.Add(3, 0, 9);
+	scheduler.Add(4, 0, 1);
+	CHECK(scheduler.Schedule() == std::vector<uint32_t>({ 5, 3, 4 }));
+}
+
+TEST(DeferredViewsAreNotStarved)
+{
+	// The focused view is always dirty and fills the budget on its own.
+	RenderScheduler scheduler;
+	scheduler.set_budget(5);
+	scheduler.Begin(0);
+	scheduler.Add(1, 0, 0);
+	scheduler.Add(2, 0, 2);
+	scheduler.Schedule();
+	scheduler.EndFrame(8);
+
+	int rendered_at = -1;
+	for (int frame = 1; frame < 100 && rendered_at < 0; frame++) {
+		scheduler.Begin(frame / 100.0);
+		scheduler.Add(1, 0, 0);
+		scheduler.Add(2, 0, 2);
+		const std::vector<uint32_t>& scheduled = scheduler.Schedule();
+		if (scheduled[0] == 1)
+			rendered_at = frame;
+		scheduler.EndFrame(4);
+	}
+
+	// Held back for kMaxDeferral at most, plus the frame it is taken in.
+	CHECK(rendered_at > 0);
+	CHECK(rendered_at <= (int)(RenderScheduler::kMaxDeferral * 100) + 2);
+}
+
+TEST(CostsAreSmoothed)
+{
+	RenderScheduler scheduler;
+	scheduler.Begin(0);
+	scheduler.Add(1, 0, 0);
+	scheduler.Schedule();
+	scheduler.EndFrame(8);
+	CHECK(scheduler.cost(1) == 8);
+
+	scheduler.Begin(1);
+	scheduler.Add(1, 0, 0);
+	scheduler.Schedule();
+	scheduler.EndFrame(0);
+	CHECK(scheduler.cost(1) == 6);
+
+	scheduler.Remove(1);
+	CHECK(scheduler.cost(1) == 0);
+
+	// Nothing scheduled, nothing learned.
+	scheduler.Begin(2);
+	scheduler.Schedule();
+	scheduler.EndFrame(100);
+	CHECK(scheduler.cost(1) == 0);
+}
@@ -0,0 +1,140 @@
+#include "Test.h"
+
+#include "gpu/ResidencyTracker.h"
+
+static const uint64_t kMB = 1024 * 1024;
+
+static uint64_t RT(uint32_t id)
+{
+	return ResidencyTracker::Key(ResidencyKind::RenderTarget, id);
+}
+
+TEST(KeysDontCollideAcrossKinds)
+{
+	CHECK(ResidencyTracker::Key(ResidencyKind::Texture, 1) != ResidencyTracker::Key(ResidencyKind::RenderTarget, 1));
+}
+
+TEST(TracksBytes)
+{
+	ResidencyTracker tracker;
+	tracker.Add(RT(1), ResidencyKind::RenderTarget, 4 * kMB);
+	tracker.Add(ResidencyTracker::Key(ResidencyKind::Texture, 1), ResidencyKind::Texture, 2 * kMB);
+	tracker.Resize(RT(1), 8 * kMB);
+
+	ResidencyStats stats = tracker.stats();
+	CHECK(stats.resident_bytes == 10 * kMB);
+	CHECK(stats.peak_bytes == 10 * kMB);
+	CHECK(stats.resource_count == 2);
+	CHECK(stats.bytes_by_kind[(size_t)ResidencyKind::RenderTarget] == 8 * kMB);
+	CHECK(stats.bytes_by_kind[(size_t)ResidencyKind::Texture] == 2 * kMB);
+
+	// Adding an existing key replaces it.
+	tracker.Add(RT(1), ResidencyKind::RenderTarget, 1 * kMB);
+	CHECK(tracker.stats().resident_bytes == 3 * kMB);
+
+	tracker.Remove(RT(1));
+	tracker.Remove(RT(1));
+	stats = tracker.stats();
+	CHECK(stats.resident_bytes == 2 * kMB);
+	CHECK(stats.peak_bytes == 10 * kMB);
+	CHECK(stats.resource_count == 1);
+}
+
+TEST(OnlyHiddenIdleTargetsAreEvicted)
+{
+	ResidencyTracker tracker;
+	ResidencyConfig config;
+	config.idle_timeout_ms = 1000;
+	tracker.set_config(config);
+
+	tracker.set_now(0);
+	tracker.Add(RT(1), ResidencyKind::RenderTarget, kMB);
+	tracker.Add(RT(2), ResidencyKind::RenderTarget, kMB);
+	tracker.SetHidden(RT(1), true);
+
+	std::vector<uint64_t> keys;
+	tracker.set_now(999);
+	tracker.CollectEvictions(keys);
+	CHECK(keys.empty());
+
+	tracker.set_now(1000);
+	tracker.CollectEvictions(keys);
+	REQUIRE(keys.size() == 1);
+	CHECK(keys[0] == RT(1));
+
+	// Hiding restarts the idle timeout, touching a hidden target does too.
+	tracker.set_now(1500);
+	tracker.SetHidden(RT(2), true);
+	tracker.Touch(RT(1));
+	tracker.set_now(2000);
+	tracker.CollectEvictions(keys);
+	CHECK(keys.empty());
+
+	tracker.SetHidden(RT(1), false);
+	tracker.set_now(10000);
+	tracker.CollectEvictions(keys);
+	REQUIRE(keys.size() == 1);
+	CHECK(keys[0] == RT(2));
+}
+
+TEST(OverBudgetEvictsLeastRecentlyUsed)
+{
+	ResidencyTracker tracker;
+	ResidencyConfig config;
+	config.budget_bytes = 5 * kMB;
+	config.idle_timeout_ms = 60000;
+	tracker.set_config(config);
+
+	for (uint32_t id = 1; id <= 4; id++) {
+		tracker.set_now(id * 10);
+		tracker.Add(RT(id), ResidencyKind::RenderTarget, 2 * kMB);
+		tracker.SetHidden(RT(id), true);
+	}
+
+	// 8 MB resident, evicting the two oldest gets under 5 MB.
+	std::vector<uint64_t> keys;
+	tracker.set_now(100);
+	tracker.Touch(RT(1));
+	tracker.CollectEvictions(keys);
+	REQUIRE(keys.size() == 2);
+	CHECK(keys[0] == RT(2));
+	CHECK(keys[1] == RT(3));
+
+	// Resources used this frame are never picked, even over budget.
+	tracker.Touch(RT(2));
+	tracker.Touch(RT(3));
+	tracker.Touch(RT(4));
+	tracker.CollectEvictions(keys);
+	CHECK(keys.empty());
+}
+
+TEST(EvictAndRestore)
+{
+	ResidencyTracker tracker;
+	tracker.Add(RT(1), ResidencyKind::RenderTarget, 4 * kMB);
+
+	tracker.MarkEvicted(RT(1));
+	tracker.MarkEvicted(RT(1));
+	CHECK(tracker.is_evicted(RT(1)));
+	ResidencyStats stats = tracker.stats();
+	CHECK(stats.resident_bytes == 0);
+	CHECK(stats.evicted_count == 1);
+	CHECK(stats.evictions == 1);
+	CHECK(stats.evicted_bytes == 4 * kMB);
+
+	// Evicted entries ignore resizes and don't count when removed.
+	tracker.Resize(RT(1), 16 * kMB);
+	CHECK(tracker.stats().resident_bytes == 0);
+
+	tracker.MarkRestored(RT(1), 6 * kMB);
+	CHECK(!tracker.is_evicted(RT(1)));
+	stats = tracker.stats();
+	CHECK(stats.resident_bytes == 6 * kMB);
+	CHECK(stats.restores == 1);
+	CHECK(stats.evicted_count == 0);
+
+	tracker.MarkEvicted(RT(1));
+	tracker.Remove(RT(1));
+	CHECK(tracker.stats().resident_bytes == 0);
+	CHECK(!tracker.is_evicted(RT(1)));
+}
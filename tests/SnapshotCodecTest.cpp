@@ -0,0 +1,107 @@
+#include "Test.h"
+
+#include <string.h>
+#include <random>
+
+#include "gpu/SnapshotCodec.h"
+
+static bool RoundTrips(const std::vector<uint8_t>& pixels, uint32_t width, uint32_t height,
+	uint32_t row_bytes, std::vector<uint8_t>& encoded)
+{
+	encoded.clear();
+	EncodeSnapshot(pixels.data(), width, height, row_bytes, encoded);
+
+	uint32_t decoded_width, decoded_height;
+	std::vector<uint8_t> decoded;
+	if (!DecodeSnapshot(encoded.data(), encoded.size(), decoded_width, decoded_height, decoded)
+		|| decoded_width != width || decoded_height != height || decoded.size() != (size_t)width * height * 4)
+		return false;
+
+	for (uint32_t y = 0; y < height; y++) {
+		if (memcmp(&decoded[(size_t)y * width * 4], &pixels[(size_t)y * row_bytes], width * 4))
+			return false;
+	}
+	return true;
+}
+
+// Random, mostly transparent and low-entropy images, odd sizes and padded rows.
+TEST(RoundTripFuzz)
+{
+	std::mt19937 random(48);
+
+	for (int round = 0; round < 300; round++) {
+		uint32_t width = random() % 40 + 1;
+		uint32_t height = random() % 40 + 1;
+		uint32_t row_bytes = width * 4 + random() % 3 * 4;
+		std::vector<uint8_t> pixels((size_t)row_bytes * height);
+
+		int kind = random() % 3;
+		for (auto& byte : pixels) {
+			if (kind == 0)
+				byte = (uint8_t)random();
+			else if (kind == 1)
+				byte = random() % 4 == 0 ? (uint8_t)random() : 0;
+			else
+				byte = (uint8_t)(random() % 3);
+		}
+
+		std::vector<uint8_t> encoded;
+		CHECK(RoundTrips(pixels, width, height, row_bytes, encoded));
+	}
+}
+
+TEST(LongRunsAndAppend)
+{
+	// A transparent 1000 x 1000 frame is mostly 62 pixel runs.
+	std::vector<uint8_t> pixels(1000 * 1000 * 4, 0);
+	std::vector<uint8_t> encoded;
+	CHECK(RoundTrips(pixels, 1000, 1000, 4000, encoded));
+	CHECK(encoded.size() < 20000);
+
+	// Encoding appends.
+	std::vector<uint8_t> out(3, 0xAB);
+	EncodeSnapshot(pixels.data(), 1000, 1000, 4000, out);
+	CHECK(out.size() == encoded.size() + 3);
+	CHECK(memcmp(out.data() + 3, encoded.data(), encoded.size()) == 0);
+}
+
+TEST(RejectsCorruptSnapshots)
+{
+	std::mt19937 random(480);
+	std::vector<uint8_t> pixels(37 * 23 * 4);
+	for (auto& byte : pixels)
+		byte = random() % 5 == 0 ? (uint8_t)random() : 7;
+
+	std::vector<uint8_t> encoded;
+	REQUIRE(RoundTrips(pixels, 37, 23, 37 * 4, encoded));
+
+	uint32_t width, height;
+	std::vector<uint8_t> decoded;
+
+	// Truncated anywhere.
+	for (size_t size = 0; size < encoded.size(); size++)
+		CHECK(!DecodeSnapshot(encoded.data(), size, width, height, decoded));
+
+	// Bad magic, zero or oversized dimensions, trailing bytes.
+	std::vector<uint8_t> bad = encoded;
+	bad[0] = 'X';
+	CHECK(!DecodeSnapshot(bad.data(), bad.size(), width, height, decoded));
+	bad = encoded;
+	memset(&bad[4], 0, 4);
+	CHECK(!DecodeSnapshot(bad.data(), bad.size(), width, height, decoded));
+	bad = encoded;
+	bad[10] = 1;
+	CHECK(!DecodeSnapshot(bad.data(), bad.size(), width, height, decoded));
+	bad = encoded;
+	bad.push_back(0);
+	CHECK(!DecodeSnapshot(bad.data(), bad.size(), width, height, decoded));
+
+	// Flipped bytes must never read or write out of bounds, whatever the result.
+	for (int round = 0; round < 2000; round++) {
+		bad = encoded;
+		size_t offset = 12 + random() % (bad.size() - 12);
+		bad[offset] ^= (uint8_t)(1 + random() % 255);
+		if (DecodeSnapshot(bad.data(), bad.size(), width, height, decoded))
+			CHECK(width == 37 && height == 23 && decoded.size() == 37 * 23 * 4);
+	}
+}
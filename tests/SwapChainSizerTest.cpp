@@ -0,0 +1,62 @@
+#include "Test.h"
+
+#include "gpu/SwapChainSizer.h"
+
+TEST(ProgrammaticResizeFitsExactly)
+{
+	SwapChainSizer sizer;
+	sizer.set_buffer_size(800, 600);
+	CHECK(sizer.Resize(1024, 768, false));
+	CHECK(sizer.buffer_width() == 1024 && sizer.buffer_height() == 768);
+	CHECK(sizer.Resize(640, 480, false));
+	CHECK(sizer.buffer_width() == 640 && sizer.buffer_height() == 480);
+	CHECK(!sizer.Resize(640, 480, false));
+}
+
+TEST(InteractiveResizeGrowsAhead)
+{
+	SwapChainSizer sizer;
+	sizer.set_buffer_size(800, 600);
+
+	// Shrinking during a drag keeps the buffers.
+	CHECK(!sizer.Resize(700, 500, true));
+	CHECK(sizer.buffer_width() == 800);
+
+	// Growing a little reserves half again.
+	CHECK(sizer.Resize(810, 600, true));
+	CHECK(sizer.buffer_width() == 1200 && sizer.buffer_height() == 600);
+
+	// A drag across many sizes only reallocates a few times.
+	for (uint32_t width = 810; width <= 2000; width += 5)
+		sizer.Resize(width, 600, true);
+	CHECK(sizer.buffer_width() >= 2000);
+	CHECK(sizer.reallocations() <= 3);
+
+	// The drag ended, fit to the client area.
+	CHECK(sizer.Resize(2000, 600, false));
+	CHECK(sizer.buffer_width() == 2000 && sizer.buffer_height() == 600);
+}
+
+TEST(GrowthIsCapped)
+{
+	SwapChainSizer sizer;
+	sizer.set_buffer_size(12000, 100);
+	CHECK(sizer.Resize(12001, 100, true));
+	CHECK(sizer.buffer_width() == SwapChainSizer::kMaxSize);
+
+	// Never below the request.
+	sizer.set_buffer_size(100, 100);
+	CHECK(sizer.Resize(1000, 100, true));
+	CHECK(sizer.buffer_width() == 1000);
+}
+
+TEST(MinimizedKeepsBuffers)
+{
+	SwapChainSizer sizer;
+	sizer.set_buffer_size(800, 600);
+	CHECK(!sizer.Resize(0, 0, false));
+	CHECK(!sizer.Resize(0, 600, true));
+	CHECK(sizer.buffer_width() == 800 && sizer.buffer_height() == 600);
+	CHECK(sizer.requests() == 2);
+	CHECK(sizer.reallocations() == 0);
+}
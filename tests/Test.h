@@ -0,0 +1,56 @@
+#pragma once
+#include <stdio.h>
+#include <vector>
+
+#include <Ultralight/platform/GPUDriver.h>
+
+// Minimal runner for the platform independent parts of the library.
+//
+// TEST registers a case, CHECK reports a failed condition and carries on, REQUIRE also leaves
+// the case. The test binary fails if any check did.
+struct TestCase {
+	const char* name;
+	void (*run)();
+};
+
+std::vector<TestCase>& TestCases();
+
+extern int g_test_failures;
+
+struct TestRegistrar {
+	TestRegistrar(const char* name, void (*run)()) { TestCases().push_back({ name, run }); }
+};
+
+#define TEST(name) \
+	static void name(); \
+	static TestRegistrar name##_registrar(#name, name); \
+	static void name()
+
+#define CHECK(cond) \
+	do { \
+		if (!(cond)) { \
+			fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+			g_test_failures++; \
+		} \
+	} while (0)
+
+#define REQUIRE(cond) \
+	do { \
+		if (!(cond)) { \
+			fprintf(stderr, "%s:%d: REQUIRE(%s) failed\n", __FILE__, __LINE__, #cond); \
+			g_test_failures++; \
+			return; \
+		} \
+	} while (0)
+
+// A command with every field zeroed. GPUDriver's structs are packed, so its bytes and any hash
+// of them are the same on every run.
+inline ultralight::Command MakeCommand(ultralight::CommandType type,
+	uint32_t render_buffer_id = 0, uint32_t geometry_id = 0)
+{
+	ultralight::Command command = {};
+	command.command_type = type;
+	command.gpu_state.render_buffer_id = render_buffer_id;
+	command.geometry_id = geometry_id;
+	return command;
+}
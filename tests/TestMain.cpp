@@ -0,0 +1,21 @@
+#include "Test.h"
+
+int g_test_failures = 0;
+
+std::vector<TestCase>& TestCases()
+{
+	static std::vector<TestCase> cases;
+	return cases;
+}
+
+int main()
+{
+	for (auto& test : TestCases()) {
+		int failures = g_test_failures;
+		test.run();
+		printf("%s %s\n", g_test_failures == failures ? "PASS" : "FAIL", test.name);
+	}
+
+	printf("%d checks failed\n", g_test_failures);
+	return g_test_failures ? 1 : 0;
+}
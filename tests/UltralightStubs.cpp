@@ -0,0 +1,197 @@
+// In-memory stand-ins for the few Ultralight entry points the portable classes call, so tests
+// don't need the Ultralight binaries.
+#include <string.h>
+#include <utility>
+#include <vector>
+
+#include <Ultralight/Bitmap.h>
+#include <Ultralight/String.h>
+#include <Ultralight/Listener.h>
+#include <Ultralight/View.h>
+#include <Ultralight/platform/GPUDriver.h>
+
+namespace ultralight {
+
+RefCounted::~RefCounted() {}
+
+View::~View() {}
+
+RefPtr<View> ViewListener::OnCreateChildView(View*, const String&, const String&, bool, const IntRect&)
+{
+	return nullptr;
+}
+
+RefPtr<View> ViewListener::OnCreateInspectorView(View*, bool, const String&)
+{
+	return nullptr;
+}
+
+RenderTarget::RenderTarget() { memset(this, 0, sizeof(*this)); }
+
+String8::String8() : data_(nullptr), length_(0) {}
+
+String8::String8(const char* c_str) : String8(c_str, c_str ? strlen(c_str) : 0) {}
+
+String8::String8(const char* c_str, size_t len) : data_(new char[len + 1]), length_(len)
+{
+	if (len && c_str)
+		memcpy(data_, c_str, len);
+	data_[len] = 0;
+}
+
+String8::String8(const String8& other) : String8(other.data_, other.length_) {}
+
+String8::String8(String8&& other) : data_(other.data_), length_(other.length_)
+{
+	other.data_ = nullptr;
+	other.length_ = 0;
+}
+
+String8::~String8() { delete[] data_; }
+
+String8& String8::operator=(const String8& other)
+{
+	if (this != &other)
+		*this = String8(other);
+	return *this;
+}
+
+String8& String8::operator=(String8&& other)
+{
+	std::swap(data_, other.data_);
+	std::swap(length_, other.length_);
+	return *this;
+}
+
+String8& String8::operator+=(const String8& other)
+{
+	String8 joined(nullptr, length_ + other.length_);
+	if (length_)
+		memcpy(joined.data_, data_, length_);
+	if (other.length_)
+		memcpy(joined.data_ + length_, other.data_, other.length_);
+	return *this = std::move(joined);
+}
+
+bool String8::operator==(const String8& other) const
+{
+	return length_ == other.length_ && (!length_ || !memcmp(data_, other.data_, length_));
+}
+
+bool String8::operator!=(const String8& other) const { return !(*this == other); }
+
+String::String() {}
+
+String::String(const char* str) : str_(str) {}
+
+String::String(const char* str, size_t len) : str_(str, len) {}
+
+String::String(const String8& str) : str_(str) {}
+
+String::String(const String& other) : str_(other.str_) {}
+
+String::String(String&& other) : str_(std::move(other.str_)) {}
+
+String::~String() {}
+
+String& String::operator=(const String& other)
+{
+	str_ = other.str_;
+	return *this;
+}
+
+String& String::operator=(String&& other)
+{
+	str_ = std::move(other.str_);
+	return *this;
+}
+
+String& String::operator+=(const String& other)
+{
+	str_ += other.str_;
+	return *this;
+}
+
+bool String::operator==(const String& other) const { return str_ == other.str_; }
+
+bool String::operator!=(const String& other) const { return str_ != other.str_; }
+
+GPUDriver::~GPUDriver() {}
+
+Bitmap::Bitmap() {}
+
+Bitmap::~Bitmap() {}
+
+class MemoryBitmap : public Bitmap {
+public:
+	MemoryBitmap() {}
+
+	MemoryBitmap(uint32_t width, uint32_t height, BitmapFormat format, uint32_t row_bytes,
+		const void* pixels, size_t size)
+		: width_(width), height_(height), format_(format), row_bytes_(row_bytes),
+		pixels_((const uint8_t*)pixels, (const uint8_t*)pixels + size)
+	{
+	}
+
+	void AddRef() const override { ref_count_++; }
+
+	void Release() const override
+	{
+		if (--ref_count_ == 0)
+			delete this;
+	}
+
+	int ref_count() const override { return ref_count_; }
+
+	uint32_t width() const override { return width_; }
+	uint32_t height() const override { return height_; }
+	IntRect bounds() const override { return { 0, 0, (int)width_, (int)height_ }; }
+	BitmapFormat format() const override { return format_; }
+	uint32_t bpp() const override { return GetBytesPerPixel(format_); }
+	uint32_t row_bytes() const override { return row_bytes_; }
+	size_t size() const override { return pixels_.size(); }
+	bool owns_pixels() const override { return true; }
+
+	LockedPixels<RefPtr<Bitmap>> LockPixelsSafe() const override
+	{
+		RefPtr<Bitmap> self((Bitmap*)this);
+		return LockedPixels<RefPtr<Bitmap>>(self);
+	}
+
+	void* LockPixels() override { return pixels_.data(); }
+	void UnlockPixels() override {}
+	const void* LockPixels() const override { return pixels_.data(); }
+	void UnlockPixels() const override {}
+	void* raw_pixels() override { return pixels_.data(); }
+	bool IsEmpty() const override { return pixels_.empty(); }
+	void Erase() override { memset(pixels_.data(), 0, pixels_.size()); }
+	void Set(RefPtr<Bitmap>) override {}
+	bool DrawBitmap(IntRect, IntRect, RefPtr<Bitmap>, bool) override { return false; }
+	RefPtr<Buffer> EncodePNG(bool, bool) const override { return nullptr; }
+	bool WritePNG(const char*, bool, bool) const override { return false; }
+	bool Resample(RefPtr<Bitmap>, bool) override { return false; }
+	void SwapRedBlueChannels() override {}
+	void ConvertToStraightAlpha() override {}
+	void ConvertToPremultipliedAlpha() override {}
+
+protected:
+	uint32_t width_ = 0;
+	uint32_t height_ = 0;
+	BitmapFormat format_ = BitmapFormat::BGRA8_UNORM_SRGB;
+	uint32_t row_bytes_ = 0;
+	std::vector<uint8_t> pixels_;
+	mutable int ref_count_ = 1;
+};
+
+RefPtr<Bitmap> Bitmap::Create()
+{
+	return AdoptRef(*(Bitmap*)new MemoryBitmap());
+}
+
+RefPtr<Bitmap> Bitmap::Create(uint32_t width, uint32_t height, BitmapFormat format,
+	uint32_t row_bytes, const void* pixels, size_t size, bool)
+{
+	return AdoptRef(*(Bitmap*)new MemoryBitmap(width, height, format, row_bytes, pixels, size));
+}
+
+}  // namespace ultralight
@@ -0,0 +1,159 @@
+#include "Test.h"
+
+#include <string.h>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+#include "gpu/UploadQueue.h"
+
+TEST(StagingArenaWrapsAround)
+{
+	StagingArena arena(100);
+	uint8_t* base = arena.Allocate(40);
+	REQUIRE(base);
+	CHECK(arena.Allocate(40) == base + 40);
+	CHECK(!arena.Allocate(30));
+	CHECK(arena.used() == 80);
+
+	// Freeing the oldest block makes room at the start.
+	arena.Release();
+	CHECK(arena.Allocate(30) == base);
+	CHECK(!arena.Allocate(11));
+	CHECK(arena.Allocate(10) == base + 30);
+
+	arena.Release();
+	arena.Release();
+	arena.Release();
+	CHECK(arena.used() == 0);
+
+	CHECK(!arena.Allocate(0));
+	CHECK(!arena.Allocate(101));
+	CHECK(arena.Allocate(100) == base);
+}
+
+// Copies what it is given, optionally holding the upload thread until released.
+class RecordingDevice : public UploadDevice {
+public:
+	void Execute(const UploadJob& job) override
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		gate_changed.wait(lock, [&] { return open; });
+		jobs.push_back(job);
+		pixels.push_back(std::vector<uint8_t>(job.pixels, job.pixels + job.size));
+	}
+
+	void SetOpen(bool value)
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			open = value;
+		}
+		gate_changed.notify_all();
+	}
+
+	std::mutex mutex;
+	std::condition_variable gate_changed;
+	bool open = true;
+	std::vector<UploadJob> jobs;
+	std::vector<std::vector<uint8_t>> pixels;
+};
+
+static UploadJob MakeJob(uint32_t id, size_t size)
+{
+	UploadJob job;
+	job.id = id;
+	job.width = (uint32_t)size / 4;
+	job.height = 1;
+	job.row_bytes = (uint32_t)size;
+	job.size = size;
+	return job;
+}
+
+TEST(ExecutesInOrderWithCopiedPixels)
+{
+	RecordingDevice device;
+	UploadQueue queue(&device, 1024);
+
+	uint64_t last = 0;
+	for (uint32_t id = 1; id <= 50; id++) {
+		std::vector<uint8_t> pixels(64, (uint8_t)id);
+		uint64_t fence = queue.Submit(MakeJob(id, pixels.size()), pixels.data());
+		CHECK(fence == last + 1);
+		last = fence;
+		// The caller's buffer may go away right after Submit.
+		memset(pixels.data(), 0xff, pixels.size());
+	}
+
+	queue.Wait(last);
+	CHECK(queue.IsComplete(last));
+	REQUIRE(device.jobs.size() == 50);
+	for (uint32_t i = 0; i < 50; i++) {
+		CHECK(device.jobs[i].id == i + 1);
+		CHECK(device.jobs[i].fence == i + 1);
+		CHECK(device.pixels[i] == std::vector<uint8_t>(64, (uint8_t)(i + 1)));
+	}
+
+	UploadQueueStats stats = queue.stats();
+	CHECK(stats.submitted == 50 && stats.completed == 50);
+	CHECK(stats.staged_bytes == 50 * 64);
+	CHECK(stats.peak_staging_bytes <= 1024);
+	CHECK(stats.oversized == 0);
+}
+
+TEST(StallsWhenStagingIsFull)
+{
+	RecordingDevice device;
+	device.SetOpen(false);
+	UploadQueue queue(&device, 256);
+
+	std::vector<uint8_t> pixels(128, 7);
+	queue.Submit(MakeJob(1, 128), pixels.data());
+	queue.Submit(MakeJob(2, 128), pixels.data());
+	CHECK(!queue.IsComplete(1));
+
+	// The third submission has to wait for the first job, open the gate from another thread.
+	std::thread opener([&] {
+		while (queue.stats().stalls == 0)
+			std::this_thread::yield();
+		device.SetOpen(true);
+	});
+	uint64_t fence = queue.Submit(MakeJob(3, 128), pixels.data());
+	opener.join();
+
+	queue.Wait(fence);
+	CHECK(queue.stats().stalls == 1);
+	CHECK(device.jobs.size() == 3);
+}
+
+TEST(OversizedJobsUseTheirOwnCopy)
+{
+	RecordingDevice device;
+	UploadQueue queue(&device, 64);
+
+	std::vector<uint8_t> pixels(1000);
+	for (size_t i = 0; i < pixels.size(); i++)
+		pixels[i] = (uint8_t)i;
+
+	uint64_t fence = queue.Submit(MakeJob(1, pixels.size()), pixels.data());
+	queue.Submit(MakeJob(2, 0), nullptr);
+	queue.Wait(fence + 1);
+
+	CHECK(queue.stats().oversized == 1);
+	REQUIRE(device.pixels.size() == 2);
+	CHECK(device.pixels[0] == pixels);
+	CHECK(device.pixels[1].empty());
+}
+
+TEST(DestructorDrainsQueue)
+{
+	RecordingDevice device;
+	{
+		UploadQueue queue(&device, 4096);
+		std::vector<uint8_t> pixels(16);
+		for (uint32_t id = 0; id < 20; id++)
+			queue.Submit(MakeJob(id, pixels.size()), pixels.data());
+	}
+	CHECK(device.jobs.size() == 20);
+}
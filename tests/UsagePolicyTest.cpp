@@ -0,0 +1,94 @@
+#include "Test.h"
+
+#include "gpu/UsagePolicy.h"
+
+TEST(ImmutableMovesToDefaultOnFirstUpdate)
+{
+	UsagePolicy policy;
+	policy.Add(1, UsageClass::Immutable);
+	CHECK(policy.usage_class(1) == UsageClass::Immutable);
+
+	policy.NextFrame();
+	CHECK(policy.OnUpdate(1) == UsageClass::Default);
+	CHECK(policy.stats().promotions == 1);
+	CHECK(policy.stats().updates[(size_t)UsageClass::Immutable] == 1);
+
+	// Unknown resources get the default class.
+	CHECK(policy.OnUpdate(99) == UsageClass::Default);
+	CHECK(policy.usage_class(99) == UsageClass::Default);
+}
+
+TEST(FrequentUpdatesGoDynamic)
+{
+	UsagePolicy policy;
+	policy.Add(1, UsageClass::Default);
+
+	// Every other frame: the third update within 8 frames promotes.
+	CHECK(policy.OnUpdate(1) == UsageClass::Default);
+	policy.NextFrame();
+	policy.NextFrame();
+	CHECK(policy.OnUpdate(1) == UsageClass::Default);
+	policy.NextFrame();
+	policy.NextFrame();
+	CHECK(policy.OnUpdate(1) == UsageClass::Dynamic);
+	CHECK(policy.usage_class(1) == UsageClass::Dynamic);
+}
+
+TEST(SparseUpdatesStayDefault)
+{
+	UsagePolicy policy;
+	policy.Add(1, UsageClass::Default);
+
+	for (int update = 0; update < 10; update++) {
+		CHECK(policy.OnUpdate(1) == UsageClass::Default);
+		for (uint32_t frame = 0; frame < UsagePolicy::kHotFrames / 2; frame++)
+			policy.NextFrame();
+	}
+	CHECK(policy.stats().promotions == 0);
+}
+
+TEST(CoolDynamicResourcesAreDemoted)
+{
+	UsagePolicy policy;
+	policy.Add(1, UsageClass::Dynamic);
+	policy.Add(2, UsageClass::Dynamic);
+	policy.Add(3, UsageClass::Default);
+
+	std::vector<uint32_t> ids;
+	for (uint32_t frame = 0; frame < UsagePolicy::kCoolFrames - 1; frame++)
+		policy.NextFrame();
+	policy.OnUpdate(2);
+	policy.NextFrame();
+
+	policy.CollectDemotions(ids);
+	REQUIRE(ids.size() == 1);
+	CHECK(ids[0] == 1);
+	CHECK(policy.usage_class(1) == UsageClass::Default);
+	CHECK(policy.usage_class(2) == UsageClass::Dynamic);
+
+	// Only reported once.
+	policy.CollectDemotions(ids);
+	CHECK(ids.empty());
+
+	UsageClassStats stats = policy.stats();
+	CHECK(stats.demotions == 1);
+	CHECK(stats.resources[(size_t)UsageClass::Default] == 2);
+	CHECK(stats.resources[(size_t)UsageClass::Dynamic] == 1);
+	CHECK(stats.updates[(size_t)UsageClass::Dynamic] == 1);
+
+	policy.Remove(2);
+	CHECK(policy.stats().resources[(size_t)UsageClass::Dynamic] == 0);
+}
+
+TEST(LongGapsResetHistory)
+{
+	UsagePolicy policy;
+	policy.Add(1, UsageClass::Default);
+	policy.OnUpdate(1);
+	policy.NextFrame();
+	policy.OnUpdate(1);
+
+	for (int frame = 0; frame < 40; frame++)
+		policy.NextFrame();
+	CHECK(policy.OnUpdate(1) == UsageClass::Default);
+}
@@ -0,0 +1,120 @@
+#include "Test.h"
+
+#include <math.h>
+#include <random>
+
+#include "gpu/VSyncPacer.h"
+
+// Simulated time, advanced by the test instead of sleeping.
+class FakeClock {
+public:
+	double now() const { return now_; }
+
+	void Advance(double seconds) { now_ += seconds; }
+
+protected:
+	double now_ = 0.0;
+};
+
+TEST(OneTickPerVBlank)
+{
+	FakeClock clock;
+	VSyncPacer pacer;
+	pacer.SetPeriod(1.0 / 60.0);
+
+	// Polling every 2 ms until just before 1 s sees each vblank exactly once.
+	uint32_t missed, ticks = 0, total_missed = 0;
+	for (int poll = 0; poll < 499; poll++) {
+		clock.Advance(0.002);
+		if (pacer.Tick(clock.now(), missed))
+			ticks++;
+		total_missed += missed;
+	}
+	CHECK(ticks == 60);
+	CHECK(total_missed == 0);
+	CHECK(pacer.stats().ticks == 60);
+}
+
+TEST(SlowPollingCountsMissed)
+{
+	VSyncPacer pacer;
+	pacer.SetPeriod(0.01);
+	uint32_t missed;
+	CHECK(pacer.Tick(0.0005, missed) && missed == 0);
+	CHECK(pacer.Tick(0.0305, missed) && missed == 2);
+	CHECK(!pacer.Tick(0.0306, missed) && missed == 0);
+	CHECK(pacer.stats().missed == 2);
+
+	// Periods <= 0 are ignored.
+	pacer.SetPeriod(0.0);
+	pacer.Sync(1.0, -1.0);
+	CHECK(pacer.period() == 0.01);
+}
+
+TEST(ResyncDoesntTickTwice)
+{
+	VSyncPacer pacer;
+	pacer.SetPeriod(0.01);
+	uint32_t missed;
+	pacer.Tick(0.031, missed);
+
+	// The vblank just ticked was really at 0.032, don't tick it again on the new grid.
+	pacer.Sync(0.032, 0.01);
+	CHECK(!pacer.Tick(0.033, missed));
+	CHECK(pacer.Tick(0.0421, missed) && missed == 0);
+	CHECK(fabs(pacer.TimeUntilNext(0.0421) - 0.0099) < 1e-9);
+	CHECK(pacer.stats().resyncs == 1);
+
+	// Measurements on the predicted grid aren't resyncs.
+	VSyncPacer aligned;
+	aligned.Sync(1.0, 0.01);
+	aligned.Sync(1.1, 0.01);
+	aligned.Sync(1.2002, 0.01);
+	CHECK(aligned.stats().resyncs == 1);
+}
+
+// Drives the pacer like Application::Run on a fake clock: wait min(2 ms, time to the next
+// vblank) rounded up to whole milliseconds, tick, and resync from a display whose real rate
+// differs from the nominal one, with some measurement jitter.
+TEST(DisplayLinkLoop)
+{
+	const double real_period = 1.0 / 59.94;
+	const double real_phase = 0.0037;
+	std::mt19937 random(46);
+	std::uniform_real_distribution<double> jitter(-0.0002, 0.0002);
+
+	FakeClock clock;
+	VSyncPacer pacer;
+	pacer.SetPeriod(1.0 / 60.0);
+
+	uint32_t ticks = 0, polls = 0, missed, total_missed = 0;
+	double worst_latency = 0.0;
+
+	while (clock.now() < 10.0) {
+		double wait_ms = ceil(fmin(0.002, pacer.TimeUntilNext(clock.now())) * 1000.0);
+		clock.Advance(wait_ms > 0.0 ? wait_ms / 1000.0 : 0.0);
+		polls++;
+
+		if (!pacer.Tick(clock.now(), missed))
+			continue;
+
+		ticks++;
+		total_missed += missed;
+
+		// Distance to the nearest real vblank once the pacer has locked on, jitter may make it
+		// tick a little early.
+		double vblank = real_phase + floor((clock.now() - real_phase) / real_period + 0.5) * real_period;
+		if (clock.now() > 1.0)
+			worst_latency = fmax(worst_latency, fabs(clock.now() - vblank));
+
+		pacer.Sync(vblank + jitter(random), real_period);
+	}
+
+	// About 599 vblanks in 10 s, none skipped, each one seen within the rounding of the wait.
+	CHECK(ticks >= 598 && ticks <= 601);
+	CHECK(total_missed == 0);
+	CHECK(worst_latency <= 0.0015);
+
+	// Waits never round down to 0: one poll per 2 ms interval plus one per vblank, no spinning.
+	CHECK(polls <= 10.0 / 0.002 + ticks);
+}
@@ -0,0 +1,284 @@
+#include "Test.h"
+
+#include <chrono>
+#include <thread>
+
+#include "ViewPool.h"
+
+// Remembers what the pool did to it, everything else is a no-op.
+class MockView : public View {
+public:
+	MockView(uint32_t width, uint32_t height, const ViewConfig& config) :
+		width_(width), height_(height), config_(config), display_id_(config.display_id) {}
+
+	void AddRef() const override { ref_count_++; }
+
+	void Release() const override
+	{
+		if (--ref_count_ == 0)
+			delete this;
+	}
+
+	int ref_count() const override { return ref_count_; }
+
+	String url() override { return url_; }
+	String title() override { return String(); }
+	uint32_t width() const override { return width_; }
+	uint32_t height() const override { return height_; }
+	uint32_t display_id() const override { return display_id_; }
+	void set_display_id(uint32_t id) override { display_id_ = id; }
+	double device_scale() const override { return device_scale_; }
+	void set_device_scale(double scale) override { device_scale_ = scale; }
+	bool is_accelerated() const override { return config_.is_accelerated; }
+	bool is_transparent() const override { return config_.is_transparent; }
+	bool is_loading() override { return false; }
+	RenderTarget render_target() override { return RenderTarget(); }
+	Surface* surface() override { return nullptr; }
+	void LoadHTML(const String&, const String&, bool) override {}
+	void LoadURL(const String& url) override
+	{
+		url_ = url;
+		loads++;
+	}
+
+	void Resize(uint32_t width, uint32_t height) override
+	{
+		// Resizing a real view relayouts the page, give hits a measurable cost.
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		width_ = width;
+		height_ = height;
+	}
+
+	RefPtr<JSContext> LockJSContext() override { return nullptr; }
+	void* JavaScriptVM() override { return nullptr; }
+	String EvaluateScript(const String&, String*) override { return String(); }
+	bool CanGoBack() override { return false; }
+	bool CanGoForward() override { return false; }
+	void GoBack() override {}
+	void GoForward() override {}
+	void GoToHistoryOffset(int) override {}
+	void Reload() override {}
+	void Stop() override { stops++; }
+	void Focus() override { focused_ = true; }
+	void Unfocus() override { focused_ = false; }
+	bool HasFocus() override { return focused_; }
+	bool HasInputFocus() override { return focused_; }
+	void FireKeyEvent(const KeyEvent&) override {}
+	void FireMouseEvent(const MouseEvent&) override {}
+	void FireScrollEvent(const ScrollEvent&) override {}
+	void set_view_listener(ViewListener* listener) override { view_listener_ = listener; }
+	ViewListener* view_listener() const override { return view_listener_; }
+	void set_load_listener(LoadListener* listener) override { load_listener_ = listener; }
+	LoadListener* load_listener() const override { return load_listener_; }
+	void set_download_listener(DownloadListener* listener) override { download_listener_ = listener; }
+	DownloadListener* download_listener() const override { return download_listener_; }
+	void CancelDownload(DownloadId) override {}
+	void set_network_listener(NetworkListener* listener) override { network_listener_ = listener; }
+	NetworkListener* network_listener() const override { return network_listener_; }
+	void set_needs_paint(bool needs_paint) override { needs_paint_ = needs_paint; }
+	bool needs_paint() const override { return needs_paint_; }
+	void CreateLocalInspectorView() override {}
+
+	int loads = 0;
+	int stops = 0;
+
+protected:
+	uint32_t width_;
+	uint32_t height_;
+	ViewConfig config_;
+	uint32_t display_id_;
+	double device_scale_ = 1.0;
+	bool focused_ = false;
+	bool needs_paint_ = false;
+	String url_;
+	ViewListener* view_listener_ = nullptr;
+	LoadListener* load_listener_ = nullptr;
+	DownloadListener* download_listener_ = nullptr;
+	NetworkListener* network_listener_ = nullptr;
+	mutable int ref_count_ = 1;
+};
+
+// Stands in for Renderer::CreateView, counts the views it made.
+struct MockRenderer {
+	ViewPool::Factory factory()
+	{
+		return [this](uint32_t width, uint32_t height, const ViewConfig& config) {
+			// Creating a real view sets up a JS context and loads a page, misses are the slow path.
+			std::this_thread::sleep_for(std::chrono::milliseconds(5));
+			created++;
+			ViewConfig with_display = config;
+			with_display.display_id = 3;
+			return AdoptRef(*(View*)new MockView(width, height, with_display));
+		};
+	}
+
+	int created = 0;
+};
+
+static MockView* Mock(const RefPtr<View>& view)
+{
+	return static_cast<MockView*>(view.get());
+}
+
+static ViewConfig PoolConfig()
+{
+	ViewConfig config;
+	config.is_accelerated = true;
+	config.is_transparent = true;
+	return config;
+}
+
+TEST(RefillCreatesOneViewPerFrame)
+{
+	MockRenderer renderer;
+	ViewPool pool(renderer.factory(), PoolConfig(), 3, 400, 300, "file:///template.html");
+	CHECK(pool.available() == 0);
+	CHECK(renderer.created == 0);
+
+	for (int frame = 1; frame <= 5; frame++) {
+		pool.Refill();
+		CHECK(pool.available() == (size_t)(frame < 3 ? frame : 3));
+	}
+	CHECK(renderer.created == 3);
+	CHECK(pool.stats().created == 3);
+}
+
+TEST(ClaimHitAndMiss)
+{
+	MockRenderer renderer;
+	ViewPool pool(renderer.factory(), PoolConfig(), 2, 400, 300, "file:///template.html");
+	pool.Refill();
+
+	bool pooled = false;
+	RefPtr<View> hit = pool.Claim(200, 100, PoolConfig(), pooled);
+	CHECK(pooled);
+	CHECK(hit->width() == 200 && hit->height() == 100);
+	CHECK(Mock(hit)->url() == String("file:///template.html"));
+	CHECK(renderer.created == 1);
+
+	// Empty pool: made on demand, but compatible so it can come back.
+	RefPtr<View> miss = pool.Claim(200, 100, PoolConfig(), pooled);
+	CHECK(pooled);
+	CHECK(renderer.created == 2);
+
+	const ViewPoolStats& stats = pool.stats();
+	CHECK(stats.claims == 2 && stats.hits == 1 && stats.misses == 1);
+	CHECK(stats.hit_claim_ms >= 1.0);
+	CHECK(stats.miss_claim_ms >= 5.0);
+	CHECK(pool.Report().find("1 of 2 claims") != std::string::npos);
+}
+
+TEST(IncompatibleConfigIsNeverPooled)
+{
+	MockRenderer renderer;
+	ViewPool pool(renderer.factory(), PoolConfig(), 2, 400, 300, "");
+	pool.Refill();
+
+	ViewConfig opaque = PoolConfig();
+	opaque.is_transparent = false;
+	CHECK(!pool.IsCompatible(opaque));
+
+	bool pooled = true;
+	RefPtr<View> view = pool.Claim(400, 300, opaque, pooled);
+	CHECK(!pooled);
+	CHECK(!view->is_transparent());
+	CHECK(pool.available() == 1);
+	CHECK(pool.stats().misses == 1);
+
+	// Giving it back anyway doesn't put it in the pool.
+	pool.Recycle(view);
+	CHECK(pool.available() == 1);
+
+	// A pool with no capacity serves nothing.
+	ViewPool empty(renderer.factory(), PoolConfig(), 0, 400, 300, "");
+	CHECK(!empty.IsCompatible(PoolConfig()));
+}
+
+TEST(RecycleResetsAndReturnsView)
+{
+	MockRenderer renderer;
+	ViewPool pool(renderer.factory(), PoolConfig(), 1, 400, 300, "file:///template.html");
+	pool.Refill();
+
+	bool pooled = false;
+	RefPtr<View> view = pool.Claim(200, 100, PoolConfig(), pooled);
+	view->LoadURL("https://example.com/widget.html");
+	view->set_display_id(0xFFFFFFFF);
+	view->set_device_scale(2.0);
+	view->Focus();
+	int loads = Mock(view)->loads;
+
+	pool.Recycle(view);
+	CHECK(pool.available() == 1);
+	CHECK(pool.stats().recycled == 1);
+	CHECK(Mock(view)->stops == 1);
+	CHECK(!view->HasFocus());
+	CHECK(view->device_scale() == 1.0);
+	CHECK(view->display_id() == 3);
+	CHECK(Mock(view)->loads == loads + 1);
+	CHECK(view->url() == String("file:///template.html"));
+
+	// The same view is served again.
+	RefPtr<View> again = pool.Claim(200, 100, PoolConfig(), pooled);
+	CHECK(again.get() == view.get());
+	CHECK(renderer.created == 1);
+}
+
+TEST(RecycleClearsListeners)
+{
+	struct Listener : public ViewListener, public LoadListener {};
+	Listener listener;
+
+	MockRenderer renderer;
+	ViewPool pool(renderer.factory(), PoolConfig(), 1, 400, 300, "");
+	pool.Refill();
+
+	bool pooled = false;
+	RefPtr<View> first = pool.Claim(400, 300, PoolConfig(), pooled);
+	RefPtr<View> second = pool.Claim(400, 300, PoolConfig(), pooled);
+	for (auto& view : { first, second }) {
+		view->set_view_listener(&listener);
+		view->set_load_listener(&listener);
+	}
+
+	// Kept, and dropped because the pool is full: neither may call the old owner back.
+	pool.Recycle(first);
+	pool.Recycle(second);
+	CHECK(pool.stats().recycled == 1 && pool.stats().dropped == 1);
+	for (auto& view : { first, second }) {
+		CHECK(view->view_listener() == nullptr);
+		CHECK(view->load_listener() == nullptr);
+		CHECK(view->download_listener() == nullptr);
+		CHECK(view->network_listener() == nullptr);
+	}
+}
+
+TEST(CallerViewsAreNeverPooled)
+{
+	struct Listener : public ViewListener {};
+	Listener listener;
+
+	MockRenderer renderer;
+	ViewPool pool(renderer.factory(), PoolConfig(), 2, 400, 300, "file:///template.html");
+
+	// Like an overlay made from a view the app created itself.
+	RefPtr<View> own = AdoptRef(*(View*)new MockView(400, 300, PoolConfig()));
+	own->LoadURL("https://example.com/app.html");
+	own->set_view_listener(&listener);
+
+	pool.Recycle(own);
+	CHECK(pool.available() == 0);
+	CHECK(pool.stats().ignored == 1);
+	CHECK(pool.stats().recycled == 0);
+	CHECK(own->view_listener() == &listener);
+	CHECK(own->url() == String("https://example.com/app.html"));
+
+	// Recycling a pooled view twice only pools it once.
+	pool.Refill();
+	bool pooled = false;
+	RefPtr<View> view = pool.Claim(400, 300, PoolConfig(), pooled);
+	pool.Recycle(view);
+	pool.Recycle(view);
+	CHECK(pool.available() == 1);
+	CHECK(pool.stats().ignored == 2);
+}